@@ -24,7 +24,6 @@ Tutorial demonstrating colored cube rendering with Methane graphics API
 #include <Methane/Kit.h>
 #include <Methane/Graphics/App.hpp>
 #include <Methane/Graphics/CubeMesh.hpp>
-#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Tutorials/AppSettings.h>
 #include <Methane/Data/TimeAnimation.h>
 
@@ -178,12 +177,9 @@ public:
         m_render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
 
         // Create index buffer for cube mesh
-        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(m_cube_mesh.GetIndexDataSize(), GetIndexFormat(m_cube_mesh.GetIndex(0))));
+        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(m_cube_mesh.GetIndexDataSize(), m_cube_mesh.GetIndexFormat()));
         m_index_buffer.SetName("Cube Index Buffer");
-        m_index_buffer.SetData(m_render_cmd_queue, {
-            reinterpret_cast<Data::ConstRawPtr>(m_cube_mesh.GetIndices().data()), // NOSONAR
-            m_cube_mesh.GetIndexDataSize()
-        });
+        m_index_buffer.SetData(m_render_cmd_queue, Rhi::SubResource(m_cube_mesh.GetIndexData()));
 
 #ifdef UNIFORMS_BUFFER_ENABLED
         // Create constant vertex buffer
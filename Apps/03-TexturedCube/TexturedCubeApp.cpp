@@ -25,7 +25,6 @@ Tutorial demonstrating textured cube rendering with Methane graphics API
 
 #include <Methane/Tutorials/AppSettings.h>
 #include <Methane/Graphics/CubeMesh.hpp>
-#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Data/TimeAnimation.h>
 
 namespace Methane::Tutorials
@@ -86,13 +85,10 @@ void TexturedCubeApp::Init()
 
     // Create index buffer for cube mesh
     const Data::Size index_data_size = cube_mesh.GetIndexDataSize();
-    const gfx::PixelFormat index_format = gfx::GetIndexFormat(cube_mesh.GetIndex(0));
+    const gfx::PixelFormat index_format = cube_mesh.GetIndexFormat();
     m_index_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForIndexBuffer(index_data_size, index_format));
     m_index_buffer.SetName("Cube Index Buffer");
-    m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(cube_mesh.GetIndices().data()), // NOSONAR
-        index_data_size
-    });
+    m_index_buffer.SetData(render_cmd_queue, rhi::SubResource(cube_mesh.GetIndexData()));
 
     // Create constants buffer for frame rendering
     const auto constants_data_size = static_cast<Data::Size>(sizeof(m_shader_constants));
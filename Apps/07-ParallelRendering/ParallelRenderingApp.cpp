@@ -35,6 +35,7 @@ Tutorial demonstrating parallel rendering with Methane graphics API
 #include <cmath>
 #include <random>
 #include <algorithm>
+#include <numeric>
 
 namespace Methane::Tutorials
 {
@@ -56,10 +57,12 @@ struct CubeVertex
 
 static const gfx::Dimensions g_texture_size{ 320U, 320U };
 static const float           g_scene_scale  = 22.F;
+static const float           g_cube_bounding_radius = std::sqrt(3.F) / 2.F; // half diagonal of the cube mesh with unit size
 
 namespace pin = Methane::Platform::Input;
 static const std::map<pin::Keyboard::State, ParallelRenderingAppAction> g_parallel_rendering_action_by_keyboard_state{
     { { pin::Keyboard::Key::P            }, ParallelRenderingAppAction::SwitchParallelRendering },
+    { { pin::Keyboard::Key::I            }, ParallelRenderingAppAction::SwitchInstancedRendering },
     { { pin::Keyboard::Key::Equal        }, ParallelRenderingAppAction::IncreaseCubesGridSize },
     { { pin::Keyboard::Key::Minus        }, ParallelRenderingAppAction::DecreaseCubesGridSize },
     { { pin::Keyboard::Key::RightBracket }, ParallelRenderingAppAction::IncreaseRenderThreadsCount },
@@ -69,8 +72,8 @@ static const std::map<pin::Keyboard::State, ParallelRenderingAppAction> g_parall
 bool ParallelRenderingApp::Settings::operator==(const Settings& other) const noexcept
 {
     META_FUNCTION_TASK();
-    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled) ==
-           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled);
+    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled, frustum_culling_enabled, instanced_rendering_enabled) ==
+           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled, other.frustum_culling_enabled, other.instanced_rendering_enabled);
 }
 
 uint32_t ParallelRenderingApp::Settings::GetTotalCubesCount() const noexcept
@@ -100,9 +103,11 @@ ParallelRenderingApp::ParallelRenderingApp()
 
     const std::string options_group = "Parallel Rendering Options";
     add_option_group(options_group);
-    add_option("-p,--parallel-render", m_settings.parallel_rendering_enabled, "enable parallel rendering")->group(options_group);
-    add_option("-g,--cubes-grid-size", m_settings.cubes_grid_size,            "cubes grid size")->group(options_group);
-    add_option("-t,--threads-count",   m_settings.render_thread_count,        "render threads count")->group(options_group);
+    add_option("-p,--parallel-render",  m_settings.parallel_rendering_enabled,  "enable parallel rendering")->group(options_group);
+    add_option("-g,--cubes-grid-size",  m_settings.cubes_grid_size,             "cubes grid size")->group(options_group);
+    add_option("-t,--threads-count",    m_settings.render_thread_count,         "render threads count")->group(options_group);
+    add_option("-c,--frustum-culling",  m_settings.frustum_culling_enabled,     "enable cubes culling by camera frustum")->group(options_group);
+    add_option("-n,--instanced-render", m_settings.instanced_rendering_enabled, "enable instanced rendering with per-instance data buffer")->group(options_group);
 
     // Setup animations
     GetAnimations().emplace_back(std::make_shared<Data::TimeAnimation>(std::bind(&ParallelRenderingApp::Animate, this, std::placeholders::_1, std::placeholders::_2)));
@@ -128,7 +133,37 @@ void ParallelRenderingApp::Init()
     // Create cube mesh
     gfx::CubeMesh<CubeVertex> cube_mesh(CubeVertex::layout);
 
+    // Cube parameters are passed to shaders either with uniforms bound to each cube draw call,
+    // or with per-instance vertex attributes read from instance buffer in instanced rendering mode
+    rhi::ProgramInputBufferLayouts program_input_buffer_layouts
+    {
+        rhi::Program::InputBufferLayout
+        {
+            rhi::Program::InputBufferLayout::ArgumentSemantics { cube_mesh.GetVertexLayout().GetSemantics() }
+        }
+    };
+    rhi::ProgramArgumentAccessors program_argument_accessors
+    {
+        { { rhi::ShaderType::Pixel, "g_texture_array" }, rhi::ProgramArgumentAccessor::Type::Constant },
+        { { rhi::ShaderType::Pixel, "g_sampler"       }, rhi::ProgramArgumentAccessor::Type::Constant },
+    };
+    if (m_settings.instanced_rendering_enabled)
+    {
+        program_input_buffer_layouts.push_back(
+            rhi::Program::InputBufferLayout
+            {
+                rhi::Program::InputBufferLayout::ArgumentSemantics { "MVP_ROW_X", "MVP_ROW_Y", "MVP_ROW_Z", "MVP_ROW_W", "TEXTURE_INDEX" },
+                rhi::Program::InputBufferLayout::StepType::PerInstance
+            });
+    }
+    else
+    {
+        program_argument_accessors.emplace(rhi::ShaderType::All, "g_uniforms", rhi::ProgramArgumentAccessor::Type::Mutable, true);
+    }
+
     // Create render state with program
+    const std::string vertex_shader_name = m_settings.instanced_rendering_enabled ? "CubeInstancedVS" : "CubeVS";
+    const std::string pixel_shader_name  = m_settings.instanced_rendering_enabled ? "CubeInstancedPS" : "CubePS";
     rhi::RenderState::Settings render_state_settings
     {
         GetRenderContext().CreateProgram(
@@ -136,22 +171,11 @@ void ParallelRenderingApp::Init()
             {
                 rhi::Program::ShaderSet
                 {
-                    { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "ParallelRendering", "CubeVS" } } },
-                    { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "ParallelRendering", "CubePS" } } },
-                },
-                rhi::ProgramInputBufferLayouts
-                {
-                    rhi::Program::InputBufferLayout
-                    {
-                        rhi::Program::InputBufferLayout::ArgumentSemantics { cube_mesh.GetVertexLayout().GetSemantics() }
-                    }
-                },
-                rhi::ProgramArgumentAccessors
-                {
-                    { { rhi::ShaderType::All,   "g_uniforms"      }, rhi::ProgramArgumentAccessor::Type::Mutable, true },
-                    { { rhi::ShaderType::Pixel, "g_texture_array" }, rhi::ProgramArgumentAccessor::Type::Constant },
-                    { { rhi::ShaderType::Pixel, "g_sampler"       }, rhi::ProgramArgumentAccessor::Type::Constant },
+                    { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "ParallelRendering", vertex_shader_name } } },
+                    { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "ParallelRendering", pixel_shader_name  } } },
                 },
+                program_input_buffer_layouts,
+                program_argument_accessors,
                 GetScreenRenderPattern().GetAttachmentFormats()
             }
         ),
@@ -163,12 +187,20 @@ void ParallelRenderingApp::Init()
 
     // Create cube mesh buffer resources
     const uint32_t cubes_count = m_settings.GetTotalCubesCount();
-    const gfx::Mesh::Subsets mesh_subsets(cubes_count,
-                                          gfx::Mesh::Subset(gfx::Mesh::Type::Box,
-                                                            gfx::Mesh::Subset::Slice(0U, cube_mesh.GetVertexCount()),
-                                                            gfx::Mesh::Subset::Slice(0U, cube_mesh.GetIndexCount()),
-                                                            false));
-    m_cube_array_buffers_ptr = std::make_unique<MeshBuffers>(render_cmd_queue, std::move(cube_mesh), "Cube", mesh_subsets);
+    if (m_settings.instanced_rendering_enabled)
+    {
+        // All cube instances are drawn with the same mesh subset, so that visible cubes are drawn with a single instanced draw call
+        m_cube_instance_buffers_ptr = std::make_unique<InstancedMeshBuffers>(render_cmd_queue, cube_mesh, "Cube", cubes_count);
+    }
+    else
+    {
+        const gfx::Mesh::Subsets mesh_subsets(cubes_count,
+                                              gfx::Mesh::Subset(gfx::Mesh::Type::Box,
+                                                                gfx::Mesh::Subset::Slice(0U, cube_mesh.GetVertexCount()),
+                                                                gfx::Mesh::Subset::Slice(0U, cube_mesh.GetIndexCount()),
+                                                                false));
+        m_cube_array_buffers_ptr = std::make_unique<MeshBuffers>(render_cmd_queue, std::move(cube_mesh), "Cube", mesh_subsets);
+    }
 
     // Create cube-map render target texture
     m_texture_array = GetRenderContext().CreateTexture(
@@ -186,37 +218,55 @@ void ParallelRenderingApp::Init()
     );
 
     // Create frame buffer resources
-    const Data::Size uniforms_data_size = m_cube_array_buffers_ptr->GetUniformsBufferSize();
-    const Data::Size uniform_data_size = MeshBuffers::GetUniformSize();
     tf::Taskflow program_bindings_task_flow;
     for(ParallelRenderingFrame& frame : GetFrames())
     {
-        // Create buffer for uniforms array related to all cube instances
-        frame.cubes_array.uniforms_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size, true, true));
-        frame.cubes_array.uniforms_buffer.SetName(fmt::format("Uniforms Buffer {}", frame.index));
-
-        // Configure program resource bindings
-        frame.cubes_array.program_bindings_per_instance.resize(cubes_count);
-        frame.cubes_array.program_bindings_per_instance[0] = render_state_settings.program.CreateBindings({
-            { { rhi::ShaderType::All,   "g_uniforms"      }, { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(0U), uniform_data_size } } },
-            { { rhi::ShaderType::Pixel, "g_texture_array" }, { { m_texture_array.GetInterface()   } } },
-            { { rhi::ShaderType::Pixel, "g_sampler"       }, { { m_texture_sampler.GetInterface() } } },
-        }, frame.index);
-        frame.cubes_array.program_bindings_per_instance[0].SetName(fmt::format("Cube 0 Bindings {}", frame.index));
-
-        program_bindings_task_flow.for_each_index(1U, cubes_count, 1U,
-            [this, &frame, uniform_data_size](const uint32_t cube_index)
-            {
-                META_UNUSED(uniform_data_size); // workaround for Clang error unused-lambda-capture uniform_data_size (false positive)
-                rhi::ProgramBindings& cube_program_bindings = frame.cubes_array.program_bindings_per_instance[cube_index];
-                cube_program_bindings = rhi::ProgramBindings(frame.cubes_array.program_bindings_per_instance[0], {
-                    {
-                        { rhi::ShaderType::All, "g_uniforms" },
-                        { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size } }
-                    }
-                }, frame.index);
-                cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
-            });
+        if (m_settings.instanced_rendering_enabled)
+        {
+            // Create volatile buffer for per-instance data of all cubes, which is bound after cube mesh vertex buffer
+            frame.cubes_instances.instance_buffer = GetRenderContext().CreateBuffer(
+                rhi::BufferSettings::ForVertexBuffer(m_cube_instance_buffers_ptr->GetInstanceBufferSize(), InstancedMeshBuffers::GetInstanceSize(), true));
+            frame.cubes_instances.instance_buffer.SetName(fmt::format("Instance Buffer {}", frame.index));
+            frame.cubes_instances.vertex_buffer_set = m_cube_instance_buffers_ptr->CreateInstanceVertexBufferSet(frame.cubes_instances.instance_buffer);
+
+            // Configure program resource bindings shared by all cube instances
+            frame.cubes_instances.program_bindings = render_state_settings.program.CreateBindings({
+                { { rhi::ShaderType::Pixel, "g_texture_array" }, { { m_texture_array.GetInterface()   } } },
+                { { rhi::ShaderType::Pixel, "g_sampler"       }, { { m_texture_sampler.GetInterface() } } },
+            }, frame.index);
+            frame.cubes_instances.program_bindings.SetName(fmt::format("Cube Instances Bindings {}", frame.index));
+        }
+        else
+        {
+            // Create buffer for uniforms array related to all cube instances
+            const Data::Size uniforms_data_size = m_cube_array_buffers_ptr->GetUniformsBufferSize();
+            const Data::Size uniform_data_size = MeshBuffers::GetUniformSize();
+            frame.cubes_array.uniforms_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForConstantBuffer(uniforms_data_size, true, true));
+            frame.cubes_array.uniforms_buffer.SetName(fmt::format("Uniforms Buffer {}", frame.index));
+
+            // Configure program resource bindings
+            frame.cubes_array.program_bindings_per_instance.resize(cubes_count);
+            frame.cubes_array.program_bindings_per_instance[0] = render_state_settings.program.CreateBindings({
+                { { rhi::ShaderType::All,   "g_uniforms"      }, { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(0U), uniform_data_size } } },
+                { { rhi::ShaderType::Pixel, "g_texture_array" }, { { m_texture_array.GetInterface()   } } },
+                { { rhi::ShaderType::Pixel, "g_sampler"       }, { { m_texture_sampler.GetInterface() } } },
+            }, frame.index);
+            frame.cubes_array.program_bindings_per_instance[0].SetName(fmt::format("Cube 0 Bindings {}", frame.index));
+
+            program_bindings_task_flow.for_each_index(1U, cubes_count, 1U,
+                [this, &frame, uniform_data_size](const uint32_t cube_index)
+                {
+                    META_UNUSED(uniform_data_size); // workaround for Clang error unused-lambda-capture uniform_data_size (false positive)
+                    rhi::ProgramBindings& cube_program_bindings = frame.cubes_array.program_bindings_per_instance[cube_index];
+                    cube_program_bindings = rhi::ProgramBindings(frame.cubes_array.program_bindings_per_instance[0], {
+                        {
+                            { rhi::ShaderType::All, "g_uniforms" },
+                            { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size } }
+                        }
+                    }, frame.index);
+                    cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
+                });
+        }
 
         if (m_settings.parallel_rendering_enabled)
         {
@@ -255,9 +305,15 @@ void ParallelRenderingApp::Init()
 
     // Initialize cube parameters
     m_cube_array_parameters = InitializeCubeArrayParameters();
+    m_cube_bounding_spheres.Resize(cubes_count);
+    m_visible_cube_indices.resize(cubes_count);
+    std::iota(m_visible_cube_indices.begin(), m_visible_cube_indices.end(), 0U);
 
     // Update initial resource states before asteroids drawing without applying barriers on GPU to let automatic state propagation from Common state work
-    m_cube_array_buffers_ptr->CreateBeginningResourceBarriers().ApplyTransitions();
+    const gfx::MeshBuffersBase& cube_mesh_buffers = m_cube_instance_buffers_ptr
+                                                  ? static_cast<const gfx::MeshBuffersBase&>(*m_cube_instance_buffers_ptr)
+                                                  : static_cast<const gfx::MeshBuffersBase&>(*m_cube_array_buffers_ptr);
+    cube_mesh_buffers.CreateBeginningResourceBarriers().ApplyTransitions();
 
     GetRenderContext().WaitForGpu(rhi::IContext::WaitFor::RenderComplete);
 }
@@ -297,6 +353,7 @@ ParallelRenderingApp::CubeArrayParameters ParallelRenderingApp::InitializeCubeAr
 
             CubeParameters& cube_params = cube_array_parameters[cube_index];
             cube_params.model_matrix = hlslpp::mul(scale_matrix, translation_matrix);
+            cube_params.bounding_radius = cs * g_cube_bounding_radius;
             cube_params.rotation_speed_y = rotation_speed_distribution(rng);
             cube_params.rotation_speed_z = rotation_speed_distribution(rng);
 
@@ -364,19 +421,47 @@ bool ParallelRenderingApp::Update()
     if (!UserInterfaceApp::Update())
         return false;
 
-    // Update MVP-matrices for all cube instances so that they are positioned in a cube grid
+    // Update MVP-matrices and bounding spheres for all cube instances so that they are positioned in a cube grid
+    const hlslpp::float4x4& view_proj_matrix = m_camera.GetViewProjMatrix();
     tf::Taskflow task_flow;
     task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
-        [this](const uint32_t cube_index)
+        [this, &view_proj_matrix](const uint32_t cube_index)
         {
             const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
-            hlslpp::Uniforms uniforms{};
-            uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
-            uniforms.texture_index = cube_params.thread_index;
-            m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+            const hlslpp::float4x4 mvp_matrix = hlslpp::mul(cube_params.model_matrix, view_proj_matrix);
+            if (m_cube_instance_buffers_ptr)
+            {
+                // Matrix rows are read by vertex shader from instance attributes, so unlike uniforms it is not transposed
+                CubeInstance cube_instance{};
+                cube_instance.mvp_matrix = mvp_matrix;
+                cube_instance.texture_index = cube_params.thread_index;
+                m_cube_instance_buffers_ptr->SetInstanceData(std::move(cube_instance), cube_index);
+            }
+            else
+            {
+                hlslpp::Uniforms uniforms{};
+                uniforms.mvp_matrix = hlslpp::transpose(mvp_matrix);
+                uniforms.texture_index = cube_params.thread_index;
+                m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+            }
+
+            const hlslpp::float3 cube_center = hlslpp::mul(hlslpp::float4(0.F, 0.F, 0.F, 1.F), cube_params.model_matrix).xyz;
+            m_cube_bounding_spheres.Set(cube_index, cube_center, cube_params.bounding_radius);
         });
 
     GetRenderContext().GetParallelExecutor().run(task_flow).get();
+
+    // Select cubes visible in camera frustum, so that only visible cubes are drawn in render command lists
+    if (m_settings.frustum_culling_enabled)
+    {
+        m_camera.GetFrustum().CullSpheres(m_cube_bounding_spheres, m_visible_cube_indices, &GetRenderContext().GetParallelExecutor());
+    }
+
+    // Visible cube instances are packed in ascending order of cube indices for uploading to the instance buffer
+    if (m_cube_instance_buffers_ptr)
+    {
+        m_cube_instance_buffers_ptr->PackInstances(m_visible_cube_indices);
+    }
     return true;
 }
 
@@ -386,10 +471,20 @@ bool ParallelRenderingApp::Render()
     if (!UserInterfaceApp::Render())
         return false;
 
-    // Update uniforms buffer related to current frame
+    // Update uniforms or instance buffer related to current frame
     const ParallelRenderingFrame& frame  = GetCurrentFrame();
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
-    frame.cubes_array.uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    const auto cubes_count = static_cast<uint32_t>(m_cube_array_parameters.size());
+    if (m_cube_instance_buffers_ptr)
+    {
+        if (const rhi::SubResource packed_instances_subresource = m_cube_instance_buffers_ptr->GetPackedInstancesSubresource();
+            !packed_instances_subresource.IsEmptyOrNull())
+            frame.cubes_instances.instance_buffer.SetData(render_cmd_queue, packed_instances_subresource);
+    }
+    else
+    {
+        frame.cubes_array.uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    }
 
     // Render cube instances of 'CUBE_MAP_ARRAY_SIZE' count
     if (m_settings.parallel_rendering_enabled)
@@ -400,16 +495,19 @@ bool ParallelRenderingApp::Render()
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
         const std::vector<rhi::RenderCommandList>& render_cmd_lists = frame.parallel_render_cmd_list.GetParallelCommandLists();
-        const uint32_t instance_count_per_command_list = Data::DivCeil(m_cube_array_buffers_ptr->GetInstanceCount(), static_cast<uint32_t>(render_cmd_lists.size()));
+        const uint32_t instance_count_per_command_list = Data::DivCeil(cubes_count, static_cast<uint32_t>(render_cmd_lists.size()));
 
         // Generate thread tasks for each of parallel render command lists to encode cubes rendering commands
         tf::Taskflow render_task_flow;
         render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
-            [this, &frame, &render_cmd_lists, instance_count_per_command_list](const uint32_t cmd_list_index)
+            [this, &frame, &render_cmd_lists, instance_count_per_command_list, cubes_count](const uint32_t cmd_list_index)
             {
-                const uint32_t begin_instance_index = cmd_list_index * instance_count_per_command_list;
-                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, m_cube_array_buffers_ptr->GetInstanceCount());
-                RenderCubesRange(render_cmd_lists[cmd_list_index], frame.cubes_array.program_bindings_per_instance, begin_instance_index, end_instance_index);
+                const uint32_t begin_instance_index = std::min(cmd_list_index * instance_count_per_command_list, cubes_count);
+                const uint32_t end_instance_index = std::min(begin_instance_index + instance_count_per_command_list, cubes_count);
+                if (m_cube_instance_buffers_ptr)
+                    RenderCubeInstancesRange(render_cmd_lists[cmd_list_index], frame.cubes_instances, begin_instance_index, end_instance_index);
+                else
+                    RenderCubesRange(render_cmd_lists[cmd_list_index], frame.cubes_array.program_bindings_per_instance, begin_instance_index, end_instance_index);
             }
         );
 
@@ -417,7 +515,10 @@ bool ParallelRenderingApp::Render()
         GetRenderContext().GetParallelExecutor().run(render_task_flow).get();
 #else
         // The same parallel rendering is done inside of MeshBuffers::DrawParallel helper function
-        m_cube_array_buffers_ptr->DrawParallel(*frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+        if (m_cube_instance_buffers_ptr)
+            m_cube_instance_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, frame.cubes_instances);
+        else
+            m_cube_array_buffers_ptr->DrawParallel(frame.parallel_render_cmd_list, frame.cubes_array.program_bindings_per_instance);
 #endif
 
         RenderOverlay(frame.parallel_render_cmd_list.GetParallelCommandLists().back());
@@ -430,9 +531,15 @@ bool ParallelRenderingApp::Render()
         frame.serial_render_cmd_list.SetViewState(GetViewState());
 
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
-        RenderCubesRange(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+        if (m_cube_instance_buffers_ptr)
+            RenderCubeInstancesRange(frame.serial_render_cmd_list, frame.cubes_instances, 0U, cubes_count);
+        else
+            RenderCubesRange(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, 0U, cubes_count);
 #else
-        m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance);
+        if (m_cube_instance_buffers_ptr)
+            m_cube_instance_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_instances);
+        else
+            m_cube_array_buffers_ptr->Draw(frame.serial_render_cmd_list, frame.cubes_array.program_bindings_per_instance, m_visible_cube_indices);
 #endif
 
         RenderOverlay(frame.serial_render_cmd_list);
@@ -454,20 +561,47 @@ void ParallelRenderingApp::RenderCubesRange(const rhi::RenderCommandList& render
     render_cmd_list.SetVertexBuffers(m_cube_array_buffers_ptr->GetVertexBuffers(), false);
     render_cmd_list.SetIndexBuffer(m_cube_array_buffers_ptr->GetIndexBuffer(), false);
 
-    for (uint32_t instance_index = begin_instance_index; instance_index < end_instance_index; ++instance_index)
+    // Only visible cubes are drawn from the instances range, visible indices are sorted in ascending order
+    const auto visible_begin_it = std::lower_bound(m_visible_cube_indices.begin(), m_visible_cube_indices.end(), begin_instance_index);
+    const auto visible_end_it   = std::lower_bound(visible_begin_it, m_visible_cube_indices.end(), end_instance_index);
+
+    for (auto visible_index_it = visible_begin_it; visible_index_it != visible_end_it; ++visible_index_it)
     {
         // Constant argument bindings are applied once per command list, mutables are applied always
         // Bound resources are retained by command list during its lifetime, but only for the first binding instance (since all binding instances use the same resource objects)
         rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior;
         bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::ConstantOnce);
-        if (instance_index == begin_instance_index)
+        if (visible_index_it == visible_begin_it)
             bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::RetainResources);
 
-        render_cmd_list.SetProgramBindings(program_bindings_per_instance[instance_index], bindings_apply_behavior);
+        render_cmd_list.SetProgramBindings(program_bindings_per_instance[*visible_index_it], bindings_apply_behavior);
         render_cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle);
     }
 }
 
+void ParallelRenderingApp::RenderCubeInstancesRange(const rhi::RenderCommandList& render_cmd_list,
+                                                    const gfx::InstanceDataMeshBufferBindings& cube_instances_bindings,
+                                                    uint32_t begin_instance_index, const uint32_t end_instance_index) const
+{
+    META_FUNCTION_TASK();
+    // Visible cubes are packed in the instance buffer in the order of visible indices,
+    // so visible cubes from the instances range are drawn with a single instanced draw call of the packed instances range
+    const auto visible_begin_it = std::lower_bound(m_visible_cube_indices.begin(), m_visible_cube_indices.end(), begin_instance_index);
+    const auto visible_end_it   = std::lower_bound(visible_begin_it, m_visible_cube_indices.end(), end_instance_index);
+
+    // Bound resources are retained by command list during its lifetime and constant argument bindings are applied once per command list
+    rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior;
+    bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::ConstantOnce);
+    bindings_apply_behavior.SetBitOn(rhi::ProgramBindingsApplyBehavior::RetainResources);
+
+    // Resource barriers are not set for vertex and index buffers, since it works with automatic state propagation from Common state
+    // and volatile instance buffer is always accessible for reading in upload memory
+    m_cube_instance_buffers_ptr->Draw(render_cmd_list, cube_instances_bindings,
+                                      static_cast<Data::Index>(std::distance(m_visible_cube_indices.begin(), visible_begin_it)),
+                                      static_cast<Data::Index>(std::distance(m_visible_cube_indices.begin(), visible_end_it)),
+                                      bindings_apply_behavior, false);
+}
+
 std::string ParallelRenderingApp::GetParametersString()
 {
     META_FUNCTION_TASK();
@@ -476,6 +610,8 @@ std::string ParallelRenderingApp::GetParametersString()
     ss << "Parallel Rendering parameters:"
         << std::endl << "  - parallel rendering:   " << (m_settings.parallel_rendering_enabled ? "ON" : "OFF")
         << std::endl << "  - render threads count: " << m_settings.GetActiveRenderThreadCount()
+        << std::endl << "  - frustum culling:      " << (m_settings.frustum_culling_enabled ? "ON" : "OFF")
+        << std::endl << "  - instanced rendering:  " << (m_settings.instanced_rendering_enabled ? "ON" : "OFF")
         << std::endl << "  - cubes grid size:      " << m_settings.cubes_grid_size
         << std::endl << "  - total cubes count:    " << m_settings.GetTotalCubesCount()
         << std::endl << "  - texture array size:   " << g_texture_size.GetWidth() <<
@@ -499,6 +635,8 @@ void ParallelRenderingApp::OnContextReleased(rhi::IContext& context)
 {
     META_FUNCTION_TASK();
     m_cube_array_buffers_ptr.reset();
+    m_cube_instance_buffers_ptr.reset();
+    m_visible_cube_indices.clear();
     m_texture_array = {};
     m_texture_sampler = {};
     m_render_state = {};
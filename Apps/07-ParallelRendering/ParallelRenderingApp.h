@@ -44,10 +44,11 @@ namespace rhi = Methane::Graphics::Rhi;
 struct ParallelRenderingFrame final
     : Graphics::AppFrame
 {
-    gfx::InstancedMeshBufferBindings cubes_array;
-    rhi::ParallelRenderCommandList   parallel_render_cmd_list;
-    rhi::RenderCommandList           serial_render_cmd_list;
-    rhi::CommandListSet              execute_cmd_list_set;
+    gfx::InstancedMeshBufferBindings    cubes_array;
+    gfx::InstanceDataMeshBufferBindings cubes_instances;
+    rhi::ParallelRenderCommandList      parallel_render_cmd_list;
+    rhi::RenderCommandList              serial_render_cmd_list;
+    rhi::CommandListSet                 execute_cmd_list_set;
 
     using gfx::AppFrame::AppFrame;
 };
@@ -62,7 +63,9 @@ public:
     {
         uint32_t cubes_grid_size            = 12U; // total_cubes_count = pow(cubes_grid_size, 3)
         uint32_t render_thread_count        = std::thread::hardware_concurrency();
-        bool     parallel_rendering_enabled = true;
+        bool     parallel_rendering_enabled  = true;
+        bool     frustum_culling_enabled     = true;
+        bool     instanced_rendering_enabled = false; // all cubes are drawn with one instanced draw call per render thread
 
         bool operator==(const Settings& other) const noexcept;
 
@@ -96,16 +99,29 @@ private:
         double           rotation_speed_y = 0.25f;
         double           rotation_speed_z = 0.5f;
         uint32_t         thread_index = 0;
+        float            bounding_radius = 0.F;
     };
 
-    using CubeArrayParameters = std::vector<CubeParameters>;
-    using MeshBuffers = gfx::MeshBuffers<hlslpp::Uniforms>;
+    // Per-instance vertex attributes layout matches VSInstanceInput structure in ParallelRendering.hlsl
+    struct CubeInstance
+    {
+        hlslpp::float4x4 mvp_matrix;
+        uint32_t         texture_index = 0U; // padded to 16 bytes by matrix alignment
+    };
+    static_assert(sizeof(CubeInstance) == 5U * sizeof(hlslpp::float4), "cube instance size should match per-instance vertex attributes");
+
+    using CubeArrayParameters  = std::vector<CubeParameters>;
+    using MeshBuffers          = gfx::MeshBuffers<hlslpp::Uniforms>;
+    using InstancedMeshBuffers = gfx::InstancedMeshBuffers<CubeInstance>;
 
     CubeArrayParameters InitializeCubeArrayParameters() const;
     bool Animate(double elapsed_seconds, double delta_seconds);
     void RenderCubesRange(const rhi::RenderCommandList& remder_cmd_list,
                           const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
                           uint32_t begin_instance_index, const uint32_t end_instance_index) const;
+    void RenderCubeInstancesRange(const rhi::RenderCommandList& render_cmd_list,
+                                  const gfx::InstanceDataMeshBufferBindings& cube_instances_bindings,
+                                  uint32_t begin_instance_index, const uint32_t end_instance_index) const;
 
     Settings            m_settings;
     gfx::Camera         m_camera;
@@ -113,7 +129,10 @@ private:
     rhi::Texture        m_texture_array;
     rhi::Sampler        m_texture_sampler;
     Ptr<MeshBuffers>    m_cube_array_buffers_ptr;
+    Ptr<InstancedMeshBuffers> m_cube_instance_buffers_ptr;
     CubeArrayParameters m_cube_array_parameters;
+    gfx::Frustum::BoundingSpheres m_cube_bounding_spheres;
+    gfx::Frustum::VisibleIndices  m_visible_cube_indices;
 };
 
 } // namespace Methane::Tutorials
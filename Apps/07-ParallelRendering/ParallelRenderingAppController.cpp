@@ -52,6 +52,10 @@ void ParallelRenderingAppController::OnKeyboardStateAction(ParallelRenderingAppA
         app_settings.parallel_rendering_enabled = !app_settings.parallel_rendering_enabled;
         break;
 
+    case ParallelRenderingAppAction::SwitchInstancedRendering:
+        app_settings.instanced_rendering_enabled = !app_settings.instanced_rendering_enabled;
+        break;
+
     case ParallelRenderingAppAction::IncreaseCubesGridSize:
         app_settings.cubes_grid_size++;
         break;
@@ -80,6 +84,7 @@ std::string ParallelRenderingAppController::GetKeyboardActionName(ParallelRender
     switch(action)
     {
     case ParallelRenderingAppAction::SwitchParallelRendering:    return "switch parallel rendering";
+    case ParallelRenderingAppAction::SwitchInstancedRendering:   return "switch instanced rendering";
     case ParallelRenderingAppAction::IncreaseCubesGridSize:      return "increase cubes grid size";
     case ParallelRenderingAppAction::DecreaseCubesGridSize:      return "decrease cubes grid size";
     case ParallelRenderingAppAction::IncreaseRenderThreadsCount: return "increase render threads count";
@@ -35,6 +35,7 @@ enum class ParallelRenderingAppAction
 {
     None,
     SwitchParallelRendering,
+    SwitchInstancedRendering,
     IncreaseCubesGridSize,
     DecreaseCubesGridSize,
     IncreaseRenderThreadsCount,
@@ -18,6 +18,7 @@ limitations under the License.
 
 FILE: MethaneKit/Apps/Tutorials/07-ParallelRendering/Shaders/ParallelRendering.hlsl
 Shaders for cube rendering with sampling from Texture2DArray in parallel rendering tutorial
+with per-instance uniforms or per-instance vertex attributes of instanced rendering
 
 ******************************************************************************/
 
@@ -36,6 +37,26 @@ struct PSInput
     float2 texcoord    : TEXCOORD;
 };
 
+// Per-instance data is read from the instance buffer bound after mesh vertex buffer,
+// matrix rows are passed in separate attributes since vertex attributes are limited to 4 components
+struct VSInstanceInput
+{
+    float3 position      : POSITION;
+    float2 texcoord      : TEXCOORD;
+    float4 mvp_row_x     : MVP_ROW_X;
+    float4 mvp_row_y     : MVP_ROW_Y;
+    float4 mvp_row_z     : MVP_ROW_Z;
+    float4 mvp_row_w     : MVP_ROW_W;
+    uint4  texture_index : TEXTURE_INDEX; // only first component is used, others are padding to 16 bytes
+};
+
+struct PSInstanceInput
+{
+    float4 position      : SV_POSITION;
+    float2 texcoord      : TEXCOORD;
+    nointerpolation uint texture_index : TEXTURE_INDEX;
+};
+
 ConstantBuffer<Uniforms>  g_uniforms      : register(b1);
 Texture2DArray            g_texture_array : register(t0);
 SamplerState              g_sampler       : register(s0);
@@ -52,3 +73,19 @@ float4 CubePS(PSInput input) : SV_TARGET
 {
     return g_texture_array.Sample(g_sampler, float3(input.texcoord, g_uniforms.texture_index));
 }
+
+PSInstanceInput CubeInstancedVS(VSInstanceInput input)
+{
+    const float4x4 mvp_matrix = float4x4(input.mvp_row_x, input.mvp_row_y, input.mvp_row_z, input.mvp_row_w);
+
+    PSInstanceInput output;
+    output.position      = mul(float4(input.position, 1.F), mvp_matrix);
+    output.texcoord      = input.texcoord;
+    output.texture_index = input.texture_index.x;
+    return output;
+}
+
+float4 CubeInstancedPS(PSInstanceInput input) : SV_TARGET
+{
+    return g_texture_array.Sample(g_sampler, float3(input.texcoord, input.texture_index));
+}
@@ -193,6 +193,8 @@ void ConsoleComputeApp::Release()
     META_FUNCTION_TASK();
     m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
 
+    m_frame_read_back_request_ptr.reset();
+    m_frame_data           = {};
     m_compute_cmd_list_set = {};
     m_compute_cmd_list     = {};
     m_compute_bindings     = {};
@@ -211,15 +213,22 @@ void ConsoleComputeApp::Compute()
                                                      data::DivCeil(field_size.GetHeight(), thread_group_size.GetHeight()),
                                                      1U);
 
+    // Previous frame read-back is completed together with compute commands before command list can be reset,
+    // its data references persistently mapped read-back buffer, which is not reused by the next frame request
+    if (m_frame_read_back_request_ptr)
+    {
+        m_frame_data = m_frame_read_back_request_ptr->GetData();
+    }
+
     META_DEBUG_GROUP_VAR(s_debum_group, "Compute Frame");
     m_compute_cmd_list.ResetWithState(m_compute_state, &s_debum_group);
     m_compute_cmd_list.SetProgramBindings(m_compute_bindings);
     m_compute_cmd_list.Dispatch(thread_groups_count);
+    m_frame_read_back_request_ptr = m_frame_texture.RequestReadBack(m_compute_cmd_list.GetInterface());
     m_compute_cmd_list.Commit();
 
+    // Compute frame is presented on CPU while the next frame is computed on GPU without waiting for its completion
     compute_cmd_queue.Execute(m_compute_cmd_list_set);
-    m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
-    m_frame_data = m_frame_texture.GetData(compute_cmd_queue);
     m_fps_counter.OnCpuFrameReadyToPresent();
 }
 
@@ -228,6 +237,11 @@ void ConsoleComputeApp::Present(ftxui::Canvas& canvas)
     META_FUNCTION_TASK();
     const data::FrameSize& field_size = GetFieldSize();
     const data::FrameRect& frame_rect = GetVisibleFrameRect();
+    if (m_frame_read_back_request_ptr && m_frame_read_back_request_ptr->IsReady())
+    {
+        m_frame_data = m_frame_read_back_request_ptr->GetData();
+    }
+
     const uint8_t* cells  = m_frame_data.GetDataPtr<uint8_t>();
     m_visible_cells_count = 0U;
 
@@ -253,6 +267,7 @@ void ConsoleComputeApp::Restart()
     META_FUNCTION_TASK();
     std::unique_lock lock(GetScreenRefreshMutex());
     m_compute_context.WaitForGpu(rhi::ContextWaitFor::ComputeComplete);
+    m_frame_read_back_request_ptr.reset();
     RandomizeFrameData();
     m_compute_context.UploadResources();
 }
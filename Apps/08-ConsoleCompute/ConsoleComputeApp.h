@@ -63,17 +63,18 @@ protected:
 private:
     void RandomizeFrameData();
 
-    std::mt19937            m_random_engine;
-    tf::Executor            m_parallel_executor;
-    rhi::ComputeContext     m_compute_context;
-    rhi::ComputeState       m_compute_state;
-    rhi::ComputeCommandList m_compute_cmd_list;
-    rhi::CommandListSet     m_compute_cmd_list_set;
-    rhi::Texture            m_frame_texture;
-    rhi::ProgramBindings    m_compute_bindings;
-    rhi::SubResource        m_frame_data;
-    Data::FpsCounter        m_fps_counter{ 60U };
-    uint32_t                m_visible_cells_count{ 0U };
+    std::mt19937               m_random_engine;
+    tf::Executor               m_parallel_executor;
+    rhi::ComputeContext        m_compute_context;
+    rhi::ComputeState          m_compute_state;
+    rhi::ComputeCommandList    m_compute_cmd_list;
+    rhi::CommandListSet        m_compute_cmd_list_set;
+    rhi::Texture               m_frame_texture;
+    rhi::ProgramBindings       m_compute_bindings;
+    rhi::SubResource           m_frame_data;
+    Ptr<rhi::IReadBackRequest> m_frame_read_back_request_ptr;
+    Data::FpsCounter           m_fps_counter{ 60U };
+    uint32_t                   m_visible_cells_count{ 0U };
 };
 
 } // namespace Methane::Tutorials
@@ -0,0 +1,151 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/BuddyAllocator.hpp
+Buddy allocator of power-of-two sized ranges in a memory block of power-of-two size,
+which tracks offsets only and does not own any memory.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace Methane::Data
+{
+
+template<typename OffsetType>
+class BuddyAllocator
+{
+public:
+    // Order of the smallest power of two which is greater or equal to the given value
+    [[nodiscard]] static uint32_t GetCeilOrder(OffsetType value) noexcept
+    {
+        uint32_t order = 0U;
+        while ((OffsetType(1U) << order) < value)
+            ++order;
+        return order;
+    }
+
+    // Order of the largest power of two which is less or equal to the given value
+    [[nodiscard]] static uint32_t GetFloorOrder(OffsetType value) noexcept
+    {
+        uint32_t order = 0U;
+        while ((OffsetType(2U) << order) <= value)
+            ++order;
+        return order;
+    }
+
+    BuddyAllocator(OffsetType size, uint32_t min_order)
+        : m_size(size)
+        , m_min_order(min_order)
+        , m_max_order(GetFloorOrder(size))
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_EQUAL_DESCR(size, OffsetType(1U) << m_max_order, "buddy allocator size should be a power of two");
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(m_min_order, m_max_order, "buddy allocator minimum order is greater than its size order");
+        m_free_offsets_by_order.resize(m_max_order - m_min_order + 1U);
+        m_free_offsets_by_order.back().insert(0U);
+    }
+
+    [[nodiscard]] OffsetType GetSize() const noexcept             { return m_size; }
+    [[nodiscard]] uint32_t   GetMinOrder() const noexcept         { return m_min_order; }
+    [[nodiscard]] uint32_t   GetMaxOrder() const noexcept         { return m_max_order; }
+    [[nodiscard]] uint32_t   GetAllocationsCount() const noexcept { return m_allocations_count; }
+    [[nodiscard]] bool       IsEmpty() const noexcept             { return m_allocations_count == 0U; }
+
+    // Returns offset of the free range of (1 << order) size aligned to its size, or nullopt when there is no free range of that size
+    [[nodiscard]] Opt<OffsetType> Allocate(uint32_t order)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_RANGE(order, m_min_order, m_max_order + 1U);
+
+        // Find the smallest free buddy which fits requested order
+        uint32_t free_order = order;
+        while (free_order <= m_max_order && m_free_offsets_by_order[free_order - m_min_order].empty())
+            ++free_order;
+
+        if (free_order > m_max_order)
+            return std::nullopt;
+
+        FreeOffsets& free_offsets = m_free_offsets_by_order[free_order - m_min_order];
+        const OffsetType offset = *free_offsets.begin();
+        free_offsets.erase(free_offsets.begin());
+
+        // Split free buddy down to the requested order, upper halves are returned to free lists
+        while (free_order > order)
+        {
+            --free_order;
+            m_free_offsets_by_order[free_order - m_min_order].insert(offset + (OffsetType(1U) << free_order));
+        }
+
+        m_allocations_count++;
+        return offset;
+    }
+
+    void Free(OffsetType offset, uint32_t order)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_RANGE(order, m_min_order, m_max_order + 1U);
+        META_CHECK_ARG_GREATER_DESCR(m_allocations_count, 0U, "buddy allocator has no allocations to free");
+        META_CHECK_ARG_EQUAL_DESCR(offset % (OffsetType(1U) << order), OffsetType(0U), "freed offset is not aligned to the range size");
+
+        // Merge freed buddy with its free neighbours up to the largest possible order
+        while (order < m_max_order)
+        {
+            const OffsetType buddy_offset = offset ^ (OffsetType(1U) << order);
+            FreeOffsets& free_offsets = m_free_offsets_by_order[order - m_min_order];
+            const auto buddy_it = free_offsets.find(buddy_offset);
+            if (buddy_it == free_offsets.end())
+                break;
+
+            free_offsets.erase(buddy_it);
+            offset = std::min(offset, buddy_offset);
+            ++order;
+        }
+
+        m_free_offsets_by_order[order - m_min_order].insert(offset);
+        m_allocations_count--;
+    }
+
+    // Number of free ranges of the given order, used to check fragmentation
+    [[nodiscard]] size_t GetFreeRangesCount(uint32_t order) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_RANGE(order, m_min_order, m_max_order + 1U);
+        return m_free_offsets_by_order[order - m_min_order].size();
+    }
+
+private:
+    using FreeOffsets = std::set<OffsetType>;
+
+    const OffsetType         m_size;
+    const uint32_t           m_min_order;
+    const uint32_t           m_max_order;
+    std::vector<FreeOffsets> m_free_offsets_by_order; // indexed with (order - min_order)
+    uint32_t                 m_allocations_count = 0U;
+};
+
+} // namespace Methane::Data
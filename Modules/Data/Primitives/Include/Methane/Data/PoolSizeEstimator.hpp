@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PoolSizeEstimator.hpp
+Estimator of pool sizes by item type, which learns the item counts from the set layouts
+allocated from pools and falls back to the configured size ratios until any layout is added.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+
+namespace Methane::Data
+{
+
+template<typename ItemType>
+class PoolSizeEstimator
+{
+public:
+    using SizeRatioByType = std::map<ItemType, float>;
+    using CountByType     = std::map<ItemType, uint32_t>;
+
+    PoolSizeEstimator(uint32_t pool_sets_count, const SizeRatioByType& size_ratio_by_type)
+        : m_pool_sets_count(pool_sets_count)
+        , m_size_ratio_by_type(size_ratio_by_type)
+    { }
+
+    [[nodiscard]] uint32_t GetPoolSetsCount() const noexcept { return m_pool_sets_count; }
+    [[nodiscard]] uint32_t GetLayoutsCount() const noexcept  { return m_layouts_count; }
+
+    void SetSizeRatio(ItemType item_type, float size_ratio)
+    {
+        META_FUNCTION_TASK();
+        m_size_ratio_by_type[item_type] = size_ratio;
+    }
+
+    void AddSetLayout(const CountByType& items_count_by_type)
+    {
+        META_FUNCTION_TASK();
+        for(const auto& [item_type, items_count] : items_count_by_type)
+        {
+            ItemTypeUsage& item_usage = m_usage_by_type[item_type];
+            item_usage.total_count  += items_count;
+            item_usage.max_set_count = std::max(item_usage.max_set_count, items_count);
+        }
+        m_layouts_count++;
+    }
+
+    // Each type gets the average items count per layout multiplied by pool sets count, but no less than the largest single layout
+    [[nodiscard]] CountByType GetPoolSizes() const
+    {
+        META_FUNCTION_TASK();
+        CountByType pool_sizes;
+        if (m_layouts_count)
+        {
+            for(const auto& [item_type, item_usage] : m_usage_by_type)
+            {
+                const auto average_pool_size = static_cast<uint32_t>(static_cast<uint64_t>(m_pool_sets_count) * item_usage.total_count / m_layouts_count);
+                pool_sizes.emplace(item_type, std::max(average_pool_size, item_usage.max_set_count));
+            }
+        }
+        else
+        {
+            for(const auto& [item_type, size_ratio] : m_size_ratio_by_type)
+            {
+                pool_sizes.emplace(item_type, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio));
+            }
+        }
+        return pool_sizes;
+    }
+
+private:
+    struct ItemTypeUsage
+    {
+        uint32_t total_count   = 0U; // total count of items of this type in all layouts
+        uint32_t max_set_count = 0U; // maximum count of items of this type in one layout
+    };
+
+    const uint32_t                    m_pool_sets_count;
+    SizeRatioByType                   m_size_ratio_by_type;
+    std::map<ItemType, ItemTypeUsage> m_usage_by_type;
+    uint32_t                          m_layouts_count = 0U;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,138 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/BoundingVolumeHierarchy.h
+Bounding volume hierarchy of scene instances axis-aligned bounding boxes
+built with binned surface area heuristic and used for hierarchical frustum
+culling and ray picking.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/Frustum.h>
+#include <Methane/Data/Types.h>
+
+#include <hlsl++_vector_float.h>
+#include <optional>
+#include <vector>
+#include <limits>
+
+namespace tf // NOSONAR
+{
+// TaskFlow classes forward declaration from <taskflow/core/executor.hpp> and <taskflow/core/flow_builder.hpp>
+class Executor;
+class Subflow;
+}
+
+namespace Methane::Graphics
+{
+
+class BoundingVolumeHierarchy
+{
+public:
+    struct Bounds
+    {
+        hlslpp::float3 min{ std::numeric_limits<float>::max() };
+        hlslpp::float3 max{ std::numeric_limits<float>::lowest() };
+
+        void Extend(const Bounds& other) noexcept;
+        void Extend(const hlslpp::float3& point) noexcept;
+
+        [[nodiscard]] bool           IsEmpty() const noexcept;
+        [[nodiscard]] bool           Contains(const Bounds& other) const noexcept;
+        [[nodiscard]] hlslpp::float3 GetCenter() const noexcept { return (min + max) * 0.5F; }
+        [[nodiscard]] float          GetSurfaceArea() const noexcept;
+        [[nodiscard]] bool           operator==(const Bounds& other) const noexcept;
+        [[nodiscard]] bool           operator!=(const Bounds& other) const noexcept { return !operator==(other); }
+    };
+
+    // Left child node follows its parent and right child node is placed after the nodes range reserved for the left subtree,
+    // so that subtrees are built in parallel without synchronization; instances of any node are stored in contiguous range
+    // of the instance indices, unused nodes of the reserved ranges have no instances
+    struct Node
+    {
+        Bounds      bounds;
+        Data::Index right_child_index = 0U; // zero for leaf nodes
+        Data::Index first_instance    = 0U; // offset in the instance indices
+        Data::Size  instance_count    = 0U;
+
+        [[nodiscard]] bool        IsLeaf() const noexcept                                { return right_child_index == 0U; }
+        [[nodiscard]] Data::Index GetLeftChildIndex(Data::Index node_index) const noexcept { return node_index + 1U; }
+    };
+
+    struct Settings
+    {
+        Data::Size max_leaf_size = 4U;  // leaf nodes are split until they have no more instances than this
+        Data::Size bins_count    = 16U; // count of bins used to evaluate split candidates along each axis
+    };
+
+    struct RayHit
+    {
+        Data::Index instance_index;
+        float       distance; // distance along the ray direction to the instance bounds entry point
+    };
+
+    using InstanceBounds = std::vector<Bounds>;
+    using Nodes          = std::vector<Node>;
+    using Indices        = std::vector<Data::Index>;
+
+    BoundingVolumeHierarchy() = default;
+    explicit BoundingVolumeHierarchy(InstanceBounds instance_bounds, tf::Executor* parallel_executor_ptr = nullptr);
+    BoundingVolumeHierarchy(InstanceBounds instance_bounds, const Settings& settings, tf::Executor* parallel_executor_ptr = nullptr);
+
+    // Hierarchy is rebuilt from scratch, which is required after instances were added or removed,
+    // or when instances have moved too far from their original positions and refitted hierarchy has degraded
+    void Build(InstanceBounds instance_bounds, tf::Executor* parallel_executor_ptr = nullptr);
+
+    // Bounds of moving instances are updated and their leaf nodes are marked for refit,
+    // so that bounds of these leaves and all their ancestors are updated by the following Refit call
+    void SetInstanceBounds(Data::Index instance_index, const Bounds& bounds);
+    void Refit();
+
+    [[nodiscard]] const Settings&       GetSettings() const noexcept        { return m_settings; }
+    [[nodiscard]] const Nodes&          GetNodes() const noexcept           { return m_nodes; }
+    [[nodiscard]] const Indices&        GetInstanceIndices() const noexcept { return m_instance_indices; }
+    [[nodiscard]] const InstanceBounds& GetInstanceBounds() const noexcept  { return m_instance_bounds; }
+    [[nodiscard]] Data::Size            GetInstanceCount() const noexcept   { return static_cast<Data::Size>(m_instance_bounds.size()); }
+    [[nodiscard]] bool                  IsRefitRequired() const noexcept    { return !m_refit_leaf_indices.empty(); }
+
+    // Indices of instances visible in frustum are written to the list in ascending order and their count is returned:
+    // subtrees outside of frustum are skipped and subtrees inside of frustum are added without testing their instances
+    Data::Size QueryFrustum(const Frustum& frustum, Indices& visible_instance_indices) const;
+
+    // Closest instance with bounds intersected by the ray is returned
+    [[nodiscard]] std::optional<RayHit> QueryRay(const Camera::Ray& ray, float max_distance = std::numeric_limits<float>::max()) const;
+    [[nodiscard]] std::optional<RayHit> QueryScreenRay(const Camera& camera, const Data::Point2I& screen_pos) const;
+
+private:
+    void BuildNode(Data::Index node_index, tf::Subflow* subflow_ptr);
+    [[nodiscard]] Data::Size SplitNodeInstances(const Node& node);
+    [[nodiscard]] Bounds GetInstancesBounds(const Node& node) const noexcept;
+
+    Settings       m_settings;
+    InstanceBounds m_instance_bounds;
+    Indices        m_instance_indices;
+    Indices        m_instance_leaf_indices;
+    Indices        m_node_parent_indices;
+    Indices        m_refit_leaf_indices;
+    Nodes          m_nodes;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,478 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/BoundingVolumeHierarchy.cpp
+Bounding volume hierarchy of scene instances axis-aligned bounding boxes
+built with binned surface area heuristic and used for hierarchical frustum
+culling and ray picking.
+
+******************************************************************************/
+
+#include <Methane/Graphics/BoundingVolumeHierarchy.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+
+namespace Methane::Graphics
+{
+
+static constexpr Data::Size g_max_bins_count          = 64U;
+static constexpr Data::Size g_parallel_build_min_size = 4096U; // minimum instances count of the subtree built in a separate task
+static constexpr Data::Size g_query_stack_size        = 64U;
+
+[[nodiscard]] static float GetAxisComponent(const hlslpp::float3& vector, uint32_t axis) noexcept
+{
+    switch (axis)
+    {
+    case 0U: return vector.x;
+    case 1U: return vector.y;
+    default: return vector.z;
+    }
+}
+
+[[nodiscard]] static float GetMaxComponent(const hlslpp::float3& vector) noexcept
+{
+    return std::max(std::max(static_cast<float>(vector.x), static_cast<float>(vector.y)), static_cast<float>(vector.z));
+}
+
+[[nodiscard]] static float GetMinComponent(const hlslpp::float3& vector) noexcept
+{
+    return std::min(std::min(static_cast<float>(vector.x), static_cast<float>(vector.y)), static_cast<float>(vector.z));
+}
+
+// Slab test of the ray with inverted direction against axis-aligned bounds returns distance to the bounds entry point
+[[nodiscard]] static std::optional<float> IntersectRayBounds(const hlslpp::float3& ray_origin, const hlslpp::float3& ray_inv_direction,
+                                                             const BoundingVolumeHierarchy::Bounds& bounds, float max_distance) noexcept
+{
+    const hlslpp::float3 min_distances = (bounds.min - ray_origin) * ray_inv_direction;
+    const hlslpp::float3 max_distances = (bounds.max - ray_origin) * ray_inv_direction;
+    const float enter_distance = std::max(GetMaxComponent(hlslpp::min(min_distances, max_distances)), 0.F);
+    const float exit_distance  = std::min(GetMinComponent(hlslpp::max(min_distances, max_distances)), max_distance);
+    if (enter_distance > exit_distance)
+        return std::nullopt;
+
+    return enter_distance;
+}
+
+void BoundingVolumeHierarchy::Bounds::Extend(const Bounds& other) noexcept
+{
+    min = hlslpp::min(min, other.min);
+    max = hlslpp::max(max, other.max);
+}
+
+void BoundingVolumeHierarchy::Bounds::Extend(const hlslpp::float3& point) noexcept
+{
+    min = hlslpp::min(min, point);
+    max = hlslpp::max(max, point);
+}
+
+bool BoundingVolumeHierarchy::Bounds::IsEmpty() const noexcept
+{
+    return hlslpp::any(min > max);
+}
+
+bool BoundingVolumeHierarchy::Bounds::Contains(const Bounds& other) const noexcept
+{
+    return hlslpp::all(min <= other.min) && hlslpp::all(other.max <= max);
+}
+
+float BoundingVolumeHierarchy::Bounds::GetSurfaceArea() const noexcept
+{
+    if (IsEmpty())
+        return 0.F;
+
+    const hlslpp::float3 size = max - min;
+    return 2.F * static_cast<float>(hlslpp::dot(size, hlslpp::float3(size.yzx)));
+}
+
+bool BoundingVolumeHierarchy::Bounds::operator==(const Bounds& other) const noexcept
+{
+    return hlslpp::all(min == other.min) && hlslpp::all(max == other.max);
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(InstanceBounds instance_bounds, tf::Executor* parallel_executor_ptr)
+    : BoundingVolumeHierarchy(std::move(instance_bounds), Settings{}, parallel_executor_ptr)
+{
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(InstanceBounds instance_bounds, const Settings& settings, tf::Executor* parallel_executor_ptr)
+    : m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.max_leaf_size, "leaf nodes should contain at least one instance");
+    META_CHECK_ARG_RANGE_INC_DESCR(m_settings.bins_count, 2U, g_max_bins_count, "unsupported count of bins for split evaluation");
+    Build(std::move(instance_bounds), parallel_executor_ptr);
+}
+
+void BoundingVolumeHierarchy::Build(InstanceBounds instance_bounds, tf::Executor* parallel_executor_ptr)
+{
+    META_FUNCTION_TASK();
+    m_instance_bounds = std::move(instance_bounds);
+    m_refit_leaf_indices.clear();
+
+    const auto instance_count = static_cast<Data::Size>(m_instance_bounds.size());
+    if (!instance_count)
+    {
+        m_instance_indices.clear();
+        m_instance_leaf_indices.clear();
+        m_node_parent_indices.clear();
+        m_nodes.clear();
+        return;
+    }
+
+    // Binary tree with at least one instance in each leaf has no more than 2N - 1 nodes
+    const Data::Size max_nodes_count = 2U * instance_count - 1U;
+    m_instance_indices.resize(instance_count);
+    std::iota(m_instance_indices.begin(), m_instance_indices.end(), 0U);
+    m_instance_leaf_indices.assign(instance_count, 0U);
+    m_node_parent_indices.assign(max_nodes_count, 0U);
+    m_nodes.assign(max_nodes_count, Node{});
+
+    Node& root_node = m_nodes.front();
+    root_node.instance_count = instance_count;
+
+    if (parallel_executor_ptr && instance_count >= g_parallel_build_min_size)
+    {
+        tf::Taskflow task_flow;
+        task_flow.emplace([this](tf::Subflow& subflow) { BuildNode(0U, &subflow); });
+        parallel_executor_ptr->run(task_flow).get();
+    }
+    else
+    {
+        BuildNode(0U, nullptr);
+    }
+}
+
+void BoundingVolumeHierarchy::BuildNode(Data::Index node_index, tf::Subflow* subflow_ptr)
+{
+    Node& node = m_nodes[node_index];
+    node.bounds = GetInstancesBounds(node);
+
+    const Data::Size left_instance_count = SplitNodeInstances(node);
+    if (!left_instance_count)
+    {
+        for (Data::Index instance_offset = node.first_instance; instance_offset < node.first_instance + node.instance_count; ++instance_offset)
+        {
+            m_instance_leaf_indices[m_instance_indices[instance_offset]] = node_index;
+        }
+        return;
+    }
+
+    // Left subtree with L instances takes no more than 2L - 1 nodes, which are reserved before the right child node
+    const Data::Index left_node_index  = node.GetLeftChildIndex(node_index);
+    const Data::Index right_node_index = node_index + 2U * left_instance_count;
+    node.right_child_index = right_node_index;
+
+    Node& left_node = m_nodes[left_node_index];
+    left_node.first_instance = node.first_instance;
+    left_node.instance_count = left_instance_count;
+
+    Node& right_node = m_nodes[right_node_index];
+    right_node.first_instance = node.first_instance + left_instance_count;
+    right_node.instance_count = node.instance_count - left_instance_count;
+
+    m_node_parent_indices[left_node_index]  = node_index;
+    m_node_parent_indices[right_node_index] = node_index;
+
+    if (subflow_ptr && node.instance_count >= g_parallel_build_min_size)
+    {
+        subflow_ptr->emplace([this, left_node_index](tf::Subflow& subflow)  { BuildNode(left_node_index, &subflow); });
+        subflow_ptr->emplace([this, right_node_index](tf::Subflow& subflow) { BuildNode(right_node_index, &subflow); });
+        return;
+    }
+
+    BuildNode(left_node_index, nullptr);
+    BuildNode(right_node_index, nullptr);
+}
+
+Data::Size BoundingVolumeHierarchy::SplitNodeInstances(const Node& node)
+{
+    if (node.instance_count <= m_settings.max_leaf_size)
+        return 0U;
+
+    const auto instances_begin_it = m_instance_indices.begin() + node.first_instance;
+    const auto instances_end_it   = instances_begin_it + node.instance_count;
+
+    Bounds centers_bounds;
+    std::for_each(instances_begin_it, instances_end_it,
+                  [this, &centers_bounds](Data::Index instance_index)
+                  { centers_bounds.Extend(m_instance_bounds[instance_index].GetCenter()); });
+
+    struct Bin
+    {
+        Bounds     bounds;
+        Data::Size count = 0U;
+    };
+
+    const Data::Size bins_count = m_settings.bins_count;
+    float      best_cost = std::numeric_limits<float>::max();
+    uint32_t   best_axis = 0U;
+    Data::Size best_bin  = 0U;
+    bool       is_split_found = false;
+
+    for (uint32_t axis = 0U; axis < 3U; ++axis)
+    {
+        const float axis_min    = GetAxisComponent(centers_bounds.min, axis);
+        const float axis_extent = GetAxisComponent(centers_bounds.max, axis) - axis_min;
+        if (axis_extent <= 0.F)
+            continue;
+
+        // Instances are distributed between bins by their centers along the axis
+        std::array<Bin, g_max_bins_count> bins{};
+        const float bin_scale = static_cast<float>(bins_count) / axis_extent;
+        std::for_each(instances_begin_it, instances_end_it,
+            [this, &bins, bins_count, bin_scale, axis_min, axis](Data::Index instance_index)
+            {
+                const Bounds& instance_bounds = m_instance_bounds[instance_index];
+                const auto bin_index = std::min(bins_count - 1U, static_cast<Data::Size>((GetAxisComponent(instance_bounds.GetCenter(), axis) - axis_min) * bin_scale));
+                bins[bin_index].bounds.Extend(instance_bounds);
+                bins[bin_index].count++;
+            });
+
+        // Surface area heuristic cost of splitting after each bin is evaluated with sweeps from both sides
+        std::array<float, g_max_bins_count> left_costs{};
+        Bounds     left_bounds;
+        Data::Size left_count = 0U;
+        for (Data::Index bin_index = 0U; bin_index < bins_count - 1U; ++bin_index)
+        {
+            left_bounds.Extend(bins[bin_index].bounds);
+            left_count += bins[bin_index].count;
+            left_costs[bin_index] = left_bounds.GetSurfaceArea() * static_cast<float>(left_count);
+        }
+
+        Bounds     right_bounds;
+        Data::Size right_count = 0U;
+        for (Data::Index bin_index = bins_count - 1U; bin_index > 0U; --bin_index)
+        {
+            right_bounds.Extend(bins[bin_index].bounds);
+            right_count += bins[bin_index].count;
+            if (right_count == node.instance_count)
+                break;
+
+            const float split_cost = left_costs[bin_index - 1U] + right_bounds.GetSurfaceArea() * static_cast<float>(right_count);
+            if (right_count > 0U && split_cost < best_cost)
+            {
+                best_cost = split_cost;
+                best_axis = axis;
+                best_bin  = bin_index - 1U;
+                is_split_found = true;
+            }
+        }
+    }
+
+    if (!is_split_found)
+    {
+        // All instance centers are coincident, so instances are split in halves in arbitrary order
+        return node.instance_count / 2U;
+    }
+
+    const float axis_min  = GetAxisComponent(centers_bounds.min, best_axis);
+    const float bin_scale = static_cast<float>(bins_count) / (GetAxisComponent(centers_bounds.max, best_axis) - axis_min);
+    const auto  split_it  = std::partition(instances_begin_it, instances_end_it,
+        [this, bins_count, bin_scale, axis_min, best_axis, best_bin](Data::Index instance_index)
+        {
+            const auto bin_index = std::min(bins_count - 1U, static_cast<Data::Size>((GetAxisComponent(m_instance_bounds[instance_index].GetCenter(), best_axis) - axis_min) * bin_scale));
+            return bin_index <= best_bin;
+        });
+
+    return static_cast<Data::Size>(std::distance(instances_begin_it, split_it));
+}
+
+BoundingVolumeHierarchy::Bounds BoundingVolumeHierarchy::GetInstancesBounds(const Node& node) const noexcept
+{
+    Bounds bounds;
+    for (Data::Index instance_offset = node.first_instance; instance_offset < node.first_instance + node.instance_count; ++instance_offset)
+    {
+        bounds.Extend(m_instance_bounds[m_instance_indices[instance_offset]]);
+    }
+    return bounds;
+}
+
+void BoundingVolumeHierarchy::SetInstanceBounds(Data::Index instance_index, const Bounds& bounds)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(instance_index, m_instance_bounds.size());
+    m_instance_bounds[instance_index] = bounds;
+
+    const Data::Index leaf_index = m_instance_leaf_indices[instance_index];
+    if (m_refit_leaf_indices.empty() || m_refit_leaf_indices.back() != leaf_index)
+        m_refit_leaf_indices.push_back(leaf_index);
+}
+
+void BoundingVolumeHierarchy::Refit()
+{
+    META_FUNCTION_TASK();
+    for (Data::Index node_index : m_refit_leaf_indices)
+    {
+        Node& leaf_node = m_nodes[node_index];
+        if (const Bounds leaf_bounds = GetInstancesBounds(leaf_node);
+            leaf_bounds != leaf_node.bounds)
+            leaf_node.bounds = leaf_bounds;
+        else
+            continue;
+
+        // Node bounds are exact unions of child bounds, so ancestors are not updated above the first unchanged node
+        while (node_index > 0U)
+        {
+            node_index = m_node_parent_indices[node_index];
+            Node& parent_node = m_nodes[node_index];
+
+            Bounds parent_bounds = m_nodes[parent_node.GetLeftChildIndex(node_index)].bounds;
+            parent_bounds.Extend(m_nodes[parent_node.right_child_index].bounds);
+            if (parent_bounds == parent_node.bounds)
+                break;
+
+            parent_node.bounds = parent_bounds;
+        }
+    }
+    m_refit_leaf_indices.clear();
+}
+
+Data::Size BoundingVolumeHierarchy::QueryFrustum(const Frustum& frustum, Indices& visible_instance_indices) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_FALSE_DESCR(IsRefitRequired(), "hierarchy should be refitted after update of instance bounds before query");
+    visible_instance_indices.clear();
+    if (m_nodes.empty())
+        return 0U;
+
+    Indices nodes_stack;
+    nodes_stack.reserve(g_query_stack_size);
+    nodes_stack.push_back(0U);
+
+    while (!nodes_stack.empty())
+    {
+        const Data::Index node_index = nodes_stack.back();
+        nodes_stack.pop_back();
+
+        const Node& node = m_nodes[node_index];
+        const auto instances_begin_it = m_instance_indices.begin() + node.first_instance;
+        const auto instances_end_it   = instances_begin_it + node.instance_count;
+
+        const Frustum::Containment node_containment = frustum.GetBoxContainment(node.bounds.min, node.bounds.max);
+        switch (node_containment)
+        {
+        case Frustum::Containment::Outside:
+            break;
+
+        case Frustum::Containment::Inside:
+            visible_instance_indices.insert(visible_instance_indices.end(), instances_begin_it, instances_end_it);
+            break;
+
+        case Frustum::Containment::Intersects:
+            if (node.IsLeaf())
+            {
+                std::copy_if(instances_begin_it, instances_end_it, std::back_inserter(visible_instance_indices),
+                             [this, &frustum](Data::Index instance_index)
+                             {
+                                 const Bounds& instance_bounds = m_instance_bounds[instance_index];
+                                 return frustum.IsBoxVisible(instance_bounds.min, instance_bounds.max);
+                             });
+            }
+            else
+            {
+                nodes_stack.push_back(node.right_child_index);
+                nodes_stack.push_back(node.GetLeftChildIndex(node_index));
+            }
+            break;
+
+        default:
+            META_UNEXPECTED_ARG(node_containment);
+        }
+    }
+
+    std::sort(visible_instance_indices.begin(), visible_instance_indices.end());
+    return static_cast<Data::Size>(visible_instance_indices.size());
+}
+
+std::optional<BoundingVolumeHierarchy::RayHit> BoundingVolumeHierarchy::QueryRay(const Camera::Ray& ray, float max_distance) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_FALSE_DESCR(IsRefitRequired(), "hierarchy should be refitted after update of instance bounds before query");
+    if (m_nodes.empty())
+        return std::nullopt;
+
+    const hlslpp::float3 ray_inv_direction = hlslpp::float3(1.F) / ray.direction;
+    if (!IntersectRayBounds(ray.origin, ray_inv_direction, m_nodes.front().bounds, max_distance))
+        return std::nullopt;
+
+    std::optional<RayHit> closest_hit;
+    float closest_distance = max_distance;
+
+    Indices nodes_stack;
+    nodes_stack.reserve(g_query_stack_size);
+    nodes_stack.push_back(0U);
+
+    while (!nodes_stack.empty())
+    {
+        const Data::Index node_index = nodes_stack.back();
+        nodes_stack.pop_back();
+
+        const Node& node = m_nodes[node_index];
+        if (node.IsLeaf())
+        {
+            for (Data::Index instance_offset = node.first_instance; instance_offset < node.first_instance + node.instance_count; ++instance_offset)
+            {
+                const Data::Index instance_index = m_instance_indices[instance_offset];
+                if (const std::optional<float> hit_distance = IntersectRayBounds(ray.origin, ray_inv_direction, m_instance_bounds[instance_index], closest_distance);
+                    hit_distance && (!closest_hit || *hit_distance < closest_distance))
+                {
+                    closest_distance = *hit_distance;
+                    closest_hit = RayHit{ instance_index, closest_distance };
+                }
+            }
+            continue;
+        }
+
+        // Nearest child node is pushed to the stack last to be traversed first,
+        // so that farther nodes are more likely to be skipped by the closest hit distance
+        const Data::Index left_node_index  = node.GetLeftChildIndex(node_index);
+        const Data::Index right_node_index = node.right_child_index;
+        const std::optional<float> left_distance  = IntersectRayBounds(ray.origin, ray_inv_direction, m_nodes[left_node_index].bounds,  closest_distance);
+        const std::optional<float> right_distance = IntersectRayBounds(ray.origin, ray_inv_direction, m_nodes[right_node_index].bounds, closest_distance);
+        if (left_distance && right_distance)
+        {
+            const bool is_left_nearest = *left_distance <= *right_distance;
+            nodes_stack.push_back(is_left_nearest ? right_node_index : left_node_index);
+            nodes_stack.push_back(is_left_nearest ? left_node_index : right_node_index);
+        }
+        else if (left_distance)
+        {
+            nodes_stack.push_back(left_node_index);
+        }
+        else if (right_distance)
+        {
+            nodes_stack.push_back(right_node_index);
+        }
+    }
+
+    return closest_hit;
+}
+
+std::optional<BoundingVolumeHierarchy::RayHit> BoundingVolumeHierarchy::QueryScreenRay(const Camera& camera, const Data::Point2I& screen_pos) const
+{
+    META_FUNCTION_TASK();
+    return QueryRay(camera.GetScreenRay(screen_pos));
+}
+
+} // namespace Methane::Graphics
@@ -24,6 +24,7 @@ Camera helper implementation allowing to generate view and projection matrices.
 #pragma once
 
 #include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/Frustum.h>
 
 #include <hlsl++_vector_float.h>
 #include <hlsl++_matrix_float.h>
@@ -55,6 +56,12 @@ public:
         float fov_deg;
     };
 
+    struct Ray
+    {
+        hlslpp::float3 origin;
+        hlslpp::float3 direction; // normalized
+    };
+
     explicit Camera() noexcept;
 
     void Resize(const Data::FloatSize& screen_size);
@@ -79,9 +86,15 @@ public:
     const hlslpp::float4x4& GetProjMatrix() const;
     const hlslpp::float4x4& GetViewProjMatrix() const noexcept;
 
+    // World space frustum is cached along with view-projection matrix and updated on its change
+    const Frustum&          GetFrustum() const noexcept;
+
     hlslpp::float2 TransformScreenToProj(const Data::Point2I& screen_pos) const noexcept;
     hlslpp::float3 TransformScreenToView(const Data::Point2I& screen_pos) const noexcept;
     hlslpp::float3 TransformScreenToWorld(const Data::Point2I& screen_pos) const noexcept;
+
+    // World space ray from the near plane point under screen position through the far plane, used for objects picking
+    Ray            GetScreenRay(const Data::Point2I& screen_pos) const noexcept;
     hlslpp::float3 TransformWorldToView(const hlslpp::float3& world_pos) const noexcept { return TransformWorldToView(world_pos, m_current_orientation); }
     hlslpp::float3 TransformViewToWorld(const hlslpp::float3& view_pos)  const noexcept { return TransformViewToWorld(view_pos,  m_current_orientation); }
     hlslpp::float4 TransformWorldToView(const hlslpp::float4& world_pos) const noexcept { return TransformWorldToView(world_pos, m_current_orientation); }
@@ -118,8 +131,10 @@ private:
     mutable hlslpp::float4x4 m_current_view_matrix;
     mutable hlslpp::float4x4 m_current_proj_matrix;
     mutable hlslpp::float4x4 m_current_view_proj_matrix;
+    mutable Frustum          m_current_frustum;
     mutable bool             m_is_current_view_matrix_dirty = true;
     mutable bool             m_is_current_proj_matrix_dirty = true;
+    mutable bool             m_is_current_view_proj_matrix_dirty = true;
 };
 
 } // namespace Methane::Graphics
@@ -0,0 +1,121 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Frustum.h
+View frustum planes in world space with visibility tests of bounding volumes
+and batch culling of bounding spheres and boxes arrays.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+#include <array>
+#include <vector>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+class Frustum
+{
+public:
+    enum class Plane : uint32_t
+    {
+        Left = 0U,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+
+        Count
+    };
+
+    enum class Containment : uint32_t
+    {
+        Outside = 0U,
+        Intersects,
+        Inside
+    };
+
+    using Planes = std::array<hlslpp::float4, static_cast<size_t>(Plane::Count)>;
+    using VisibleIndices = std::vector<Data::Index>;
+
+    // Bounding volumes are stored as structure of arrays to be tested with SIMD instructions by 4 objects at once
+    struct BoundingSpheres
+    {
+        std::vector<float> center_x;
+        std::vector<float> center_y;
+        std::vector<float> center_z;
+        std::vector<float> radius;
+
+        void Resize(Data::Size count);
+        void Set(Data::Index index, const hlslpp::float3& center, float sphere_radius) noexcept;
+        [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(radius.size()); }
+    };
+
+    struct BoundingBoxes
+    {
+        std::vector<float> min_x;
+        std::vector<float> min_y;
+        std::vector<float> min_z;
+        std::vector<float> max_x;
+        std::vector<float> max_y;
+        std::vector<float> max_z;
+
+        void Resize(Data::Size count);
+        void Set(Data::Index index, const hlslpp::float3& min, const hlslpp::float3& max) noexcept;
+        [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(min_x.size()); }
+    };
+
+    Frustum() = default;
+
+    // Normalized planes are extracted from view-projection matrix with depth clipped to [0, 1] range
+    // and row-vector multiplication convention: clip_pos = mul(world_pos, view_proj_matrix)
+    explicit Frustum(const hlslpp::float4x4& view_proj_matrix) noexcept;
+
+    [[nodiscard]] const Planes&         GetPlanes() const noexcept               { return m_planes; }
+    [[nodiscard]] const hlslpp::float4& GetPlane(Plane plane) const noexcept { return m_planes[static_cast<size_t>(plane)]; }
+
+    [[nodiscard]] bool IsPointVisible(const hlslpp::float3& point) const noexcept;
+    [[nodiscard]] bool IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept;
+    [[nodiscard]] bool IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept;
+
+    // Box is inside when all its corners are inside of frustum, which allows to skip testing of its contents in hierarchical culling
+    [[nodiscard]] Containment GetBoxContainment(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept;
+
+    // Indices of visible bounding volumes are written to the compacted list in ascending order and their count is returned;
+    // volumes are tested conservatively: some volumes intersecting frustum planes outside of frustum may be reported as visible.
+    // Batch is split in blocks tested in parallel with executor when it is provided, or sequentially otherwise.
+    Data::Size CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr = nullptr) const;
+    Data::Size CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr = nullptr) const;
+
+private:
+    Planes m_planes{ };
+};
+
+} // namespace Methane::Graphics
@@ -121,6 +121,7 @@ const hlslpp::float4x4& Camera::GetViewMatrix() const noexcept
 
     m_current_view_matrix = CreateViewMatrix(m_current_orientation);
     m_is_current_view_matrix_dirty = false;
+    m_is_current_view_proj_matrix_dirty = true;
     return m_current_view_matrix;
 }
 
@@ -132,19 +133,33 @@ const hlslpp::float4x4& Camera::GetProjMatrix() const
 
     m_current_proj_matrix = CreateProjMatrix();
     m_is_current_proj_matrix_dirty = false;
+    m_is_current_view_proj_matrix_dirty = true;
     return m_current_proj_matrix;
 }
 
 const hlslpp::float4x4& Camera::GetViewProjMatrix() const noexcept
 {
     META_FUNCTION_TASK();
-    if (!m_is_current_view_matrix_dirty && !m_is_current_proj_matrix_dirty)
+    // View and projection matrices are updated first to mark view-projection matrix dirty on their change,
+    // even when they were updated separately before
+    const hlslpp::float4x4& view_matrix = GetViewMatrix();
+    const hlslpp::float4x4& proj_matrix = GetProjMatrix();
+    if (!m_is_current_view_proj_matrix_dirty)
         return m_current_view_proj_matrix;
 
-    m_current_view_proj_matrix = hlslpp::mul(GetViewMatrix(), GetProjMatrix());
+    m_current_view_proj_matrix = hlslpp::mul(view_matrix, proj_matrix);
+    m_current_frustum = Frustum(m_current_view_proj_matrix);
+    m_is_current_view_proj_matrix_dirty = false;
     return m_current_view_proj_matrix;
 }
 
+const Frustum& Camera::GetFrustum() const noexcept
+{
+    META_FUNCTION_TASK();
+    GetViewProjMatrix();
+    return m_current_frustum;
+}
+
 hlslpp::float2 Camera::TransformScreenToProj(const Data::Point2I& screen_pos) const noexcept
 {
     META_FUNCTION_TASK();
@@ -164,6 +179,17 @@ hlslpp::float3 Camera::TransformScreenToWorld(const Data::Point2I& screen_pos) c
     return TransformViewToWorld(TransformScreenToView(screen_pos));
 }
 
+Camera::Ray Camera::GetScreenRay(const Data::Point2I& screen_pos) const noexcept
+{
+    META_FUNCTION_TASK();
+    const hlslpp::float2   proj_pos      = TransformScreenToProj(screen_pos);
+    const hlslpp::float4x4 inv_view_proj = hlslpp::inverse(GetViewProjMatrix());
+    const hlslpp::float4   near_pos      = hlslpp::mul(hlslpp::float4(proj_pos, 0.F, 1.F), inv_view_proj);
+    const hlslpp::float4   far_pos       = hlslpp::mul(hlslpp::float4(proj_pos, 1.F, 1.F), inv_view_proj);
+    const hlslpp::float3   origin        = near_pos.xyz / near_pos.w;
+    return Ray{ origin, hlslpp::normalize(far_pos.xyz / far_pos.w - origin) };
+}
+
 hlslpp::float4 Camera::TransformWorldToView(const hlslpp::float4& world_pos, const Orientation& orientation) const noexcept
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,329 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Frustum.cpp
+View frustum planes in world space with visibility tests of bounding volumes
+and batch culling of bounding spheres and boxes arrays.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Frustum.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+static constexpr Data::Size g_simd_width         = 4U;
+static constexpr Data::Size g_culling_block_size = 4096U; // objects count culled by one parallel task
+
+// Frustum plane components broadcast to all SIMD lanes to test 4 bounding volumes at once
+struct FrustumSimdPlanes
+{
+    std::array<hlslpp::float4, std::tuple_size_v<Frustum::Planes>> normal_x;
+    std::array<hlslpp::float4, std::tuple_size_v<Frustum::Planes>> normal_y;
+    std::array<hlslpp::float4, std::tuple_size_v<Frustum::Planes>> normal_z;
+    std::array<hlslpp::float4, std::tuple_size_v<Frustum::Planes>> distance;
+
+    explicit FrustumSimdPlanes(const Frustum::Planes& planes) noexcept
+    {
+        for (size_t plane_index = 0; plane_index < planes.size(); ++plane_index)
+        {
+            const hlslpp::float4& plane = planes[plane_index];
+            normal_x[plane_index] = plane.xxxx;
+            normal_y[plane_index] = plane.yyyy;
+            normal_z[plane_index] = plane.zzzz;
+            distance[plane_index] = plane.wwww;
+        }
+    }
+};
+
+[[nodiscard]] static hlslpp::float4 LoadSimd(const std::vector<float>& values, Data::Index index) noexcept
+{
+    return hlslpp::float4(values[index], values[index + 1U], values[index + 2U], values[index + 3U]);
+}
+
+// Returns minimum signed distance from sphere centers to frustum planes reduced by sphere radiuses,
+// so that all 4 spheres are tested for intersection with the frustum by a single comparison with zero
+[[nodiscard]] static hlslpp::float4 GetSpheresDistance(const FrustumSimdPlanes& planes, const Frustum::BoundingSpheres& spheres, Data::Index index) noexcept
+{
+    const hlslpp::float4 center_x = LoadSimd(spheres.center_x, index);
+    const hlslpp::float4 center_y = LoadSimd(spheres.center_y, index);
+    const hlslpp::float4 center_z = LoadSimd(spheres.center_z, index);
+
+    hlslpp::float4 min_distance = planes.normal_x[0] * center_x + planes.normal_y[0] * center_y + planes.normal_z[0] * center_z + planes.distance[0];
+    for (size_t plane_index = 1; plane_index < planes.distance.size(); ++plane_index)
+    {
+        min_distance = hlslpp::min(min_distance, planes.normal_x[plane_index] * center_x +
+                                                 planes.normal_y[plane_index] * center_y +
+                                                 planes.normal_z[plane_index] * center_z +
+                                                 planes.distance[plane_index]);
+    }
+    return min_distance + LoadSimd(spheres.radius, index);
+}
+
+// Returns minimum signed distance from the box corners farthest along plane normals (positive vertices)
+// computed with box centers and extents: dot(n, center) + dot(abs(n), extent) + d
+[[nodiscard]] static hlslpp::float4 GetBoxesDistance(const FrustumSimdPlanes& planes, const Frustum::BoundingBoxes& boxes, Data::Index index) noexcept
+{
+    const hlslpp::float4 min_x = LoadSimd(boxes.min_x, index);
+    const hlslpp::float4 min_y = LoadSimd(boxes.min_y, index);
+    const hlslpp::float4 min_z = LoadSimd(boxes.min_z, index);
+    const hlslpp::float4 max_x = LoadSimd(boxes.max_x, index);
+    const hlslpp::float4 max_y = LoadSimd(boxes.max_y, index);
+    const hlslpp::float4 max_z = LoadSimd(boxes.max_z, index);
+
+    const hlslpp::float4 center_x = (min_x + max_x) * 0.5F;
+    const hlslpp::float4 center_y = (min_y + max_y) * 0.5F;
+    const hlslpp::float4 center_z = (min_z + max_z) * 0.5F;
+    const hlslpp::float4 extent_x = (max_x - min_x) * 0.5F;
+    const hlslpp::float4 extent_y = (max_y - min_y) * 0.5F;
+    const hlslpp::float4 extent_z = (max_z - min_z) * 0.5F;
+
+    hlslpp::float4 min_distance(std::numeric_limits<float>::max());
+    for (size_t plane_index = 0; plane_index < planes.distance.size(); ++plane_index)
+    {
+        min_distance = hlslpp::min(min_distance, planes.normal_x[plane_index] * center_x + hlslpp::abs(planes.normal_x[plane_index]) * extent_x +
+                                                 planes.normal_y[plane_index] * center_y + hlslpp::abs(planes.normal_y[plane_index]) * extent_y +
+                                                 planes.normal_z[plane_index] * center_z + hlslpp::abs(planes.normal_z[plane_index]) * extent_z +
+                                                 planes.distance[plane_index]);
+    }
+    return min_distance;
+}
+
+// Culls objects in blocks writing visible indices of each block to the beginning of its own range of the output list,
+// which is compacted afterwards, so that parallel tasks do not need any synchronization
+template<typename GetDistanceFuncType, typename IsVisibleFuncType>
+static Data::Size CullObjects(Data::Size objects_count, Frustum::VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr,
+                              const GetDistanceFuncType& get_simd_distance, const IsVisibleFuncType& is_visible)
+{
+    META_FUNCTION_TASK();
+    visible_indices.resize(objects_count);
+    if (!objects_count)
+        return 0U;
+
+    const Data::Size blocks_count = Data::DivCeil(objects_count, g_culling_block_size);
+    std::vector<Data::Size> visible_count_per_block(blocks_count, 0U);
+
+    const auto cull_block = [objects_count, &visible_indices, &visible_count_per_block, &get_simd_distance, &is_visible](Data::Index block_index)
+    {
+        const Data::Index begin_index = block_index * g_culling_block_size;
+        const Data::Index end_index   = std::min(begin_index + g_culling_block_size, objects_count);
+        const Data::Index simd_end_index = begin_index + (end_index - begin_index) / g_simd_width * g_simd_width;
+        Data::Index* block_visible_indices = visible_indices.data() + begin_index;
+        Data::Size   visible_count = 0U;
+
+        std::array<float, g_simd_width> distances{};
+        Data::Index index = begin_index;
+        for (; index < simd_end_index; index += g_simd_width)
+        {
+            hlslpp::store(get_simd_distance(index), distances.data());
+
+            // Index is written unconditionally and kept only when visible to avoid branch mispredictions
+            for (Data::Index lane = 0U; lane < g_simd_width; ++lane)
+            {
+                block_visible_indices[visible_count] = index + lane;
+                visible_count += static_cast<Data::Size>(distances[lane] >= 0.F);
+            }
+        }
+        for (; index < end_index; ++index)
+        {
+            block_visible_indices[visible_count] = index;
+            visible_count += static_cast<Data::Size>(is_visible(index));
+        }
+        visible_count_per_block[block_index] = visible_count;
+    };
+
+    if (parallel_executor_ptr && blocks_count > 1U)
+    {
+        tf::Taskflow task_flow;
+        task_flow.for_each_index(Data::Index(0), blocks_count, Data::Index(1), cull_block);
+        parallel_executor_ptr->run(task_flow).get();
+    }
+    else
+    {
+        for (Data::Index block_index = 0U; block_index < blocks_count; ++block_index)
+            cull_block(block_index);
+    }
+
+    Data::Size visible_count = visible_count_per_block[0];
+    for (Data::Index block_index = 1U; block_index < blocks_count; ++block_index)
+    {
+        const auto block_begin_it = visible_indices.begin() + block_index * g_culling_block_size;
+        std::copy(block_begin_it, block_begin_it + visible_count_per_block[block_index], visible_indices.begin() + visible_count);
+        visible_count += visible_count_per_block[block_index];
+    }
+    visible_indices.resize(visible_count);
+    return visible_count;
+}
+
+void Frustum::BoundingSpheres::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    center_x.resize(count);
+    center_y.resize(count);
+    center_z.resize(count);
+    radius.resize(count);
+}
+
+void Frustum::BoundingSpheres::Set(Data::Index index, const hlslpp::float3& center, float sphere_radius) noexcept
+{
+    center_x[index] = center.x;
+    center_y[index] = center.y;
+    center_z[index] = center.z;
+    radius[index]   = sphere_radius;
+}
+
+void Frustum::BoundingBoxes::Resize(Data::Size count)
+{
+    META_FUNCTION_TASK();
+    min_x.resize(count);
+    min_y.resize(count);
+    min_z.resize(count);
+    max_x.resize(count);
+    max_y.resize(count);
+    max_z.resize(count);
+}
+
+void Frustum::BoundingBoxes::Set(Data::Index index, const hlslpp::float3& min, const hlslpp::float3& max) noexcept
+{
+    min_x[index] = min.x;
+    min_y[index] = min.y;
+    min_z[index] = min.z;
+    max_x[index] = max.x;
+    max_y[index] = max.y;
+    max_z[index] = max.z;
+}
+
+Frustum::Frustum(const hlslpp::float4x4& view_proj_matrix) noexcept
+{
+    META_FUNCTION_TASK();
+    // Columns of view-projection matrix are multiplied by world position to get clip-space coordinates
+    const hlslpp::float4 column_x = hlslpp::mul(view_proj_matrix, hlslpp::float4(1.F, 0.F, 0.F, 0.F));
+    const hlslpp::float4 column_y = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 1.F, 0.F, 0.F));
+    const hlslpp::float4 column_z = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 0.F, 1.F, 0.F));
+    const hlslpp::float4 column_w = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 0.F, 0.F, 1.F));
+
+    m_planes = {
+        column_w + column_x, // Left:   -w <= x
+        column_w - column_x, // Right:   x <= w
+        column_w + column_y, // Bottom: -w <= y
+        column_w - column_y, // Top:     y <= w
+        column_z,            // Near:    0 <= z
+        column_w - column_z, // Far:     z <= w
+    };
+
+    // Planes are normalized to get signed distances to points in world space units
+    for (hlslpp::float4& plane : m_planes)
+    {
+        const float normal_length = hlslpp::length(plane.xyz);
+        if (normal_length > 0.F)
+            plane /= normal_length;
+    }
+}
+
+bool Frustum::IsPointVisible(const hlslpp::float3& point) const noexcept
+{
+    return IsSphereVisible(point, 0.F);
+}
+
+bool Frustum::IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept
+{
+    return std::all_of(m_planes.begin(), m_planes.end(),
+                       [&center, radius](const hlslpp::float4& plane)
+                       { return static_cast<float>(hlslpp::dot(plane.xyz, center)) + static_cast<float>(plane.w) >= -radius; });
+}
+
+bool Frustum::IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept
+{
+    const hlslpp::float3 center = (min + max) * 0.5F;
+    const hlslpp::float3 extent = (max - min) * 0.5F;
+    return std::all_of(m_planes.begin(), m_planes.end(),
+                       [&center, &extent](const hlslpp::float4& plane)
+                       {
+                           return static_cast<float>(hlslpp::dot(plane.xyz, center)) +
+                                  static_cast<float>(hlslpp::dot(hlslpp::abs(plane.xyz), extent)) +
+                                  static_cast<float>(plane.w) >= 0.F;
+                       });
+}
+
+Frustum::Containment Frustum::GetBoxContainment(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept
+{
+    const hlslpp::float3 center = (min + max) * 0.5F;
+    const hlslpp::float3 extent = (max - min) * 0.5F;
+    Containment containment = Containment::Inside;
+    for (const hlslpp::float4& plane : m_planes)
+    {
+        const float center_distance = static_cast<float>(hlslpp::dot(plane.xyz, center)) + static_cast<float>(plane.w);
+        const float extent_distance = hlslpp::dot(hlslpp::abs(plane.xyz), extent);
+        if (center_distance + extent_distance < 0.F)
+            return Containment::Outside;
+        if (center_distance - extent_distance < 0.F)
+            containment = Containment::Intersects;
+    }
+    return containment;
+}
+
+Data::Size Frustum::CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size spheres_count = spheres.GetCount();
+    META_CHECK_ARG_EQUAL_DESCR(spheres.center_x.size(), spheres_count, "bounding spheres arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(spheres.center_y.size(), spheres_count, "bounding spheres arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(spheres.center_z.size(), spheres_count, "bounding spheres arrays should have equal size");
+
+    const FrustumSimdPlanes simd_planes(m_planes);
+    return CullObjects(spheres_count, visible_indices, parallel_executor_ptr,
+        [&simd_planes, &spheres](Data::Index index)
+        { return GetSpheresDistance(simd_planes, spheres, index); },
+        [this, &spheres](Data::Index index)
+        {
+            return IsSphereVisible(hlslpp::float3(spheres.center_x[index], spheres.center_y[index], spheres.center_z[index]),
+                                   spheres.radius[index]);
+        });
+}
+
+Data::Size Frustum::CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size boxes_count = boxes.GetCount();
+    META_CHECK_ARG_EQUAL_DESCR(boxes.min_y.size(), boxes_count, "bounding boxes arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(boxes.min_z.size(), boxes_count, "bounding boxes arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(boxes.max_x.size(), boxes_count, "bounding boxes arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(boxes.max_y.size(), boxes_count, "bounding boxes arrays should have equal size");
+    META_CHECK_ARG_EQUAL_DESCR(boxes.max_z.size(), boxes_count, "bounding boxes arrays should have equal size");
+
+    const FrustumSimdPlanes simd_planes(m_planes);
+    return CullObjects(boxes_count, visible_indices, parallel_executor_ptr,
+        [&simd_planes, &boxes](Data::Index index)
+        { return GetBoxesDistance(simd_planes, boxes, index); },
+        [this, &boxes](Data::Index index)
+        {
+            return IsBoxVisible(hlslpp::float3(boxes.min_x[index], boxes.min_y[index], boxes.min_z[index]),
+                                hlslpp::float3(boxes.max_x[index], boxes.max_y[index], boxes.max_z[index]));
+        });
+}
+
+} // namespace Methane::Graphics
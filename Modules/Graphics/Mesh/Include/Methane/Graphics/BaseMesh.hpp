@@ -24,9 +24,15 @@ Base mesh implementation with customizable vertex types
 #pragma once
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/MeshVertexTraits.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
 namespace Methane::Graphics
 {
 
@@ -35,13 +41,19 @@ class BaseMesh
     : public Mesh
 {
 public:
-    using Vertices = std::vector<VType>;
+    using Vertices     = std::vector<VType>;
+    using VertexTraits = MeshVertexTraits<VType>;
 
     BaseMesh(Type type, const VertexLayout& vertex_layout)
         : Mesh(type, vertex_layout)
     {
         META_FUNCTION_TASK();
+        META_CHECK_ARG_NAME_DESCR("vertex_layout", !vertex_layout.IsCompact(), "mesh vertices are generated in full precision, use CompactMesh to encode them to compact layout");
         META_CHECK_ARG_EQUAL_DESCR(GetVertexSize(), sizeof(VType), "size of vertex structure differs from vertex size calculated by vertex layout");
+        if constexpr (VertexTraits::is_reflected)
+        {
+            META_CHECK_ARG_NAME_DESCR("vertex_layout", vertex_layout == VertexTraits::GetLayout(), "vertex layout differs from the order of fields in vertex structure");
+        }
     }
 
     [[nodiscard]] const Vertices&   GetVertices() const noexcept             { return m_vertices; }
@@ -49,114 +61,321 @@ public:
     [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept final { return static_cast<Data::Size>(m_vertices.size() * GetVertexSize()); }
     [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept final     { return reinterpret_cast<Data::ConstRawPtr>(m_vertices.data()); } // NOSONAR
 
-protected:
-    template<typename FType>
-    [[nodiscard]] FType& GetVertexField(VType& vertex, VertexField field) noexcept
+    // Optional post-process stage, which reorders triangles for post-transform vertex cache locality and, optionally, for reduced overdraw,
+    // then reorders vertices in order of their first use for vertex fetch locality; mesh geometry and triangles winding are not changed
+    void Optimize(const OptimizationSettings& settings = {})
     {
         META_FUNCTION_TASK();
-        const int32_t field_offset = GetVertexFieldOffset(field);
-        return *reinterpret_cast<FType*>(reinterpret_cast<std::byte*>(&vertex) + field_offset); // NOSONAR
+        OptimizeRange(0U, GetIndexCount(), 0U, GetVertexCount(), 0U, settings);
+    }
+
+    // Radius of the sphere around mesh bounding box, which is the unit of mesh simplification error
+    [[nodiscard]] float GetBoundingRadius() const noexcept
+    {
+        if (m_vertices.empty())
+            return 0.F;
+
+        HlslPosition min_position = GetVertexField<VertexField::Position>(m_vertices.front()).AsHlsl();
+        HlslPosition max_position = min_position;
+        for (const VType& vertex : m_vertices)
+        {
+            const HlslPosition position = GetVertexField<VertexField::Position>(vertex).AsHlsl();
+            min_position = hlslpp::min(min_position, position);
+            max_position = hlslpp::max(max_position, position);
+        }
+        return static_cast<float>(hlslpp::length(max_position - min_position)) / 2.F;
     }
 
-    template<typename FType>
-    [[nodiscard]] const FType& GetVertexField(const VType& vertex, VertexField field) noexcept
+    // Simplified mesh indices reference a subset of mesh vertices, so they can be drawn with the same vertex buffer;
+    // result error of simplification is relative to mesh bounding radius and does not exceed max_error
+    [[nodiscard]] Indices GetSimplifiedIndices(Data::Size target_index_count, float max_error, float& result_error) const
     {
         META_FUNCTION_TASK();
-        const int32_t field_offset = GetVertexFieldOffset(field);
-        return *reinterpret_cast<const FType*>(reinterpret_cast<const std::byte*>(&vertex) + field_offset); // NOSONAR
+        return Mesh::GetSimplifiedIndices(GetIndices(), GetPositions(0U, GetVertexCount()), target_index_count, max_error, result_error);
     }
 
-    using EdgeMidpoints = std::map<Mesh::Edge, Mesh::Index>;
-    Index AddEdgeMidpoint(const Edge& edge, EdgeMidpoints& edge_midpoints)
+    // Recomputes vertex normals as area-weighted averages of adjacent triangle normals, optionally in parallel;
+    // normals are gathered for each vertex from adjacent triangles in order of triangle indices,
+    // which makes the result identical for sequential and parallel execution
+    void ComputeAverageNormals(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
-        if (const auto edge_midpoint_it = edge_midpoints.find(edge);
-            edge_midpoint_it != edge_midpoints.end())
-            return edge_midpoint_it->second;
+        CheckLayoutHasVertexField(VertexField::Normal);
+        META_CHECK_ARG_DESCR(BaseMesh::GetIndexCount(), BaseMesh::GetIndexCount() % 3 == 0,
+                             "mesh indices count should be a multiple of three representing triangles list");
 
-        const VType& v1 = m_vertices[edge.first_index];
-        const VType& v2 = m_vertices[edge.second_index];
-        VType  v_mid{ };
+        const Data::Size triangles_count = BaseMesh::GetIndexCount() / 3;
+        const Data::Size vertex_count    = GetVertexCount();
+
+        // NOTE: weight average by contributing face area
+        std::vector<HlslNormal> face_normals(triangles_count);
+        ForEachIndex(parallel_executor_ptr, triangles_count,
+            [this, &face_normals](Data::Index triangle_index)
+            {
+                const Mesh::HlslPosition p1 = GetVertexField<VertexField::Position>(m_vertices[GetIndex(triangle_index * 3)]).AsHlsl();
+                const Mesh::HlslPosition p2 = GetVertexField<VertexField::Position>(m_vertices[GetIndex(triangle_index * 3 + 1)]).AsHlsl();
+                const Mesh::HlslPosition p3 = GetVertexField<VertexField::Position>(m_vertices[GetIndex(triangle_index * 3 + 2)]).AsHlsl();
+                face_normals[triangle_index] = hlslpp::cross(p2 - p1, p3 - p1);
+            });
+
+        // Vertex to adjacent triangles map in compressed sparse row format
+        std::vector<std::atomic<Data::Index>> vertex_triangle_counters(vertex_count);
+        ForEachIndex(parallel_executor_ptr, BaseMesh::GetIndexCount(),
+            [this, &vertex_triangle_counters](Data::Index index)
+            {
+                vertex_triangle_counters[GetIndex(index)].fetch_add(1U, std::memory_order_relaxed);
+            });
+
+        std::vector<Data::Index> vertex_triangle_offsets(vertex_count + 1U, 0U);
+        for (Data::Index vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+        {
+            vertex_triangle_offsets[vertex_index + 1U] = vertex_triangle_offsets[vertex_index] + vertex_triangle_counters[vertex_index].load(std::memory_order_relaxed);
+            vertex_triangle_counters[vertex_index].store(0U, std::memory_order_relaxed);
+        }
+
+        std::vector<Data::Index> vertex_triangles(BaseMesh::GetIndexCount());
+        ForEachIndex(parallel_executor_ptr, BaseMesh::GetIndexCount(),
+            [this, &vertex_triangle_counters, &vertex_triangle_offsets, &vertex_triangles](Data::Index index)
+            {
+                const Index vertex_index = GetIndex(index);
+                const Data::Index triangle_position = vertex_triangle_offsets[vertex_index] + vertex_triangle_counters[vertex_index].fetch_add(1U, std::memory_order_relaxed);
+                vertex_triangles[triangle_position] = index / 3;
+            });
+
+        ForEachIndex(parallel_executor_ptr, vertex_count,
+            [this, &face_normals, &vertex_triangle_offsets, &vertex_triangles](Data::Index vertex_index)
+            {
+                const auto triangles_begin = vertex_triangles.begin() + vertex_triangle_offsets[vertex_index];
+                const auto triangles_end   = vertex_triangles.begin() + vertex_triangle_offsets[vertex_index + 1U];
+                std::sort(triangles_begin, triangles_end);
+
+                HlslNormal vertex_normal(0.F, 0.F, 0.F);
+                for (auto triangle_it = triangles_begin; triangle_it != triangles_end; ++triangle_it)
+                {
+                    vertex_normal += face_normals[*triangle_it];
+                }
+                GetVertexField<VertexField::Normal>(m_vertices[vertex_index]) = Mesh::Normal(hlslpp::normalize(vertex_normal));
+            });
+    }
 
-        const HlslPosition v1_position = GetVertexField<Mesh::Position>(v1, Mesh::VertexField::Position).AsHlsl();
-        const HlslPosition v2_position = GetVertexField<Mesh::Position>(v2, Mesh::VertexField::Position).AsHlsl();
-        Mesh::Position& v_mid_position = GetVertexField<Mesh::Position>(v_mid, Mesh::VertexField::Position);
+protected:
+    using Mesh::HasVertexField;
+
+    // Field presence is a compile-time constant for reflected vertex structures, so branches on it are eliminated
+    template<VertexField field>
+    [[nodiscard]] bool HasVertexField() const noexcept
+    {
+        if constexpr (VertexTraits::is_reflected)
+            return VertexTraits::template has_field<field>;
+        else
+            return Mesh::HasVertexField(field);
+    }
+
+    // Fields of reflected vertex structures are accessed directly by name,
+    // other vertex structures use field offsets calculated from vertex layout at runtime
+    template<VertexField field>
+    [[nodiscard]] MeshVertexFieldTypeT<field>& GetVertexField(VType& vertex) const noexcept
+    {
+        if constexpr (VertexTraits::is_reflected && VertexTraits::template has_field<field>)
+            return VertexTraits::template GetField<field>(vertex);
+        else
+            return *reinterpret_cast<MeshVertexFieldTypeT<field>*>(reinterpret_cast<std::byte*>(&vertex) + GetVertexFieldOffset(field)); // NOSONAR
+    }
+
+    template<VertexField field>
+    [[nodiscard]] const MeshVertexFieldTypeT<field>& GetVertexField(const VType& vertex) const noexcept
+    {
+        if constexpr (VertexTraits::is_reflected && VertexTraits::template has_field<field>)
+            return VertexTraits::template GetField<field>(vertex);
+        else
+            return *reinterpret_cast<const MeshVertexFieldTypeT<field>*>(reinterpret_cast<const std::byte*>(&vertex) + GetVertexFieldOffset(field)); // NOSONAR
+    }
+
+    // Processes index range in parallel with executor when it is provided, or sequentially otherwise
+    template<typename IndexFuncType>
+    static void ForEachIndex(tf::Executor* parallel_executor_ptr, Data::Size count, const IndexFuncType& index_func)
+    {
+        if (!parallel_executor_ptr)
+        {
+            for (Data::Index index = 0; index < count; ++index)
+                index_func(index);
+            return;
+        }
+
+        tf::Taskflow task_flow;
+        task_flow.for_each_index(Data::Index(0), count, Data::Index(1), index_func);
+        parallel_executor_ptr->run(task_flow).get();
+    }
+
+    [[nodiscard]] VType GetEdgeMidpoint(const VType& v1, const VType& v2) const noexcept
+    {
+        VType v_mid{ };
+
+        const HlslPosition v1_position = GetVertexField<VertexField::Position>(v1).AsHlsl();
+        const HlslPosition v2_position = GetVertexField<VertexField::Position>(v2).AsHlsl();
+        Mesh::Position& v_mid_position = GetVertexField<VertexField::Position>(v_mid);
         v_mid_position = Mesh::Position((v1_position + v2_position) / 2.F);
 
-        if (Mesh::HasVertexField(Mesh::VertexField::Normal))
+        if (HasVertexField<VertexField::Normal>())
         {
-            const HlslNormal v1_normal = GetVertexField<Mesh::Normal>(v1, Mesh::VertexField::Normal).AsHlsl();
-            const HlslNormal v2_normal = GetVertexField<Mesh::Normal>(v2, Mesh::VertexField::Normal).AsHlsl();
-            Mesh::Normal& v_mid_normal = GetVertexField<Mesh::Normal>(v_mid, Mesh::VertexField::Normal);
+            const HlslNormal v1_normal = GetVertexField<VertexField::Normal>(v1).AsHlsl();
+            const HlslNormal v2_normal = GetVertexField<VertexField::Normal>(v2).AsHlsl();
+            Mesh::Normal& v_mid_normal = GetVertexField<VertexField::Normal>(v_mid);
             v_mid_normal = Mesh::Normal(hlslpp::normalize(v1_normal + v2_normal));
         }
 
-        if (Mesh::HasVertexField(Mesh::VertexField::Color))
+        if (HasVertexField<VertexField::Color>())
         {
-            const HlslColor v1_color = GetVertexField<Mesh::Color>(v1, Mesh::VertexField::Color).AsHlsl();
-            const HlslColor v2_color = GetVertexField<Mesh::Color>(v2, Mesh::VertexField::Color).AsHlsl();
-            Mesh::Color& v_mid_color = GetVertexField<Mesh::Color>(v_mid, Mesh::VertexField::Color);
+            const HlslColor v1_color = GetVertexField<VertexField::Color>(v1).AsHlsl();
+            const HlslColor v2_color = GetVertexField<VertexField::Color>(v2).AsHlsl();
+            Mesh::Color& v_mid_color = GetVertexField<VertexField::Color>(v_mid);
             v_mid_color = Mesh::Color((v1_color + v2_color) / 2.F);
         }
 
-        if (Mesh::HasVertexField(Mesh::VertexField::TexCoord))
+        if (HasVertexField<VertexField::TexCoord>())
         {
-            const HlslTexCoord v1_texcoord = GetVertexField<Mesh::TexCoord>(v1,    Mesh::VertexField::TexCoord).AsHlsl();
-            const HlslTexCoord v2_texcoord = GetVertexField<Mesh::TexCoord>(v2,    Mesh::VertexField::TexCoord).AsHlsl();
-            Mesh::TexCoord& v_mid_texcoord = GetVertexField<Mesh::TexCoord>(v_mid, Mesh::VertexField::TexCoord);
+            const HlslTexCoord v1_texcoord = GetVertexField<VertexField::TexCoord>(v1).AsHlsl();
+            const HlslTexCoord v2_texcoord = GetVertexField<VertexField::TexCoord>(v2).AsHlsl();
+            Mesh::TexCoord& v_mid_texcoord = GetVertexField<VertexField::TexCoord>(v_mid);
             v_mid_texcoord = Mesh::TexCoord((v1_texcoord + v2_texcoord) / 2.F);
         }
 
-        const auto v_mid_index = static_cast<Mesh::Index>(m_vertices.size());
-        edge_midpoints.try_emplace(edge, v_mid_index);
-        m_vertices.push_back(v_mid);
-        return v_mid_index;
+        return v_mid;
     }
 
-    void ComputeAverageNormals()
+    // Splits each triangle into four triangles by edge midpoints shared between adjacent triangles.
+    // Midpoint vertices are numbered in order of the first triangle edge referencing them,
+    // so the result does not depend on parallel execution order.
+    void SubdivideTriangles(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
-        CheckLayoutHasVertexField(VertexField::Normal);
-        META_CHECK_ARG_DESCR(BaseMesh::GetIndexCount(), BaseMesh::GetIndexCount() % 3 == 0,
+        META_CHECK_ARG_DESCR(GetIndexCount(), GetIndexCount() % 3 == 0,
                              "mesh indices count should be a multiple of three representing triangles list");
 
-        for (VType& vertex : m_vertices)
+        const Data::Size triangles_count  = GetIndexCount() / 3;
+        const Data::Size edge_slots_count = GetIndexCount();
+        const auto get_slot_edge = [this](Data::Index edge_slot_index)
+        {
+            // Edge slot is an index of the triangle edge start vertex, which is connected with the next vertex of the triangle
+            const Data::Index next_slot_index = edge_slot_index % 3 == 2 ? edge_slot_index - 2 : edge_slot_index + 1;
+            return Edge(GetIndex(edge_slot_index), GetIndex(next_slot_index));
+        };
+
+        EdgeSlotTable edge_slot_table(edge_slots_count);
+        ForEachIndex(parallel_executor_ptr, edge_slots_count,
+            [&edge_slot_table, &get_slot_edge](Data::Index edge_slot_index)
+            {
+                edge_slot_table.AddEdgeSlot(get_slot_edge(edge_slot_index), edge_slot_index);
+            });
+
+        std::vector<Data::Index> first_edge_slots(edge_slots_count);
+        ForEachIndex(parallel_executor_ptr, edge_slots_count,
+            [&edge_slot_table, &get_slot_edge, &first_edge_slots](Data::Index edge_slot_index)
+            {
+                first_edge_slots[edge_slot_index] = edge_slot_table.GetFirstEdgeSlot(get_slot_edge(edge_slot_index));
+            });
+
+        // Sequential numbering of midpoint vertices is a cheap linear scan, since the first edge slot always precedes others
+        Indices midpoint_indices(edge_slots_count);
+        size_t vertex_count = m_vertices.size();
+        for (Data::Index edge_slot_index = 0; edge_slot_index < edge_slots_count; ++edge_slot_index)
         {
-            Mesh::Normal& vertex_normal = GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-            vertex_normal = { 0.F, 0.F, 0.F };
+            const Data::Index first_edge_slot = first_edge_slots[edge_slot_index];
+            midpoint_indices[edge_slot_index] = first_edge_slot == edge_slot_index
+                                              ? static_cast<Index>(vertex_count++)
+                                              : midpoint_indices[first_edge_slot];
         }
+        META_CHECK_ARG_LESS_DESCR(vertex_count, std::numeric_limits<Index>::max(),
+                                  "subdivided mesh vertex count exceeds maximum index value");
+
+        ResizeVertices(vertex_count);
+        ForEachIndex(parallel_executor_ptr, edge_slots_count,
+            [this, &get_slot_edge, &first_edge_slots, &midpoint_indices](Data::Index edge_slot_index)
+            {
+                if (first_edge_slots[edge_slot_index] != edge_slot_index)
+                    return;
+
+                const Edge edge = get_slot_edge(edge_slot_index);
+                m_vertices[midpoint_indices[edge_slot_index]] = GetEdgeMidpoint(m_vertices[edge.first_index], m_vertices[edge.second_index]);
+            });
+
+        Indices new_indices(GetIndexCount() * 4);
+        ForEachIndex(parallel_executor_ptr, triangles_count,
+            [this, &midpoint_indices, &new_indices](Data::Index triangle_index)
+            {
+                const Data::Index first_index = triangle_index * 3;
+                const Index vi1 = GetIndex(first_index);
+                const Index vi2 = GetIndex(first_index + 1);
+                const Index vi3 = GetIndex(first_index + 2);
+                const Index vm1 = midpoint_indices[first_index];
+                const Index vm2 = midpoint_indices[first_index + 1];
+                const Index vm3 = midpoint_indices[first_index + 2];
+
+                const std::array<Index, 3 * 4> indices{
+                    vi1, vm1, vm3,
+                    vm1, vi2, vm2,
+                    vm1, vm2, vm3,
+                    vm3, vm2, vi3,
+                };
+                std::copy(indices.begin(), indices.end(), new_indices.begin() + triangle_index * indices.size());
+            });
+
+        SwapIndices(new_indices);
+    }
 
-        const Data::Size triangles_count = BaseMesh::GetIndexCount() / 3;
-        for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
+    // Optimizes triangles in index range, which reference vertices in vertex range with index values starting from index base
+    void OptimizeRange(Data::Index index_offset, Data::Size index_count,
+                       Data::Index vertex_offset, Data::Size vertex_count,
+                       Index index_base, const OptimizationSettings& settings)
+    {
+        META_FUNCTION_TASK();
+        Indices range_indices(index_count);
+        for (Data::Index index = 0; index < index_count; ++index)
         {
-            VType& v1 = GetMutableVertex(GetIndex(triangle_index * 3));
-            VType& v2 = GetMutableVertex(GetIndex(triangle_index * 3 + 1));
-            VType& v3 = GetMutableVertex(GetIndex(triangle_index * 3 + 2));
-
-            const Mesh::HlslPosition p1 = GetVertexField<Mesh::Position>(v1, Mesh::VertexField::Position).AsHlsl();
-            const Mesh::HlslPosition p2 = GetVertexField<Mesh::Position>(v2, Mesh::VertexField::Position).AsHlsl();
-            const Mesh::HlslPosition p3 = GetVertexField<Mesh::Position>(v3, Mesh::VertexField::Position).AsHlsl();
+            const Index vertex_index = GetIndex(index_offset + index);
+            META_CHECK_ARG_RANGE_DESCR(vertex_index, index_base, index_base + vertex_count,
+                                       "mesh index at position {} is out of optimized vertex range", index_offset + index);
+            range_indices[index] = vertex_index - index_base;
+        }
 
-            const Mesh::HlslPosition u = p2 - p1;
-            const Mesh::HlslPosition v = p3 - p1;
-            const Mesh::HlslNormal   n = hlslpp::cross(u, v);
+        std::vector<Data::Index> cluster_offsets;
+        range_indices = GetVertexCacheOptimizedIndices(range_indices, vertex_count, settings.vertex_cache_size, cluster_offsets);
 
-            // NOTE: weight average by contributing face area
-            Mesh::Normal& n1 = GetVertexField<Mesh::Normal>(v1, Mesh::VertexField::Normal);
-            n1 = static_cast<Mesh::Normal>(n1.AsHlsl() + n);
+        if (settings.reorder_for_overdraw)
+        {
+            range_indices = GetOverdrawOptimizedIndices(range_indices, GetPositions(vertex_offset, vertex_count), cluster_offsets);
+        }
 
-            Mesh::Normal& n2 = GetVertexField<Mesh::Normal>(v2, Mesh::VertexField::Normal);
-            n2 = static_cast<Mesh::Normal>(n2.AsHlsl() + n);
+        if (settings.reorder_vertex_fetch)
+        {
+            const Indices vertex_remap = GetVertexFetchRemap(range_indices, vertex_count);
+            Vertices range_vertices(vertex_count);
+            for (Data::Index vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+            {
+                range_vertices[vertex_remap[vertex_index]] = m_vertices[vertex_offset + vertex_index];
+            }
+            std::copy(range_vertices.begin(), range_vertices.end(), m_vertices.begin() + vertex_offset);
+
+            for (Index& vertex_index : range_indices)
+            {
+                vertex_index = vertex_remap[vertex_index];
+            }
+        }
 
-            Mesh::Normal& n3 = GetVertexField<Mesh::Normal>(v3, Mesh::VertexField::Normal);
-            n3 = static_cast<Mesh::Normal>(n3.AsHlsl() + n);
+        for (Data::Index index = 0; index < index_count; ++index)
+        {
+            SetIndex(index_offset + index, range_indices[index] + index_base);
         }
+    }
 
-        for (VType& vertex : m_vertices)
+    [[nodiscard]] std::vector<Position> GetPositions(Data::Index vertex_offset, Data::Size vertex_count) const
+    {
+        std::vector<Position> positions(vertex_count);
+        for (Data::Index vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
         {
-            Mesh::Normal& vertex_normal = GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-            vertex_normal = Mesh::Normal(hlslpp::normalize(vertex_normal.AsHlsl()));
+            positions[vertex_index] = GetVertexField<VertexField::Position>(m_vertices[vertex_offset + vertex_index]);
         }
+        return positions;
     }
 
     void ValidateMeshData()
@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/CompactMesh.h
+Mesh with vertices encoded to compact vertex layout: half float positions,
+octahedral normals, 16-bit normalized texture coordinates and 8-bit colors.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <array>
+
+namespace Methane::Graphics
+{
+
+class CompactMesh final
+    : public Mesh
+{
+public:
+    // Half float positions are normalized to [-1, 1] range of mesh bounding box and are decoded in vertex shader
+    // as position = encoded_position.xyz * scale + bias
+    struct PositionEncoding
+    {
+        Position scale{ 1.F, 1.F, 1.F };
+        Position bias{ 0.F, 0.F, 0.F };
+    };
+
+    // Unorm16 texture coordinates out of [0, 1] range are normalized to texture coordinates bounding rectangle of the mesh
+    // and are decoded in vertex shader as texcoord = encoded_texcoord.xy * scale + bias; encoding is identity for [0, 1] range
+    struct TexCoordEncoding
+    {
+        TexCoord scale{ 1.F, 1.F };
+        TexCoord bias{ 0.F, 0.F };
+    };
+
+    using OctahedralNormal = std::array<int16_t, 2>;
+
+    // Vertices of full precision mesh are encoded in the same order, so mesh subsets and indices stay valid;
+    // compact vertex layout has to contain the same fields as the source mesh layout, probably in different order
+    CompactMesh(const Mesh& mesh, const VertexLayout& compact_vertex_layout);
+
+    [[nodiscard]] const PositionEncoding& GetPositionEncoding() const noexcept { return m_position_encoding; }
+    [[nodiscard]] const TexCoordEncoding& GetTexCoordEncoding() const noexcept { return m_texcoord_encoding; }
+
+    // Mesh interface
+    [[nodiscard]] Data::Size        GetVertexCount() const noexcept final    { return m_vertex_count; }
+    [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept final { return static_cast<Data::Size>(m_vertex_data.size()); }
+    [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept final     { return m_vertex_data.data(); }
+
+    // Half float conversion with rounding to nearest even, overflowing values are converted to infinity
+    [[nodiscard]] static uint16_t EncodeHalf(float value) noexcept;
+    [[nodiscard]] static float    DecodeHalf(uint16_t half_value) noexcept;
+
+    // Unit vector is projected on octahedron, which lower half is unfolded over the upper half to the [-1, 1] square
+    [[nodiscard]] static OctahedralNormal EncodeOctahedralNormal(const Normal& normal) noexcept;
+    [[nodiscard]] static Normal           DecodeOctahedralNormal(const OctahedralNormal& encoded_normal) noexcept;
+
+    // Values are clamped to [0, 1] range, so texture coordinates out of this range are normalized with TexCoordEncoding first
+    [[nodiscard]] static uint16_t EncodeUnorm16(float value) noexcept;
+    [[nodiscard]] static uint8_t  EncodeUnorm8(float value) noexcept;
+
+private:
+    [[nodiscard]] static PositionEncoding GetPositionEncoding(const Mesh& mesh, const VertexLayout& compact_vertex_layout);
+    [[nodiscard]] static TexCoordEncoding GetTexCoordEncoding(const Mesh& mesh, const VertexLayout& compact_vertex_layout);
+
+    const Data::Size       m_vertex_count;
+    const PositionEncoding m_position_encoding;
+    const TexCoordEncoding m_texcoord_encoding;
+    Data::Bytes            m_vertex_data;
+};
+
+} // namespace Methane::Graphics
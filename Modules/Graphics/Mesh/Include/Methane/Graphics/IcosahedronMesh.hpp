@@ -37,14 +37,50 @@ public:
     using BaseMeshT = BaseMesh<VType>;
 
     explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false)
+        : IcosahedronMesh(vertex_layout, radius, subdivisions_count, spherify, nullptr)
+    { }
+
+    // Subdivision and spherification of the mesh run in parallel with the same result as in sequential mode
+    IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius, uint32_t subdivisions_count, bool spherify, tf::Executor& parallel_executor)
+        : IcosahedronMesh(vertex_layout, radius, subdivisions_count, spherify, &parallel_executor)
+    { }
+
+    float GetRadius() const noexcept  { return m_radius; }
+
+    void Subdivide()
+    {
+        META_FUNCTION_TASK();
+        BaseMeshT::SubdivideTriangles();
+    }
+
+    void Subdivide(tf::Executor& parallel_executor)
+    {
+        META_FUNCTION_TASK();
+        BaseMeshT::SubdivideTriangles(&parallel_executor);
+    }
+
+    void Spherify()
+    {
+        META_FUNCTION_TASK();
+        SpherifyVertices(nullptr);
+    }
+
+    void Spherify(tf::Executor& parallel_executor)
+    {
+        META_FUNCTION_TASK();
+        SpherifyVertices(&parallel_executor);
+    }
+
+private:
+    IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius, uint32_t subdivisions_count, bool spherify, tf::Executor* parallel_executor_ptr)
         : BaseMeshT(Mesh::Type::Icosahedron, vertex_layout)
         , m_radius(radius)
     {
         META_FUNCTION_TASK();
 
-        const bool has_colors   = BaseMeshT::HasVertexField(Mesh::VertexField::Color);
-        const bool has_normals  = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
-        const bool has_texcoord = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
+        const bool has_colors   = BaseMeshT::template HasVertexField<Mesh::VertexField::Color>();
+        const bool has_normals  = BaseMeshT::template HasVertexField<Mesh::VertexField::Normal>();
+        const bool has_texcoord = BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>();
 
         META_CHECK_ARG_FALSE_DESCR(has_colors, "colored vertices are not supported by icosahedron mesh");
 
@@ -70,18 +106,18 @@ public:
         {
             VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
 
-            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(vertex);
             vertex_position = vertex_positions[vertex_index];
 
             if (has_normals)
             {
-                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(vertex);
                 vertex_normal = Mesh::Normal(hlslpp::normalize(vertex_position.AsHlsl()));
             }
 
             if (has_texcoord)
             {
-                Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::TexCoord>(vertex, Mesh::VertexField::TexCoord);
+                Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::VertexField::TexCoord>(vertex);
                 const Mesh::Position vertex_direction(hlslpp::normalize(vertex_position.AsHlsl()));
 
                 vertex_texcoord.SetX(std::atan2(vertex_direction.GetZ(), vertex_direction.GetX()) / ConstFloat::TwoPi + 0.5F);
@@ -117,73 +153,34 @@ public:
 
         for(uint32_t subdivision = 0; subdivision < subdivisions_count; ++subdivision)
         {
-            Subdivide();
+            BaseMeshT::SubdivideTriangles(parallel_executor_ptr);
         }
 
         if (spherify)
         {
-            Spherify();
+            SpherifyVertices(parallel_executor_ptr);
         }
     }
 
-    float GetRadius() const noexcept  { return m_radius; }
-
-    void Subdivide()
-    {
-        META_FUNCTION_TASK();
-        META_CHECK_ARG_DESCR(Mesh::GetIndexCount(), Mesh::GetIndexCount() % 3 == 0,
-                             "icosahedron indices count should be a multiple of three representing triangles list");
-
-        Mesh::Indices new_indices;
-        new_indices.reserve(Mesh::GetIndexCount() * 4);
-        BaseMeshT::ReserveVertices(BaseMeshT::GetVertexCount() * 2);
-
-        typename BaseMeshT::EdgeMidpoints edge_midpoints;
-
-        const Data::Size triangles_count = Mesh::GetIndexCount() / 3;
-        for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
-        {
-            const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3);
-            const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + 1);
-            const Mesh::Index vi3 = Mesh::GetIndex(triangle_index * 3 + 2);
-
-            const Mesh::Index vm1 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi1, vi2), edge_midpoints);
-            const Mesh::Index vm2 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi2, vi3), edge_midpoints);
-            const Mesh::Index vm3 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi3, vi1), edge_midpoints);
-
-            std::array<Mesh::Index, 3 * 4> indices{
-                vi1, vm1, vm3,
-                vm1, vi2, vm2,
-                vm1, vm2, vm3,
-                vm3, vm2, vi3,
-            };
-            new_indices.insert(new_indices.end(), indices.begin(), indices.end());
-        }
-
-        BaseMeshT::SwapIndices(new_indices);
-    }
 
-    void Spherify()
+    void SpherifyVertices(tf::Executor* parallel_executor_ptr)
     {
-        META_FUNCTION_TASK();
-        const bool has_normals = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
-
-        for(size_t vertex_index = 0; vertex_index < BaseMeshT::GetVertexCount(); ++vertex_index)
-        {
-            VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
-            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
-            const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
-            vertex_position = Mesh::Position(vertex_position_norm * m_radius);
-
-            if (has_normals)
+        BaseMeshT::ForEachIndex(parallel_executor_ptr, BaseMeshT::GetVertexCount(),
+            [this](Data::Index vertex_index)
             {
-                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-                vertex_normal = Mesh::Normal(vertex_position_norm);
-            }
-        }
+                VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
+                Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(vertex);
+                const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
+                vertex_position = Mesh::Position(vertex_position_norm * m_radius);
+
+                if (BaseMeshT::template HasVertexField<Mesh::VertexField::Normal>())
+                {
+                    Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(vertex);
+                    vertex_normal = Mesh::Normal(vertex_position_norm);
+                }
+            });
     }
 
-private:
     const float m_radius;
 };
 
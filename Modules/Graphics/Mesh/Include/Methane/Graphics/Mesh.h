@@ -23,28 +23,40 @@ Abstract mesh class
 
 #pragma once
 
+#include <Methane/Graphics/Types.h>
 #include <Methane/Data/Types.h>
 #include <Methane/Data/Vector.hpp>
 
 #include <vector>
 #include <array>
+#include <atomic>
 #include <string_view>
 #include <map>
+#include <limits>
 
 namespace Methane::Graphics
 {
 
+class MeshCache;
+
 class Mesh
 {
+    friend class MeshCache;
+
 public:
     using Position   = Data::RawVector3F;
     using Position2D = Data::RawVector2F;
     using Normal     = Data::RawVector3F;
     using Color      = Data::RawVector3F;
     using TexCoord   = Data::RawVector2F;
-    using Index      = uint16_t;
+    using Index      = uint32_t;
+    using Index16    = uint16_t;
     using Indices    = std::vector<Index>;
 
+    // Meshes with vertex count not exceeding this limit have 16-bit index data, otherwise 32-bit index data is used;
+    // maximum 16-bit value is not used as vertex index, since it is reserved for primitive restart
+    static constexpr Data::Size max_index16_vertex_count = std::numeric_limits<Index16>::max();
+
     enum class Type
     {
         Unknown,
@@ -66,17 +78,44 @@ public:
             Slice(const Slice& other) = default;
         };
 
-        const Type  mesh_type;
-        const Slice vertices;
-        const Slice indices;
-        const bool  indices_adjusted;
+        const Type        mesh_type;
+        const Slice       vertices;
+        const Slice       indices;
+        const bool        indices_adjusted;
+        const Data::Index lod_index; // level of detail in the chain of consecutive subsets, zero for the full detail level
+        const float       lod_error; // simplification error of the level of detail relative to mesh bounding radius
 
-        Subset(Type in_mesh_type, const Slice& in_vertices, const Slice& in_indices, bool in_indices_adjusted);
+        Subset(Type in_mesh_type, const Slice& in_vertices, const Slice& in_indices, bool in_indices_adjusted,
+               Data::Index in_lod_index = 0U, float in_lod_error = 0.F);
         Subset(const Subset& other) = default;
     };
 
     using Subsets = std::vector<Subset>;
 
+    static constexpr uint32_t default_vertex_cache_size = 16U;
+
+    struct OptimizationSettings
+    {
+        uint32_t vertex_cache_size    = default_vertex_cache_size;
+        bool     reorder_vertex_fetch = true;
+        bool     reorder_for_overdraw = false;
+    };
+
+    // Post-transform vertex cache efficiency simulated with FIFO cache
+    struct VertexCacheStatistics
+    {
+        float acmr = 0.F; // average cache miss ratio: transformed vertices per triangle, from 3.0 down to ~0.5
+        float atvr = 0.F; // average transform to vertex ratio: transformed vertices per mesh vertex, 1.0 is optimal
+    };
+
+    // Levels of detail are generated by mesh simplification with quadric error metric
+    struct LodSettings
+    {
+        Data::Size lods_count      = 4U;   // maximum levels of detail count including the full detail level
+        float      triangles_ratio = 0.5F; // target ratio of triangles count between consecutive levels of detail
+        float      max_error       = 0.1F; // maximum simplification error relative to mesh bounding radius
+    };
+
     enum class VertexField : size_t
     {
         Position,
@@ -87,6 +126,17 @@ public:
         Count
     };
 
+    // Compact vertex field formats reduce vertex size and fetch bandwidth, they are encoded by CompactMesh
+    // and have to be decoded in vertex shader by the same rules, except automatically normalized integer formats
+    enum class VertexFieldFormat : uint32_t
+    {
+        Float,      // full precision floating point vector of the vertex field type
+        Half,       // position: 4 half floats normalized with mesh position scale and bias, W is one
+        Octahedral, // normal: 2 normalized signed 16-bit integers of octahedral unit vector encoding
+        Unorm16,    // texcoord: 2 normalized unsigned 16-bit integers in [0, 1] range, normalized with mesh texcoord scale and bias
+        Unorm8,     // color: 4 normalized unsigned 8-bit integers in [0, 1] range, alpha is one
+    };
+
     class VertexLayout : public std::vector<VertexField>
     {
     public:
@@ -103,9 +153,25 @@ public:
 
         using std::vector<VertexField>::vector;
 
+        VertexLayout& SetFieldFormat(VertexField vertex_field, VertexFieldFormat field_format);
+
+        [[nodiscard]] VertexFieldFormat GetFieldFormat(VertexField vertex_field) const noexcept { return m_field_formats[static_cast<size_t>(vertex_field)]; }
+        [[nodiscard]] bool IsCompact() const noexcept;
         [[nodiscard]] std::vector<std::string_view> GetSemantics() const;
 
+        // Vertex input formats of the layout fields, unknown format is returned for full precision fields,
+        // which input format is reflected from vertex shader
+        [[nodiscard]] std::vector<PixelFormat> GetFormats() const;
+
+        [[nodiscard]] bool operator==(const VertexLayout& other) const noexcept;
+        [[nodiscard]] bool operator!=(const VertexLayout& other) const noexcept { return !(*this == other); }
+
         [[nodiscard]] static std::string_view GetSemanticByVertexField(VertexField vertex_field);
+        [[nodiscard]] static bool IsFieldFormatSupported(VertexField vertex_field, VertexFieldFormat field_format) noexcept;
+        [[nodiscard]] static PixelFormat GetPixelFormat(VertexFieldFormat field_format) noexcept;
+
+    private:
+        std::array<VertexFieldFormat, static_cast<size_t>(VertexField::Count)> m_field_formats{};
     };
 
     Mesh(Type type, const VertexLayout& vertex_layout);
@@ -117,7 +183,13 @@ public:
     [[nodiscard]] const Indices&      GetIndices() const noexcept            { return m_indices; }
     [[nodiscard]] Index               GetIndex(Data::Index i) const noexcept { return i < m_indices.size() ? m_indices[i] : 0; }
     [[nodiscard]] Data::Size          GetIndexCount() const noexcept         { return static_cast<Data::Size>(m_indices.size()); }
-    [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
+    [[nodiscard]] bool                HasIndex16Data() const noexcept        { return GetVertexCount() <= max_index16_vertex_count; }
+    [[nodiscard]] PixelFormat         GetIndexFormat() const noexcept        { return HasIndex16Data() ? PixelFormat::R16Uint : PixelFormat::R32Uint; }
+    [[nodiscard]] Data::Size          GetIndexSize() const noexcept          { return HasIndex16Data() ? sizeof(Index16) : sizeof(Index); }
+    [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return GetIndexCount() * GetIndexSize(); }
+    [[nodiscard]] Data::Bytes         GetIndexData() const;
+
+    [[nodiscard]] VertexCacheStatistics GetVertexCacheStatistics(uint32_t cache_size = default_vertex_cache_size) const;
 
     // Mesh interface methods
     [[nodiscard]] virtual Data::Size        GetVertexCount() const noexcept = 0;
@@ -140,6 +212,25 @@ protected:
 
         [[nodiscard]] bool operator<(const Edge& other) const;
     };
+
+    // Lock-free open-addressing hash table of mesh edges, which keeps the first triangle edge slot referencing each edge.
+    // Edge slots can be added from multiple threads in any order with deterministic result.
+    class EdgeSlotTable
+    {
+    public:
+        explicit EdgeSlotTable(Data::Size edge_slots_count);
+
+        void AddEdgeSlot(const Edge& edge, Data::Index edge_slot_index) noexcept;
+        [[nodiscard]] Data::Index GetFirstEdgeSlot(const Edge& edge) const noexcept;
+
+    private:
+        [[nodiscard]] static uint64_t GetEdgeKey(const Edge& edge) noexcept;
+        [[nodiscard]] size_t GetFirstPosition(uint64_t edge_key) const noexcept;
+
+        const size_t                       m_position_mask;
+        std::vector<std::atomic<uint64_t>> m_edge_keys;   // edge key incremented by one, zero in empty position
+        std::vector<std::atomic<uint32_t>> m_first_slots; // first edge slot index incremented by one
+    };
     
     using VertexFieldOffsets = std::array<int32_t, static_cast<size_t>(VertexField::Count)>;
 
@@ -154,10 +245,31 @@ protected:
     void AppendIndices(const Mesh::Indices& indices)     { m_indices.insert(m_indices.end(), indices.begin(), indices.end()); }
     auto GetIndicesBackInserter()                        { return std::back_inserter(m_indices); }
 
+    // Triangles are reordered with Tipsify algorithm for post-transform vertex cache locality;
+    // offsets of triangle clusters, which can be reordered without breaking the locality, are returned in cluster_offsets
+    [[nodiscard]] static Indices GetVertexCacheOptimizedIndices(const Indices& indices, Data::Size vertex_count, uint32_t cache_size,
+                                                                std::vector<Data::Index>& cluster_offsets);
+
+    // Triangle clusters are sorted to draw outward facing clusters first, which reduces overdraw for convex-like meshes
+    [[nodiscard]] static Indices GetOverdrawOptimizedIndices(const Indices& indices, const std::vector<Position>& positions,
+                                                             const std::vector<Data::Index>& cluster_offsets);
+
+    // Remap of old vertex indices to new ones in order of the first use in index buffer, unused vertices are moved to the end
+    [[nodiscard]] static Indices GetVertexFetchRemap(const Indices& indices, Data::Size vertex_count);
+
+    // Triangles are simplified with half-edge collapses ordered by quadric error metric, so simplified indices reference a subset of original vertices;
+    // collapses stop when target index count is reached or the next collapse error relative to mesh bounding radius exceeds max_error.
+    // Vertices of border edges are never collapsed, which keeps mesh silhouette and vertex attribute seams.
+    [[nodiscard]] static Indices GetSimplifiedIndices(const Indices& indices, const std::vector<Position>& positions,
+                                                      Data::Size target_index_count, float max_error, float& result_error);
+
+    [[nodiscard]] static VertexCacheStatistics SimulateVertexCache(const Indices& indices, Data::Size vertex_count, uint32_t cache_size);
+
     [[nodiscard]] static VertexFieldOffsets GetVertexFieldOffsets(const VertexLayout& vertex_layout);
     [[nodiscard]] static Data::Size         GetVertexSize(const VertexLayout& vertex_layout) noexcept;
     [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field)   { return GetVertexFieldSize(static_cast<size_t>(vertex_field)); }
     [[nodiscard]] static Data::Size         GetVertexFieldSize(size_t vertex_field_index);
+    [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field, VertexFieldFormat field_format);
     [[nodiscard]] static const Position2D&  GetFacePosition2D(size_t index);
     [[nodiscard]] static Data::Size         GetFacePositionCount() noexcept;
     [[nodiscard]] static const TexCoord&    GetFaceTexCoord(size_t index);
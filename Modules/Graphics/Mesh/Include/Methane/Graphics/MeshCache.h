@@ -0,0 +1,135 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshCache.h
+Versioned binary mesh container with vertex layout, subsets and aligned
+vertex and index data, which is viewed in place without copying.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+#include "CompactMesh.h"
+
+#include <Methane/Data/IProvider.h>
+#include <Methane/Data/Chunk.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+class MeshCache
+{
+public:
+    // Version is incremented on any change of binary layout, data of other versions is rejected
+    static constexpr uint32_t   format_version = 2U;
+    static constexpr Data::Size data_alignment = 16U;
+
+    // Data is validated and kept in mesh cache, so that vertex and index data are viewed in place:
+    // data chunk referencing memory mapped file or embedded resource is not copied
+    explicit MeshCache(Data::Chunk&& data);
+
+    [[nodiscard]] static MeshCache   Load(const Data::IProvider& data_provider, const std::string& data_path);
+    [[nodiscard]] static Data::Bytes Serialize(const Mesh& mesh, const Mesh::Subsets& subsets = {}, uint64_t generation_key = 0U);
+    [[nodiscard]] static bool        IsValidData(const Data::Chunk& data) noexcept;
+    static void Save(const Data::Bytes& data, const std::filesystem::path& file_path);
+
+    // Key of procedural mesh generated with numeric arguments, which is stored in cache to detect stale cache files
+    template<typename... GenerationArgs>
+    [[nodiscard]] static uint64_t GetGenerationKey(Mesh::Type mesh_type, const Mesh::VertexLayout& vertex_layout, const GenerationArgs&... generation_args) noexcept
+    {
+        static_assert((std::is_arithmetic_v<GenerationArgs> && ...), "mesh generation arguments should be numbers");
+        uint64_t generation_key = GetVertexLayoutKey(mesh_type, vertex_layout);
+        ((generation_key = GetDataKey(generation_key, &generation_args, sizeof(generation_args))), ...);
+        return generation_key;
+    }
+
+    // Procedural mesh is loaded from cache file, when it was generated with the same key,
+    // otherwise mesh is generated with its subsets, saved to cache file and returned for use
+    template<typename GenerateMeshFunc>
+    [[nodiscard]] static MeshCache LoadOrGenerate(const std::filesystem::path& cache_file_path, uint64_t generation_key,
+                                                  const GenerateMeshFunc& generate_mesh)
+    {
+        META_FUNCTION_TASK();
+        if (Data::Chunk cache_data = LoadFile(cache_file_path, generation_key);
+            !cache_data.IsEmptyOrNull())
+            return MeshCache(std::move(cache_data));
+
+        const auto mesh = generate_mesh();
+        Data::Bytes mesh_data;
+        if constexpr (HasSubsets<decltype(mesh)>::value)
+            mesh_data = Serialize(mesh, mesh.GetSubsets(), generation_key);
+        else
+            mesh_data = Serialize(mesh, {}, generation_key);
+
+        Save(mesh_data, cache_file_path);
+        return MeshCache(Data::Chunk(std::move(mesh_data)));
+    }
+
+    [[nodiscard]] Mesh::Type                           GetType() const noexcept             { return m_type; }
+    [[nodiscard]] const Mesh::VertexLayout&            GetVertexLayout() const noexcept     { return m_vertex_layout; }
+    [[nodiscard]] Data::Size                           GetVertexSize() const noexcept       { return m_vertex_size; }
+    [[nodiscard]] Data::Size                           GetVertexCount() const noexcept      { return m_vertex_count; }
+    [[nodiscard]] Data::Size                           GetVertexDataSize() const noexcept   { return m_vertex_count * m_vertex_size; }
+    [[nodiscard]] Data::ConstRawPtr                    GetVertexData() const noexcept       { return m_data.GetDataPtr() + m_vertex_data_offset; }
+    [[nodiscard]] Data::Size                           GetIndexCount() const noexcept       { return m_index_count; }
+    [[nodiscard]] Data::Size                           GetIndexSize() const noexcept        { return m_index_size; }
+    [[nodiscard]] PixelFormat                          GetIndexFormat() const noexcept      { return m_index_size == sizeof(Mesh::Index16) ? PixelFormat::R16Uint : PixelFormat::R32Uint; }
+    [[nodiscard]] Data::Size                           GetIndexDataSize() const noexcept    { return m_index_count * m_index_size; }
+    [[nodiscard]] Data::ConstRawPtr                    GetIndexData() const noexcept        { return m_data.GetDataPtr() + m_index_data_offset; }
+    [[nodiscard]] const Mesh::Subsets&                 GetSubsets() const noexcept          { return m_subsets; }
+    [[nodiscard]] float                                GetBoundingRadius() const noexcept   { return m_bounding_radius; }
+    [[nodiscard]] const CompactMesh::PositionEncoding& GetPositionEncoding() const noexcept { return m_position_encoding; }
+    [[nodiscard]] const CompactMesh::TexCoordEncoding& GetTexCoordEncoding() const noexcept { return m_texcoord_encoding; }
+    [[nodiscard]] uint64_t                             GetGenerationKey() const noexcept    { return m_generation_key; }
+    [[nodiscard]] const Data::Chunk&                   GetData() const noexcept             { return m_data; }
+
+private:
+    template<typename MeshType, typename = void>
+    struct HasSubsets : std::false_type { };
+
+    template<typename MeshType>
+    struct HasSubsets<MeshType, std::void_t<decltype(std::declval<const MeshType&>().GetSubsets())>> : std::true_type { };
+
+    [[nodiscard]] static Data::Chunk LoadFile(const std::filesystem::path& cache_file_path, uint64_t generation_key);
+    [[nodiscard]] static uint64_t    GetVertexLayoutKey(Mesh::Type mesh_type, const Mesh::VertexLayout& vertex_layout) noexcept;
+    [[nodiscard]] static uint64_t    GetDataKey(uint64_t key, const void* data_ptr, size_t data_size) noexcept;
+
+    Data::Chunk                    m_data;
+    Mesh::Type                     m_type = Mesh::Type::Unknown;
+    Mesh::VertexLayout             m_vertex_layout;
+    Data::Size                     m_vertex_size = 0U;
+    Data::Size                     m_vertex_count = 0U;
+    Data::Size                     m_index_size = 0U;
+    Data::Size                     m_index_count = 0U;
+    Data::Size                     m_vertex_data_offset = 0U;
+    Data::Size                     m_index_data_offset = 0U;
+    Mesh::Subsets                  m_subsets;
+    float                          m_bounding_radius = 0.F;
+    CompactMesh::PositionEncoding  m_position_encoding;
+    CompactMesh::TexCoordEncoding  m_texcoord_encoding;
+    uint64_t                       m_generation_key = 0U;
+};
+
+} // namespace Methane::Graphics
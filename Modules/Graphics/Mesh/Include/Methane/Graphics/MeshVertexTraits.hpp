@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshVertexTraits.hpp
+Compile-time reflection of mesh vertex structure layout by names of its fields:
+position, normal, texcoord and color.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Mesh.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace Methane::Graphics
+{
+
+template<Mesh::VertexField field>
+struct MeshVertexFieldType;
+
+template<> struct MeshVertexFieldType<Mesh::VertexField::Position> { using Type = Mesh::Position; };
+template<> struct MeshVertexFieldType<Mesh::VertexField::Normal>   { using Type = Mesh::Normal; };
+template<> struct MeshVertexFieldType<Mesh::VertexField::TexCoord> { using Type = Mesh::TexCoord; };
+template<> struct MeshVertexFieldType<Mesh::VertexField::Color>    { using Type = Mesh::Color; };
+
+template<Mesh::VertexField field>
+using MeshVertexFieldTypeT = typename MeshVertexFieldType<field>::Type;
+
+template<typename VType, Mesh::VertexField field, typename = void>
+struct MeshVertexMember : std::false_type { };
+
+#define META_MESH_VERTEX_MEMBER(field_name, member_name) \
+    template<typename VType> \
+    struct MeshVertexMember<VType, Mesh::VertexField::field_name, \
+                            std::enable_if_t<std::is_same_v<decltype(VType::member_name), Mesh::field_name>>> \
+        : std::true_type \
+    { \
+        static constexpr size_t GetOffset() noexcept { return offsetof(VType, member_name); } \
+        template<typename V> \
+        static constexpr auto& Get(V& vertex) noexcept { return vertex.member_name; } \
+    }
+
+META_MESH_VERTEX_MEMBER(Position, position);
+META_MESH_VERTEX_MEMBER(Normal,   normal);
+META_MESH_VERTEX_MEMBER(TexCoord, texcoord);
+META_MESH_VERTEX_MEMBER(Color,    color);
+
+#undef META_MESH_VERTEX_MEMBER
+
+template<typename VType>
+struct MeshVertexTraits
+{
+    template<Mesh::VertexField field>
+    static constexpr bool has_field = MeshVertexMember<VType, field>::value;
+
+    static constexpr size_t field_count = static_cast<size_t>(has_field<Mesh::VertexField::Position>)
+                                        + static_cast<size_t>(has_field<Mesh::VertexField::Normal>)
+                                        + static_cast<size_t>(has_field<Mesh::VertexField::TexCoord>)
+                                        + static_cast<size_t>(has_field<Mesh::VertexField::Color>);
+
+    static constexpr size_t fields_size = (has_field<Mesh::VertexField::Position> ? sizeof(Mesh::Position) : 0U)
+                                        + (has_field<Mesh::VertexField::Normal>   ? sizeof(Mesh::Normal)   : 0U)
+                                        + (has_field<Mesh::VertexField::TexCoord> ? sizeof(Mesh::TexCoord) : 0U)
+                                        + (has_field<Mesh::VertexField::Color>    ? sizeof(Mesh::Color)    : 0U);
+
+    // Vertex structure is reflected when it consists only of the named fields without padding,
+    // so that its vertex layout and field offsets are known at compile time
+    static constexpr bool is_reflected = std::is_standard_layout_v<VType>
+                                      && has_field<Mesh::VertexField::Position>
+                                      && fields_size == sizeof(VType);
+
+    using Fields = std::array<Mesh::VertexField, field_count>;
+
+    // Vertex fields ordered by their offsets in vertex structure
+    [[nodiscard]] static constexpr Fields GetFields() noexcept
+    {
+        static_assert(std::is_standard_layout_v<VType>, "vertex structure must have standard layout to get field offsets");
+        Fields sorted_fields{};
+        std::array<size_t, field_count> field_offsets{};
+        size_t count = 0U;
+        AddField<Mesh::VertexField::Position>(sorted_fields, field_offsets, count);
+        AddField<Mesh::VertexField::Normal>(sorted_fields, field_offsets, count);
+        AddField<Mesh::VertexField::TexCoord>(sorted_fields, field_offsets, count);
+        AddField<Mesh::VertexField::Color>(sorted_fields, field_offsets, count);
+        return sorted_fields;
+    }
+
+    [[nodiscard]] static Mesh::VertexLayout GetLayout()
+    {
+        constexpr Fields fields = GetFields();
+        return Mesh::VertexLayout(fields.begin(), fields.end());
+    }
+
+    template<Mesh::VertexField field, typename V>
+    [[nodiscard]] static constexpr auto& GetField(V& vertex) noexcept
+    {
+        static_assert(has_field<field>, "vertex structure does not have requested field");
+        return MeshVertexMember<VType, field>::Get(vertex);
+    }
+
+private:
+    // Insertion of vertex field in the array sorted by offsets
+    template<Mesh::VertexField field>
+    static constexpr void AddField([[maybe_unused]] Fields& sorted_fields, [[maybe_unused]] std::array<size_t, field_count>& field_offsets,
+                                   [[maybe_unused]] size_t& count) noexcept
+    {
+        if constexpr (has_field<field>)
+        {
+            const size_t offset = MeshVertexMember<VType, field>::GetOffset();
+            size_t index = count++;
+            for (; index > 0U && field_offsets[index - 1U] > offset; --index)
+            {
+                sorted_fields[index] = sorted_fields[index - 1U];
+                field_offsets[index] = field_offsets[index - 1U];
+            }
+            sorted_fields[index] = field;
+            field_offsets[index] = offset;
+        }
+    }
+};
+
+} // namespace Methane::Graphics
@@ -51,9 +51,9 @@ public:
     {
         META_FUNCTION_TASK();
 
-        const bool has_colors   = BaseMeshT::HasVertexField(Mesh::VertexField::Color);
-        const bool has_normals  = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
-        const bool has_texcoord = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
+        const bool has_colors   = BaseMeshT::template HasVertexField<Mesh::VertexField::Color>();
+        const bool has_normals  = BaseMeshT::template HasVertexField<Mesh::VertexField::Normal>();
+        const bool has_texcoord = BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>();
 
         for (size_t face_vertex_idx = 0; face_vertex_idx < Mesh::Mesh::GetFacePositionCount(); ++face_vertex_idx)
         {
@@ -96,7 +96,7 @@ private:
     void InitVertexPosition(const FaceType& face_type, size_t face_vertex_idx, VType& vertex)
     {
         const Mesh::Position2D& pos_2d = Mesh::GetFacePosition2D(face_vertex_idx);
-        Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+        Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(vertex);
         switch (face_type)
         {
         case FaceType::XY: vertex_position = Mesh::Position(pos_2d[0] * m_width, pos_2d[1] * m_height, m_depth_pos); break;
@@ -108,7 +108,7 @@ private:
 
     void InitVertexNormal(const FaceType& face_type, VType& vertex)
     {
-        Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+        Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(vertex);
         const float depth_norm      = m_depth_pos >= 0.F ? 1.F : -1.F;
         switch (face_type)
         {
@@ -121,13 +121,13 @@ private:
 
     void InitVertexColor(size_t color_index, VType& vertex)
     {
-        Mesh::Color& vertex_color = BaseMeshT::template GetVertexField<Mesh::Color>(vertex, Mesh::VertexField::Color);
+        Mesh::Color& vertex_color = BaseMeshT::template GetVertexField<Mesh::VertexField::Color>(vertex);
         vertex_color = Mesh::GetColor(color_index % Mesh::GetColorsCount());
     }
 
     void InitVertexTexCoord(size_t face_vertex_idx, VType& vertex)
     {
-        Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::TexCoord>(vertex, Mesh::VertexField::TexCoord);
+        Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::VertexField::TexCoord>(vertex);
         vertex_texcoord = Mesh::GetFaceTexCoord(face_vertex_idx);
     }
 
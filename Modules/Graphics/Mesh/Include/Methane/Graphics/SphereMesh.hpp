@@ -43,7 +43,7 @@ public:
         , m_long_lines_count(long_lines_count)
     {
         META_FUNCTION_TASK();
-        META_CHECK_ARG_NAME_DESCR("vertex_layout", !Mesh::HasVertexField(Mesh::VertexField::Color), "colored vertices are not supported by sphere mesh");
+        META_CHECK_ARG_NAME_DESCR("vertex_layout", !BaseMeshT::template HasVertexField<Mesh::VertexField::Color>(), "colored vertices are not supported by sphere mesh");
         META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_lat_lines_count,  3, "latitude lines count should not be less than 3");
         META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_long_lines_count, 3, "longitude lines count should not be less than 3");
 
@@ -58,13 +58,13 @@ public:
 private:
     Mesh::Index GetActualLongLinesCount() const noexcept
     {
-        return Mesh::HasVertexField(Mesh::VertexField::TexCoord)
+        return BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>()
              ? m_long_lines_count + 1
              : m_long_lines_count;
     }
     Mesh::Index GetSphereFacesCount() const noexcept
     {
-        return (Mesh::HasVertexField(Mesh::VertexField::TexCoord)
+        return (BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>()
              ? m_lat_lines_count
              : m_lat_lines_count - 2) * m_long_lines_count * 2;
     }
@@ -77,8 +77,8 @@ private:
         // an additional ending longitude line of vertices is added (with same positions as for the first line),
         // required to complete the texture projection on sphere
 
-        const bool        has_texcoord = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
-        const bool        has_normals  = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
+        const bool        has_texcoord = BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>();
+        const bool        has_normals  = BaseMeshT::template HasVertexField<Mesh::VertexField::Normal>();
         const Mesh::Index actual_long_lines_count = GetActualLongLinesCount();
         const Mesh::Index cap_vertex_count = 2 * (has_texcoord ? actual_long_lines_count : 1);
 
@@ -86,16 +86,16 @@ private:
 
         if (!has_texcoord)
         {
-            Mesh::Position& first_vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(BaseMeshT::GetMutableFirstVertex(), Mesh::VertexField::Position);
-            Mesh::Position& last_vertex_position  = BaseMeshT::template GetVertexField<Mesh::Position>(BaseMeshT::GetMutableLastVertex(), Mesh::VertexField::Position);
+            Mesh::Position& first_vertex_position = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(BaseMeshT::GetMutableFirstVertex());
+            Mesh::Position& last_vertex_position  = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(BaseMeshT::GetMutableLastVertex());
 
             first_vertex_position = Mesh::Position(0.F,  m_radius, 0.F);
             last_vertex_position  = Mesh::Position(0.F, -m_radius, 0.F);
 
             if (has_normals)
             {
-                Mesh::Normal& first_vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(BaseMeshT::GetMutableFirstVertex(), Mesh::VertexField::Normal);
-                Mesh::Normal& last_vertex_normal  = BaseMeshT::template GetVertexField<Mesh::Normal>(BaseMeshT::GetMutableLastVertex(), Mesh::VertexField::Normal);
+                Mesh::Normal& first_vertex_normal = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(BaseMeshT::GetMutableFirstVertex());
+                Mesh::Normal& last_vertex_normal  = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(BaseMeshT::GetMutableLastVertex());
 
                 first_vertex_normal = Mesh::Normal(0.F,  1.F, 0.F);
                 last_vertex_normal  = Mesh::Normal(0.F, -1.F, 0.F);
@@ -120,14 +120,14 @@ private:
 
                 VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
 
-                Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+                Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::VertexField::Position>(vertex);
                 vertex_position.SetX(std::sin(ConstFloat::Pi * lat_ratio) * std::cos(ConstFloat::TwoPi * long_ratio));
                 vertex_position.SetZ(std::sin(ConstFloat::Pi * lat_ratio) * std::sin(ConstFloat::TwoPi * long_ratio));
                 vertex_position.SetY(std::cos(ConstFloat::Pi * lat_ratio));
 
                 if (has_normals)
                 {
-                    Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                    Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::VertexField::Normal>(vertex);
                     vertex_normal = vertex_position;
                 }
 
@@ -135,7 +135,7 @@ private:
 
                 if (has_texcoord)
                 {
-                    Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::TexCoord>(vertex, Mesh::VertexField::TexCoord);
+                    Mesh::TexCoord& vertex_texcoord = BaseMeshT::template GetVertexField<Mesh::VertexField::TexCoord>(vertex);
                     vertex_texcoord.SetX(texcoord_long_spacing * static_cast<float>(long_line_index));
                     vertex_texcoord.SetY(texcoord_lat_spacing  * static_cast<float>(lat_line_index));
                 }
@@ -146,7 +146,7 @@ private:
     void GenerateSphereIndices()
     {
         META_FUNCTION_TASK();
-        const bool        has_texcoord            = BaseMeshT::HasVertexField(Mesh::VertexField::TexCoord);
+        const bool        has_texcoord            = BaseMeshT::template HasVertexField<Mesh::VertexField::TexCoord>();
         const Mesh::Index actual_long_lines_count = GetActualLongLinesCount();
         const Mesh::Index sphere_faces_count      = GetSphereFacesCount();
         Data::Index       index_offset            = 0;
@@ -49,25 +49,44 @@ public:
                                Mesh::Subset::Slice(Mesh::GetIndexCount(),       static_cast<Data::Size>(sub_indices.size())),
                                adjust_indices);
 
-        if (adjust_indices)
-        {
-            const Data::Size vertex_count = BaseMeshT::GetVertexCount();
-            META_CHECK_ARG_LESS(vertex_count, std::numeric_limits<Mesh::Index>::max());
-
-            const auto index_offset = static_cast<Mesh::Index>(vertex_count);
-            std::transform(sub_indices.begin(), sub_indices.end(), BaseMeshT::GetIndicesBackInserter(),
-                           [index_offset](const Mesh::Index& index)
-                           {
-                               META_CHECK_ARG_LESS(index_offset, std::numeric_limits<Mesh::Index>::max() - index);
-                               return static_cast<Mesh::Index>(index_offset + index);
-                           });
-        }
-        else
+        AppendSubsetIndices(sub_indices, adjust_indices, BaseMeshT::GetVertexCount());
+        BaseMeshT::AppendVertices(sub_vertices);
+    }
+
+    // Sub-mesh is added with the chain of simplified levels of detail in consecutive subsets, which share sub-mesh vertices;
+    // each level is simplified from the full detail mesh, chain ends early when triangles count can not be reduced within max error.
+    // Returns count of added levels of detail including the full detail level.
+    Data::Size AddSubMeshWithLods(const BaseMeshT& sub_mesh, bool adjust_indices, const Mesh::LodSettings& lod_settings = {})
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO(lod_settings.lods_count);
+        META_CHECK_ARG_RANGE_DESCR(lod_settings.triangles_ratio, 0.F, 1.F, "triangles ratio between levels of detail should be in range [0, 1)");
+
+        const Data::Index first_subset_index = static_cast<Data::Index>(m_subsets.size());
+        AddSubMesh(sub_mesh, adjust_indices);
+
+        const Mesh::Subset& full_subset = m_subsets[first_subset_index];
+        const Mesh::Subset::Slice sub_vertices = full_subset.vertices;
+        Data::Size lod_triangles_count = full_subset.indices.count / 3U;
+
+        Data::Size lods_count = 1U;
+        for (; lods_count < lod_settings.lods_count; ++lods_count)
         {
-            BaseMeshT::AppendIndices(sub_indices);
+            const auto target_triangles_count = static_cast<Data::Size>(static_cast<float>(lod_triangles_count) * lod_settings.triangles_ratio);
+            float lod_error = 0.F;
+            const Mesh::Indices lod_indices = sub_mesh.GetSimplifiedIndices(target_triangles_count * 3U, lod_settings.max_error, lod_error);
+            const auto lod_index_count = static_cast<Data::Size>(lod_indices.size());
+            if (lod_index_count == 0U || lod_index_count / 3U >= lod_triangles_count)
+                break;
+
+            m_subsets.emplace_back(sub_mesh.GetType(), sub_vertices,
+                                   Mesh::Subset::Slice(Mesh::GetIndexCount(), lod_index_count),
+                                   adjust_indices, lods_count, lod_error);
+
+            AppendSubsetIndices(lod_indices, adjust_indices, sub_vertices.offset);
+            lod_triangles_count = lod_index_count / 3U;
         }
-
-        BaseMeshT::AppendVertices(sub_vertices);
+        return lods_count;
     }
 
     const Mesh::Subsets& GetSubsets() const                     { return m_subsets; }
@@ -79,6 +98,26 @@ public:
         return m_subsets[subset_index];
     }
 
+    // Each subset is optimized separately in its own vertex and index ranges, so that subsets can still be drawn independently;
+    // vertices shared by levels of detail are not reordered for vertex fetch, since it would break indices of the other levels
+    void Optimize(const Mesh::OptimizationSettings& settings = {})
+    {
+        META_FUNCTION_TASK();
+        Mesh::OptimizationSettings lod_settings = settings;
+        lod_settings.reorder_vertex_fetch = false;
+
+        for (size_t subset_index = 0; subset_index < m_subsets.size(); ++subset_index)
+        {
+            const Mesh::Subset& subset = m_subsets[subset_index];
+            const bool is_lod_chain_subset = subset.lod_index > 0U ||
+                                             (subset_index + 1U < m_subsets.size() && m_subsets[subset_index + 1U].lod_index > 0U);
+            BaseMeshT::OptimizeRange(subset.indices.offset, subset.indices.count,
+                                     subset.vertices.offset, subset.vertices.count,
+                                     subset.indices_adjusted ? subset.vertices.offset : 0U,
+                                     is_lod_chain_subset ? lod_settings : settings);
+        }
+    }
+
     std::pair<const VType*, size_t> GetSubsetVertices(size_t subset_index) const
     {
         META_FUNCTION_TASK();
@@ -94,6 +133,24 @@ public:
     }
 
 private:
+    void AppendSubsetIndices(const Mesh::Indices& sub_indices, bool adjust_indices, Data::Size vertex_offset)
+    {
+        if (!adjust_indices)
+        {
+            BaseMeshT::AppendIndices(sub_indices);
+            return;
+        }
+
+        META_CHECK_ARG_LESS(vertex_offset, std::numeric_limits<Mesh::Index>::max());
+        const auto index_offset = static_cast<Mesh::Index>(vertex_offset);
+        std::transform(sub_indices.begin(), sub_indices.end(), BaseMeshT::GetIndicesBackInserter(),
+                       [index_offset](const Mesh::Index& index)
+                       {
+                           META_CHECK_ARG_LESS(index_offset, std::numeric_limits<Mesh::Index>::max() - index);
+                           return static_cast<Mesh::Index>(index_offset + index);
+                       });
+    }
+
     Mesh::Subsets m_subsets;
 };
 
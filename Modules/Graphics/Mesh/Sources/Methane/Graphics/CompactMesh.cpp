@@ -0,0 +1,306 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/CompactMesh.cpp
+Mesh with vertices encoded to compact vertex layout: half float positions,
+octahedral normals, 16-bit normalized texture coordinates and 8-bit colors.
+
+******************************************************************************/
+
+#include <Methane/Graphics/CompactMesh.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Methane::Graphics
+{
+
+static constexpr uint16_t g_half_one = 0x3C00U;
+
+template<typename T>
+static T ReadVertexField(Data::ConstRawPtr vertex_data_ptr, int32_t field_offset) noexcept
+{
+    T field_value;
+    std::memcpy(&field_value, vertex_data_ptr + field_offset, sizeof(T));
+    return field_value;
+}
+
+template<typename T>
+static void WriteVertexField(Data::RawPtr vertex_data_ptr, int32_t field_offset, const T& field_value) noexcept
+{
+    std::memcpy(vertex_data_ptr + field_offset, &field_value, sizeof(T));
+}
+
+static float GetSignNotZero(float value) noexcept
+{
+    return value >= 0.F ? 1.F : -1.F;
+}
+
+static int16_t EncodeSnorm16(float value) noexcept
+{
+    return static_cast<int16_t>(std::lround(std::clamp(value, -1.F, 1.F) * 32767.F));
+}
+
+CompactMesh::CompactMesh(const Mesh& mesh, const VertexLayout& compact_vertex_layout)
+    : Mesh(mesh.GetType(), compact_vertex_layout)
+    , m_vertex_count(mesh.GetVertexCount())
+    , m_position_encoding(GetPositionEncoding(mesh, compact_vertex_layout))
+    , m_texcoord_encoding(GetTexCoordEncoding(mesh, compact_vertex_layout))
+    , m_vertex_data(static_cast<size_t>(m_vertex_count) * GetVertexSize())
+{
+    META_FUNCTION_TASK();
+    const VertexLayout&      mesh_vertex_layout  = mesh.GetVertexLayout();
+    const VertexFieldOffsets mesh_field_offsets  = GetVertexFieldOffsets(mesh_vertex_layout);
+    const Data::Size         mesh_vertex_size    = mesh.GetVertexSize();
+    const Data::ConstRawPtr  mesh_vertex_data    = mesh.GetVertexData();
+    META_CHECK_ARG_NAME_DESCR("mesh", !mesh_vertex_layout.IsCompact(), "mesh vertices are already encoded to compact layout");
+
+    for (VertexField vertex_field : compact_vertex_layout)
+    {
+        const int32_t mesh_field_offset = mesh_field_offsets[static_cast<size_t>(vertex_field)];
+        if (mesh_field_offset < 0)
+            throw VertexLayout::IncompatibleException(vertex_field);
+
+        const int32_t           field_offset = GetVertexFieldOffset(vertex_field);
+        const VertexFieldFormat field_format = compact_vertex_layout.GetFieldFormat(vertex_field);
+        const Data::Size        field_size   = GetVertexFieldSize(vertex_field);
+        for (Data::Index vertex_index = 0U; vertex_index < m_vertex_count; ++vertex_index)
+        {
+            const Data::ConstRawPtr mesh_vertex_ptr = mesh_vertex_data + static_cast<size_t>(vertex_index) * mesh_vertex_size;
+            const Data::RawPtr      vertex_ptr      = m_vertex_data.data() + static_cast<size_t>(vertex_index) * GetVertexSize();
+            switch (field_format)
+            {
+            case VertexFieldFormat::Half:
+            {
+                const auto position = ReadVertexField<Position>(mesh_vertex_ptr, mesh_field_offset);
+                std::array<uint16_t, 4> encoded_position{ 0U, 0U, 0U, g_half_one };
+                for (size_t component = 0U; component < 3U; ++component)
+                {
+                    encoded_position[component] = EncodeHalf((position[component] - m_position_encoding.bias[component]) /
+                                                             m_position_encoding.scale[component]);
+                }
+                WriteVertexField(vertex_ptr, field_offset, encoded_position);
+                break;
+            }
+            case VertexFieldFormat::Octahedral:
+                WriteVertexField(vertex_ptr, field_offset, EncodeOctahedralNormal(ReadVertexField<Normal>(mesh_vertex_ptr, mesh_field_offset)));
+                break;
+
+            case VertexFieldFormat::Unorm16:
+            {
+                const auto texcoord = ReadVertexField<TexCoord>(mesh_vertex_ptr, mesh_field_offset);
+                const std::array<uint16_t, 2> encoded_texcoord{
+                    EncodeUnorm16((texcoord.GetX() - m_texcoord_encoding.bias.GetX()) / m_texcoord_encoding.scale.GetX()),
+                    EncodeUnorm16((texcoord.GetY() - m_texcoord_encoding.bias.GetY()) / m_texcoord_encoding.scale.GetY())
+                };
+                WriteVertexField(vertex_ptr, field_offset, encoded_texcoord);
+                break;
+            }
+            case VertexFieldFormat::Unorm8:
+            {
+                const auto color = ReadVertexField<Color>(mesh_vertex_ptr, mesh_field_offset);
+                const std::array<uint8_t, 4> encoded_color{ EncodeUnorm8(color.GetX()), EncodeUnorm8(color.GetY()), EncodeUnorm8(color.GetZ()), 255U };
+                WriteVertexField(vertex_ptr, field_offset, encoded_color);
+                break;
+            }
+            default:
+                std::memcpy(vertex_ptr + field_offset, mesh_vertex_ptr + mesh_field_offset, field_size);
+            }
+        }
+    }
+
+    SetIndices(Indices(mesh.GetIndices()));
+}
+
+CompactMesh::PositionEncoding CompactMesh::GetPositionEncoding(const Mesh& mesh, const VertexLayout& compact_vertex_layout)
+{
+    META_FUNCTION_TASK();
+    if (compact_vertex_layout.GetFieldFormat(VertexField::Position) != VertexFieldFormat::Half || !mesh.GetVertexCount())
+        return PositionEncoding{};
+
+    const int32_t position_offset = GetVertexFieldOffsets(mesh.GetVertexLayout())[static_cast<size_t>(VertexField::Position)];
+    Position min_position = ReadVertexField<Position>(mesh.GetVertexData(), position_offset);
+    Position max_position = min_position;
+    for (Data::Index vertex_index = 1U; vertex_index < mesh.GetVertexCount(); ++vertex_index)
+    {
+        const auto position = ReadVertexField<Position>(mesh.GetVertexData() + static_cast<size_t>(vertex_index) * mesh.GetVertexSize(), position_offset);
+        for (size_t component = 0U; component < 3U; ++component)
+        {
+            min_position[component] = std::min(min_position[component], position[component]);
+            max_position[component] = std::max(max_position[component], position[component]);
+        }
+    }
+
+    // Positions are centered in the bounding box and scaled by its half extent to use the best half float precision
+    PositionEncoding position_encoding;
+    for (size_t component = 0U; component < 3U; ++component)
+    {
+        const float half_extent = (max_position[component] - min_position[component]) / 2.F;
+        position_encoding.bias[component]  = (max_position[component] + min_position[component]) / 2.F;
+        position_encoding.scale[component] = half_extent > 0.F ? half_extent : 1.F;
+    }
+    return position_encoding;
+}
+
+CompactMesh::TexCoordEncoding CompactMesh::GetTexCoordEncoding(const Mesh& mesh, const VertexLayout& compact_vertex_layout)
+{
+    META_FUNCTION_TASK();
+    if (compact_vertex_layout.GetFieldFormat(VertexField::TexCoord) != VertexFieldFormat::Unorm16 || !mesh.GetVertexCount())
+        return TexCoordEncoding{};
+
+    const int32_t texcoord_offset = GetVertexFieldOffsets(mesh.GetVertexLayout())[static_cast<size_t>(VertexField::TexCoord)];
+    if (texcoord_offset < 0)
+        return TexCoordEncoding{};
+
+    TexCoord min_texcoord = ReadVertexField<TexCoord>(mesh.GetVertexData(), texcoord_offset);
+    TexCoord max_texcoord = min_texcoord;
+    for (Data::Index vertex_index = 1U; vertex_index < mesh.GetVertexCount(); ++vertex_index)
+    {
+        const auto texcoord = ReadVertexField<TexCoord>(mesh.GetVertexData() + static_cast<size_t>(vertex_index) * mesh.GetVertexSize(), texcoord_offset);
+        for (size_t component = 0U; component < 2U; ++component)
+        {
+            min_texcoord[component] = std::min(min_texcoord[component], texcoord[component]);
+            max_texcoord[component] = std::max(max_texcoord[component], texcoord[component]);
+        }
+    }
+
+    // Texture coordinates in [0, 1] range are encoded as is, so that shaders may skip decoding of such meshes,
+    // while wrapped coordinates are mapped to their bounding rectangle instead of being clamped
+    TexCoordEncoding texcoord_encoding;
+    for (size_t component = 0U; component < 2U; ++component)
+    {
+        if (min_texcoord[component] >= 0.F && max_texcoord[component] <= 1.F)
+            continue;
+
+        const float extent = max_texcoord[component] - min_texcoord[component];
+        texcoord_encoding.bias[component]  = min_texcoord[component];
+        texcoord_encoding.scale[component] = extent > 0.F ? extent : 1.F;
+    }
+    return texcoord_encoding;
+}
+
+uint16_t CompactMesh::EncodeHalf(float value) noexcept
+{
+    uint32_t value_bits = 0U;
+    std::memcpy(&value_bits, &value, sizeof(value_bits));
+    const auto     sign_bits = static_cast<uint16_t>((value_bits >> 16U) & 0x8000U);
+    const uint32_t abs_bits  = value_bits & 0x7FFFFFFFU;
+
+    if (abs_bits >= 0x7F800000U) // infinity or NaN
+        return static_cast<uint16_t>(sign_bits | 0x7C00U | (abs_bits > 0x7F800000U ? 0x0200U : 0U));
+
+    if (abs_bits >= 0x477FF000U) // 65520 and greater values are rounded to infinity
+        return static_cast<uint16_t>(sign_bits | 0x7C00U);
+
+    if (abs_bits < 0x38800000U) // values less than 2^-14 are converted to subnormal half floats
+    {
+        if (abs_bits <= 0x33000000U) // values not greater than 2^-25 are rounded to zero
+            return sign_bits;
+
+        const uint32_t mantissa      = (abs_bits & 0x7FFFFFU) | 0x800000U;
+        const uint32_t shift         = 126U - (abs_bits >> 23U);
+        const uint32_t half_mantissa = mantissa >> shift;
+        const uint32_t remainder     = mantissa & ((1U << shift) - 1U);
+        const uint32_t halfway       = 1U << (shift - 1U);
+        const uint32_t round_up      = remainder > halfway || (remainder == halfway && (half_mantissa & 1U)) ? 1U : 0U;
+        return static_cast<uint16_t>(sign_bits | (half_mantissa + round_up));
+    }
+
+    // Exponent is re-biased from 127 to 15, rounding carry to exponent produces correct result
+    const uint32_t rebiased_bits = abs_bits - 0x38000000U;
+    const uint32_t remainder     = rebiased_bits & 0x1FFFU;
+    uint32_t       half_bits     = rebiased_bits >> 13U;
+    if (remainder > 0x1000U || (remainder == 0x1000U && (half_bits & 1U)))
+        half_bits++;
+    return static_cast<uint16_t>(sign_bits | half_bits);
+}
+
+float CompactMesh::DecodeHalf(uint16_t half_value) noexcept
+{
+    const uint32_t sign_bits = static_cast<uint32_t>(half_value & 0x8000U) << 16U;
+    const uint32_t exponent  = (half_value >> 10U) & 0x1FU;
+    const uint32_t mantissa  = half_value & 0x3FFU;
+
+    uint32_t value_bits = 0U;
+    if (exponent == 0x1FU) // infinity or NaN
+    {
+        value_bits = sign_bits | 0x7F800000U | (mantissa << 13U);
+    }
+    else if (exponent)
+    {
+        value_bits = sign_bits | ((exponent + 112U) << 23U) | (mantissa << 13U);
+    }
+    else
+    {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign_bits ? -value : value;
+    }
+
+    float value = 0.F;
+    std::memcpy(&value, &value_bits, sizeof(value));
+    return value;
+}
+
+CompactMesh::OctahedralNormal CompactMesh::EncodeOctahedralNormal(const Normal& normal) noexcept
+{
+    const float manhattan_length = std::abs(normal.GetX()) + std::abs(normal.GetY()) + std::abs(normal.GetZ());
+    if (manhattan_length <= 0.F)
+        return { 0, 0 };
+
+    float x = normal.GetX() / manhattan_length;
+    float y = normal.GetY() / manhattan_length;
+    if (normal.GetZ() < 0.F)
+    {
+        const float folded_x = (1.F - std::abs(y)) * GetSignNotZero(x);
+        const float folded_y = (1.F - std::abs(x)) * GetSignNotZero(y);
+        x = folded_x;
+        y = folded_y;
+    }
+    return { EncodeSnorm16(x), EncodeSnorm16(y) };
+}
+
+Mesh::Normal CompactMesh::DecodeOctahedralNormal(const OctahedralNormal& encoded_normal) noexcept
+{
+    float x = std::max(static_cast<float>(encoded_normal[0]) / 32767.F, -1.F);
+    float y = std::max(static_cast<float>(encoded_normal[1]) / 32767.F, -1.F);
+    const float z = 1.F - std::abs(x) - std::abs(y);
+    if (z < 0.F)
+    {
+        const float unfolded_x = (1.F - std::abs(y)) * GetSignNotZero(x);
+        const float unfolded_y = (1.F - std::abs(x)) * GetSignNotZero(y);
+        x = unfolded_x;
+        y = unfolded_y;
+    }
+    const float length = std::sqrt(x * x + y * y + z * z);
+    return Normal(x / length, y / length, z / length);
+}
+
+uint16_t CompactMesh::EncodeUnorm16(float value) noexcept
+{
+    return static_cast<uint16_t>(std::lround(std::clamp(value, 0.F, 1.F) * 65535.F));
+}
+
+uint8_t CompactMesh::EncodeUnorm8(float value) noexcept
+{
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.F, 1.F) * 255.F));
+}
+
+} // namespace Methane::Graphics
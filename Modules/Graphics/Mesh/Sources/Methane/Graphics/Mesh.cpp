@@ -27,6 +27,9 @@ Abstract mesh class
 
 #include <magic_enum.hpp>
 #include <array>
+#include <algorithm>
+#include <numeric>
+#include <cassert>
 
 namespace Methane::Graphics
 {
@@ -46,6 +49,18 @@ Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index)
     return s_vertex_field_sizes[vertex_field_index];
 }
 
+Data::Size Mesh::GetVertexFieldSize(VertexField vertex_field, VertexFieldFormat field_format)
+{
+    switch (field_format)
+    {
+    case VertexFieldFormat::Half:       return 4U * sizeof(uint16_t);
+    case VertexFieldFormat::Octahedral: return 2U * sizeof(int16_t);
+    case VertexFieldFormat::Unorm16:    return 2U * sizeof(uint16_t);
+    case VertexFieldFormat::Unorm8:     return 4U * sizeof(uint8_t);
+    default:                            return GetVertexFieldSize(vertex_field);
+    }
+}
+
 const Mesh::Position2D& Mesh::GetFacePosition2D(size_t index)
 {
     // Quad vertices in clockwise order
@@ -107,6 +122,256 @@ Mesh::Index Mesh::GetFaceIndicesCount() noexcept
     return g_face_indices_count;
 }
 
+Data::Bytes Mesh::GetIndexData() const
+{
+    META_FUNCTION_TASK();
+    if (!HasIndex16Data())
+    {
+        const auto* indices_data_ptr = reinterpret_cast<Data::ConstRawPtr>(m_indices.data()); // NOSONAR
+        return Data::Bytes(indices_data_ptr, indices_data_ptr + GetIndexDataSize());
+    }
+
+    // Indices of small meshes are narrowed to 16-bit to halve index buffer size and bandwidth
+    Data::Bytes index_data(GetIndexDataSize());
+    auto* index16_data_ptr = reinterpret_cast<Index16*>(index_data.data()); // NOSONAR
+    std::transform(m_indices.begin(), m_indices.end(), index16_data_ptr,
+                   [](Index index) { return static_cast<Index16>(index); });
+    return index_data;
+}
+
+Mesh::VertexCacheStatistics Mesh::GetVertexCacheStatistics(uint32_t cache_size) const
+{
+    META_FUNCTION_TASK();
+    return SimulateVertexCache(m_indices, GetVertexCount(), cache_size);
+}
+
+Mesh::VertexCacheStatistics Mesh::SimulateVertexCache(const Indices& indices, Data::Size vertex_count, uint32_t cache_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(cache_size);
+    if (indices.empty() || !vertex_count)
+        return {};
+
+    // Vertex is in FIFO cache when less than cache size vertices were added to cache after it
+    std::vector<uint32_t> cache_timestamps(vertex_count, 0U);
+    uint32_t timestamp = cache_size + 1U;
+    uint32_t cache_misses_count = 0U;
+    for (Index index : indices)
+    {
+        META_CHECK_ARG_LESS(index, vertex_count);
+        if (timestamp - cache_timestamps[index] > cache_size)
+        {
+            cache_timestamps[index] = timestamp++;
+            cache_misses_count++;
+        }
+    }
+
+    return VertexCacheStatistics{
+        static_cast<float>(cache_misses_count) * 3.F / static_cast<float>(indices.size()),
+        static_cast<float>(cache_misses_count) / static_cast<float>(vertex_count)
+    };
+}
+
+Mesh::Indices Mesh::GetVertexCacheOptimizedIndices(const Indices& indices, Data::Size vertex_count, uint32_t cache_size,
+                                                   std::vector<Data::Index>& cluster_offsets)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(cache_size);
+    META_CHECK_ARG_DESCR(indices.size(), indices.size() % 3 == 0,
+                         "mesh indices count should be a multiple of three representing triangles list");
+
+    cluster_offsets.clear();
+    if (indices.empty())
+        return {};
+
+    // Vertex to adjacent triangles map in compressed sparse row format
+    std::vector<Data::Index> adjacency_offsets(vertex_count + 1U, 0U);
+    for (Index index : indices)
+    {
+        META_CHECK_ARG_LESS(index, vertex_count);
+        adjacency_offsets[index + 1U]++;
+    }
+    std::partial_sum(adjacency_offsets.begin(), adjacency_offsets.end(), adjacency_offsets.begin());
+
+    std::vector<Data::Index> adjacency_triangles(indices.size());
+    std::vector<Data::Index> adjacency_positions(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+    for (size_t index = 0; index < indices.size(); ++index)
+    {
+        adjacency_triangles[adjacency_positions[indices[index]]++] = static_cast<Data::Index>(index / 3U);
+    }
+
+    std::vector<Data::Size> live_triangles_counts(vertex_count);
+    for (Index vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+    {
+        live_triangles_counts[vertex_index] = adjacency_offsets[vertex_index + 1U] - adjacency_offsets[vertex_index];
+    }
+
+    std::vector<uint32_t> cache_timestamps(vertex_count, 0U);
+    std::vector<bool>     emitted_triangles(indices.size() / 3U, false);
+    std::vector<Index>    dead_end_stack;
+    std::vector<Index>    candidate_vertices;
+    Indices               optimized_indices;
+    optimized_indices.reserve(indices.size());
+
+    constexpr Index no_vertex      = std::numeric_limits<Index>::max();
+    uint32_t        timestamp      = cache_size + 1U;
+    Index           scan_vertex    = 0U;
+    Index           fanning_vertex = 0U;
+    cluster_offsets.push_back(0U);
+
+    const auto is_cached = [&cache_timestamps, &timestamp, cache_size](Index vertex_index)
+    {
+        return timestamp - cache_timestamps[vertex_index] <= cache_size;
+    };
+
+    while (fanning_vertex != no_vertex)
+    {
+        candidate_vertices.clear();
+
+        // Emit all live triangles adjacent to the fanning vertex
+        for (Data::Index adjacency_index = adjacency_offsets[fanning_vertex]; adjacency_index < adjacency_offsets[fanning_vertex + 1U]; ++adjacency_index)
+        {
+            const Data::Index triangle_index = adjacency_triangles[adjacency_index];
+            if (emitted_triangles[triangle_index])
+                continue;
+
+            emitted_triangles[triangle_index] = true;
+            for (Data::Index triangle_vertex = 0U; triangle_vertex < 3U; ++triangle_vertex)
+            {
+                const Index vertex_index = indices[triangle_index * 3U + triangle_vertex];
+                optimized_indices.push_back(vertex_index);
+                dead_end_stack.push_back(vertex_index);
+                candidate_vertices.push_back(vertex_index);
+                live_triangles_counts[vertex_index]--;
+                if (!is_cached(vertex_index))
+                {
+                    cache_timestamps[vertex_index] = timestamp++;
+                }
+            }
+        }
+
+        // Next fanning vertex is the oldest candidate in cache, which will still be in cache after emitting its live triangles;
+        // candidates with zero priority are still preferred over dead-end search, so the first candidate with live triangles is always taken
+        fanning_vertex = no_vertex;
+        uint32_t max_priority = 0U;
+        for (Index vertex_index : candidate_vertices)
+        {
+            if (!live_triangles_counts[vertex_index])
+                continue;
+
+            const uint32_t vertex_age = timestamp - cache_timestamps[vertex_index];
+            const uint32_t priority   = vertex_age + 2U * live_triangles_counts[vertex_index] <= cache_size ? vertex_age : 0U;
+            if (fanning_vertex == no_vertex || priority > max_priority)
+            {
+                max_priority   = priority;
+                fanning_vertex = vertex_index;
+            }
+        }
+
+        if (fanning_vertex != no_vertex)
+            continue;
+
+        // Dead-end: continue from the recently used vertex with live triangles or from the next vertex in input order
+        while (!dead_end_stack.empty() && fanning_vertex == no_vertex)
+        {
+            const Index vertex_index = dead_end_stack.back();
+            dead_end_stack.pop_back();
+            if (live_triangles_counts[vertex_index])
+                fanning_vertex = vertex_index;
+        }
+        for (; fanning_vertex == no_vertex && scan_vertex < vertex_count; ++scan_vertex)
+        {
+            if (live_triangles_counts[scan_vertex])
+                fanning_vertex = scan_vertex;
+        }
+
+        // New cluster starts when the fanning vertex is out of cache, so clusters reordering does not break cache locality
+        const auto emitted_triangles_count = static_cast<Data::Index>(optimized_indices.size() / 3U);
+        if (fanning_vertex != no_vertex && !is_cached(fanning_vertex) && emitted_triangles_count > cluster_offsets.back())
+        {
+            cluster_offsets.push_back(emitted_triangles_count);
+        }
+    }
+
+    return optimized_indices;
+}
+
+Mesh::Indices Mesh::GetOverdrawOptimizedIndices(const Indices& indices, const std::vector<Position>& positions,
+                                                const std::vector<Data::Index>& cluster_offsets)
+{
+    META_FUNCTION_TASK();
+    const auto triangles_count = static_cast<Data::Index>(indices.size() / 3U);
+    if (cluster_offsets.size() < 2U || positions.empty())
+        return indices;
+
+    HlslPosition mesh_centroid(0.F, 0.F, 0.F);
+    for (const Position& position : positions)
+    {
+        mesh_centroid += position.AsHlsl();
+    }
+    mesh_centroid = mesh_centroid / static_cast<float>(positions.size());
+
+    // Clusters facing outward of the mesh centroid are drawn first to occlude the inner clusters
+    std::vector<std::pair<float, Data::Index>> cluster_sort_keys;
+    cluster_sort_keys.reserve(cluster_offsets.size());
+    for (Data::Index cluster_index = 0U; cluster_index < cluster_offsets.size(); ++cluster_index)
+    {
+        const Data::Index triangle_begin = cluster_offsets[cluster_index];
+        const Data::Index triangle_end   = cluster_index + 1U < cluster_offsets.size() ? cluster_offsets[cluster_index + 1U] : triangles_count;
+
+        HlslPosition cluster_centroid(0.F, 0.F, 0.F);
+        HlslNormal   cluster_normal(0.F, 0.F, 0.F);
+        for (Data::Index triangle_index = triangle_begin; triangle_index < triangle_end; ++triangle_index)
+        {
+            const HlslPosition p1 = positions[indices[triangle_index * 3U]].AsHlsl();
+            const HlslPosition p2 = positions[indices[triangle_index * 3U + 1U]].AsHlsl();
+            const HlslPosition p3 = positions[indices[triangle_index * 3U + 2U]].AsHlsl();
+            cluster_centroid += (p1 + p2 + p3) / 3.F;
+            cluster_normal   += hlslpp::cross(p2 - p1, p3 - p1);
+        }
+        cluster_centroid = cluster_centroid / static_cast<float>(triangle_end - triangle_begin);
+
+        const float cluster_normal_length = hlslpp::length(cluster_normal);
+        const float cluster_sort_key      = cluster_normal_length > 0.F
+                                          ? static_cast<float>(hlslpp::dot(cluster_centroid - mesh_centroid, cluster_normal)) / cluster_normal_length
+                                          : 0.F;
+        cluster_sort_keys.emplace_back(-cluster_sort_key, cluster_index);
+    }
+
+    // Sorting by key and cluster index makes result deterministic
+    std::sort(cluster_sort_keys.begin(), cluster_sort_keys.end());
+
+    Indices optimized_indices;
+    optimized_indices.reserve(indices.size());
+    for (const auto& [cluster_sort_key, cluster_index] : cluster_sort_keys)
+    {
+        const Data::Index triangle_begin = cluster_offsets[cluster_index];
+        const Data::Index triangle_end   = cluster_index + 1U < cluster_offsets.size() ? cluster_offsets[cluster_index + 1U] : triangles_count;
+        optimized_indices.insert(optimized_indices.end(), indices.begin() + triangle_begin * 3U, indices.begin() + triangle_end * 3U);
+    }
+    return optimized_indices;
+}
+
+Mesh::Indices Mesh::GetVertexFetchRemap(const Indices& indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    constexpr Index unused_index = std::numeric_limits<Index>::max();
+    Indices vertex_remap(vertex_count, unused_index);
+    Index   next_vertex_index = 0U;
+    for (Index index : indices)
+    {
+        META_CHECK_ARG_LESS(index, vertex_count);
+        if (vertex_remap[index] == unused_index)
+            vertex_remap[index] = next_vertex_index++;
+    }
+    for (Index& remapped_index : vertex_remap)
+    {
+        if (remapped_index == unused_index)
+            remapped_index = next_vertex_index++;
+    }
+    return vertex_remap;
+}
+
 std::string_view Mesh::VertexLayout::GetSemanticByVertexField(VertexField vertex_field)
 {
     META_FUNCTION_TASK();
@@ -126,6 +391,68 @@ Mesh::VertexLayout::IncompatibleException::IncompatibleException(VertexField mis
     , m_missing_field(missing_field)
 { }
 
+bool Mesh::VertexLayout::IsFieldFormatSupported(VertexField vertex_field, VertexFieldFormat field_format) noexcept
+{
+    switch (field_format)
+    {
+    case VertexFieldFormat::Float:      return true;
+    case VertexFieldFormat::Half:       return vertex_field == VertexField::Position;
+    case VertexFieldFormat::Octahedral: return vertex_field == VertexField::Normal;
+    case VertexFieldFormat::Unorm16:    return vertex_field == VertexField::TexCoord;
+    case VertexFieldFormat::Unorm8:     return vertex_field == VertexField::Color;
+    default:                            return false;
+    }
+}
+
+PixelFormat Mesh::VertexLayout::GetPixelFormat(VertexFieldFormat field_format) noexcept
+{
+    switch (field_format)
+    {
+    case VertexFieldFormat::Half:       return PixelFormat::RGBA16Float;
+    case VertexFieldFormat::Octahedral: return PixelFormat::RG16Snorm;
+    case VertexFieldFormat::Unorm16:    return PixelFormat::RG16Unorm;
+    case VertexFieldFormat::Unorm8:     return PixelFormat::RGBA8Unorm;
+    default:                            return PixelFormat::Unknown;
+    }
+}
+
+Mesh::VertexLayout& Mesh::VertexLayout::SetFieldFormat(VertexField vertex_field, VertexFieldFormat field_format)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(field_format, IsFieldFormatSupported(vertex_field, field_format),
+                         "vertex field {} does not support this format", GetSemanticByVertexField(vertex_field));
+    if (std::find(begin(), end(), vertex_field) == end())
+        throw IncompatibleException(vertex_field);
+
+    m_field_formats[static_cast<size_t>(vertex_field)] = field_format;
+    return *this;
+}
+
+bool Mesh::VertexLayout::IsCompact() const noexcept
+{
+    return std::any_of(begin(), end(), [this](VertexField vertex_field)
+                       { return GetFieldFormat(vertex_field) != VertexFieldFormat::Float; });
+}
+
+std::vector<PixelFormat> Mesh::VertexLayout::GetFormats() const
+{
+    META_FUNCTION_TASK();
+    std::vector<PixelFormat> field_formats;
+    field_formats.reserve(size());
+    for(VertexField vertex_field : *this)
+    {
+        field_formats.emplace_back(GetPixelFormat(GetFieldFormat(vertex_field)));
+    }
+    return field_formats;
+}
+
+bool Mesh::VertexLayout::operator==(const VertexLayout& other) const noexcept
+{
+    return static_cast<const std::vector<VertexField>&>(*this) == static_cast<const std::vector<VertexField>&>(other) &&
+           std::all_of(begin(), end(), [this, &other](VertexField vertex_field)
+                       { return GetFieldFormat(vertex_field) == other.GetFieldFormat(vertex_field); });
+}
+
 std::vector<std::string_view> Mesh::VertexLayout::GetSemantics() const
 {
     META_FUNCTION_TASK();
@@ -139,11 +466,14 @@ std::vector<std::string_view> Mesh::VertexLayout::GetSemantics() const
     return semantic_names;
 }
 
-Mesh::Subset::Subset(Type in_mesh_type, const Slice& in_vertices, const Slice& in_indices, bool in_indices_adjusted)
+Mesh::Subset::Subset(Type in_mesh_type, const Slice& in_vertices, const Slice& in_indices, bool in_indices_adjusted,
+                     Data::Index in_lod_index, float in_lod_error)
     : mesh_type(in_mesh_type)
     , vertices(in_vertices)
     , indices(in_indices)
     , indices_adjusted(in_indices_adjusted)
+    , lod_index(in_lod_index)
+    , lod_error(in_lod_error)
 { }
 
 Mesh::VertexFieldOffsets Mesh::GetVertexFieldOffsets(const VertexLayout& vertex_layout)
@@ -157,7 +487,7 @@ Mesh::VertexFieldOffsets Mesh::GetVertexFieldOffsets(const VertexLayout& vertex_
     {
         const auto vertex_field_index = static_cast<size_t>(vertex_field);
         field_offsets[vertex_field_index] = static_cast<int32_t>(current_offset);
-        current_offset += GetVertexFieldSize(vertex_field_index);
+        current_offset += GetVertexFieldSize(vertex_field, vertex_layout.GetFieldFormat(vertex_field));
     }
 
     META_CHECK_ARG_NAME_DESCR("vertex_layout", field_offsets[static_cast<size_t>(VertexField::Position)] >= 0, "position field must be specified in vertex layout");
@@ -170,7 +500,7 @@ Data::Size Mesh::GetVertexSize(const VertexLayout& vertex_layout) noexcept
     Data::Size vertex_size = 0;
     for (VertexField vertex_field : vertex_layout)
     {
-        vertex_size += GetVertexFieldSize(vertex_field);
+        vertex_size += GetVertexFieldSize(vertex_field, vertex_layout.GetFieldFormat(vertex_field));
     }
     return vertex_size;
 }
@@ -211,4 +541,64 @@ bool Mesh::Edge::operator<(const Edge& other) const
           (first_index == other.first_index && second_index < other.second_index);
 }
 
+static size_t GetEdgeSlotTableSize(Data::Size edge_slots_count) noexcept
+{
+    // Table size is not less than edge slots count, so that it can not overflow even when all edges are unique,
+    // while closed meshes with two slots per edge have load factor not greater than 0.5
+    size_t table_size = 1U;
+    while (table_size < edge_slots_count)
+        table_size <<= 1U;
+    return table_size;
+}
+
+Mesh::EdgeSlotTable::EdgeSlotTable(Data::Size edge_slots_count)
+    : m_position_mask(GetEdgeSlotTableSize(edge_slots_count) - 1U)
+    , m_edge_keys(m_position_mask + 1U)
+    , m_first_slots(m_position_mask + 1U)
+{ }
+
+void Mesh::EdgeSlotTable::AddEdgeSlot(const Edge& edge, Data::Index edge_slot_index) noexcept
+{
+    const uint64_t edge_key = GetEdgeKey(edge);
+    size_t position = GetFirstPosition(edge_key);
+    for (;; position = (position + 1U) & m_position_mask)
+    {
+        uint64_t position_key = 0U;
+        if (m_edge_keys[position].compare_exchange_strong(position_key, edge_key, std::memory_order_acq_rel) ||
+            position_key == edge_key)
+            break;
+    }
+
+    // Atomic minimum of the edge slot indices
+    const uint32_t slot_value = edge_slot_index + 1U;
+    std::atomic<uint32_t>& first_slot = m_first_slots[position];
+    uint32_t first_slot_value = first_slot.load(std::memory_order_relaxed);
+    while ((!first_slot_value || slot_value < first_slot_value) &&
+           !first_slot.compare_exchange_weak(first_slot_value, slot_value, std::memory_order_relaxed));
+}
+
+Data::Index Mesh::EdgeSlotTable::GetFirstEdgeSlot(const Edge& edge) const noexcept
+{
+    const uint64_t edge_key = GetEdgeKey(edge);
+    size_t position = GetFirstPosition(edge_key);
+    while (m_edge_keys[position].load(std::memory_order_acquire) != edge_key)
+    {
+        assert(m_edge_keys[position].load(std::memory_order_relaxed) != 0U && "edge was not added to the table");
+        position = (position + 1U) & m_position_mask;
+    }
+    return m_first_slots[position].load(std::memory_order_relaxed) - 1U;
+}
+
+uint64_t Mesh::EdgeSlotTable::GetEdgeKey(const Edge& edge) noexcept
+{
+    // Key is incremented to distinguish it from empty position
+    return ((static_cast<uint64_t>(edge.first_index) << 32U) | edge.second_index) + 1U;
+}
+
+size_t Mesh::EdgeSlotTable::GetFirstPosition(uint64_t edge_key) const noexcept
+{
+    // Fibonacci hashing spreads sequential vertex indices over the table
+    return static_cast<size_t>((edge_key * 0x9E3779B97F4A7C15ULL) >> 32U) & m_position_mask;
+}
+
 } // namespace Methane::Graphics
@@ -0,0 +1,411 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshCache.cpp
+Versioned binary mesh container with vertex layout, subsets and aligned
+vertex and index data, which is viewed in place without copying.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Data/FileProvider.hpp>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace Methane::Graphics
+{
+
+// Binary layout: header, vertex layout fields, subsets, vertex data and index data aligned to MeshCache::data_alignment
+struct MeshCacheHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t data_size;
+    uint32_t mesh_type;
+    uint32_t vertex_fields_count;
+    uint32_t vertex_size;
+    uint32_t vertex_count;
+    uint32_t index_size;
+    uint32_t index_count;
+    uint32_t subsets_count;
+    uint32_t vertex_layout_offset;
+    uint32_t subsets_offset;
+    uint32_t vertex_data_offset;
+    uint32_t index_data_offset;
+    float    bounding_radius;
+    float    position_scale[3];
+    float    position_bias[3];
+    float    texcoord_scale[2];
+    float    texcoord_bias[2];
+    uint64_t generation_key;
+};
+
+struct MeshCacheVertexField
+{
+    uint32_t field;
+    uint32_t format;
+};
+
+struct MeshCacheSubset
+{
+    uint32_t mesh_type;
+    uint32_t vertex_offset;
+    uint32_t vertex_count;
+    uint32_t index_offset;
+    uint32_t index_count;
+    uint32_t indices_adjusted;
+    uint32_t lod_index;
+    float    lod_error;
+};
+
+static_assert(sizeof(MeshCacheHeader) == 112U);
+static_assert(sizeof(MeshCacheVertexField) == 8U);
+static_assert(sizeof(MeshCacheSubset) == 32U);
+
+static constexpr uint32_t g_mesh_cache_magic = 0x48534D4DU; // "MMSH" in little-endian byte order
+static constexpr uint64_t g_fnv_offset_basis = 0xCBF29CE484222325ULL;
+static constexpr uint64_t g_fnv_prime        = 0x100000001B3ULL;
+
+static uint64_t GetAlignedOffset(uint64_t offset) noexcept
+{
+    return (offset + MeshCache::data_alignment - 1U) / MeshCache::data_alignment * MeshCache::data_alignment;
+}
+
+template<typename T>
+static T ReadData(const Data::Chunk& data, uint64_t offset) noexcept
+{
+    T value;
+    std::memcpy(&value, data.GetDataPtr() + offset, sizeof(T));
+    return value;
+}
+
+template<typename T>
+static void WriteData(Data::Bytes& data, uint64_t offset, const T& value) noexcept
+{
+    std::memcpy(data.data() + offset, &value, sizeof(T));
+}
+
+template<typename IndexType>
+static bool AreIndicesInVertexRange(const Data::Chunk& data, uint64_t index_data_offset, uint32_t index_count, uint32_t vertex_count) noexcept
+{
+    for (uint64_t index = 0U; index < index_count; ++index)
+    {
+        if (ReadData<IndexType>(data, index_data_offset + index * sizeof(IndexType)) >= vertex_count)
+            return false;
+    }
+    return true;
+}
+
+static float GetMeshBoundingRadius(const Mesh& mesh, int32_t position_offset)
+{
+    META_FUNCTION_TASK();
+    if (const auto* compact_mesh_ptr = dynamic_cast<const CompactMesh*>(&mesh);
+        compact_mesh_ptr && mesh.GetVertexLayout().GetFieldFormat(Mesh::VertexField::Position) == Mesh::VertexFieldFormat::Half)
+    {
+        // Encoded positions are in [-1, 1] range, so bounding box half extent is equal to position scale
+        return compact_mesh_ptr->GetPositionEncoding().scale.GetLength();
+    }
+    if (!mesh.GetVertexCount())
+        return 0.F;
+
+    std::array<float, 3> min_position{ };
+    std::array<float, 3> max_position{ };
+    for (Data::Index vertex_index = 0U; vertex_index < mesh.GetVertexCount(); ++vertex_index)
+    {
+        std::array<float, 3> position{ };
+        std::memcpy(position.data(), mesh.GetVertexData() + static_cast<size_t>(vertex_index) * mesh.GetVertexSize() + position_offset, sizeof(position));
+        for (size_t component = 0U; component < 3U; ++component)
+        {
+            min_position[component] = vertex_index ? std::min(min_position[component], position[component]) : position[component];
+            max_position[component] = vertex_index ? std::max(max_position[component], position[component]) : position[component];
+        }
+    }
+    return std::hypot(max_position[0] - min_position[0], max_position[1] - min_position[1], max_position[2] - min_position[2]) / 2.F;
+}
+
+MeshCache::MeshCache(Data::Chunk&& data)
+    : m_data(std::move(data))
+{
+    META_FUNCTION_TASK();
+    // Data is validated even with checks disabled, since it is loaded from external files
+    if (!IsValidData(m_data))
+        throw std::invalid_argument("Mesh cache data is corrupted or has unsupported format version.");
+
+    const auto header = ReadData<MeshCacheHeader>(m_data, 0U);
+    m_type               = static_cast<Mesh::Type>(header.mesh_type);
+    m_vertex_size        = header.vertex_size;
+    m_vertex_count       = header.vertex_count;
+    m_index_size         = header.index_size;
+    m_index_count        = header.index_count;
+    m_vertex_data_offset = header.vertex_data_offset;
+    m_index_data_offset  = header.index_data_offset;
+    m_bounding_radius    = header.bounding_radius;
+    m_generation_key     = header.generation_key;
+    m_position_encoding.scale = Mesh::Position(header.position_scale[0], header.position_scale[1], header.position_scale[2]);
+    m_position_encoding.bias  = Mesh::Position(header.position_bias[0], header.position_bias[1], header.position_bias[2]);
+    m_texcoord_encoding.scale = Mesh::TexCoord(header.texcoord_scale[0], header.texcoord_scale[1]);
+    m_texcoord_encoding.bias  = Mesh::TexCoord(header.texcoord_bias[0], header.texcoord_bias[1]);
+
+    m_vertex_layout.reserve(header.vertex_fields_count);
+    for (uint32_t field_index = 0U; field_index < header.vertex_fields_count; ++field_index)
+    {
+        const auto field = ReadData<MeshCacheVertexField>(m_data, header.vertex_layout_offset + field_index * sizeof(MeshCacheVertexField));
+        m_vertex_layout.push_back(static_cast<Mesh::VertexField>(field.field));
+        m_vertex_layout.SetFieldFormat(static_cast<Mesh::VertexField>(field.field), static_cast<Mesh::VertexFieldFormat>(field.format));
+    }
+
+    m_subsets.reserve(header.subsets_count);
+    for (uint32_t subset_index = 0U; subset_index < header.subsets_count; ++subset_index)
+    {
+        const auto subset = ReadData<MeshCacheSubset>(m_data, header.subsets_offset + subset_index * sizeof(MeshCacheSubset));
+        m_subsets.emplace_back(static_cast<Mesh::Type>(subset.mesh_type),
+                               Mesh::Subset::Slice(subset.vertex_offset, subset.vertex_count),
+                               Mesh::Subset::Slice(subset.index_offset, subset.index_count),
+                               subset.indices_adjusted != 0U, subset.lod_index, subset.lod_error);
+    }
+}
+
+MeshCache MeshCache::Load(const Data::IProvider& data_provider, const std::string& data_path)
+{
+    META_FUNCTION_TASK();
+    return MeshCache(data_provider.GetData(data_path));
+}
+
+bool MeshCache::IsValidData(const Data::Chunk& data) noexcept
+{
+    META_FUNCTION_TASK();
+    if (data.IsEmptyOrNull() || data.GetDataSize() < sizeof(MeshCacheHeader))
+        return false;
+
+    const auto header = ReadData<MeshCacheHeader>(data, 0U);
+    if (header.magic != g_mesh_cache_magic || header.version != format_version ||
+        header.header_size != sizeof(MeshCacheHeader) || header.data_size > data.GetDataSize() ||
+        !magic_enum::enum_contains<Mesh::Type>(static_cast<std::underlying_type_t<Mesh::Type>>(header.mesh_type)) ||
+        header.vertex_data_offset % data_alignment || header.index_data_offset % data_alignment)
+        return false;
+
+    const auto is_range_valid = [&header](uint64_t offset, uint64_t count, uint64_t size)
+    {
+        return offset >= header.header_size && offset + count * size <= header.data_size;
+    };
+    if (!is_range_valid(header.vertex_layout_offset, header.vertex_fields_count, sizeof(MeshCacheVertexField)) ||
+        !is_range_valid(header.subsets_offset, header.subsets_count, sizeof(MeshCacheSubset)) ||
+        !is_range_valid(header.vertex_data_offset, header.vertex_count, header.vertex_size) ||
+        !is_range_valid(header.index_data_offset, header.index_count, header.index_size))
+        return false;
+
+    // Index size is defined by vertex count in the same way as for the mesh
+    const Data::Size index_size = header.vertex_count <= Mesh::max_index16_vertex_count ? sizeof(Mesh::Index16) : sizeof(Mesh::Index);
+    if (header.index_size != index_size)
+        return false;
+
+    Mesh::VertexLayout vertex_layout;
+    for (uint32_t field_index = 0U; field_index < header.vertex_fields_count; ++field_index)
+    {
+        const auto field = ReadData<MeshCacheVertexField>(data, header.vertex_layout_offset + field_index * sizeof(MeshCacheVertexField));
+        const auto vertex_field = static_cast<Mesh::VertexField>(field.field);
+        if (field.field >= static_cast<uint32_t>(Mesh::VertexField::Count) ||
+            std::find(vertex_layout.begin(), vertex_layout.end(), vertex_field) != vertex_layout.end() ||
+            !Mesh::VertexLayout::IsFieldFormatSupported(vertex_field, static_cast<Mesh::VertexFieldFormat>(field.format)))
+            return false;
+
+        vertex_layout.push_back(vertex_field);
+        vertex_layout.SetFieldFormat(vertex_field, static_cast<Mesh::VertexFieldFormat>(field.format));
+    }
+    if (std::find(vertex_layout.begin(), vertex_layout.end(), Mesh::VertexField::Position) == vertex_layout.end() ||
+        Mesh::GetVertexSize(vertex_layout) != header.vertex_size)
+        return false;
+
+    for (uint32_t subset_index = 0U; subset_index < header.subsets_count; ++subset_index)
+    {
+        const auto subset = ReadData<MeshCacheSubset>(data, header.subsets_offset + subset_index * sizeof(MeshCacheSubset));
+        if (!magic_enum::enum_contains<Mesh::Type>(static_cast<std::underlying_type_t<Mesh::Type>>(subset.mesh_type)) ||
+            static_cast<uint64_t>(subset.vertex_offset) + subset.vertex_count > header.vertex_count ||
+            static_cast<uint64_t>(subset.index_offset) + subset.index_count > header.index_count)
+            return false;
+    }
+
+    // Every index is checked to be in vertex range, so that corrupted index data can not make GPU read out of vertex buffer
+    return index_size == sizeof(Mesh::Index16)
+         ? AreIndicesInVertexRange<Mesh::Index16>(data, header.index_data_offset, header.index_count, header.vertex_count)
+         : AreIndicesInVertexRange<Mesh::Index>(data, header.index_data_offset, header.index_count, header.vertex_count);
+}
+
+Data::Bytes MeshCache::Serialize(const Mesh& mesh, const Mesh::Subsets& subsets, uint64_t generation_key)
+{
+    META_FUNCTION_TASK();
+    const Mesh::VertexLayout& vertex_layout = mesh.GetVertexLayout();
+    const Mesh::Subsets mesh_subsets = !subsets.empty()
+                                     ? subsets
+                                     : Mesh::Subsets{
+                                         Mesh::Subset(mesh.GetType(), { 0, mesh.GetVertexCount() }, { 0, mesh.GetIndexCount() }, true)
+                                       };
+
+    MeshCacheHeader header{};
+    header.magic                = g_mesh_cache_magic;
+    header.version              = format_version;
+    header.header_size          = sizeof(MeshCacheHeader);
+    header.mesh_type            = static_cast<uint32_t>(mesh.GetType());
+    header.vertex_fields_count  = static_cast<uint32_t>(vertex_layout.size());
+    header.vertex_size          = mesh.GetVertexSize();
+    header.vertex_count         = mesh.GetVertexCount();
+    header.index_size           = mesh.GetIndexSize();
+    header.index_count          = mesh.GetIndexCount();
+    header.subsets_count        = static_cast<uint32_t>(mesh_subsets.size());
+    header.bounding_radius      = GetMeshBoundingRadius(mesh, mesh.GetVertexFieldOffset(Mesh::VertexField::Position));
+    header.generation_key       = generation_key;
+
+    CompactMesh::PositionEncoding position_encoding;
+    CompactMesh::TexCoordEncoding texcoord_encoding;
+    if (const auto* compact_mesh_ptr = dynamic_cast<const CompactMesh*>(&mesh); compact_mesh_ptr)
+    {
+        position_encoding = compact_mesh_ptr->GetPositionEncoding();
+        texcoord_encoding = compact_mesh_ptr->GetTexCoordEncoding();
+    }
+
+    for (size_t component = 0U; component < 3U; ++component)
+    {
+        header.position_scale[component] = position_encoding.scale[component];
+        header.position_bias[component]  = position_encoding.bias[component];
+    }
+    for (size_t component = 0U; component < 2U; ++component)
+    {
+        header.texcoord_scale[component] = texcoord_encoding.scale[component];
+        header.texcoord_bias[component]  = texcoord_encoding.bias[component];
+    }
+
+    const uint64_t vertex_layout_offset = sizeof(MeshCacheHeader);
+    const uint64_t subsets_offset       = vertex_layout_offset + vertex_layout.size() * sizeof(MeshCacheVertexField);
+    const uint64_t vertex_data_offset   = GetAlignedOffset(subsets_offset + mesh_subsets.size() * sizeof(MeshCacheSubset));
+    const uint64_t index_data_offset    = GetAlignedOffset(vertex_data_offset + mesh.GetVertexDataSize());
+    const uint64_t data_size            = GetAlignedOffset(index_data_offset + mesh.GetIndexDataSize());
+    META_CHECK_ARG_LESS_DESCR(data_size, std::numeric_limits<Data::Size>::max(), "mesh is too big to be stored in mesh cache");
+
+    header.vertex_layout_offset = static_cast<uint32_t>(vertex_layout_offset);
+    header.subsets_offset       = static_cast<uint32_t>(subsets_offset);
+    header.vertex_data_offset   = static_cast<uint32_t>(vertex_data_offset);
+    header.index_data_offset    = static_cast<uint32_t>(index_data_offset);
+    header.data_size            = static_cast<uint32_t>(data_size);
+
+    Data::Bytes data(data_size, Data::Byte{ 0 });
+    WriteData(data, 0U, header);
+
+    for (size_t field_index = 0U; field_index < vertex_layout.size(); ++field_index)
+    {
+        const Mesh::VertexField vertex_field = vertex_layout[field_index];
+        WriteData(data, vertex_layout_offset + field_index * sizeof(MeshCacheVertexField), MeshCacheVertexField{
+            static_cast<uint32_t>(vertex_field),
+            static_cast<uint32_t>(vertex_layout.GetFieldFormat(vertex_field))
+        });
+    }
+
+    for (size_t subset_index = 0U; subset_index < mesh_subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& subset = mesh_subsets[subset_index];
+        META_CHECK_ARG_LESS_OR_EQUAL(subset.vertices.offset + subset.vertices.count, mesh.GetVertexCount());
+        META_CHECK_ARG_LESS_OR_EQUAL(subset.indices.offset + subset.indices.count, mesh.GetIndexCount());
+        WriteData(data, subsets_offset + subset_index * sizeof(MeshCacheSubset), MeshCacheSubset{
+            static_cast<uint32_t>(subset.mesh_type),
+            subset.vertices.offset, subset.vertices.count,
+            subset.indices.offset, subset.indices.count,
+            subset.indices_adjusted ? 1U : 0U,
+            subset.lod_index, subset.lod_error
+        });
+    }
+
+    if (mesh.GetVertexDataSize())
+        std::memcpy(data.data() + vertex_data_offset, mesh.GetVertexData(), mesh.GetVertexDataSize());
+
+    const Data::Bytes index_data = mesh.GetIndexData();
+    std::copy(index_data.begin(), index_data.end(), data.begin() + static_cast<ptrdiff_t>(index_data_offset));
+    return data;
+}
+
+void MeshCache::Save(const Data::Bytes& data, const std::filesystem::path& file_path)
+{
+    META_FUNCTION_TASK();
+    if (file_path.has_parent_path())
+        std::filesystem::create_directories(file_path.parent_path());
+
+    // Cache data is written to temporary file first and then renamed to prevent loading of partially written cache
+    const std::filesystem::path temp_file_path = std::filesystem::path(file_path).concat(".tmp");
+    {
+        std::ofstream fs(temp_file_path, std::ios::binary | std::ios::trunc);
+        fs.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOSONAR
+        fs.close();
+        if (!fs.good())
+        {
+            std::error_code remove_error;
+            std::filesystem::remove(temp_file_path, remove_error);
+            throw std::runtime_error(fmt::format("Failed to write mesh cache file '{}'.", temp_file_path.string()));
+        }
+    }
+    std::filesystem::rename(temp_file_path, file_path);
+}
+
+Data::Chunk MeshCache::LoadFile(const std::filesystem::path& cache_file_path, uint64_t generation_key)
+{
+    META_FUNCTION_TASK();
+    // Absolute path is used to load file from the same location where it is saved, independent of resources directory
+    const std::string  absolute_file_path = std::filesystem::absolute(cache_file_path).string();
+    Data::IProvider&   file_provider      = Data::FileProvider::Get();
+    if (!file_provider.HasData(absolute_file_path))
+        return {};
+
+    // Stale or corrupted cache file is ignored to be regenerated
+    Data::Chunk cache_data = file_provider.GetData(absolute_file_path);
+    if (!IsValidData(cache_data) || ReadData<MeshCacheHeader>(cache_data, 0U).generation_key != generation_key)
+        return {};
+
+    return Data::Chunk(std::move(cache_data));
+}
+
+uint64_t MeshCache::GetVertexLayoutKey(Mesh::Type mesh_type, const Mesh::VertexLayout& vertex_layout) noexcept
+{
+    const std::array<uint32_t, 2> key_header{ format_version, static_cast<uint32_t>(mesh_type) };
+    uint64_t key = GetDataKey(g_fnv_offset_basis, key_header.data(), sizeof(key_header));
+    for (Mesh::VertexField vertex_field : vertex_layout)
+    {
+        const MeshCacheVertexField field{ static_cast<uint32_t>(vertex_field), static_cast<uint32_t>(vertex_layout.GetFieldFormat(vertex_field)) };
+        key = GetDataKey(key, &field, sizeof(field));
+    }
+    return key;
+}
+
+uint64_t MeshCache::GetDataKey(uint64_t key, const void* data_ptr, size_t data_size) noexcept
+{
+    // FNV-1a hash is stable between runs and platforms with the same byte order
+    const auto* bytes_ptr = static_cast<const uint8_t*>(data_ptr);
+    for (size_t byte_index = 0U; byte_index < data_size; ++byte_index)
+    {
+        key = (key ^ bytes_ptr[byte_index]) * g_fnv_prime;
+    }
+    return key;
+}
+
+} // namespace Methane::Graphics
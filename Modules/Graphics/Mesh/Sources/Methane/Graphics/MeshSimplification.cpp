@@ -0,0 +1,410 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshSimplification.cpp
+Mesh triangles simplification with half-edge collapses ordered by quadric error metric.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Mesh.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+
+namespace Methane::Graphics
+{
+
+using Vector3D = std::array<double, 3>;
+
+static Vector3D GetVector3D(const Mesh::Position& position) noexcept
+{
+    return { static_cast<double>(position.GetX()), static_cast<double>(position.GetY()), static_cast<double>(position.GetZ()) };
+}
+
+static Vector3D Subtract(const Vector3D& a, const Vector3D& b) noexcept
+{
+    return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+}
+
+static Vector3D Cross(const Vector3D& a, const Vector3D& b) noexcept
+{
+    return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+static double Dot(const Vector3D& a, const Vector3D& b) noexcept
+{
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+// Symmetric 4x4 matrix of the quadric error metric, which evaluates sum of squared distances from point to the accumulated planes
+class Quadric
+{
+public:
+    Quadric() = default;
+
+    Quadric(const Vector3D& plane_normal, double plane_distance) noexcept
+        : m_coeffs{
+            plane_normal[0] * plane_normal[0], plane_normal[0] * plane_normal[1], plane_normal[0] * plane_normal[2], plane_normal[0] * plane_distance,
+                                               plane_normal[1] * plane_normal[1], plane_normal[1] * plane_normal[2], plane_normal[1] * plane_distance,
+                                                                                  plane_normal[2] * plane_normal[2], plane_normal[2] * plane_distance,
+                                                                                                                     plane_distance  * plane_distance
+        }
+    { }
+
+    Quadric& operator+=(const Quadric& other) noexcept
+    {
+        for (size_t i = 0; i < m_coeffs.size(); ++i)
+            m_coeffs[i] += other.m_coeffs[i];
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const noexcept
+    {
+        Quadric sum(*this);
+        sum += other;
+        return sum;
+    }
+
+    [[nodiscard]] double GetError(const Vector3D& p) const noexcept
+    {
+        const double error = m_coeffs[0] * p[0] * p[0] + 2.0 * m_coeffs[1] * p[0] * p[1] + 2.0 * m_coeffs[2] * p[0] * p[2] + 2.0 * m_coeffs[3] * p[0]
+                           + m_coeffs[4] * p[1] * p[1] + 2.0 * m_coeffs[5] * p[1] * p[2] + 2.0 * m_coeffs[6] * p[1]
+                           + m_coeffs[7] * p[2] * p[2] + 2.0 * m_coeffs[8] * p[2]
+                           + m_coeffs[9];
+        return std::max(error, 0.0);
+    }
+
+private:
+    std::array<double, 10> m_coeffs{ };
+};
+
+// Collapse is rejected when it rotates any remaining triangle by more than ~75 degrees
+static constexpr double g_min_normal_cos = 0.25;
+
+// Half-edge collapse of the source vertex to the target vertex, which is kept in simplified mesh
+struct EdgeCollapse
+{
+    double      error;
+    Mesh::Index source_vertex;
+    Mesh::Index target_vertex;
+    uint32_t    source_version;
+
+    // Reversed order for the min-heap, ties are resolved by vertex indices to make result deterministic
+    bool operator<(const EdgeCollapse& other) const noexcept
+    {
+        return std::tie(error, source_vertex, target_vertex) > std::tie(other.error, other.source_vertex, other.target_vertex);
+    }
+};
+
+class TriangleSimplifier
+{
+public:
+    TriangleSimplifier(const Mesh::Indices& indices, const std::vector<Mesh::Position>& positions)
+        : m_indices(indices)
+        , m_positions(positions.size())
+        , m_quadrics(positions.size())
+        , m_vertex_triangles(positions.size())
+        , m_vertex_versions(positions.size(), 0U)
+        , m_is_vertex_locked(positions.size(), false)
+        , m_is_vertex_removed(positions.size(), false)
+        , m_is_triangle_removed(indices.size() / 3U, false)
+        , m_triangles_count(static_cast<Data::Size>(indices.size() / 3U))
+    {
+        META_FUNCTION_TASK();
+        std::transform(positions.begin(), positions.end(), m_positions.begin(), GetVector3D);
+
+        // Mesh is scaled to unit radius of its bounding sphere so that simplification error does not depend on mesh size
+        Vector3D min_position = { std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max() };
+        Vector3D max_position = { std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest() };
+        for (const Vector3D& position : m_positions)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                min_position[i] = std::min(min_position[i], position[i]);
+                max_position[i] = std::max(max_position[i], position[i]);
+            }
+        }
+        const Vector3D diagonal = Subtract(max_position, min_position);
+        m_bounding_radius = std::sqrt(Dot(diagonal, diagonal)) / 2.0;
+        if (m_bounding_radius <= 0.0)
+            m_bounding_radius = 1.0;
+
+        std::unordered_map<uint64_t, uint32_t> edge_triangle_counts;
+        edge_triangle_counts.reserve(m_indices.size());
+        for (Data::Index triangle_index = 0; triangle_index < m_triangles_count; ++triangle_index)
+        {
+            const Mesh::Index* triangle = &m_indices[triangle_index * 3U];
+            const Vector3D& p0 = m_positions[triangle[0]];
+            Vector3D plane_normal = Cross(Subtract(m_positions[triangle[1]], p0), Subtract(m_positions[triangle[2]], p0));
+            const double normal_length = std::sqrt(Dot(plane_normal, plane_normal));
+            if (normal_length > 0.0)
+            {
+                for (double& normal_component : plane_normal)
+                    normal_component /= normal_length;
+
+                const Quadric triangle_quadric(plane_normal, -Dot(plane_normal, p0));
+                for (size_t i = 0; i < 3; ++i)
+                    m_quadrics[triangle[i]] += triangle_quadric;
+            }
+            for (size_t i = 0; i < 3; ++i)
+            {
+                m_vertex_triangles[triangle[i]].push_back(triangle_index);
+                ++edge_triangle_counts[GetEdgeKey(triangle[i], triangle[(i + 1) % 3])];
+            }
+        }
+
+        // Vertices of border and non-manifold edges are locked to preserve mesh silhouette and attribute seams
+        for (const auto& [edge_key, triangles_count] : edge_triangle_counts)
+        {
+            if (triangles_count == 2U)
+                continue;
+
+            m_is_vertex_locked[static_cast<size_t>(edge_key >> 32U)] = true;
+            m_is_vertex_locked[static_cast<size_t>(edge_key & 0xFFFFFFFFU)] = true;
+        }
+
+        for (Mesh::Index vertex_index = 0; vertex_index < m_positions.size(); ++vertex_index)
+        {
+            AddBestEdgeCollapse(vertex_index);
+        }
+    }
+
+    void Simplify(Data::Size target_triangles_count, double max_error)
+    {
+        META_FUNCTION_TASK();
+        while (m_triangles_count > target_triangles_count && !m_collapses_queue.empty())
+        {
+            const EdgeCollapse collapse = m_collapses_queue.top();
+            m_collapses_queue.pop();
+            if (m_is_vertex_removed[collapse.source_vertex] || collapse.source_version != m_vertex_versions[collapse.source_vertex])
+                continue;
+
+            if (collapse.error > max_error)
+                break;
+
+            // Collapse could be invalidated by the changed neighbourhood of its target vertex
+            if (!IsValidEdgeCollapse(collapse.source_vertex, collapse.target_vertex, GetAdjacentVertices(collapse.source_vertex)))
+            {
+                ++m_vertex_versions[collapse.source_vertex];
+                AddBestEdgeCollapse(collapse.source_vertex);
+                continue;
+            }
+
+            Collapse(collapse.source_vertex, collapse.target_vertex);
+            m_error = std::max(m_error, collapse.error);
+        }
+    }
+
+    [[nodiscard]] Mesh::Indices GetIndices() const
+    {
+        META_FUNCTION_TASK();
+        Mesh::Indices simplified_indices;
+        simplified_indices.reserve(m_triangles_count * 3U);
+        for (Data::Index triangle_index = 0; triangle_index < m_is_triangle_removed.size(); ++triangle_index)
+        {
+            if (m_is_triangle_removed[triangle_index])
+                continue;
+
+            simplified_indices.insert(simplified_indices.end(), m_indices.begin() + triangle_index * 3U, m_indices.begin() + triangle_index * 3U + 3U);
+        }
+        return simplified_indices;
+    }
+
+    [[nodiscard]] double GetError() const noexcept { return m_error; }
+
+private:
+    [[nodiscard]] static uint64_t GetEdgeKey(Mesh::Index v1_index, Mesh::Index v2_index) noexcept
+    {
+        return (static_cast<uint64_t>(std::min(v1_index, v2_index)) << 32U) | static_cast<uint64_t>(std::max(v1_index, v2_index));
+    }
+
+    [[nodiscard]] const Mesh::Index* GetTriangle(Data::Index triangle_index) const noexcept { return &m_indices[triangle_index * 3U]; }
+
+    template<typename TriangleFuncType>
+    void ForEachVertexTriangle(Mesh::Index vertex_index, const TriangleFuncType& triangle_func) const
+    {
+        for (Data::Index triangle_index : m_vertex_triangles[vertex_index])
+        {
+            if (!m_is_triangle_removed[triangle_index])
+                triangle_func(triangle_index, GetTriangle(triangle_index));
+        }
+    }
+
+    [[nodiscard]] std::vector<Mesh::Index> GetAdjacentVertices(Mesh::Index vertex_index) const
+    {
+        std::vector<Mesh::Index> adjacent_vertices;
+        ForEachVertexTriangle(vertex_index, [&adjacent_vertices, vertex_index](Data::Index, const Mesh::Index* triangle)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (triangle[i] != vertex_index)
+                    adjacent_vertices.push_back(triangle[i]);
+            }
+        });
+        std::sort(adjacent_vertices.begin(), adjacent_vertices.end());
+        adjacent_vertices.erase(std::unique(adjacent_vertices.begin(), adjacent_vertices.end()), adjacent_vertices.end());
+        return adjacent_vertices;
+    }
+
+    // Collapse is valid when it keeps mesh manifold (link condition) and does not flip remaining triangles around the source vertex
+    [[nodiscard]] bool IsValidEdgeCollapse(Mesh::Index source_vertex, Mesh::Index target_vertex,
+                                           const std::vector<Mesh::Index>& source_adjacent_vertices) const
+    {
+        const std::vector<Mesh::Index> target_adjacent_vertices = GetAdjacentVertices(target_vertex);
+        std::vector<Mesh::Index> common_adjacent_vertices;
+        std::set_intersection(source_adjacent_vertices.begin(), source_adjacent_vertices.end(),
+                              target_adjacent_vertices.begin(), target_adjacent_vertices.end(),
+                              std::back_inserter(common_adjacent_vertices));
+
+        Data::Size edge_triangles_count = 0U;
+        bool is_triangle_flipped = false;
+        ForEachVertexTriangle(source_vertex, [this, source_vertex, target_vertex, &edge_triangles_count, &is_triangle_flipped]
+                                             (Data::Index, const Mesh::Index* triangle)
+        {
+            if (triangle[0] == target_vertex || triangle[1] == target_vertex || triangle[2] == target_vertex)
+            {
+                ++edge_triangles_count;
+                return;
+            }
+
+            std::array<Vector3D, 3> triangle_positions{ };
+            for (size_t i = 0; i < 3; ++i)
+                triangle_positions[i] = m_positions[triangle[i]];
+
+            const Vector3D old_normal = Cross(Subtract(triangle_positions[1], triangle_positions[0]), Subtract(triangle_positions[2], triangle_positions[0]));
+            for (size_t i = 0; i < 3; ++i)
+            {
+                if (triangle[i] == source_vertex)
+                    triangle_positions[i] = m_positions[target_vertex];
+            }
+            const Vector3D new_normal = Cross(Subtract(triangle_positions[1], triangle_positions[0]), Subtract(triangle_positions[2], triangle_positions[0]));
+            if (Dot(old_normal, new_normal) <= g_min_normal_cos * std::sqrt(Dot(old_normal, old_normal) * Dot(new_normal, new_normal)))
+                is_triangle_flipped = true;
+        });
+
+        return !is_triangle_flipped && common_adjacent_vertices.size() == edge_triangles_count;
+    }
+
+    // The cheapest valid collapse of the source vertex is queued, it stays valid until the vertex neighbourhood is changed
+    void AddBestEdgeCollapse(Mesh::Index source_vertex)
+    {
+        if (m_is_vertex_locked[source_vertex] || m_is_vertex_removed[source_vertex])
+            return;
+
+        const std::vector<Mesh::Index> adjacent_vertices = GetAdjacentVertices(source_vertex);
+        std::vector<EdgeCollapse> edge_collapses;
+        edge_collapses.reserve(adjacent_vertices.size());
+        for (Mesh::Index target_vertex : adjacent_vertices)
+        {
+            const Quadric collapse_quadric = m_quadrics[source_vertex] + m_quadrics[target_vertex];
+            const double  collapse_error   = std::sqrt(collapse_quadric.GetError(m_positions[target_vertex])) / m_bounding_radius;
+            edge_collapses.push_back({ collapse_error, source_vertex, target_vertex, m_vertex_versions[source_vertex] });
+        }
+
+        // EdgeCollapse::operator< is reversed for the min-heap, so sorting puts the cheapest collapse to the end
+        std::sort(edge_collapses.begin(), edge_collapses.end());
+        for (auto edge_collapse_it = edge_collapses.rbegin(); edge_collapse_it != edge_collapses.rend(); ++edge_collapse_it)
+        {
+            if (IsValidEdgeCollapse(source_vertex, edge_collapse_it->target_vertex, adjacent_vertices))
+            {
+                m_collapses_queue.push(*edge_collapse_it);
+                return;
+            }
+        }
+    }
+
+    void Collapse(Mesh::Index source_vertex, Mesh::Index target_vertex)
+    {
+        for (Data::Index triangle_index : m_vertex_triangles[source_vertex])
+        {
+            if (m_is_triangle_removed[triangle_index])
+                continue;
+
+            Mesh::Index* triangle = &m_indices[triangle_index * 3U];
+            if (triangle[0] == target_vertex || triangle[1] == target_vertex || triangle[2] == target_vertex)
+            {
+                m_is_triangle_removed[triangle_index] = true;
+                --m_triangles_count;
+                continue;
+            }
+
+            std::replace(triangle, triangle + 3, source_vertex, target_vertex);
+            m_vertex_triangles[target_vertex].push_back(triangle_index);
+        }
+        m_vertex_triangles[source_vertex].clear();
+        m_quadrics[target_vertex] += m_quadrics[source_vertex];
+        m_is_vertex_removed[source_vertex] = true;
+
+        // Removed triangles are dropped from adjacency of the target vertex to keep its triangle list short
+        std::vector<Data::Index>& target_triangles = m_vertex_triangles[target_vertex];
+        target_triangles.erase(std::remove_if(target_triangles.begin(), target_triangles.end(),
+                                              [this](Data::Index triangle_index) { return m_is_triangle_removed[triangle_index]; }),
+                               target_triangles.end());
+
+        // Collapses of all vertices in the changed neighbourhood are re-evaluated, outdated ones are skipped by version
+        std::vector<Mesh::Index> changed_vertices = GetAdjacentVertices(target_vertex);
+        changed_vertices.push_back(target_vertex);
+        for (Mesh::Index vertex_index : changed_vertices)
+        {
+            ++m_vertex_versions[vertex_index];
+            AddBestEdgeCollapse(vertex_index);
+        }
+    }
+
+    Mesh::Indices                            m_indices;
+    std::vector<Vector3D>                    m_positions;
+    std::vector<Quadric>                     m_quadrics;
+    std::vector<std::vector<Data::Index>>    m_vertex_triangles;
+    std::vector<uint32_t>                    m_vertex_versions;
+    std::vector<bool>                        m_is_vertex_locked;
+    std::vector<bool>                        m_is_vertex_removed;
+    std::vector<bool>                        m_is_triangle_removed;
+    std::priority_queue<EdgeCollapse>        m_collapses_queue;
+    Data::Size                               m_triangles_count;
+    double                                   m_bounding_radius = 1.0;
+    double                                   m_error = 0.0;
+};
+
+Mesh::Indices Mesh::GetSimplifiedIndices(const Indices& indices, const std::vector<Position>& positions,
+                                         Data::Size target_index_count, float max_error, float& result_error)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(indices.size(), indices.size() % 3U == 0U, "mesh indices count should be a multiple of three");
+    result_error = 0.F;
+    if (target_index_count >= indices.size())
+        return indices;
+
+    for (Index index : indices)
+    {
+        META_CHECK_ARG_LESS(index, positions.size());
+    }
+
+    TriangleSimplifier simplifier(indices, positions);
+    simplifier.Simplify(target_index_count / 3U, static_cast<double>(max_error));
+    result_error = static_cast<float>(simplifier.GetError());
+    return simplifier.GetIndices();
+}
+
+} // namespace Methane::Graphics
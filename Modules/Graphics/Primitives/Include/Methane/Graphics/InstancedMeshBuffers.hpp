@@ -0,0 +1,208 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: InstancedMeshBuffers.hpp
+Mesh buffers with per-instance data packed in vertex-rate instance buffer
+and drawn with a single instanced draw call per mesh subset.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MeshBuffersBase.h"
+
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+template<typename InstanceType>
+class InstancedMeshBuffers
+    : public MeshBuffersBase
+{
+public:
+    using Instances = std::vector<InstanceType>;
+
+    template<typename VertexType>
+    InstancedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VertexType>& mesh_data,
+                         std::string_view mesh_name, Data::Size instance_count, const Mesh::Subsets& mesh_subsets = Mesh::Subsets())
+        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets)
+    {
+        META_FUNCTION_TASK();
+        SetInstanceCount(instance_count);
+    }
+
+    template<typename VertexType>
+    InstancedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data,
+                         std::string_view mesh_name, Data::Size instance_count)
+        : InstancedMeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, instance_count, uber_mesh_data.GetSubsets())
+    { }
+
+    [[nodiscard]] Data::Size GetInstanceCount() const noexcept
+    {
+        return static_cast<Data::Size>(m_instances.size());
+    }
+
+    [[nodiscard]]
+    static constexpr Data::Size GetInstanceSize() noexcept
+    {
+        return static_cast<Data::Size>(sizeof(InstanceType));
+    }
+
+    // Instance buffer is created separately in frame dependent resources with size enough to hold all instances
+    [[nodiscard]] Data::Size GetInstanceBufferSize() const noexcept
+    {
+        return GetInstanceCount() * GetInstanceSize();
+    }
+
+    [[nodiscard]]
+    const InstanceType& GetInstanceData(Data::Index instance_index) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_LESS(instance_index, m_instances.size());
+        return m_instances[instance_index];
+    }
+
+    // Instance data can be changed every frame from multiple threads for different instances
+    void SetInstanceData(InstanceType&& instance_data, Data::Index instance_index)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_LESS(instance_index, m_instances.size());
+        m_instances[instance_index] = std::move(instance_data);
+    }
+
+    // All instances are packed for drawing grouped by mesh subsets, keeping ascending order of instances in every group
+    Data::Size PackInstances()
+    {
+        META_FUNCTION_TASK();
+        const std::vector<Data::Index>& instance_subset_indices = GetInstanceSubsetIndices();
+        CountSubsetInstances(instance_subset_indices.begin(), instance_subset_indices.end());
+
+        m_packed_instances.resize(GetInstanceCount());
+        SubsetInstanceOffsets subset_pack_offsets(m_subset_instance_offsets.begin(), m_subset_instance_offsets.end() - 1);
+        for (Data::Index instance_index = 0U; instance_index < m_instances.size(); ++instance_index)
+        {
+            m_packed_instances[subset_pack_offsets[instance_subset_indices[instance_index]]++] = m_instances[instance_index];
+        }
+        return GetPackedInstanceCount();
+    }
+
+    // Only instances from the list of visible indices (i.e. produced by frustum culling) are packed for drawing,
+    // so that packed instances of every subset keep the order of visible indices
+    Data::Size PackInstances(const std::vector<Data::Index>& visible_instance_indices)
+    {
+        META_FUNCTION_TASK();
+        m_visible_subset_indices.resize(visible_instance_indices.size());
+        for (size_t visible_index = 0U; visible_index < visible_instance_indices.size(); ++visible_index)
+        {
+            const Data::Index instance_index = visible_instance_indices[visible_index];
+            META_CHECK_ARG_LESS(instance_index, m_instances.size());
+            m_visible_subset_indices[visible_index] = GetSubsetByInstanceIndex(instance_index);
+        }
+        CountSubsetInstances(m_visible_subset_indices.begin(), m_visible_subset_indices.end());
+
+        m_packed_instances.resize(visible_instance_indices.size());
+        SubsetInstanceOffsets subset_pack_offsets(m_subset_instance_offsets.begin(), m_subset_instance_offsets.end() - 1);
+        for (size_t visible_index = 0U; visible_index < visible_instance_indices.size(); ++visible_index)
+        {
+            m_packed_instances[subset_pack_offsets[m_visible_subset_indices[visible_index]]++] = m_instances[visible_instance_indices[visible_index]];
+        }
+        return GetPackedInstanceCount();
+    }
+
+    [[nodiscard]] Data::Size                   GetPackedInstanceCount() const noexcept   { return static_cast<Data::Size>(m_packed_instances.size()); }
+    [[nodiscard]] const Instances&             GetPackedInstances() const noexcept       { return m_packed_instances; }
+    [[nodiscard]] const SubsetInstanceOffsets& GetSubsetInstanceOffsets() const noexcept { return m_subset_instance_offsets; }
+
+    // Sub-resource of packed instances data is empty when no instances were packed, so instance buffer update should be skipped
+    [[nodiscard]] Rhi::SubResource GetPackedInstancesSubresource() const
+    {
+        META_FUNCTION_TASK();
+        return Rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(m_packed_instances.data()), // NOSONAR
+            GetPackedInstanceCount() * GetInstanceSize()
+        );
+    }
+
+    void Draw(const Rhi::RenderCommandList& cmd_list, const InstanceDataMeshBufferBindings& instance_bindings,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool set_resource_barriers = true) const
+    {
+        META_FUNCTION_TASK();
+        DrawInstanced(cmd_list, instance_bindings.program_bindings, instance_bindings.vertex_buffer_set,
+                      m_subset_instance_offsets, bindings_apply_behavior, set_resource_barriers);
+    }
+
+    void Draw(const Rhi::RenderCommandList& cmd_list, const InstanceDataMeshBufferBindings& instance_bindings,
+              Data::Index begin_packed_instance, Data::Index end_packed_instance,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool set_resource_barriers = true) const
+    {
+        META_FUNCTION_TASK();
+        DrawInstanced(cmd_list, instance_bindings.program_bindings, instance_bindings.vertex_buffer_set, m_subset_instance_offsets,
+                      begin_packed_instance, end_packed_instance, bindings_apply_behavior, set_resource_barriers);
+    }
+
+    void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list, const InstanceDataMeshBufferBindings& instance_bindings,
+                      Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                      bool set_resource_barriers = true) const
+    {
+        META_FUNCTION_TASK();
+        DrawInstancedParallel(parallel_cmd_list, instance_bindings.program_bindings, instance_bindings.vertex_buffer_set,
+                              m_subset_instance_offsets, bindings_apply_behavior, set_resource_barriers);
+    }
+
+protected:
+    // All instances are drawn with the first mesh subset by default
+    void SetInstanceCount(Data::Size instance_count)
+    {
+        META_FUNCTION_TASK();
+        m_instances.resize(instance_count);
+        ResizeInstanceSubsetIndices(instance_count, 0U);
+        m_packed_instances.clear();
+        m_subset_instance_offsets.assign(GetSubsetsCount() + 1U, 0U);
+    }
+
+private:
+    template<typename SubsetIndexIterator>
+    void CountSubsetInstances(SubsetIndexIterator subset_indices_begin, SubsetIndexIterator subset_indices_end)
+    {
+        META_FUNCTION_TASK();
+        std::fill(m_subset_instance_offsets.begin(), m_subset_instance_offsets.end(), 0U);
+        for (SubsetIndexIterator subset_index_it = subset_indices_begin; subset_index_it != subset_indices_end; ++subset_index_it)
+        {
+            m_subset_instance_offsets[*subset_index_it + 1U]++;
+        }
+        for (size_t subset_index = 1U; subset_index < m_subset_instance_offsets.size(); ++subset_index)
+        {
+            m_subset_instance_offsets[subset_index] += m_subset_instance_offsets[subset_index - 1U];
+        }
+    }
+
+    Instances                m_instances;
+    Instances                m_packed_instances;
+    std::vector<Data::Index> m_visible_subset_indices;
+    SubsetInstanceOffsets    m_subset_instance_offsets;
+};
+
+} // namespace Methane::Graphics
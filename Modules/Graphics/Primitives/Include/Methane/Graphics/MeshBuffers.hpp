@@ -27,12 +27,14 @@ Mesh buffers with texture extension structure.
 
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/CompactMesh.h>
 #include <Methane/Graphics/Types.h>
 #include <Methane/Data/AlignedAllocator.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <fmt/format.h>
+#include <vector>
 
 namespace Methane::Graphics
 {
@@ -58,6 +60,22 @@ public:
         SetInstanceCount(GetSubsetsCount());
     }
 
+    // Compact mesh has vertices in the same order as the source mesh, so subsets of the source uber-mesh can be used with it
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const CompactMesh& compact_mesh_data,
+                std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets())
+        : MeshBuffersBase(render_cmd_queue, compact_mesh_data, mesh_name, mesh_subsets)
+    {
+        META_FUNCTION_TASK();
+        SetInstanceCount(GetSubsetsCount());
+    }
+
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name)
+        : MeshBuffersBase(render_cmd_queue, mesh_cache, mesh_name)
+    {
+        META_FUNCTION_TASK();
+        SetInstanceCount(GetSubsetsCount());
+    }
+
     template<typename VertexType>
     MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data, std::string_view mesh_name)
         : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets())
@@ -124,6 +142,7 @@ protected:
             reinterpret_cast<Data::ConstRawPtr>(m_final_pass_instance_uniforms.data()), // NOSONAR
             GetUniformsBufferSize()
         );
+        ResizeInstanceSubsetIndices(instance_count);
     }
 };
 
@@ -29,6 +29,8 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Memory.hpp>
 
 #include <vector>
 #include <string>
@@ -55,14 +57,27 @@ struct InstancedMeshBufferBindings
     std::vector<Rhi::ProgramBindings> program_bindings_per_instance;
 };
 
+struct InstanceDataMeshBufferBindings
+{
+    Rhi::Buffer          instance_buffer;
+    Rhi::BufferSet       vertex_buffer_set; // mesh vertex buffers followed by the instance buffer
+    Rhi::ProgramBindings program_bindings;
+};
+
 class MeshBuffersBase
 {
 public:
     using ProgramBindingsIteratorType = std::vector<Rhi::ProgramBindings>::const_iterator;
 
+    // Offsets of the first packed instance of each mesh subset in the instance buffer followed by the total packed instances count
+    using SubsetInstanceOffsets = std::vector<Data::Index>;
+
     MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
                     std::string_view mesh_name, const Mesh::Subsets& mesh_subsets);
 
+    // Vertex and index buffers are uploaded directly from mesh cache data without intermediate copies
+    MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name);
+
     virtual ~MeshBuffersBase() = default;
 
     [[nodiscard]] const Rhi::IContext&  GetContext() const noexcept        { return m_context; }
@@ -70,6 +85,23 @@ public:
     [[nodiscard]] Data::Size            GetSubsetsCount() const noexcept   { return static_cast<Data::Size>(m_mesh_subsets.size()); }
     [[nodiscard]] const Rhi::BufferSet& GetVertexBuffers() const noexcept  { return m_vertex_buffer_set; }
     [[nodiscard]] const Rhi::Buffer&    GetIndexBuffer() const noexcept    { return m_index_buffer; }
+    [[nodiscard]] const Mesh::Subset&   GetSubset(Data::Index subset_index) const;
+
+    // Level of detail is selected from the chain of consecutive subsets starting with the full detail subset:
+    // the coarsest level with simplification error projected to screen not exceeding max_error_px is returned
+    [[nodiscard]] Data::Index GetLodSubsetIndex(Data::Index full_detail_subset_index, float projected_radius_px, float max_error_px = 1.F) const;
+
+    [[nodiscard]] Data::Index GetInstanceSubsetIndex(Data::Index instance_index) const;
+
+    // Instance subset can be changed every frame from multiple threads for different instances,
+    // for example to draw distant instances with simplified levels of detail
+    void SetInstanceSubsetIndex(Data::Index instance_index, Data::Index subset_index);
+
+    // Selects instance level of detail from the chain of subsets by projected radius of instance bounding sphere in pixels
+    Data::Index SetInstanceLod(Data::Index instance_index, Data::Index full_detail_subset_index, float projected_radius_px, float max_error_px = 1.F);
+
+    // Screen height of the mesh bounding sphere radius in pixels for perspective projection with vertical field of view angle
+    [[nodiscard]] static float GetProjectedRadius(float bounding_radius, float distance, float fov_angle_y, float screen_height_px) noexcept;
 
     Rhi::ResourceBarriers CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr = nullptr) const;
 
@@ -80,6 +112,12 @@ public:
               Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
               uint32_t first_instance_index = 0U, bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Only instances from the list of visible indices sorted in ascending order (i.e. produced by frustum culling) are drawn
+    void Draw(const Rhi::RenderCommandList& cmd_list, const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+              const std::vector<Data::Index>& visible_instance_indices,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool retain_bindings_once = false, bool set_resource_barriers = true) const;
+
     void Draw(const Rhi::RenderCommandList& cmd_list,
               const ProgramBindingsIteratorType& instance_program_bindings_begin,
               const ProgramBindingsIteratorType& instance_program_bindings_end,
@@ -91,16 +129,51 @@ public:
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
                       bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Vertex buffer set with mesh vertex buffers followed by the buffer of per-instance data,
+    // which is read in vertex shader by the program input buffer layout with per-instance step type
+    [[nodiscard]] Rhi::BufferSet CreateInstanceVertexBufferSet(const Rhi::Buffer& instance_buffer) const;
+
+    // Instances packed in the instance buffer grouped by mesh subsets are drawn with a single instanced draw call per subset
+    // using the same program bindings for all instances; only packed instances in range [begin_instance, end_instance) are drawn,
+    // which allows to split drawing of instances between parallel render command lists
+    void DrawInstanced(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                       const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                       bool set_resource_barriers = true) const;
+
+    void DrawInstanced(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                       const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                       Data::Index begin_instance, Data::Index end_instance,
+                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                       bool set_resource_barriers = true) const;
+
+    void DrawInstancedParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list, const Rhi::ProgramBindings& program_bindings,
+                               const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                               Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                               bool set_resource_barriers = true) const;
+
 protected:
-    [[nodiscard]]
-    virtual Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const { return instance_index; }
+    // Instances are drawn with mesh subsets 1:1 by instance index, until instance subset indices are resized
+    [[nodiscard]] Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const;
+    [[nodiscard]] const std::vector<Data::Index>& GetInstanceSubsetIndices() const noexcept { return m_instance_subset_indices; }
+
+    // Added instances are drawn with mesh subsets 1:1 by instance index or with the default subset, when it is given
+    void ResizeInstanceSubsetIndices(Data::Size instance_count, const Opt<Data::Index>& default_subset_index_opt = {});
 
 private:
-    const Rhi::IContext& m_context;
-    const std::string    m_mesh_name;
-    const Mesh::Subsets  m_mesh_subsets;
-    Rhi::BufferSet       m_vertex_buffer_set;
-    Rhi::Buffer          m_index_buffer;
+    void InitBuffers(const Rhi::CommandQueue& render_cmd_queue, const Rhi::SubResource& vertex_data, Data::Size vertex_size,
+                     const Rhi::SubResource& index_data, PixelFormat index_format);
+
+    // Draws mesh subset of the instance with its program bindings, vertex and index buffers should be already set
+    void DrawInstance(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                      Data::Index instance_index, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) const;
+
+    const Rhi::IContext&     m_context;
+    const std::string        m_mesh_name;
+    const Mesh::Subsets      m_mesh_subsets;
+    Rhi::BufferSet           m_vertex_buffer_set;
+    Rhi::Buffer              m_index_buffer;
+    std::vector<Data::Index> m_instance_subset_indices;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
@@ -25,6 +25,7 @@ Methane graphics extensions: all headers under one umbrella.
 
 #include "ImageLoader.h"
 #include "MeshBuffers.hpp"
+#include "InstancedMeshBuffers.hpp"
 #include "SkyBox.h"
 #include "ScreenQuad.h"
 #include "ScreenQuad.h"
\ No newline at end of file
@@ -25,11 +25,13 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/RenderCommandList.h>
 #include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
-#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <taskflow/algorithm/for_each.hpp>
 #include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 
 namespace Methane::Graphics
 {
@@ -47,27 +49,126 @@ MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, cons
                       })
 {
     META_FUNCTION_TASK();
+    InitBuffers(render_cmd_queue,
+                Rhi::SubResource(mesh_data.GetVertexData(), mesh_data.GetVertexDataSize()), mesh_data.GetVertexSize(),
+                Rhi::SubResource(mesh_data.GetIndexData()), mesh_data.GetIndexFormat());
+}
+
+MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshCache& mesh_cache, std::string_view mesh_name)
+    : m_context(render_cmd_queue.GetContext())
+    , m_mesh_name(mesh_name)
+    , m_mesh_subsets(mesh_cache.GetSubsets())
+{
+    META_FUNCTION_TASK();
+    InitBuffers(render_cmd_queue,
+                Rhi::SubResource(mesh_cache.GetVertexData(), mesh_cache.GetVertexDataSize()), mesh_cache.GetVertexSize(),
+                Rhi::SubResource(mesh_cache.GetIndexData(), mesh_cache.GetIndexDataSize()), mesh_cache.GetIndexFormat());
+}
 
+void MeshBuffersBase::InitBuffers(const Rhi::CommandQueue& render_cmd_queue, const Rhi::SubResource& vertex_data, Data::Size vertex_size,
+                                  const Rhi::SubResource& index_data, PixelFormat index_format)
+{
+    META_FUNCTION_TASK();
     Rhi::Buffer vertex_buffer(m_context,
         Rhi::BufferSettings::ForVertexBuffer(
-            mesh_data.GetVertexDataSize(),
-            mesh_data.GetVertexSize()));
-    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", mesh_name));
-    vertex_buffer.SetData(render_cmd_queue, {
-        mesh_data.GetVertexData(),
-        mesh_data.GetVertexDataSize()
-    });
+            vertex_data.GetDataSize(),
+            vertex_size));
+    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", m_mesh_name));
+    vertex_buffer.SetData(render_cmd_queue, vertex_data);
     m_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
 
     m_index_buffer = Rhi::Buffer(m_context,
         Rhi::BufferSettings::ForIndexBuffer(
-            mesh_data.GetIndexDataSize(),
-            GetIndexFormat(mesh_data.GetIndex(0))));
-    m_index_buffer.SetName(fmt::format("{} Index Buffer", mesh_name));
-    m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(mesh_data.GetIndices().data()), // NOSONAR
-        mesh_data.GetIndexDataSize()
-    });
+            index_data.GetDataSize(),
+            index_format));
+    m_index_buffer.SetName(fmt::format("{} Index Buffer", m_mesh_name));
+    m_index_buffer.SetData(render_cmd_queue, index_data);
+}
+
+const Mesh::Subset& MeshBuffersBase::GetSubset(Data::Index subset_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
+    return m_mesh_subsets[subset_index];
+}
+
+Data::Index MeshBuffersBase::GetLodSubsetIndex(Data::Index full_detail_subset_index, float projected_radius_px, float max_error_px) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(full_detail_subset_index, m_mesh_subsets.size());
+    META_CHECK_ARG_EQUAL_DESCR(m_mesh_subsets[full_detail_subset_index].lod_index, 0U, "subset is not the full detail level of LOD chain");
+
+    // Simplification error grows with level of detail, so the search stops at the first level exceeding screen error threshold
+    Data::Index lod_subset_index = full_detail_subset_index;
+    for (Data::Index subset_index = full_detail_subset_index + 1U; subset_index < m_mesh_subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& lod_subset = m_mesh_subsets[subset_index];
+        if (lod_subset.lod_index != subset_index - full_detail_subset_index ||
+            lod_subset.lod_error * projected_radius_px > max_error_px)
+            break;
+
+        lod_subset_index = subset_index;
+    }
+    return lod_subset_index;
+}
+
+Data::Index MeshBuffersBase::GetInstanceSubsetIndex(Data::Index instance_index) const
+{
+    META_FUNCTION_TASK();
+    return GetSubsetByInstanceIndex(instance_index);
+}
+
+void MeshBuffersBase::SetInstanceSubsetIndex(Data::Index instance_index, Data::Index subset_index)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(instance_index, m_instance_subset_indices.size());
+    META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
+    m_instance_subset_indices[instance_index] = subset_index;
+}
+
+Data::Index MeshBuffersBase::SetInstanceLod(Data::Index instance_index, Data::Index full_detail_subset_index, float projected_radius_px, float max_error_px)
+{
+    META_FUNCTION_TASK();
+    const Data::Index lod_subset_index = GetLodSubsetIndex(full_detail_subset_index, projected_radius_px, max_error_px);
+    SetInstanceSubsetIndex(instance_index, lod_subset_index);
+    return lod_subset_index;
+}
+
+float MeshBuffersBase::GetProjectedRadius(float bounding_radius, float distance, float fov_angle_y, float screen_height_px) noexcept
+{
+    META_FUNCTION_TASK();
+    // Camera inside of the bounding sphere sees the mesh in full screen
+    if (distance <= bounding_radius)
+        return screen_height_px;
+
+    return bounding_radius * screen_height_px / (2.F * distance * std::tan(fov_angle_y / 2.F));
+}
+
+Data::Index MeshBuffersBase::GetSubsetByInstanceIndex(Data::Index instance_index) const
+{
+    if (m_instance_subset_indices.empty())
+        return instance_index;
+
+    META_CHECK_ARG_LESS(instance_index, m_instance_subset_indices.size());
+    return m_instance_subset_indices[instance_index];
+}
+
+void MeshBuffersBase::ResizeInstanceSubsetIndices(Data::Size instance_count, const Opt<Data::Index>& default_subset_index_opt)
+{
+    META_FUNCTION_TASK();
+    const auto prev_instance_count = static_cast<Data::Size>(m_instance_subset_indices.size());
+    if (default_subset_index_opt)
+    {
+        META_CHECK_ARG_LESS(*default_subset_index_opt, m_mesh_subsets.size());
+        m_instance_subset_indices.resize(instance_count, *default_subset_index_opt);
+        return;
+    }
+
+    m_instance_subset_indices.resize(instance_count);
+    if (instance_count > prev_instance_count)
+    {
+        std::iota(m_instance_subset_indices.begin() + prev_instance_count, m_instance_subset_indices.end(), prev_instance_count);
+    }
 }
 
 Rhi::ResourceBarriers MeshBuffersBase::CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr) const
@@ -126,6 +227,29 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
          bindings_apply_behavior, first_instance_index, retain_bindings_once, set_resource_barriers);
 }
 
+void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
+                           const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
+                           const std::vector<Data::Index>& visible_instance_indices,
+                           Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                           bool retain_bindings_once, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+
+    for (auto visible_index_it = visible_instance_indices.begin(); visible_index_it != visible_instance_indices.end(); ++visible_index_it)
+    {
+        const Data::Index instance_index = *visible_index_it;
+        META_CHECK_ARG_LESS(instance_index, instance_program_bindings.size());
+
+        Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
+        apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
+                              !retain_bindings_once || visible_index_it == visible_instance_indices.begin());
+
+        DrawInstance(cmd_list, instance_program_bindings[instance_index], instance_index, apply_behavior);
+    }
+}
+
 void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
                            const ProgramBindingsIteratorType& instance_program_bindings_begin,
                            const ProgramBindingsIteratorType& instance_program_bindings_end,
@@ -140,27 +264,33 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
          instance_program_bindings_it != instance_program_bindings_end;
          ++instance_program_bindings_it)
     {
-        const Rhi::ProgramBindings& program_bindings = *instance_program_bindings_it;
-        META_CHECK_ARG_TRUE(program_bindings.IsInitialized());
-
         const uint32_t instance_index = first_instance_index + static_cast<uint32_t>(std::distance(instance_program_bindings_begin, instance_program_bindings_it));
-        const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
-
-        META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
-        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
 
         Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
         apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
                               !retain_bindings_once || instance_program_bindings_it == instance_program_bindings_begin);
 
-        cmd_list.SetProgramBindings(program_bindings, apply_behavior);
-        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
-                             mesh_subset.indices.count, mesh_subset.indices.offset,
-                             mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
-                             1, 0);
+        DrawInstance(cmd_list, *instance_program_bindings_it, instance_index, apply_behavior);
     }
 }
 
+void MeshBuffersBase::DrawInstance(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                   Data::Index instance_index, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE(program_bindings.IsInitialized());
+
+    const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
+    META_CHECK_ARG_LESS(subset_index, m_mesh_subsets.size());
+    const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+
+    cmd_list.SetProgramBindings(program_bindings, apply_behavior);
+    cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
+                         mesh_subset.indices.count, mesh_subset.indices.offset,
+                         mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+                         1, 0);
+}
+
 void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                                    const std::vector<Rhi::ProgramBindings>& instance_program_bindings,
                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
@@ -190,4 +320,83 @@ void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& paralle
     m_context.GetParallelExecutor().run(render_task_flow).get();
 }
 
+Rhi::BufferSet MeshBuffersBase::CreateInstanceVertexBufferSet(const Rhi::Buffer& instance_buffer) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(instance_buffer.IsInitialized(), "instance buffer is not initialized");
+    META_CHECK_ARG_EQUAL_DESCR(instance_buffer.GetSettings().type, Rhi::BufferType::Vertex, "instance buffer should be a vertex buffer");
+
+    Rhi::BufferSet::Buffers vertex_buffers = m_vertex_buffer_set.GetRefs();
+    vertex_buffers.push_back(instance_buffer);
+    return Rhi::BufferSet(Rhi::BufferType::Vertex, Refs<Rhi::Buffer>(vertex_buffers.begin(), vertex_buffers.end()));
+}
+
+void MeshBuffersBase::DrawInstanced(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                    const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY(subset_instance_offsets);
+    DrawInstanced(cmd_list, program_bindings, instance_vertex_buffer_set, subset_instance_offsets,
+                  0U, subset_instance_offsets.back(), bindings_apply_behavior, set_resource_barriers);
+}
+
+void MeshBuffersBase::DrawInstanced(const Rhi::RenderCommandList& cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                    const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                                    Data::Index begin_instance, Data::Index end_instance,
+                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(subset_instance_offsets.size(), m_mesh_subsets.size() + 1U,
+                               "instance offsets are required for all mesh subsets followed by total instances count");
+    META_CHECK_ARG_LESS_OR_EQUAL(end_instance, subset_instance_offsets.back());
+    META_CHECK_ARG_LESS_OR_EQUAL(begin_instance, end_instance);
+    if (begin_instance == end_instance)
+        return;
+
+    cmd_list.SetProgramBindings(program_bindings, bindings_apply_behavior);
+    cmd_list.SetVertexBuffers(instance_vertex_buffer_set, set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+
+    // Instances of every subset occupy contiguous range in the instance buffer, which is drawn with a single draw call
+    for (Data::Index subset_index = 0U; subset_index < m_mesh_subsets.size(); ++subset_index)
+    {
+        const Data::Index subset_begin_instance = std::max(subset_instance_offsets[subset_index], begin_instance);
+        const Data::Index subset_end_instance   = std::min(subset_instance_offsets[subset_index + 1U], end_instance);
+        if (subset_begin_instance >= subset_end_instance)
+            continue;
+
+        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
+                             mesh_subset.indices.count, mesh_subset.indices.offset,
+                             mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+                             subset_end_instance - subset_begin_instance, subset_begin_instance);
+    }
+}
+
+void MeshBuffersBase::DrawInstancedParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list, const Rhi::ProgramBindings& program_bindings,
+                                            const Rhi::BufferSet& instance_vertex_buffer_set, const SubsetInstanceOffsets& subset_instance_offsets,
+                                            Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior, bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY(subset_instance_offsets);
+    const std::vector<Rhi::RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    const Data::Size instances_count = subset_instance_offsets.back();
+    const auto instances_count_per_command_list = static_cast<uint32_t>(Data::DivCeil(instances_count, static_cast<Data::Size>(render_cmd_lists.size())));
+
+    tf::Taskflow render_task_flow;
+    render_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
+        [this, &render_cmd_lists, &program_bindings, &instance_vertex_buffer_set, &subset_instance_offsets,
+         instances_count, instances_count_per_command_list, bindings_apply_behavior, set_resource_barriers](const uint32_t cmd_list_index)
+        {
+            const uint32_t begin_instance_index = std::min(cmd_list_index * instances_count_per_command_list, instances_count);
+            const uint32_t end_instance_index   = std::min(begin_instance_index + instances_count_per_command_list, instances_count);
+
+            DrawInstanced(render_cmd_lists[cmd_list_index], program_bindings, instance_vertex_buffer_set, subset_instance_offsets,
+                          begin_instance_index, end_instance_index, bindings_apply_behavior, set_resource_barriers);
+        }
+    );
+    m_context.GetParallelExecutor().run(render_task_flow).get();
+}
+
 } // namespace Methane::Graphics
@@ -35,7 +35,6 @@ Screen Quad rendering primitive.
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/QuadMesh.hpp>
-#include <Methane/Graphics/TypeConverters.hpp>
 #include <Methane/Data/AppResourceProviders.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -230,12 +229,9 @@ public:
             m_index_buffer = render_context.CreateBuffer(
                 Rhi::BufferSettings::ForIndexBuffer(
                     s_quad_mesh.GetIndexDataSize(),
-                    GetIndexFormat(s_quad_mesh.GetIndex(0))));
+                    s_quad_mesh.GetIndexFormat()));
             m_index_buffer.SetName(s_index_buffer_name);
-            m_index_buffer.SetData(m_render_cmd_queue, {
-                reinterpret_cast<Data::ConstRawPtr>(s_quad_mesh.GetIndices().data()), // NOSONAR
-                s_quad_mesh.GetIndexDataSize()
-            });
+            m_index_buffer.SetData(m_render_cmd_queue, Rhi::SubResource(s_quad_mesh.GetIndexData()));
             render_context.GetObjectRegistry().AddGraphicsObject(m_index_buffer.GetInterface());
         }
 
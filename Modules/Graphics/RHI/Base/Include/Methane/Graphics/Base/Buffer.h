@@ -46,6 +46,7 @@ public:
     const Settings& GetSettings() const noexcept final { return m_settings; }
     uint32_t        GetFormattedItemsCount() const noexcept final;
     void            SetData(Rhi::ICommandQueue&, const SubResource& sub_resource) override;
+    Ptr<Rhi::IReadBackRequest> RequestReadBack(Rhi::ICommandList& cmd_list, const BytesRangeOpt& data_range = {}) override;
 
 private:
     Settings m_settings;
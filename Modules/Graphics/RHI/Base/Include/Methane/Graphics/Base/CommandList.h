@@ -46,6 +46,7 @@ namespace Methane::Graphics::Base
 
 class CommandQueue;
 class ProgramBindings;
+class ResourceBarriers;
 class CommandListDebugGroup;
 
 class CommandList // NOSONAR - custom destructor is used for logging, class has more than 35 methods
@@ -95,6 +96,11 @@ public:
     const ProgramBindings* GetProgramBindingsPtr() const noexcept { return GetCommandState().program_bindings_ptr; }
     Ptr<CommandList>       GetCommandListPtr()                    { return GetPtr<CommandList>(); }
 
+    // Pending resource barriers are merged by resource and set to command list with one call
+    // right before the next draw, dispatch, explicitly set barriers or commit
+    void AddPendingResourceBarriers(const Rhi::IResourceBarriers& resource_barriers);
+    const Rhi::IResourceBarriers* GetPendingResourceBarriersPtr() const noexcept;
+
     inline void RetainResource(const Ptr<Object>& resource_ptr)   { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
     inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
     inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
@@ -125,18 +131,20 @@ protected:
     void EndGpuZone();
 
     void VerifyEncodingState() const;
+    void FlushPendingResourceBarriers();
 
 private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroup>>;
 
     void CompleteInternal();
 
-    const Type        m_type;
-    Ptr<CommandQueue> m_command_queue_ptr;
-    CommandState      m_command_state;
-    DebugGroupStack   m_open_debug_groups;
-    CompletedCallback m_completed_callback;
-    State             m_state = State::Pending;
+    const Type            m_type;
+    Ptr<CommandQueue>     m_command_queue_ptr;
+    CommandState          m_command_state;
+    DebugGroupStack       m_open_debug_groups;
+    Ptr<ResourceBarriers> m_pending_resource_barriers_ptr;
+    CompletedCallback     m_completed_callback;
+    State                 m_state = State::Pending;
 
     mutable TracyLockable(std::recursive_mutex, m_state_mutex);
     TracyLockable(std::mutex,   m_state_change_mutex);
@@ -54,6 +54,7 @@ public:
 
     // ICommandQueue overrides
     [[nodiscard]] Ptr<Rhi::ICommandKit> CreateCommandKit() final;
+    [[nodiscard]] Ptr<Rhi::IRenderCommandList> CreateRenderCommandBundle(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] const Rhi::IContext& GetContext() const noexcept final;
     Rhi::CommandListType GetCommandListType() const noexcept final { return m_command_lists_type; }
     void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
@@ -49,8 +49,13 @@ public:
 
     ComputeState& GetComputeState();
 
+protected:
+    // Dispatch is skipped by the native command list, when compute state was not applied because it is not compiled yet
+    bool IsComputeStateApplied() const noexcept { return m_is_compute_state_applied; }
+
 private:
     Ptr<ComputeState> m_compute_state_ptr;
+    bool              m_is_compute_state_applied = false;
 };
 
 } // namespace Methane::Graphics::Base
@@ -24,8 +24,10 @@ Base implementation of the compute state interface.
 #pragma once
 
 #include "Object.h"
+#include "StateCompiler.h"
 
 #include <Methane/Graphics/RHI/IComputeState.h>
+#include <Methane/Data/Emitter.hpp>
 
 namespace Methane::Graphics::Base
 {
@@ -35,25 +37,34 @@ class ComputeCommandList;
 class ComputeState
     : public Object
     , public Rhi::IComputeState
+    , public Data::Emitter<Rhi::IComputeStateCallback>
 {
 public:
     ComputeState(const Rhi::IContext& context, const Settings& settings);
 
     // IComputeState overrides
     const Settings& GetSettings() const noexcept override { return m_settings; }
+    bool IsCompiled() const noexcept override             { return m_compiler.IsCompleted(); }
     void Reset(const Settings& settings) override;
 
-    // ComputeState interface
-    virtual void Apply(ComputeCommandList& command_list) = 0;
+    // ComputeState interface, returns false when state can not be applied because it is not compiled yet
+    // and throws the error of failed asynchronous compilation
+    virtual bool Apply(ComputeCommandList& command_list) = 0;
 
     const Rhi::IContext& GetContext() const noexcept { return m_context; }
 
 protected:
     Rhi::IProgram& GetProgram();
 
+    // Compile function is executed asynchronously on context parallel executor when it is enabled in settings
+    void Compile(StateCompiler::CompileFunction&& compile_function);
+    void WaitForCompilation() const  { m_compiler.WaitForCompletion(); }
+    void RethrowCompileError() const { m_compiler.RethrowCompileError(); }
+
 private:
     const Rhi::IContext& m_context;
     Settings             m_settings;
+    StateCompiler        m_compiler;
 };
 
 } // namespace Methane::Graphics::Base
@@ -29,8 +29,12 @@ Base implementation of the context interface.
 #include <Methane/Graphics/RHI/IContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <array>
+#include <atomic>
+#include <mutex>
+#include <set>
 #include <string>
 
 namespace tf
@@ -91,6 +95,7 @@ public:
     bool SetName(std::string_view name) override;
 
     DeferredAction           GetRequestedAction() const noexcept { return m_requested_action; }
+    void                     CompleteAsyncUploads(Rhi::ICommandQueue& cmd_queue) const;
     Ptr<Device>              GetBaseDevicePtr() const noexcept   { return m_device_ptr; }
     Device&                  GetBaseDevice();
     const Device&            GetBaseDevice() const;
@@ -107,6 +112,7 @@ protected:
 private:
     using CommandKitPtrByType = std::array<Ptr<Rhi::ICommandKit>, static_cast<size_t>(Rhi::CommandListType::Count)>;
     using CommandKitByQueue   = std::map<Rhi::ICommandQueue*, Ptr<Rhi::ICommandKit>>;
+    using CommandQueuePtrs    = std::set<Rhi::ICommandQueue*>;
 
     template<Rhi::CommandListPurpose cmd_list_purpose>
     void ExecuteSyncCommandLists(const Rhi::ICommandKit& upload_cmd_kit) const;
@@ -120,6 +126,9 @@ private:
     mutable CommandKitByQueue          m_default_command_kit_ptr_by_queue;
     mutable DeferredAction             m_requested_action = DeferredAction::None;
     mutable bool                       m_is_completing_initialization = false;
+    mutable std::atomic<bool>          m_is_async_upload_pending{ false };
+    mutable CommandQueuePtrs           m_async_upload_pending_queues;
+    mutable TracyLockable(std::mutex,  m_async_upload_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -46,6 +46,7 @@ public:
     bool                IsSoftwareAdapter() const noexcept override { return m_is_software_adapter; }
     const Capabilities& GetCapabilities() const noexcept override   { return m_capabilities; }
     std::string         ToString() const override;
+    MemoryStatistics    GetMemoryStatistics() const override        { return {}; }
     
 protected:
     friend class System;
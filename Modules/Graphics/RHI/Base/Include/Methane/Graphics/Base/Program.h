@@ -31,8 +31,10 @@ Base implementation of the program interface.
 
 #include <memory>
 #include <array>
+#include <vector>
 #include <optional>
 #include <mutex>
+#include <atomic>
 
 namespace Methane::Graphics::Base
 {
@@ -56,22 +58,35 @@ public:
     const Ptr<Rhi::IShader>& GetShader(Rhi::ShaderType shader_type) const final;
     bool                     HasShader(Rhi::ShaderType shader_type) const       { return !!GetShader(shader_type); }
     Data::Size               GetBindingsCount() const noexcept final            { return m_bindings_count; }
+    ArgumentId               GetArgumentId(const Argument& argument) const final;
+
+    const Argument&  GetArgument(ArgumentId argument_id) const;
+    const Arguments& GetArguments() const noexcept      { return m_arguments; }
+    Data::Size       GetArgumentsCount() const noexcept { return static_cast<Data::Size>(m_arguments_by_id.size()); }
 
     const Context& GetContext() const { return m_context; }
 
 protected:
     using ArgumentBinding       = ProgramBindings::ArgumentBinding;
     using ArgumentBindings      = ProgramBindings::ArgumentBindings;
-    using FrameArgumentBindings = std::unordered_map<IProgram::Argument, Ptrs<ArgumentBinding>, IProgram::Argument::Hash>;
+    using FrameArgumentBindings = std::vector<Ptrs<ArgumentBinding>>; // indexed by argument id, empty for non frame-constant arguments
+    using ResourcesCountByAccess = std::array<Data::Size, magic_enum::enum_count<Rhi::ProgramArgumentAccessType>()>;
 
     void InitArgumentBindings(const ArgumentAccessors& argument_accessors);
-    const ArgumentBindings&         GetArgumentBindings() const noexcept      { return m_binding_by_argument; }
-    const FrameArgumentBindings&    GetFrameArgumentBindings() const noexcept { return m_frame_bindings_by_argument; }
-    const Ptr<ArgumentBinding>&     GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const;
-    Ptr<ArgumentBinding>            CreateArgumentBindingInstance(const Ptr<ArgumentBinding>& argument_binding_ptr, Data::Index frame_index) const;
+    const ArgumentBindings&         GetArgumentBindings() const noexcept      { return m_binding_by_argument_id; }
+    const FrameArgumentBindings&    GetFrameArgumentBindings() const noexcept { return m_frame_bindings_by_argument_id; }
+    const ResourcesCountByAccess&   GetResourcesCountByAccess() const noexcept { return m_resources_count_by_access; }
+    const Ptr<ArgumentBinding>&     GetFrameArgumentBinding(Data::Index frame_index, ArgumentId argument_id) const;
+    Ptr<ArgumentBinding>            CreateArgumentBindingInstance(const Ptr<ArgumentBinding>& argument_binding_ptr, Data::Index frame_index,
+                                                                  const ArgumentBinding::Allocator& allocator = {}) const;
+
+    // Arena size of argument binding instances is measured on program bindings creation and is shared by all program bindings
+    size_t GetArgumentBindingsArenaSize() const noexcept { return m_argument_bindings_arena_size; }
+    void   UpdateArgumentBindingsArenaSize(size_t arena_size) noexcept;
 
     Rhi::IShader& GetShaderRef(Rhi::ShaderType shader_type) const;
     uint32_t GetInputBufferIndexByArgumentSemantic(const std::string& argument_semantic) const;
+    PixelFormat GetInputArgumentFormatBySemantic(const std::string& argument_semantic) const;
 
     using ShadersByType = std::array<Ptr<Rhi::IShader>, magic_enum::enum_count<Rhi::ShaderType>() - 1>;
     static ShadersByType CreateShadersByType(const Ptrs<Rhi::IShader>& shaders);
@@ -82,10 +97,17 @@ private:
     const Context&         m_context;
     const Settings         m_settings;
     const ShadersByType    m_shaders_by_type;
-    const Rhi::ShaderTypes m_shader_types;
-    ArgumentBindings       m_binding_by_argument;
-    FrameArgumentBindings  m_frame_bindings_by_argument;
-    Data::Size             m_bindings_count = 0u;
+    using ArgumentIdByArgument = std::unordered_map<Argument, ArgumentId, Argument::Hash>;
+
+    const Rhi::ShaderTypes  m_shader_types;
+    Arguments               m_arguments;
+    std::vector<Argument>   m_arguments_by_id;
+    ArgumentIdByArgument    m_argument_id_by_argument;
+    ArgumentBindings        m_binding_by_argument_id;
+    FrameArgumentBindings   m_frame_bindings_by_argument_id;
+    ResourcesCountByAccess  m_resources_count_by_access{ };
+    std::atomic<Data::Size> m_bindings_count{ 0U }; // program bindings may be created in parallel
+    std::atomic<size_t>     m_argument_bindings_arena_size{ 0U };
 };
 
 } // namespace Methane::Graphics::Base
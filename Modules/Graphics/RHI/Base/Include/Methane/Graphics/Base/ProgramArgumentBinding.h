@@ -23,6 +23,8 @@ Base implementation of the program argument binding interface.
 
 #pragma once
 
+#include "ProgramArgumentBindingsArena.h"
+
 #include <Methane/Graphics/RHI/IProgramBindings.h>
 #include <Methane/Graphics/RHI/IResource.h>
 #include <Methane/Data/Emitter.hpp>
@@ -39,10 +41,14 @@ class ProgramArgumentBinding
     , public std::enable_shared_from_this<ProgramArgumentBinding>
 {
 public:
+    using Allocator = ProgramArgumentBindingsAllocator<ProgramArgumentBinding>;
+
     ProgramArgumentBinding(const Context& context, const Settings& settings);
 
+    [[nodiscard]] Ptr<ProgramArgumentBinding> CreateCopy() const { return CreateCopy(Allocator()); }
+
     // Base::ProgramArgumentBinding interface
-    [[nodiscard]] virtual Ptr<ProgramArgumentBinding> CreateCopy() const = 0;
+    [[nodiscard]] virtual Ptr<ProgramArgumentBinding> CreateCopy(const Allocator& allocator) const = 0;
     virtual void MergeSettings(const ProgramArgumentBinding& other);
 
     // IArgumentBinding interface
@@ -51,7 +57,9 @@ public:
     bool                      SetResourceViews(const Rhi::ResourceViews& resource_views) override;
     explicit operator std::string() const final;
 
-    Ptr<ProgramArgumentBinding> GetPtr() { return shared_from_this(); }
+    Ptr<ProgramArgumentBinding> GetPtr()                                       { return shared_from_this(); }
+    Rhi::ProgramArgumentId      GetArgumentId() const noexcept                 { return m_argument_id; }
+    void                        SetArgumentId(Rhi::ProgramArgumentId arg_id) noexcept { m_argument_id = arg_id; }
 
     bool IsAlreadyApplied(const Rhi::IProgram& program,
                           const ProgramBindings& applied_program_bindings,
@@ -61,9 +69,10 @@ protected:
     const Context& GetContext() const noexcept { return m_context; }
 
 private:
-    const Context&     m_context;
-    const Settings     m_settings;
-    Rhi::ResourceViews m_resource_views;
+    const Context&         m_context;
+    const Settings         m_settings;
+    Rhi::ResourceViews     m_resource_views;
+    Rhi::ProgramArgumentId m_argument_id = 0U;
 };
 
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,112 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ProgramArgumentBindingsArena.h
+Contiguous memory arena and allocator of the argument binding instances
+owned by one program bindings object.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Methane::Graphics::Base
+{
+
+// Single contiguous memory block sized by the program from the layout of its argument bindings:
+// argument binding instances are allocated one after another and memory is released all at once with the arena
+class ProgramArgumentBindingsArena
+{
+public:
+    explicit ProgramArgumentBindingsArena(size_t capacity);
+
+    // Returns nullptr when arena capacity is exhausted, but requested size is counted anyway
+    // to let the program size arenas of the next program bindings objects
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment) noexcept;
+    [[nodiscard]] bool  Contains(const void* memory_ptr) const noexcept;
+
+    [[nodiscard]] size_t GetCapacity() const noexcept      { return m_capacity; }
+    [[nodiscard]] size_t GetUsedSize() const noexcept      { return m_used_size; }
+    [[nodiscard]] size_t GetRequestedSize() const noexcept { return m_requested_size; }
+
+private:
+    const size_t                 m_capacity;
+    std::unique_ptr<std::byte[]> m_memory;
+    size_t                       m_used_size = 0U;
+    size_t                       m_requested_size = 0U;
+};
+
+// STL allocator used with std::allocate_shared to place argument binding instances together with their control blocks in the arena,
+// arena is kept alive by allocator copies stored in control blocks, so argument bindings can safely outlive their program bindings
+template<typename T>
+class ProgramArgumentBindingsAllocator
+{
+public:
+    using value_type = T;
+
+    static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned types are not supported by argument bindings allocator");
+
+    ProgramArgumentBindingsAllocator() noexcept = default;
+
+    explicit ProgramArgumentBindingsAllocator(Ptr<ProgramArgumentBindingsArena> arena_ptr) noexcept
+        : m_arena_ptr(std::move(arena_ptr))
+    { }
+
+    template<typename U>
+    ProgramArgumentBindingsAllocator(const ProgramArgumentBindingsAllocator<U>& other) noexcept // NOSONAR - implicit conversion is required for rebind
+        : m_arena_ptr(other.GetArenaPtr())
+    { }
+
+    [[nodiscard]] T* allocate(size_t count)
+    {
+        const size_t allocate_size = count * sizeof(T);
+        if (m_arena_ptr)
+        {
+            if (void* memory_ptr = m_arena_ptr->Allocate(allocate_size, alignof(T)))
+                return static_cast<T*>(memory_ptr);
+        }
+        return static_cast<T*>(::operator new(allocate_size));
+    }
+
+    void deallocate(T* memory_ptr, size_t) const noexcept
+    {
+        // Memory allocated in arena is released all at once with the arena itself
+        if (m_arena_ptr && m_arena_ptr->Contains(memory_ptr))
+            return;
+
+        ::operator delete(memory_ptr);
+    }
+
+    [[nodiscard]] const Ptr<ProgramArgumentBindingsArena>& GetArenaPtr() const noexcept { return m_arena_ptr; }
+
+    template<typename U>
+    bool operator==(const ProgramArgumentBindingsAllocator<U>& other) const noexcept { return m_arena_ptr == other.GetArenaPtr(); }
+
+    template<typename U>
+    bool operator!=(const ProgramArgumentBindingsAllocator<U>& other) const noexcept { return !(*this == other); }
+
+private:
+    Ptr<ProgramArgumentBindingsArena> m_arena_ptr;
+};
+
+} // namespace Methane::Graphics::Base
@@ -29,8 +29,10 @@ Base implementation of the program bindings interface.
 #include <Methane/Graphics/RHI/IProgramBindings.h>
 #include <Methane/Graphics/RHI/IResource.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <magic_enum.hpp>
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -46,23 +48,24 @@ class ProgramBindings
 {
 public:
     using ArgumentBinding  = ProgramArgumentBinding;
-    using ArgumentBindings = std::unordered_map<Rhi::IProgram::Argument, Ptr<ArgumentBinding>, Rhi::IProgram::Argument::Hash>;
+    using ArgumentBindings = std::vector<Ptr<ArgumentBinding>>; // indexed by program argument id
 
     ProgramBindings(Program& program, Data::Index frame_index);
     ProgramBindings(Program& program, const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index);
     ProgramBindings(const ProgramBindings& other_program_bindings, const ResourceViewsByArgument& replace_resource_view_by_argument, const Opt<Data::Index>& frame_index);
     ProgramBindings(const ProgramBindings& other_program_bindings, const Opt<Data::Index>& frame_index);
-    ProgramBindings(ProgramBindings&&) noexcept = default;
+    ProgramBindings(ProgramBindings&&) = delete;
 
     ProgramBindings& operator=(const ProgramBindings& other) = delete;
     ProgramBindings& operator=(ProgramBindings&& other) = delete;
 
     // IProgramBindings interface
     Rhi::IProgram&                  GetProgram() const final;
-    const Rhi::IProgram::Arguments& GetArguments() const noexcept final     { return m_arguments; }
+    const Rhi::IProgram::Arguments& GetArguments() const noexcept final;
     Data::Index                     GetFrameIndex() const noexcept final    { return m_frame_index; }
     Data::Index                     GetBindingsIndex() const noexcept final { return m_bindings_index; }
     IArgumentBinding&               Get(const Rhi::IProgram::Argument& shader_argument) const final;
+    IArgumentBinding&               Get(Rhi::ProgramArgumentId argument_id) const final;
     explicit operator std::string() const final;
 
     // ProgramBindings interface
@@ -71,17 +74,11 @@ public:
 
     Rhi::IProgram::Arguments GetUnboundArguments() const;
 
-    template<typename CommandListType>
-    void ApplyResourceTransitionBarriers(CommandListType& command_list,
+    // Resource transition barriers are added to pending barriers of the command list,
+    // which are flushed with a single call before the next draw or dispatch
+    void ApplyResourceTransitionBarriers(CommandList& command_list,
                                          Rhi::ProgramArgumentAccessMask apply_access = Rhi::ProgramArgumentAccessMask{ ~0U },
-                                         const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const
-    {
-        if (ApplyResourceStates(apply_access, owner_queue_ptr) &&
-            m_resource_state_transition_barriers_ptr && !m_resource_state_transition_barriers_ptr->IsEmpty())
-        {
-            command_list.SetResourceBarriers(*m_resource_state_transition_barriers_ptr);
-        }
-    }
+                                         const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const;
 
 protected:
     // IProgramBindings::IProgramArgumentBindingCallback
@@ -89,15 +86,20 @@ protected:
 
     void SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument);
 
+    // Resource views are set to each argument binding from SetResourcesForArguments with this call,
+    // which can be overridden by native implementation to update descriptors of all changed arguments in a batch
+    virtual bool SetArgumentResourceViews(IArgumentBinding& argument_binding, const Rhi::IResource::Views& resource_views);
+
     void InitializeArgumentBindings(const ProgramBindings* other_program_bindings_ptr = nullptr);
     ResourceViewsByArgument ReplaceResourceViews(const ArgumentBindings& argument_bindings,
                                                  const ResourceViewsByArgument& replace_resource_views) const;
     void VerifyAllArgumentsAreBoundToResources() const;
-    const ArgumentBindings& GetArgumentBindings() const { return m_binding_by_argument; }
+    const ArgumentBindings& GetArgumentBindings() const { return m_binding_by_argument_id; }
     const Refs<Rhi::IResource>& GetResourceRefsByAccess(Rhi::ProgramArgumentAccessType access_type) const;
 
     void ClearTransitionResourceStates();
     void RemoveTransitionResourceStates(const Rhi::IProgramBindings::IArgumentBinding& argument_binding, const Rhi::IResource& resource);
+    void RemoveTransitionResourceStates(const Rhi::IProgramBindings::IArgumentBinding& argument_binding);
     void AddTransitionResourceState(const Rhi::IProgramBindings::IArgumentBinding& argument_binding, Rhi::IResource& resource);
     void AddTransitionResourceStates(const Rhi::IProgramBindings::IArgumentBinding& argument_binding);
 
@@ -116,15 +118,17 @@ private:
 
     bool ApplyResourceStates(Rhi::ProgramArgumentAccessMask access, const Rhi::ICommandQueue* owner_queue_ptr = nullptr) const;
     void InitResourceRefsByAccess();
+    void ReserveTransitionResourceStates();
 
     const Ptr<Rhi::IProgram>             m_program_ptr;
     Data::Index                          m_frame_index;
-    Rhi::IProgram::Arguments             m_arguments;
-    ArgumentBindings                     m_binding_by_argument;
+    ArgumentBindings                     m_binding_by_argument_id;
     ResourceStatesByAccess               m_transition_resource_states_by_access;
     ResourceRefsByAccess                 m_resource_refs_by_access;
     mutable Ptr<Rhi::IResourceBarriers>  m_resource_state_transition_barriers_ptr;
+    mutable TracyLockable(std::mutex,    m_resource_state_transition_barriers_mutex); // program bindings may be applied by parallel render command lists
     Data::Index                          m_bindings_index = 0u; // index of this program bindings object between all program bindings of the program
+    bool                                 m_is_copy_initializing = false; // transition states and resource refs are copied from the original program bindings
 };
 
 } // namespace Methane::Graphics::Base
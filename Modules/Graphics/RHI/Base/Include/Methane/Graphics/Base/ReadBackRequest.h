@@ -0,0 +1,65 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ReadBackRequest.h
+Base implementation of the asynchronous resource read-back request,
+which becomes ready on completion of the command list with read-back commands.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IReadBackRequest.h>
+#include <Methane/Graphics/RHI/IResource.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Data/Receiver.hpp>
+
+#include <functional>
+#include <atomic>
+
+namespace Methane::Graphics::Base
+{
+
+class ReadBackRequest final
+    : public Rhi::IReadBackRequest
+    , private Data::Receiver<Rhi::ICommandListCallback>
+{
+public:
+    using DataProvider = std::function<Rhi::SubResource()>;
+
+    ReadBackRequest(Rhi::IResource& resource, Rhi::ICommandList& cmd_list, const DataProvider& data_provider);
+
+    // IReadBackRequest interface
+    bool                    IsReady() const noexcept override { return m_is_ready; }
+    bool                    WaitUntilReady(uint32_t timeout_ms = 0U) override;
+    const Rhi::SubResource& GetData() override;
+
+private:
+    // ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& cmd_list) override;
+
+    const Ptr<Rhi::IObject> m_resource_ptr; // resource with its read-back buffer is kept alive while request is in use
+    const Ptr<Rhi::IObject> m_cmd_list_ptr;
+    Rhi::ICommandList&      m_cmd_list;
+    const DataProvider      m_data_provider;
+    Opt<Rhi::SubResource>   m_data_opt;
+    std::atomic<bool>       m_is_executing = false;
+    std::atomic<bool>       m_is_ready = false;
+};
+
+} // namespace Methane::Graphics::Base
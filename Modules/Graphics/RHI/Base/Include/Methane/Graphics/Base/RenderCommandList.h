@@ -29,6 +29,7 @@ Base implementation of the render command list interface.
 
 #include <Methane/Data/EnumMask.hpp>
 
+#include <atomic>
 #include <optional>
 
 namespace Methane::Graphics::Rhi
@@ -54,7 +55,8 @@ struct RenderDrawingState
     enum class Change : uint32_t
     {
         PrimitiveType,
-        ViewState
+        ViewState,
+        RenderState // render state was not applied because it is not compiled yet
     };
 
     using ChangeMask = Data::EnumMask<Change>;
@@ -80,13 +82,16 @@ public:
 
     explicit RenderCommandList(CommandQueue& command_queue);
     RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass);
+    RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle);
     explicit RenderCommandList(ParallelRenderCommandList& parallel_render_command_list);
-    
+    ~RenderCommandList() override;
+
     using CommandList::Reset;
 
     // IRenderCommandList interface
     bool IsValidationEnabled() const noexcept final             { return m_is_validation_enabled; }
     void SetValidationEnabled(bool is_validation_enabled) final { m_is_validation_enabled = is_validation_enabled; }
+    bool IsBundle() const noexcept final                        { return m_is_bundle; }
     Rhi::IRenderPass& GetRenderPass() const final;
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
@@ -99,11 +104,16 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void ExecuteBundle(Rhi::IRenderCommandList& bundle) override;
+
+    // CommandList interface
+    void Complete() override;
 
     RenderPass&         GetPass();
     RenderPass*         GetPassPtr() const noexcept      { return m_render_pass_ptr.get(); }
     bool                HasPass() const noexcept         { return !!m_render_pass_ptr; }
     const DrawingState& GetDrawingState() const noexcept { return m_drawing_state; }
+    uint32_t            GetExecutingListsCount() const noexcept { return m_executing_lists_count; }
 
 protected:
     // CommandList overrides
@@ -112,14 +122,32 @@ protected:
     DrawingState& GetDrawingState() noexcept  { return m_drawing_state; }
     bool          IsParallel() const noexcept { return m_is_parallel; }
 
+    // Bundle is never executed on command queue, so it can be reset for recording again right after commit,
+    // unless it is still executed by other command lists which were not completed yet
+    void ResetCommittedBundle();
+
+    // Bundles executed by this command list are released when its execution is completed or encoding is reset
+    void ReleaseExecutedBundles();
+
+    // Drawing state is not inherited by the bundle commands and is not restored after bundle execution
+    void ResetDrawingState();
+
+    // Draw is skipped by the native command list, when render state was not applied because it is not compiled yet
+    bool IsRenderStateApplied() const noexcept { return !m_drawing_state.changes.HasAnyBit(DrawingState::Change::RenderState); }
+
     inline void UpdateDrawingState(Primitive primitive_type);
-    inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
+    // Start vertex is validated against per-vertex buffers and instances range against per-instance buffers
+    inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count,
+                                          uint32_t draw_start_instance, uint32_t draw_instance_count) const;
 
 private:
-    const bool            m_is_parallel = false;
-    const Ptr<RenderPass> m_render_pass_ptr;
-    DrawingState          m_drawing_state;
-    bool                  m_is_validation_enabled = true;
+    const bool              m_is_parallel = false;
+    const bool              m_is_bundle = false;
+    const Ptr<RenderPass>   m_render_pass_ptr;
+    DrawingState            m_drawing_state;
+    bool                    m_is_validation_enabled = true;
+    Ptrs<RenderCommandList> m_executed_bundle_ptrs;
+    std::atomic<uint32_t>   m_executing_lists_count{ 0U }; // count of not completed command lists executing this bundle
 };
 
 } // namespace Methane::Graphics::Base
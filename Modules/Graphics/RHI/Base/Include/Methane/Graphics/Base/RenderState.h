@@ -24,8 +24,10 @@ Base implementation of the render state interface.
 #pragma once
 
 #include "Object.h"
+#include "StateCompiler.h"
 
 #include <Methane/Graphics/RHI/IRenderState.h>
+#include <Methane/Data/Emitter.hpp>
 
 namespace Methane::Graphics::Base
 {
@@ -36,16 +38,19 @@ class RenderCommandList;
 class RenderState
     : public Object
     , public Rhi::IRenderState
+    , public Data::Emitter<Rhi::IRenderStateCallback>
 {
 public:
     RenderState(const RenderContext& context, const Settings& settings, bool is_deferred = false);
 
     // IRenderState overrides
     const Settings& GetSettings() const noexcept override { return m_settings; }
+    bool IsCompiled() const noexcept override             { return m_compiler.IsCompleted(); }
     void Reset(const Settings& settings) override;
 
-    // RenderState interface
-    virtual void Apply(RenderCommandList& command_list, Groups apply_groups) = 0;
+    // RenderState interface, returns false when state can not be applied because it is not compiled yet
+    // and throws the error of failed asynchronous compilation
+    virtual bool Apply(RenderCommandList& command_list, Groups apply_groups) = 0;
 
     const RenderContext& GetRenderContext() const noexcept { return m_context; }
     bool                 IsDeferred() const noexcept       { return m_is_deferred; }
@@ -53,9 +58,15 @@ public:
 protected:
     Rhi::IProgram& GetProgram();
 
+    // Compile function is executed asynchronously on context parallel executor when it is enabled in settings
+    void Compile(StateCompiler::CompileFunction&& compile_function);
+    void WaitForCompilation() const  { m_compiler.WaitForCompletion(); }
+    void RethrowCompileError() const { m_compiler.RethrowCompileError(); }
+
 private:
     const RenderContext& m_context;
     Settings             m_settings;
+    StateCompiler        m_compiler;
     
     // Deferred state is applied on first Draw, instead of SetRenderState call
     // This is required for Vulkan without dynamic state support (on mobile platforms):
@@ -30,6 +30,7 @@ Base implementation of the resource interface.
 
 #include <set>
 #include <map>
+#include <vector>
 #include <mutex>
 
 namespace Methane::Graphics::Base
@@ -54,13 +55,20 @@ public:
     [[nodiscard]] const Opt<uint32_t>& GetOwnerQueueFamily() const noexcept final { return m_owner_queue_family_index_opt; }
     [[nodiscard]] UsageMask            GetUsage() const noexcept final            { return m_usage_mask; }
     [[nodiscard]] const Rhi::IContext& GetContext() const noexcept final;
+    [[nodiscard]] State                GetSubResourceState(const SubResource::Index& subresource_index) const final;
 
     bool SetState(State state, Ptr<IBarriers>& out_barriers) final;
     bool SetState(State state) final;
+    bool SetSubResourceState(const SubResource::Index& subresource_index, State state, Ptr<IBarriers>& out_barriers) final;
+    bool SetSubResourceState(const SubResource::Index& subresource_index, State state) final;
     bool SetOwnerQueueFamily(uint32_t family_index) final;
     bool SetOwnerQueueFamily(uint32_t family_index, Ptr<IBarriers>& out_barriers) final;
 
     [[nodiscard]] Ptr<IBarriers>& GetSetupTransitionBarriers() noexcept  { return m_setup_transition_barriers_ptr; }
+    [[nodiscard]] bool            IsSubResourceStateTracked() const;
+
+    // Resource interface
+    [[nodiscard]] virtual SubResource::Count GetSubresourceCount() const noexcept { return SubResource::Count(); }
 
 protected:
     [[nodiscard]] const Context& GetBaseContext() const noexcept           { return m_context; }
@@ -71,16 +79,23 @@ protected:
     { m_is_state_change_updates_barriers = is_state_change_updates_barriers; }
 
 private:
+    using SubResourceStates = std::vector<State>;
+
+    bool SetSubResourceStatesToState(State state, Ptr<IBarriers>* out_barriers_ptr);
+    bool UpdateSubResourceState(const SubResource::Index& subresource_index, State state, Ptr<IBarriers>* out_barriers_ptr);
+    void SplitStateTransitionBarrier(IBarriers& barriers);
+
     const Context&     m_context;
     const Type         m_type;
     const UsageMask    m_usage_mask;
     State              m_state;
+    SubResourceStates  m_subresource_states; // per sub-resource states are tracked only while they are different
     const Opt<State>   m_auto_transition_source_state_opt;
     Data::Size         m_initialized_data_size = 0U;
     Ptr<IBarriers>     m_setup_transition_barriers_ptr;
     Opt<uint32_t>      m_owner_queue_family_index_opt;
     bool               m_is_state_change_updates_barriers = true;
-    TracyLockable(std::mutex, m_state_mutex);
+    mutable TracyLockable(std::mutex, m_state_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -24,9 +24,6 @@ Methane resource barriers base implementation.
 #pragma once
 
 #include <Methane/Graphics/RHI/IResourceBarriers.h>
-#include <Methane/Instrumentation.h>
-
-#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -39,10 +36,10 @@ public:
     explicit ResourceBarriers(const Set& barriers);
 
     // IResourceBarriers overrides
-    [[nodiscard]] Ptr<IResourceBarriers> GetPtr() final     { return shared_from_this(); }
-    [[nodiscard]] bool       IsEmpty() const noexcept final { return m_barriers_map.empty(); }
-    [[nodiscard]] Set        GetSet() const noexcept final;
-    [[nodiscard]] const Map& GetMap() const noexcept final  { return m_barriers_map; }
+    [[nodiscard]] Ptr<IResourceBarriers> GetPtr() final              { return shared_from_this(); }
+    [[nodiscard]] bool            IsEmpty() const noexcept final     { return m_barriers.empty(); }
+    [[nodiscard]] Set             GetSet() const noexcept final;
+    [[nodiscard]] const Barriers& GetBarriers() const noexcept final { return m_barriers; }
     [[nodiscard]] explicit operator std::string() const noexcept final;
 
     [[nodiscard]] const Barrier* GetBarrier(const Barrier::Id& id) const noexcept final;
@@ -61,11 +58,24 @@ public:
 
     void ApplyTransitions() const final;
 
-    auto Lock() const { return std::scoped_lock<LockableBase(std::recursive_mutex)>(m_barriers_mutex); }
+    // ResourceBarriers interface
+    virtual void Clear();
+    void RemoveResourceBarriers(const Rhi::IResource& resource);
+    [[nodiscard]] bool HasResourceBarriers(const Rhi::IResource& resource) const noexcept;
+    [[nodiscard]] bool HasSubResourceStateTransitions(Rhi::IResource& resource) const;
+    [[nodiscard]] bool HasOtherScopeStateTransition(const Barrier::Id& id) const;
+    void RemoveSubResourceStateTransitions(Rhi::IResource& resource);
 
 private:
-    Map m_barriers_map;
-    mutable TracyLockable(std::recursive_mutex, m_barriers_mutex);
+    Barriers::iterator       FindBarrier(const Barrier::Id& id) noexcept;
+    Barriers::const_iterator FindBarrier(const Barrier::Id& id) const noexcept;
+    Barriers::const_iterator FindSubResourceStateTransition(const Rhi::IResource& resource) const noexcept;
+
+    // Barriers are stored in a flat vector and searched linearly, which is faster than any index for a few barriers in a typical set.
+    // State transitions of the whole resource and of its sub-resources are never mixed in one barriers set,
+    // because native barriers of the overlapping sub-resource ranges have no defined order of execution.
+    // Barriers are not synchronized: sets shared between threads are guarded by their owner (see Base::ProgramBindings).
+    Barriers m_barriers;
 };
 
 } // namespace Methane::Graphics::Base
@@ -64,6 +64,7 @@ public:
 
 protected:
     uint32_t    GetProgramInputBufferIndexByArgumentSemantic(const Program& program, const std::string& argument_semantic) const;
+    PixelFormat GetProgramInputArgumentFormatBySemantic(const Program& program, const std::string& argument_semantic) const;
     std::string GetCompiledEntryFunctionName() const { return GetCompiledEntryFunctionName(m_settings); }
 
     static std::string GetCompiledEntryFunctionName(const Settings& settings);
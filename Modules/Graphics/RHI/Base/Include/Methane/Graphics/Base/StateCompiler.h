@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/StateCompiler.h
+Pipeline state compiler running compilation tasks synchronously
+or asynchronously on the parallel executor of the context.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <functional>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
+
+namespace tf
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics::Base
+{
+
+class StateCompiler // NOSONAR - custom destructor is required
+{
+public:
+    using CompileFunction   = std::function<void()>;
+    using CompletedCallback = std::function<void()>;
+
+    StateCompiler(tf::Executor& parallel_executor, CompletedCallback&& completed_callback);
+    ~StateCompiler();
+
+    StateCompiler(const StateCompiler&) = delete;
+    StateCompiler(StateCompiler&&) = delete;
+
+    StateCompiler& operator=(const StateCompiler&) = delete;
+    StateCompiler& operator=(StateCompiler&&) = delete;
+
+    // Synchronous compile function is called right away, while asynchronous one is executed on parallel executor
+    // and completed callback is called from the executor thread when all asynchronous compile functions are done;
+    // compilation error of the previous asynchronous compile functions is cleared with the next compile call
+    void Compile(CompileFunction&& compile_function, bool is_async);
+
+    // Blocks calling thread until all asynchronous compile functions are completed;
+    // it must not be called from the parallel executor thread to avoid worker starvation
+    void WaitForCompletion() const;
+
+    // Compilation is not completed when any asynchronous compile function has failed
+    [[nodiscard]] bool IsCompleted() const noexcept;
+
+    // Rethrows exception of the failed asynchronous compile function on the calling thread
+    void RethrowCompileError() const;
+
+private:
+    tf::Executor&                       m_parallel_executor;
+    const CompletedCallback             m_completed_callback;
+    uint32_t                            m_pending_tasks_count = 0U; // decremented before completed callback
+    uint32_t                            m_running_tasks_count = 0U; // decremented after completed callback
+    std::exception_ptr                  m_compile_exception_ptr;    // first error of asynchronous compile functions
+    mutable TracyLockable(std::mutex,   m_mutex);
+    mutable std::condition_variable_any m_completed_condition_var;
+};
+
+} // namespace Methane::Graphics::Base
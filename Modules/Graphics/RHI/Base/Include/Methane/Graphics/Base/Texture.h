@@ -44,6 +44,8 @@ public:
     [[nodiscard]] SubResource::Count GetSubresourceCount() const noexcept final { return m_sub_resource_count; }
     [[nodiscard]] Data::Size         GetSubResourceDataSize(const SubResource::Index& subresource_index) const final;
     void SetData(Rhi::ICommandQueue&, const SubResources& sub_resources) override;
+    Ptr<Rhi::IReadBackRequest> RequestReadBack(Rhi::ICommandList& cmd_list, const SubResource::Index& sub_resource_index = {},
+                                               const BytesRangeOpt& data_range = {}) override;
 
     static Data::Size GetRequiredMipLevelsCount(const Dimensions& dimensions);
 
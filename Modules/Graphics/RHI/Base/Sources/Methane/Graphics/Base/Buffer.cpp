@@ -23,6 +23,7 @@ Base implementation of the buffer interface.
 
 #include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/ReadBackRequest.h>
 
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
@@ -63,4 +64,19 @@ void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
     SetInitializedDataSize(sub_resource.GetDataSize());
 }
 
+Ptr<Rhi::IReadBackRequest> Buffer::RequestReadBack(Rhi::ICommandList& cmd_list, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    if (data_range)
+    {
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_range->GetEnd(), GetDataSize(), "read-back data range is out of buffer bounds");
+    }
+
+    // Default implementation without native read-back commands encoding gets buffer data synchronously
+    // on the command list queue, when request data is accessed after command list execution completion
+    Rhi::ICommandQueue& cmd_queue = cmd_list.GetCommandQueue();
+    return std::make_shared<ReadBackRequest>(*this, cmd_list,
+        [this, &cmd_queue, data_range]() { return GetData(cmd_queue, data_range); });
+}
+
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -27,6 +27,7 @@ Base implementation of the command list interface.
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/Base/ResourceBarriers.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -159,6 +160,62 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
     }
 }
 
+void CommandList::AddPendingResourceBarriers(const Rhi::IResourceBarriers& resource_barriers)
+{
+    META_FUNCTION_TASK();
+    if (resource_barriers.IsEmpty())
+        return;
+
+    if (!m_pending_resource_barriers_ptr)
+        m_pending_resource_barriers_ptr = std::static_pointer_cast<ResourceBarriers>(Rhi::IResourceBarriers::Create());
+
+    for(const Rhi::ResourceBarrier& barrier : resource_barriers.GetBarriers())
+    {
+        const Rhi::ResourceBarrier::Id& barrier_id = barrier.GetId();
+        const Rhi::ResourceBarrier* pending_barrier_ptr = m_pending_resource_barriers_ptr->GetBarrier(barrier_id);
+        if (!pending_barrier_ptr)
+        {
+            // Whole resource and sub-resource state transitions of the same resource are not mixed in one set of barriers,
+            // so pending barriers are flushed first to apply transitions of the other scope before this one
+            if (m_pending_resource_barriers_ptr->HasOtherScopeStateTransition(barrier_id))
+                FlushPendingResourceBarriers();
+
+            m_pending_resource_barriers_ptr->Add(barrier_id, barrier);
+            continue;
+        }
+
+        if (*pending_barrier_ptr == barrier &&
+            barrier_id.GetType() == Rhi::ResourceBarrier::Type::OwnerTransition)
+            continue;
+
+        if (barrier_id.GetType() != Rhi::ResourceBarrier::Type::StateTransition ||
+            pending_barrier_ptr->GetStateChange().GetStateAfter() != barrier.GetStateChange().GetStateBefore())
+        {
+            // Transitions which do not follow each other can not be merged,
+            // so pending barriers are flushed first to keep the order of transitions
+            FlushPendingResourceBarriers();
+            m_pending_resource_barriers_ptr->Add(barrier_id, barrier);
+            continue;
+        }
+
+        // Sequential state transitions of the same resource are merged into one transition from the first to the last state
+        const Rhi::ResourceState state_before = pending_barrier_ptr->GetStateChange().GetStateBefore();
+        const Rhi::ResourceState state_after  = barrier.GetStateChange().GetStateAfter();
+        if (state_before == state_after)
+            m_pending_resource_barriers_ptr->Remove(barrier_id);
+        else if (const Opt<Rhi::SubResource::Index>& subresource_index_opt = barrier_id.GetSubResourceIndex();
+                 subresource_index_opt)
+            m_pending_resource_barriers_ptr->Add(barrier_id, Rhi::ResourceBarrier(barrier_id.GetResource(), *subresource_index_opt, state_before, state_after));
+        else
+            m_pending_resource_barriers_ptr->Add(barrier_id, Rhi::ResourceBarrier(barrier_id.GetResource(), state_before, state_after));
+    }
+}
+
+const Rhi::IResourceBarriers* CommandList::GetPendingResourceBarriersPtr() const noexcept
+{
+    return m_pending_resource_barriers_ptr.get();
+}
+
 void CommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -168,6 +225,8 @@ void CommandList::Commit()
                                "{} command list '{}' in {} state can not be committed; only command lists in 'Encoding' state can be committed",
                                magic_enum::enum_name(m_type), GetName(), magic_enum::enum_name(m_state));
 
+    FlushPendingResourceBarriers();
+
     TRACY_GPU_SCOPE_END(m_tracy_gpu_scope);
     META_LOG("{} Command list '{}' COMMIT", magic_enum::enum_name(m_type), GetName());
 
@@ -284,6 +343,19 @@ void CommandList::SetCommandListStateNoLock(State state)
     Data::Emitter<Rhi::ICommandListCallback>::Emit(&Rhi::ICommandListCallback::OnCommandListStateChanged, *this);
 }
 
+void CommandList::FlushPendingResourceBarriers()
+{
+    META_FUNCTION_TASK();
+    if (!m_pending_resource_barriers_ptr || m_pending_resource_barriers_ptr->IsEmpty())
+        return;
+
+    // Pending barriers are detached while being set to prevent recursive flush from SetResourceBarriers implementation
+    const Ptr<ResourceBarriers> pending_resource_barriers_ptr = std::move(m_pending_resource_barriers_ptr);
+    SetResourceBarriers(*pending_resource_barriers_ptr);
+    pending_resource_barriers_ptr->Clear();
+    m_pending_resource_barriers_ptr = pending_resource_barriers_ptr;
+}
+
 void CommandList::VerifyEncodingState() const
 {
     META_CHECK_ARG_EQUAL_DESCR(m_state, State::Encoding,
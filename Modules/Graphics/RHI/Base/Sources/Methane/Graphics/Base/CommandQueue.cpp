@@ -28,6 +28,7 @@ Base implementation of the command queue interface.
 #include <Methane/Graphics/Base/RenderContext.h>
 
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
 
 namespace Methane::Graphics::Base
 {
@@ -65,6 +66,12 @@ Ptr<Rhi::ICommandKit> CommandQueue::CreateCommandKit()
     return std::make_shared<CommandKit>(*this);
 }
 
+Ptr<Rhi::IRenderCommandList> CommandQueue::CreateRenderCommandBundle(Rhi::IRenderPass&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "Render command bundles are not supported by this graphics API.");
+}
+
 const Rhi::IContext& CommandQueue::GetContext() const noexcept
 {
     META_FUNCTION_TASK();
@@ -75,6 +82,7 @@ void CommandQueue::Execute(Rhi::ICommandListSet& command_lists, const Rhi::IComm
 {
     META_FUNCTION_TASK();
     META_LOG("Command queue '{}' is executing", GetName());
+    m_context.CompleteAsyncUploads(*this);
     static_cast<CommandListSet&>(command_lists).Execute(completed_callback);
 }
 
@@ -63,7 +63,7 @@ void ComputeCommandList::SetComputeState(Rhi::IComputeState& compute_state)
 
     const bool render_state_changed = m_compute_state_ptr.get() != std::addressof(compute_state);
     auto& compute_state_base = static_cast<ComputeState&>(compute_state);
-    compute_state_base.Apply(*this);
+    m_is_compute_state_applied = compute_state_base.Apply(*this);
 
     Ptr<Object> compute_state_object_ptr = compute_state_base.GetBasePtr();
     m_compute_state_ptr = std::static_pointer_cast<ComputeState>(compute_state_object_ptr);
@@ -86,6 +86,14 @@ void ComputeCommandList::Dispatch([[maybe_unused]] const Rhi::ThreadGroupsCount&
     META_FUNCTION_TASK();
     META_LOG("{} Command list '{}' DISPATCH {} thread groups count.",
              magic_enum::enum_name(GetType()), GetName(), thread_groups_count);
+
+    FlushPendingResourceBarriers();
+
+    // Asynchronously compiled compute state is applied on the first dispatch after compilation completion
+    if (m_compute_state_ptr && !m_is_compute_state_applied)
+    {
+        m_is_compute_state_applied = m_compute_state_ptr->Apply(*this);
+    }
 }
 
 } // namespace Methane::Graphics::Base
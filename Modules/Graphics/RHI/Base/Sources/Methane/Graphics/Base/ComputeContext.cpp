@@ -83,11 +83,16 @@ void ComputeContext::Initialize(Device& device, bool is_callback_emitted)
 bool ComputeContext::UploadResources() const
 {
     META_FUNCTION_TASK();
+    // Compute command kit is created before upload to be synchronized with asynchronous upload before its first execution
+    const Rhi::ICommandKit& compute_cmd_kit = GetComputeCommandKit();
     if (!Context::UploadResources())
         return false;
 
+    if (GetOptions().HasBit(Rhi::ContextOption::AsyncResourceUploads))
+        return true;
+
     // Compute commands will wait for resources uploading completion in upload queue
-    GetUploadCommandKit().GetFence().FlushOnGpu(GetComputeCommandKit().GetQueue());
+    GetUploadCommandKit().GetFence().FlushOnGpu(compute_cmd_kit.GetQueue());
     return true;
 }
 
@@ -23,6 +23,7 @@ Base implementation of the compute state interface.
 
 #include <Methane/Graphics/Base/ComputeState.h>
 #include <Methane/Graphics/RHI/IProgram.h>
+#include <Methane/Graphics/RHI/IContext.h>
 
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
@@ -33,6 +34,7 @@ namespace Methane::Graphics::Base
 ComputeState::ComputeState(const Rhi::IContext& context, const Settings& settings)
     : m_context(context)
     , m_settings(settings)
+    , m_compiler(context.GetParallelExecutor(), [this]() { Data::Emitter<Rhi::IComputeStateCallback>::Emit(&Rhi::IComputeStateCallback::OnComputeStateCompiled, *this); })
 { }
 
 void ComputeState::Reset(const Settings& settings)
@@ -44,6 +46,12 @@ void ComputeState::Reset(const Settings& settings)
     m_settings = settings;
 }
 
+void ComputeState::Compile(StateCompiler::CompileFunction&& compile_function)
+{
+    META_FUNCTION_TASK();
+    m_compiler.Compile(std::move(compile_function), m_settings.async_compilation_enabled);
+}
+
 Rhi::IProgram& ComputeState::GetProgram()
 {
     META_FUNCTION_TASK();
@@ -147,6 +147,12 @@ void Context::Release()
 
     m_device_ptr.reset();
 
+    {
+        std::scoped_lock lock_guard(m_async_upload_mutex);
+        m_async_upload_pending_queues.clear();
+        m_is_async_upload_pending = false;
+    }
+
     m_default_command_kit_ptr_by_queue.clear();
     for (Ptr<Rhi::ICommandKit>& cmd_kit_ptr : m_default_command_kit_ptrs)
         cmd_kit_ptr.reset();
@@ -310,6 +316,20 @@ bool Context::UploadResources() const
     // Execute resource upload command lists
     upload_cmd_kit.GetQueue().Execute(upload_cmd_kit.GetListSet());
 
+    if (GetOptions().HasBit(Rhi::ContextOption::AsyncResourceUploads))
+    {
+        // Other command queues are synchronized with upload right before their next command lists execution,
+        // so that upload does not wait for these queues and they do not wait for upload until actually used
+        std::scoped_lock lock_guard(m_async_upload_mutex);
+        for (const auto& [cmd_queue_ptr, cmd_kit_ptr] : m_default_command_kit_ptr_by_queue)
+        {
+            if (cmd_kit_ptr.get() != std::addressof(upload_cmd_kit))
+                m_async_upload_pending_queues.insert(cmd_queue_ptr);
+        }
+        m_is_async_upload_pending = !m_async_upload_pending_queues.empty();
+        return true;
+    }
+
     // Execute post-upload synchronization command lists for all queues except the upload command queue
     // and set post-upload command queue fences to wait for upload command command queue completion
     ExecuteSyncCommandLists<Rhi::CommandListPurpose::PostUploadSync>(upload_cmd_kit);
@@ -317,6 +337,49 @@ bool Context::UploadResources() const
     return true;
 }
 
+void Context::CompleteAsyncUploads(Rhi::ICommandQueue& cmd_queue) const
+{
+    META_FUNCTION_TASK();
+    if (!m_is_async_upload_pending)
+        return;
+
+    const Rhi::ICommandKit& upload_cmd_kit = GetUploadCommandKit();
+    if (std::addressof(upload_cmd_kit.GetQueue()) == std::addressof(cmd_queue))
+        return;
+
+    // Post-upload synchronization list may already contain acquire barriers of the next upload,
+    // so the next upload is executed first to submit the matching release barriers before them
+    if (upload_cmd_kit.HasList() && upload_cmd_kit.GetList().GetState() == Rhi::CommandListState::Encoding)
+        UploadResources();
+
+    // Command queue does not wait for upload on GPU and keeps executing its command lists with previously uploaded resources,
+    // until upload completion is observed on CPU, after which post-upload synchronization is executed without any wait
+    if (upload_cmd_kit.HasList() && upload_cmd_kit.GetList().GetState() == Rhi::CommandListState::Executing)
+        return;
+
+    {
+        std::scoped_lock lock_guard(m_async_upload_mutex);
+        if (!m_async_upload_pending_queues.erase(std::addressof(cmd_queue)))
+            return;
+
+        m_is_async_upload_pending = !m_async_upload_pending_queues.empty();
+    }
+
+    META_LOG("Context '{}' SYNCHRONIZING completed asynchronous upload with command queue '{}'", GetName(), cmd_queue.GetName());
+
+    constexpr auto cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+    const auto cmd_kit_it = m_default_command_kit_ptr_by_queue.find(std::addressof(cmd_queue));
+    if (cmd_kit_it == m_default_command_kit_ptr_by_queue.end() || !cmd_kit_it->second->HasList(cmd_list_id))
+        return;
+
+    Rhi::ICommandList& post_upload_cmd_list = cmd_kit_it->second->GetList(cmd_list_id);
+    if (post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding)
+        post_upload_cmd_list.Commit();
+
+    if (post_upload_cmd_list.GetState() == Rhi::CommandListState::Committed)
+        cmd_queue.Execute(cmd_kit_it->second->GetListSet({ cmd_list_id }));
+}
+
 void Context::PerformRequestedAction()
 {
     META_FUNCTION_TASK();
@@ -28,6 +28,7 @@ Base implementation of the program interface.
 
 #include <magic_enum.hpp>
 #include <algorithm>
+#include <tuple>
 
 namespace Methane::Graphics::Base
 {
@@ -61,7 +62,16 @@ Program::Program(const Context& context, const Settings& settings)
     , m_settings(settings)
     , m_shaders_by_type(CreateShadersByType(settings.shaders))
     , m_shader_types(CreateShaderTypes(settings.shaders))
-{ }
+{
+    META_FUNCTION_TASK();
+    for (const InputBufferLayout& input_buffer_layout : m_settings.input_buffer_layouts)
+    {
+        META_CHECK_ARG_DESCR(input_buffer_layout.argument_formats.size(),
+                             input_buffer_layout.argument_formats.empty() ||
+                             input_buffer_layout.argument_formats.size() == input_buffer_layout.argument_semantics.size(),
+                             "input buffer argument formats count should be equal to argument semantics count");
+    }
+}
 
 const Ptr<Rhi::IShader>& Program::GetShader(Rhi::ShaderType shader_type) const
 {
@@ -71,10 +81,11 @@ const Ptr<Rhi::IShader>& Program::GetShader(Rhi::ShaderType shader_type) const
 void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
 {
     META_FUNCTION_TASK();
+    using BindingByArgument = std::unordered_map<Argument, Ptr<ArgumentBinding>, Argument::Hash>;
     Rhi::ShaderTypes all_shader_types;
-    std::map<std::string_view, Rhi::ShaderTypes, std::less<>> shader_types_by_argument_name_map;
-    
-    m_binding_by_argument.clear();
+    BindingByArgument binding_by_argument;
+    std::unordered_map<std::string_view, Rhi::ShaderTypes> shader_types_by_argument_name_map;
+
     for (const Ptr<Rhi::IShader>& shader_ptr : m_settings.shaders)
     {
         META_CHECK_ARG_NOT_NULL_DESCR(shader_ptr, "empty shader pointer in program is not allowed");
@@ -86,7 +97,7 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
         {
             META_CHECK_ARG_NOT_NULL_DESCR(argument_binging_ptr, "empty resource binding provided by shader");
             const Argument& shader_argument = argument_binging_ptr->GetSettings().argument;
-            if (const auto [it, added] = m_binding_by_argument.try_emplace(shader_argument, argument_binging_ptr);
+            if (const auto [it, added] = binding_by_argument.try_emplace(shader_argument, argument_binging_ptr);
                 !added)
             {
                 it->second->MergeSettings(*argument_binging_ptr);
@@ -107,8 +118,8 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
             for (Rhi::ShaderType shader_type: all_shader_types)
             {
                 const Argument argument{ shader_type, argument_name };
-                auto binding_by_argument_it = m_binding_by_argument.find(argument);
-                META_CHECK_ARG_DESCR(argument, binding_by_argument_it != m_binding_by_argument.end(), "Resource binding was not initialized for for argument");
+                auto binding_by_argument_it = binding_by_argument.find(argument);
+                META_CHECK_ARG_DESCR(argument, binding_by_argument_it != binding_by_argument.end(), "Resource binding was not initialized for for argument");
                 if (argument_binding_ptr)
                 {
                     argument_binding_ptr->MergeSettings(*binding_by_argument_it->second);
@@ -117,47 +128,96 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
                 {
                     argument_binding_ptr = binding_by_argument_it->second;
                 }
-                m_binding_by_argument.erase(binding_by_argument_it);
+                binding_by_argument.erase(binding_by_argument_it);
             }
 
             META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "failed to create resource binding for argument '{}'", argument_name);
-            m_binding_by_argument.try_emplace(Argument{ Rhi::ShaderType::All, argument_name }, argument_binding_ptr);
+            binding_by_argument.try_emplace(Argument{ Rhi::ShaderType::All, argument_name }, argument_binding_ptr);
         }
     }
 
+    // Intern program arguments to dense identifiers, which are assigned in stable order of argument names and shader types
+    m_arguments_by_id.clear();
+    m_arguments_by_id.reserve(binding_by_argument.size());
+    for (const auto& [program_argument, argument_binding_ptr] : binding_by_argument)
+    {
+        m_arguments_by_id.push_back(program_argument);
+    }
+    std::sort(m_arguments_by_id.begin(), m_arguments_by_id.end(),
+              [](const Argument& left, const Argument& right)
+              { return std::make_tuple(left.GetName(), left.GetShaderType()) < std::make_tuple(right.GetName(), right.GetShaderType()); });
+
+    m_arguments.clear();
+    m_argument_id_by_argument.clear();
+    m_binding_by_argument_id.clear();
+    m_binding_by_argument_id.reserve(m_arguments_by_id.size());
+    m_resources_count_by_access.fill(0U);
+    for (ArgumentId argument_id = 0U; argument_id < static_cast<ArgumentId>(m_arguments_by_id.size()); ++argument_id)
+    {
+        const Argument& program_argument = m_arguments_by_id[argument_id];
+        const Ptr<ArgumentBinding>& argument_binding_ptr = binding_by_argument.at(program_argument);
+        const Rhi::ProgramArgumentBindingSettings& argument_binding_settings = argument_binding_ptr->GetSettings();
+        argument_binding_ptr->SetArgumentId(argument_id);
+        m_arguments.insert(program_argument);
+        m_argument_id_by_argument.try_emplace(program_argument, argument_id);
+        m_binding_by_argument_id.push_back(argument_binding_ptr);
+        m_resources_count_by_access[argument_binding_settings.argument.GetAccessorIndex()] += argument_binding_settings.resource_count;
+    }
+
     if (m_context.GetType() != Rhi::IContext::Type::Render)
         return;
 
     // Create frame-constant argument bindings only when program is created in render context
-    m_frame_bindings_by_argument.clear();
+    m_frame_bindings_by_argument_id.clear();
+    m_frame_bindings_by_argument_id.resize(m_binding_by_argument_id.size());
     const auto& render_context = static_cast<const RenderContext&>(m_context);
     const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
     META_CHECK_ARG_GREATER_OR_EQUAL(frame_buffers_count, 2);
 
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (size_t argument_index = 0U; argument_index < m_binding_by_argument_id.size(); ++argument_index)
     {
+        const Ptr<ArgumentBinding>& argument_binding_ptr = m_binding_by_argument_id[argument_index];
         if (!argument_binding_ptr->GetSettings().argument.IsFrameConstant())
             continue;
 
-        Ptrs<ProgramBindings::ArgumentBinding> per_frame_argument_bindings(frame_buffers_count);
+        Ptrs<ProgramBindings::ArgumentBinding>& per_frame_argument_bindings = m_frame_bindings_by_argument_id[argument_index];
+        per_frame_argument_bindings.resize(frame_buffers_count);
         per_frame_argument_bindings[0] = argument_binding_ptr;
         for(uint32_t frame_index = 1; frame_index < frame_buffers_count; ++frame_index)
         {
             per_frame_argument_bindings[frame_index] = argument_binding_ptr->CreateCopy();
         }
-        m_frame_bindings_by_argument.try_emplace(program_argument, std::move(per_frame_argument_bindings));
     }
 }
 
-const Ptr<ProgramBindings::ArgumentBinding>& Program::GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const
+Program::ArgumentId Program::GetArgumentId(const Argument& argument) const
+{
+    META_FUNCTION_TASK();
+    const auto argument_id_it = m_argument_id_by_argument.find(argument);
+    if (argument_id_it == m_argument_id_by_argument.end())
+        throw Argument::NotFoundException(*this, argument);
+
+    return argument_id_it->second;
+}
+
+const Program::Argument& Program::GetArgument(ArgumentId argument_id) const
 {
     META_FUNCTION_TASK();
-    const auto argument_frame_bindings_it = m_frame_bindings_by_argument.find(argument_accessor);
-    META_CHECK_ARG_TRUE_DESCR(argument_frame_bindings_it != m_frame_bindings_by_argument.end(), "can not find frame-constant argument binding in program");
-    return argument_frame_bindings_it->second.at(frame_index);
+    META_CHECK_ARG_LESS(argument_id, m_arguments_by_id.size());
+    return m_arguments_by_id[argument_id];
 }
 
-Ptr<ProgramBindings::ArgumentBinding> Program::CreateArgumentBindingInstance(const Ptr<ProgramBindings::ArgumentBinding>& argument_binding_ptr, Data::Index frame_index) const
+const Ptr<ProgramBindings::ArgumentBinding>& Program::GetFrameArgumentBinding(Data::Index frame_index, ArgumentId argument_id) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(argument_id, m_frame_bindings_by_argument_id.size());
+    const Ptrs<ArgumentBinding>& argument_frame_bindings = m_frame_bindings_by_argument_id[argument_id];
+    META_CHECK_ARG_NOT_EMPTY_DESCR(argument_frame_bindings, "can not find frame-constant argument binding in program");
+    return argument_frame_bindings.at(frame_index);
+}
+
+Ptr<ProgramBindings::ArgumentBinding> Program::CreateArgumentBindingInstance(const Ptr<ProgramBindings::ArgumentBinding>& argument_binding_ptr, Data::Index frame_index,
+                                                                             const ArgumentBinding::Allocator& allocator) const
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
@@ -165,13 +225,21 @@ Ptr<ProgramBindings::ArgumentBinding> Program::CreateArgumentBindingInstance(con
     const Rhi::ProgramArgumentAccessor& argument_accessor = argument_binding_ptr->GetSettings().argument;
     switch(argument_accessor.GetAccessorType())
     {
-    case ArgumentAccessor::Type::Mutable:       return argument_binding_ptr->CreateCopy();
+    case ArgumentAccessor::Type::Mutable:       return argument_binding_ptr->CreateCopy(allocator);
     case ArgumentAccessor::Type::Constant:      return argument_binding_ptr;
-    case ArgumentAccessor::Type::FrameConstant: return GetFrameArgumentBinding(frame_index, argument_accessor);
+    case ArgumentAccessor::Type::FrameConstant: return GetFrameArgumentBinding(frame_index, argument_binding_ptr->GetArgumentId());
     default:                                    META_UNEXPECTED_ARG_RETURN(argument_accessor.GetAccessorType(), nullptr);
     }
 }
 
+void Program::UpdateArgumentBindingsArenaSize(size_t arena_size) noexcept
+{
+    META_FUNCTION_TASK();
+    size_t prev_arena_size = m_argument_bindings_arena_size;
+    while(prev_arena_size < arena_size &&
+          !m_argument_bindings_arena_size.compare_exchange_weak(prev_arena_size, arena_size));
+}
+
 Rhi::IShader& Program::GetShaderRef(Rhi::ShaderType shader_type) const
 {
     META_FUNCTION_TASK();
@@ -196,4 +264,18 @@ uint32_t Program::GetInputBufferIndexByArgumentSemantic(const std::string& argum
 #endif
 }
 
+PixelFormat Program::GetInputArgumentFormatBySemantic(const std::string& argument_semantic) const
+{
+    META_FUNCTION_TASK();
+    for (const InputBufferLayout& input_buffer_layout : m_settings.input_buffer_layouts)
+    {
+        if (auto argument_it = std::find(input_buffer_layout.argument_semantics.begin(), input_buffer_layout.argument_semantics.end(), argument_semantic);
+            argument_it != input_buffer_layout.argument_semantics.end())
+            return input_buffer_layout.argument_formats.empty()
+                 ? PixelFormat::Unknown
+                 : input_buffer_layout.argument_formats[std::distance(input_buffer_layout.argument_semantics.begin(), argument_it)];
+    }
+    return PixelFormat::Unknown;
+}
+
 } // namespace Methane::Graphics::Base
@@ -139,7 +139,7 @@ bool ProgramArgumentBinding::IsAlreadyApplied(const Rhi::IProgram& program,
 
     // 2) No need in setting resource binding to the same location
     //    as a previous resource binding set in the same command list for the same program
-    if (const Rhi::IProgramBindings::IArgumentBinding& previous_argument_argument_binding = applied_program_bindings.Get(m_settings.argument);
+    if (const Rhi::IProgramBindings::IArgumentBinding& previous_argument_argument_binding = applied_program_bindings.Get(m_argument_id);
         previous_argument_argument_binding.GetResourceViews() == m_resource_views)
         return true;
 
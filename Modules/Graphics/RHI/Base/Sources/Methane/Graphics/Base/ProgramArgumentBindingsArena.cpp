@@ -0,0 +1,65 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ProgramArgumentBindingsArena.cpp
+Contiguous memory arena and allocator of the argument binding instances
+owned by one program bindings object.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ProgramArgumentBindingsArena.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <functional>
+
+namespace Methane::Graphics::Base
+{
+
+static size_t GetAlignedSize(size_t size, size_t alignment) noexcept
+{
+    return (size + alignment - 1U) / alignment * alignment;
+}
+
+ProgramArgumentBindingsArena::ProgramArgumentBindingsArena(size_t capacity)
+    : m_capacity(capacity)
+    , m_memory(capacity ? std::make_unique<std::byte[]>(capacity) : nullptr)
+{ }
+
+void* ProgramArgumentBindingsArena::Allocate(size_t size, size_t alignment) noexcept
+{
+    META_FUNCTION_TASK();
+    // Memory block is allocated with default new alignment, so aligning offsets is enough to align addresses
+    const size_t aligned_offset = GetAlignedSize(m_used_size, alignment);
+    m_requested_size = GetAlignedSize(m_requested_size, alignment) + size;
+    if (aligned_offset + size > m_capacity)
+        return nullptr;
+
+    m_used_size = aligned_offset + size;
+    return m_memory.get() + aligned_offset;
+}
+
+bool ProgramArgumentBindingsArena::Contains(const void* memory_ptr) const noexcept
+{
+    META_FUNCTION_TASK();
+    const std::byte* byte_ptr = static_cast<const std::byte*>(memory_ptr);
+    const std::less_equal<const std::byte*> less_equal;
+    return m_memory && less_equal(m_memory.get(), byte_ptr) && !less_equal(m_memory.get() + m_capacity, byte_ptr);
+}
+
+} // namespace Methane::Graphics::Base
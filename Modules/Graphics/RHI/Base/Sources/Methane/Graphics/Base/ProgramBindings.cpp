@@ -36,6 +36,8 @@ Base implementation of the program bindings interface.
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 #include <array>
+#include <vector>
+#include <algorithm>
 
 namespace Methane::Graphics::Base
 {
@@ -86,6 +88,7 @@ ProgramBindings::ProgramBindings(Program& program, Data::Index frame_index)
 {
     META_FUNCTION_TASK();
     InitializeArgumentBindings();
+    ReserveTransitionResourceStates();
 }
 
 ProgramBindings::ProgramBindings(Program& program, const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index)
@@ -109,11 +112,23 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
     , Data::Receiver<IProgramBindings::IArgumentBindingCallback>()
     , m_program_ptr(other_program_bindings.m_program_ptr)
     , m_frame_index(frame_index.value_or(other_program_bindings.m_frame_index))
-    , m_transition_resource_states_by_access(other_program_bindings.m_transition_resource_states_by_access)
     , m_bindings_index(static_cast<Program&>(*m_program_ptr).GetBindingsCountAndIncrement())
 {
     META_FUNCTION_TASK();
     InitializeArgumentBindings(&other_program_bindings);
+    ReserveTransitionResourceStates();
+
+    // Flat arrays of transition states and resource refs are copied as a whole from the original program bindings:
+    // constant argument bindings are shared and mutable argument bindings are copied with the same resource views,
+    // so their states are updated only for replaced resource views, while frame-constant argument bindings
+    // may be different for the other frame index, so their transition states are added after resource views replacement
+    for(Rhi::ProgramArgumentAccessType access_type : { Rhi::ProgramArgumentAccessType::Constant, Rhi::ProgramArgumentAccessType::Mutable })
+    {
+        const size_t access_index = magic_enum::enum_index(access_type).value();
+        m_transition_resource_states_by_access[access_index] = other_program_bindings.m_transition_resource_states_by_access[access_index];
+    }
+    m_resource_refs_by_access = other_program_bindings.m_resource_refs_by_access;
+    m_is_copy_initializing = true;
 }
 
 Rhi::IProgram& ProgramBindings::GetProgram() const
@@ -128,6 +143,7 @@ void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgume
                                                                        const Rhi::IResource::Views& new_resource_views)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_resource_state_transition_barriers_mutex);
     if (!m_resource_state_transition_barriers_ptr)
         return;
 
@@ -164,22 +180,35 @@ void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgume
 void ProgramBindings::InitializeArgumentBindings(const ProgramBindings* other_program_bindings_ptr)
 {
     META_FUNCTION_TASK();
-    const auto& program = static_cast<const Program&>(GetProgram());
+    auto& program = static_cast<Program&>(GetProgram());
     const ArgumentBindings& argument_bindings = other_program_bindings_ptr
                                               ? other_program_bindings_ptr->GetArgumentBindings()
                                               : program.GetArgumentBindings();
-    for (const auto& [program_argument, argument_binding_ptr] : argument_bindings)
+    m_binding_by_argument_id.resize(argument_bindings.size());
+
+    // Mutable argument binding instances are allocated in a single contiguous arena sized by the program
+    constexpr size_t mutable_access_index = magic_enum::enum_index(Rhi::ProgramArgumentAccessType::Mutable).value();
+    const Ptr<ProgramArgumentBindingsArena> arena_ptr = program.GetResourcesCountByAccess()[mutable_access_index]
+                                                      ? std::make_shared<ProgramArgumentBindingsArena>(program.GetArgumentBindingsArenaSize())
+                                                      : nullptr;
+    const ArgumentBinding::Allocator argument_binding_allocator(arena_ptr);
+    for (Rhi::ProgramArgumentId argument_id = 0U; argument_id < static_cast<Rhi::ProgramArgumentId>(argument_bindings.size()); ++argument_id)
     {
-        META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
-        m_arguments.insert(program_argument);
-        if (m_binding_by_argument.count(program_argument))
+        const Ptr<ArgumentBinding>& argument_binding_ptr = argument_bindings[argument_id];
+        META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program.GetArgument(argument_id).GetName());
+        if (m_binding_by_argument_id[argument_id])
             continue;
 
-        Ptr<ProgramBindings::ArgumentBinding> argument_binding_instance_ptr = program.CreateArgumentBindingInstance(argument_binding_ptr, m_frame_index);
+        Ptr<ProgramBindings::ArgumentBinding> argument_binding_instance_ptr = program.CreateArgumentBindingInstance(argument_binding_ptr, m_frame_index, argument_binding_allocator);
         if (argument_binding_ptr->GetSettings().argument.GetAccessorType() == Rhi::ProgramArgumentAccessType::Mutable)
             argument_binding_instance_ptr->Connect(*this);
 
-        m_binding_by_argument.try_emplace(program_argument, std::move(argument_binding_instance_ptr));
+        m_binding_by_argument_id[argument_id] = std::move(argument_binding_instance_ptr);
+    }
+
+    if (arena_ptr)
+    {
+        program.UpdateArgumentBindingsArenaSize(arena_ptr->GetRequestedSize());
     }
 }
 
@@ -187,9 +216,12 @@ Rhi::IProgramBindings::ResourceViewsByArgument ProgramBindings::ReplaceResourceV
                                                                                     const ResourceViewsByArgument& replace_resource_views) const
 {
     META_FUNCTION_TASK();
+    const auto& program = static_cast<const Program&>(GetProgram());
     ResourceViewsByArgument resource_views_by_argument = replace_resource_views;
-    for (const auto& [program_argument, argument_binding_ptr] : argument_bindings)
+    for (Rhi::ProgramArgumentId argument_id = 0U; argument_id < static_cast<Rhi::ProgramArgumentId>(argument_bindings.size()); ++argument_id)
     {
+        const Ptr<ArgumentBinding>& argument_binding_ptr = argument_bindings[argument_id];
+        const Rhi::IProgram::Argument& program_argument = program.GetArgument(argument_id);
         META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
 
         // NOTE:
@@ -207,38 +239,68 @@ Rhi::IProgramBindings::ResourceViewsByArgument ProgramBindings::ReplaceResourceV
 void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument)
 {
     META_FUNCTION_TASK();
+    bool resource_views_changed = !m_is_copy_initializing;
     for (const auto& [program_argument, resource_views] : resource_views_by_argument)
     {
         Rhi::IProgramBindings::IArgumentBinding& argument_binding = Get(program_argument);
-        argument_binding.SetResourceViews(resource_views);
+        if (m_is_copy_initializing && !argument_binding.GetSettings().argument.IsFrameConstant())
+        {
+            // Transition states copied from the original program bindings are updated only for the replaced resource views
+            if (argument_binding.GetResourceViews() == resource_views)
+                continue;
+
+            RemoveTransitionResourceStates(argument_binding);
+        }
+        resource_views_changed |= SetArgumentResourceViews(argument_binding, resource_views);
         AddTransitionResourceStates(argument_binding);
     }
-    InitResourceRefsByAccess();
+
+    if (resource_views_changed)
+    {
+        InitResourceRefsByAccess();
+    }
+    m_is_copy_initializing = false;
+}
+
+bool ProgramBindings::SetArgumentResourceViews(IArgumentBinding& argument_binding, const Rhi::IResource::Views& resource_views)
+{
+    META_FUNCTION_TASK();
+    return argument_binding.SetResourceViews(resource_views);
+}
+
+const Rhi::IProgram::Arguments& ProgramBindings::GetArguments() const noexcept
+{
+    return static_cast<const Program&>(*m_program_ptr).GetArguments();
 }
 
 Rhi::IProgramBindings::IArgumentBinding& ProgramBindings::Get(const Rhi::IProgram::Argument& shader_argument) const
 {
     META_FUNCTION_TASK();
-    const auto binding_by_argument_it = m_binding_by_argument.find(shader_argument);
-    if (binding_by_argument_it == m_binding_by_argument.end())
-        throw Rhi::IProgram::Argument::NotFoundException(*m_program_ptr, shader_argument);
+    return Get(m_program_ptr->GetArgumentId(shader_argument));
+}
 
-    return *binding_by_argument_it->second;
+Rhi::IProgramBindings::IArgumentBinding& ProgramBindings::Get(Rhi::ProgramArgumentId argument_id) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(argument_id, m_binding_by_argument_id.size());
+    const Ptr<ArgumentBinding>& argument_binding_ptr = m_binding_by_argument_id[argument_id];
+    META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
+    return *argument_binding_ptr;
 }
 
 ProgramBindings::operator std::string() const
 {
     META_FUNCTION_TASK();
     std::vector<std::string> argument_binding_strings;
-    argument_binding_strings.reserve(m_binding_by_argument.size());
+    argument_binding_strings.reserve(m_binding_by_argument_id.size());
 
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (const Ptr<ArgumentBinding>& argument_binding_ptr : m_binding_by_argument_id)
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
         argument_binding_strings.push_back(static_cast<std::string>(*argument_binding_ptr));
     }
 
-    // Arguments are stored in unordered_set, so to get reliable output we need to sort them
+    // Argument bindings are ordered by argument names, but their string representation starts with shader type, so we need to sort them
     std::sort(argument_binding_strings.begin(), argument_binding_strings.end());
 
     std::stringstream ss;
@@ -256,9 +318,12 @@ ProgramBindings::operator std::string() const
 Rhi::IProgram::Arguments ProgramBindings::GetUnboundArguments() const
 {
     META_FUNCTION_TASK();
+    const auto& program = static_cast<const Program&>(GetProgram());
     Rhi::IProgram::Arguments unbound_arguments;
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (Rhi::ProgramArgumentId argument_id = 0U; argument_id < static_cast<Rhi::ProgramArgumentId>(m_binding_by_argument_id.size()); ++argument_id)
     {
+        const Ptr<ArgumentBinding>& argument_binding_ptr = m_binding_by_argument_id[argument_id];
+        const Rhi::IProgram::Argument& program_argument = program.GetArgument(argument_id);
         META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
 
         if (argument_binding_ptr->GetResourceViews().empty())
@@ -280,6 +345,16 @@ void ProgramBindings::VerifyAllArgumentsAreBoundToResources() const
     }
 }
 
+void ProgramBindings::ReserveTransitionResourceStates()
+{
+    META_FUNCTION_TASK();
+    const Program::ResourcesCountByAccess& resources_count_by_access = static_cast<const Program&>(*m_program_ptr).GetResourcesCountByAccess();
+    for(size_t access_index = 0; access_index < resources_count_by_access.size(); ++access_index)
+    {
+        m_transition_resource_states_by_access[access_index].reserve(resources_count_by_access[access_index]);
+    }
+}
+
 void ProgramBindings::ClearTransitionResourceStates()
 {
     META_FUNCTION_TASK();
@@ -304,6 +379,16 @@ void ProgramBindings::RemoveTransitionResourceStates(const Rhi::IProgramBindings
         transition_resource_states.erase(transition_resource_state_it);
 }
 
+void ProgramBindings::RemoveTransitionResourceStates(const Rhi::IProgramBindings::IArgumentBinding& argument_binding)
+{
+    META_FUNCTION_TASK();
+    for(const Rhi::ResourceView& resource_view : argument_binding.GetResourceViews())
+    {
+        if (resource_view.GetResourcePtr())
+            RemoveTransitionResourceStates(argument_binding, resource_view.GetResource());
+    }
+}
+
 void ProgramBindings::AddTransitionResourceState(const Rhi::IProgramBindings::IArgumentBinding& argument_binding, Rhi::IResource& resource)
 {
     META_FUNCTION_TASK();
@@ -336,6 +421,20 @@ void ProgramBindings::AddTransitionResourceStates(const Rhi::IProgramBindings::I
     }
 }
 
+void ProgramBindings::ApplyResourceTransitionBarriers(CommandList& command_list, Rhi::ProgramArgumentAccessMask apply_access,
+                                                      const Rhi::ICommandQueue* owner_queue_ptr) const
+{
+    META_FUNCTION_TASK();
+    // Transition barriers of program bindings are shared between command lists, so unlike the pending barriers
+    // of each command list, they are modified and merged into the command list barriers under lock
+    std::scoped_lock lock_guard(m_resource_state_transition_barriers_mutex);
+    if (ApplyResourceStates(apply_access, owner_queue_ptr) &&
+        m_resource_state_transition_barriers_ptr && !m_resource_state_transition_barriers_ptr->IsEmpty())
+    {
+        command_list.AddPendingResourceBarriers(*m_resource_state_transition_barriers_ptr);
+    }
+}
+
 bool ProgramBindings::ApplyResourceStates(Rhi::ProgramArgumentAccessMask access, const Rhi::ICommandQueue* owner_queue_ptr) const
 {
     META_FUNCTION_TASK();
@@ -359,23 +458,32 @@ void ProgramBindings::InitResourceRefsByAccess()
 {
     META_FUNCTION_TASK();
     constexpr size_t access_count = magic_enum::enum_count<Rhi::ProgramArgumentAccessType>();
-    std::array<std::set<Rhi::IResource*>, access_count> unique_resources_by_access;
+    const Program::ResourcesCountByAccess& resources_count_by_access = static_cast<const Program&>(*m_program_ptr).GetResourcesCountByAccess();
+    std::array<std::vector<Rhi::IResource*>, access_count> unique_resources_by_access;
+    for(size_t access_index = 0; access_index < access_count; ++access_index)
+    {
+        unique_resources_by_access[access_index].reserve(resources_count_by_access[access_index]);
+    }
 
-    for (auto& [program_argument, argument_binding_ptr] : GetArgumentBindings())
+    for (const Ptr<ArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
-        std::set<Rhi::IResource*>& unique_resources = unique_resources_by_access[argument_binding_ptr->GetSettings().argument.GetAccessorIndex()];
+        std::vector<Rhi::IResource*>& unique_resources = unique_resources_by_access[argument_binding_ptr->GetSettings().argument.GetAccessorIndex()];
         for (const Rhi::IResource::View& resource_view : argument_binding_ptr->GetResourceViews())
         {
-            unique_resources.emplace(resource_view.GetResourcePtr().get());
+            unique_resources.push_back(resource_view.GetResourcePtr().get());
         }
     }
 
     for(size_t access_index = 0; access_index < access_count; ++access_index)
     {
-        const std::set<Rhi::IResource*>& unique_resources = unique_resources_by_access[access_index];
+        std::vector<Rhi::IResource*>& unique_resources = unique_resources_by_access[access_index];
+        std::sort(unique_resources.begin(), unique_resources.end());
+        unique_resources.erase(std::unique(unique_resources.begin(), unique_resources.end()), unique_resources.end());
+
         Refs<Rhi::IResource>& resource_refs = m_resource_refs_by_access[access_index];
         resource_refs.clear();
+        resource_refs.reserve(unique_resources.size());
         std::transform(unique_resources.begin(), unique_resources.end(), std::back_inserter(resource_refs),
                        [](Rhi::IResource* resource_ptr) { return Ref<Rhi::IResource>(*resource_ptr); });
     }
@@ -0,0 +1,103 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ReadBackRequest.cpp
+Base implementation of the asynchronous resource read-back request,
+which becomes ready on completion of the command list with read-back commands.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ReadBackRequest.h>
+
+#include <Methane/Graphics/RHI/ICommandQueue.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+ReadBackRequest::ReadBackRequest(Rhi::IResource& resource, Rhi::ICommandList& cmd_list, const DataProvider& data_provider)
+    : m_resource_ptr(resource.GetPtr())
+    , m_cmd_list_ptr(cmd_list.GetPtr())
+    , m_cmd_list(cmd_list)
+    , m_data_provider(data_provider)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(resource.GetUsage().HasAnyBit(Rhi::ResourceUsage::ReadBack),
+                              "read-back can be requested only for resources with CPU Read-back usage flag");
+    META_CHECK_ARG_DESCR(cmd_list.GetType(),
+                         cmd_list.GetType() == Rhi::CommandListType::Transfer || cmd_list.GetType() == Rhi::CommandListType::Compute,
+                         "read-back commands can be encoded only in transfer or compute command lists");
+    META_CHECK_ARG_EQUAL_DESCR(cmd_list.GetState(), Rhi::CommandListState::Encoding,
+                               "read-back commands can be encoded only in command list in Encoding state");
+
+    const Opt<uint32_t>& owner_queue_family_opt = resource.GetOwnerQueueFamily();
+    META_CHECK_ARG_TRUE_DESCR(!owner_queue_family_opt || *owner_queue_family_opt == cmd_list.GetCommandQueue().GetFamilyIndex(),
+                              "read-back command list should be executed on the queue family owning the resource");
+
+    cmd_list.Connect(*this);
+}
+
+bool ReadBackRequest::WaitUntilReady(uint32_t timeout_ms)
+{
+    META_FUNCTION_TASK();
+    if (m_is_ready)
+        return true;
+
+    META_CHECK_ARG_TRUE_DESCR(m_is_executing, "read-back request can not be awaited until its command list is executed");
+    m_cmd_list.WaitUntilCompleted(timeout_ms);
+
+    // Command list completion is notified before state change callback is emitted,
+    // so completed execution is also detected by command list leaving the Executing state
+    if (m_cmd_list.GetState() != Rhi::CommandListState::Executing)
+        m_is_ready = true;
+
+    return m_is_ready;
+}
+
+const Rhi::SubResource& ReadBackRequest::GetData()
+{
+    META_FUNCTION_TASK();
+    if (m_data_opt)
+        return *m_data_opt;
+
+    WaitUntilReady();
+    m_data_opt = m_data_provider();
+    return *m_data_opt;
+}
+
+void ReadBackRequest::OnCommandListStateChanged(Rhi::ICommandList& cmd_list)
+{
+    META_FUNCTION_TASK();
+    switch(cmd_list.GetState())
+    {
+    case Rhi::CommandListState::Executing:
+        m_is_executing = true;
+        break;
+
+    case Rhi::CommandListState::Pending:
+        if (m_is_executing)
+            m_is_ready = true;
+        break;
+
+    default:
+        break;
+    }
+}
+
+} // namespace Methane::Graphics::Base
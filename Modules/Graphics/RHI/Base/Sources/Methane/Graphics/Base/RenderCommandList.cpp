@@ -35,6 +35,7 @@ Base implementation of the render command list interface.
 #include <Methane/Instrumentation.h>
 
 #include <magic_enum.hpp>
+#include <algorithm>
 
 namespace Methane::Graphics::Base
 {
@@ -48,12 +49,24 @@ RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& pa
     , m_render_pass_ptr(pass.GetPtr<RenderPass>())
 { }
 
+RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& pass, bool is_bundle)
+    : CommandList(command_queue, Type::Render)
+    , m_is_bundle(is_bundle)
+    , m_render_pass_ptr(pass.GetPtr<RenderPass>())
+{ }
+
 RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_command_list)
     : CommandList(static_cast<CommandQueue&>(parallel_render_command_list.GetCommandQueue()), Type::Render)
     , m_is_parallel(true)
     , m_render_pass_ptr(parallel_render_command_list.GetRenderPass().GetPtr<RenderPass>())
 { }
 
+RenderCommandList::~RenderCommandList()
+{
+    META_FUNCTION_TASK();
+    ReleaseExecutedBundles();
+}
+
 Rhi::IRenderPass& RenderCommandList::GetRenderPass() const
 {
     META_FUNCTION_TASK();
@@ -64,7 +77,9 @@ Rhi::IRenderPass& RenderCommandList::GetRenderPass() const
 void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
+    ResetCommittedBundle();
     CommandList::Reset(debug_group_ptr);
+    ReleaseExecutedBundles();
     if (m_render_pass_ptr)
     {
         META_LOG("{}", static_cast<std::string>(m_render_pass_ptr->GetPattern().GetSettings()));
@@ -110,10 +125,17 @@ void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::Ren
     }
     changed_states |= ~m_drawing_state.render_state_groups;
 
+    // All state groups are applied when previous render state was not applied because it was not compiled yet
+    if (m_drawing_state.changes.HasAnyBit(DrawingState::Change::RenderState))
+        changed_states = Rhi::RenderStateGroupMask(~0U);
+
     auto& render_state_base = static_cast<RenderState&>(render_state);
     if (!render_state_base.IsDeferred())
     {
-        render_state_base.Apply(*this, changed_states & state_groups);
+        if (render_state_base.Apply(*this, changed_states & state_groups))
+            m_drawing_state.changes.SetBitOff(DrawingState::Change::RenderState);
+        else
+            m_drawing_state.changes.SetBitOn(DrawingState::Change::RenderState);
     }
 
     Ptr<Object> render_state_object_ptr = render_state_base.GetBasePtr();
@@ -222,14 +244,14 @@ void RenderCommandList::DrawIndexed(Primitive primitive_type, uint32_t index_cou
         META_CHECK_ARG_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
         META_CHECK_ARG_LESS_DESCR(start_index, formatted_items_count - index_count + 1U, "ending index is out of buffer bounds");
 
-        ValidateDrawVertexBuffers(start_vertex);
+        ValidateDrawVertexBuffers(start_vertex, 0U, start_instance, instance_count);
     }
 
     META_LOG("{} Command list '{}' DRAW INDEXED with vertex buffers {} and index buffer '{}' using {} primive type, {} indices from {} index and {} vertex with {} instances count from {} instance",
              magic_enum::enum_name(GetType()), GetName(), GetDrawingState().vertex_buffer_set_ptr->GetNames(), GetDrawingState().index_buffer_ptr->GetName(),
              magic_enum::enum_name(primitive_type), index_count, start_index, start_vertex, instance_count, start_instance);
-    META_UNUSED(start_instance);
 
+    FlushPendingResourceBarriers();
     UpdateDrawingState(primitive_type);
 }
 
@@ -251,18 +273,86 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
         META_CHECK_ARG_NOT_ZERO_DESCR(vertex_count, "can not draw zero vertices");
         META_CHECK_ARG_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
 
-        ValidateDrawVertexBuffers(start_vertex, vertex_count);
+        ValidateDrawVertexBuffers(start_vertex, vertex_count, start_instance, instance_count);
     }
 
     META_LOG("{} Command list '{}' DRAW with vertex buffers {} using {} primitive type, {} vertices from {} vertex with {} instances count from {} instance",
              magic_enum::enum_name(GetType()), GetName(),
              GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
              magic_enum::enum_name(primitive_type), vertex_count, start_vertex, instance_count, start_instance);
-    META_UNUSED(start_instance);
 
+    FlushPendingResourceBarriers();
     UpdateDrawingState(primitive_type);
 }
 
+void RenderCommandList::ExecuteBundle(Rhi::IRenderCommandList& bundle)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    META_CHECK_ARG_FALSE_DESCR(m_is_bundle, "render command bundle '{}' can not execute other bundles", GetName());
+    META_CHECK_ARG_FALSE_DESCR(m_is_parallel, "parallel render command list '{}' can not execute bundles", GetName());
+    META_CHECK_ARG_TRUE_DESCR(bundle.IsBundle(), "render command list '{}' is not a bundle and can not be executed", bundle.GetName());
+    META_CHECK_ARG_EQUAL_DESCR(bundle.GetState(), State::Committed,
+                               "render command bundle '{}' in {} state can not be executed; only committed bundles can be executed",
+                               bundle.GetName(), magic_enum::enum_name(bundle.GetState()));
+    META_CHECK_ARG_TRUE_DESCR(std::addressof(bundle.GetRenderPass().GetPattern()) == std::addressof(GetRenderPass().GetPattern()),
+                              "render command bundle '{}' was recorded with incompatible render pattern", bundle.GetName());
+
+    META_LOG("{} Command list '{}' EXECUTE BUNDLE '{}'", magic_enum::enum_name(GetType()), GetName(), bundle.GetName());
+
+    FlushPendingResourceBarriers();
+    ResetDrawingState();
+
+    // Bundle is retained and can not be reset until execution of this command list is completed
+    auto& base_bundle = static_cast<RenderCommandList&>(bundle);
+    if (std::none_of(m_executed_bundle_ptrs.begin(), m_executed_bundle_ptrs.end(),
+                     [&base_bundle](const Ptr<RenderCommandList>& bundle_ptr) { return bundle_ptr.get() == std::addressof(base_bundle); }))
+    {
+        base_bundle.m_executing_lists_count++;
+        m_executed_bundle_ptrs.emplace_back(base_bundle.GetPtr<RenderCommandList>());
+    }
+}
+
+void RenderCommandList::Complete()
+{
+    META_FUNCTION_TASK();
+    // Executed bundles are released before completion, since command list can be reset right after it
+    ReleaseExecutedBundles();
+    CommandList::Complete();
+}
+
+void RenderCommandList::ResetCommittedBundle()
+{
+    META_FUNCTION_TASK();
+    if (!m_is_bundle || GetState() != State::Committed)
+        return;
+
+    META_CHECK_ARG_EQUAL_DESCR(m_executing_lists_count.load(), 0U,
+                               "render command bundle '{}' can not be reset while it is executed by other command lists",
+                               GetName());
+    ReleaseRetainedResources();
+    SetCommandListState(State::Pending);
+}
+
+void RenderCommandList::ReleaseExecutedBundles()
+{
+    META_FUNCTION_TASK();
+    for(const Ptr<RenderCommandList>& bundle_ptr : m_executed_bundle_ptrs)
+    {
+        bundle_ptr->m_executing_lists_count--;
+    }
+    m_executed_bundle_ptrs.clear();
+}
+
+void RenderCommandList::ResetDrawingState()
+{
+    META_FUNCTION_TASK();
+    Ptrs<Texture> render_pass_attachment_ptrs = std::move(m_drawing_state.render_pass_attachment_ptrs);
+    ResetCommandState();
+    m_drawing_state.render_pass_attachment_ptrs = std::move(render_pass_attachment_ptrs);
+}
+
 void RenderCommandList::ResetCommandState()
 {
     META_FUNCTION_TASK();
@@ -290,36 +380,71 @@ void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
         drawing_state.primitive_type_opt = primitive_type;
     }
 
-    if (m_drawing_state.render_state_ptr &&
-        m_drawing_state.render_state_ptr->IsDeferred() &&
+    if (!m_drawing_state.render_state_ptr)
+        return;
+
+    if (m_drawing_state.render_state_ptr->IsDeferred() &&
         (static_cast<bool>(m_drawing_state.render_state_groups) ||
          drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType) ||
-         drawing_state.changes.HasAnyBit(DrawingState::Change::ViewState)))
+         drawing_state.changes.HasAnyBit(DrawingState::Change::ViewState) ||
+         drawing_state.changes.HasAnyBit(DrawingState::Change::RenderState)))
     {
         // Apply render state in deferred mode right before the Draw call,
         // only in case when any render state groups or view state or primitive type has changed
-        m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups);
+        if (!m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups))
+        {
+            // Deferred render state is applied again on next Draw call, until its compilation is completed
+            drawing_state.changes.SetBitOn(DrawingState::Change::RenderState);
+            return;
+        }
         RetainResource(m_drawing_state.render_state_ptr);
 
         m_drawing_state.render_state_groups = {};
         drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
         drawing_state.changes.SetBitOff(DrawingState::Change::ViewState);
+        drawing_state.changes.SetBitOff(DrawingState::Change::RenderState);
+    }
+    else if (drawing_state.changes.HasAnyBit(DrawingState::Change::RenderState) &&
+             m_drawing_state.render_state_ptr->Apply(*this, Rhi::RenderStateGroupMask(~0U)))
+    {
+        // Asynchronously compiled render state is applied on the first Draw call after compilation completion
+        drawing_state.changes.SetBitOff(DrawingState::Change::RenderState);
     }
 }
 
-void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count) const
+void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count,
+                                                  uint32_t draw_start_instance, uint32_t draw_instance_count) const
 {
     META_FUNCTION_TASK();
     META_UNUSED(draw_vertex_count);
     if (!m_drawing_state.vertex_buffer_set_ptr)
         return;
 
+    // Vertex buffers without matching input buffer layout are validated as per-vertex buffers
+    const Rhi::ProgramInputBufferLayouts* input_buffer_layouts_ptr = m_drawing_state.render_state_ptr
+        ? &m_drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts
+        : nullptr;
+
     const Data::Size vertex_buffers_count = m_drawing_state.vertex_buffer_set_ptr->GetCount();
     for (Data::Index vertex_buffer_index = 0U; vertex_buffer_index < vertex_buffers_count; ++vertex_buffer_index)
     {
         const Rhi::IBuffer&  vertex_buffer = (*m_drawing_state.vertex_buffer_set_ptr)[vertex_buffer_index];
         const uint32_t vertex_count  = vertex_buffer.GetFormattedItemsCount();
         META_UNUSED(vertex_count);
+
+        if (input_buffer_layouts_ptr && vertex_buffer_index < input_buffer_layouts_ptr->size() &&
+            (*input_buffer_layouts_ptr)[vertex_buffer_index].step_type == Rhi::ProgramInputBufferLayout::StepType::PerInstance)
+        {
+            // Per-instance buffer item is used by the step rate number of consecutive instances
+            const uint32_t step_rate = std::max((*input_buffer_layouts_ptr)[vertex_buffer_index].step_rate, 1U);
+            const uint32_t instance_items_count = (draw_start_instance + draw_instance_count + step_rate - 1U) / step_rate;
+            META_UNUSED(instance_items_count);
+            META_CHECK_ARG_LESS_OR_EQUAL_DESCR(instance_items_count, vertex_count,
+                                               "can not draw {} instances starting from instance {} which are out of bounds for per-instance buffer '{}' with items count {}",
+                                               draw_instance_count, draw_start_instance, vertex_buffer.GetName(), vertex_count);
+            continue;
+        }
+
         META_CHECK_ARG_LESS_DESCR(draw_start_vertex, vertex_count - draw_vertex_count + 1U,
                                   "can not draw starting from vertex {}{} which is out of bounds for vertex buffer '{}' with vertex count {}",
                                   draw_start_vertex, draw_vertex_count ? fmt::format(" with {} vertex count", draw_vertex_count) : "",
@@ -151,11 +151,16 @@ void RenderContext::Initialize(Device& device, bool is_callback_emitted)
 bool RenderContext::UploadResources() const
 {
     META_FUNCTION_TASK();
+    // Render command kit is created before upload to be synchronized with asynchronous upload before its first execution
+    const Rhi::ICommandKit& render_cmd_kit = GetRenderCommandKit();
     if (!Context::UploadResources())
         return false;
 
+    if (GetOptions().HasBit(Rhi::ContextOption::AsyncResourceUploads))
+        return true;
+
     // Render commands will wait for resources uploading completion in upload queue
-    GetUploadCommandKit().GetFence().FlushOnGpu(GetRenderCommandKit().GetQueue());
+    GetUploadCommandKit().GetFence().FlushOnGpu(render_cmd_kit.GetQueue());
     return true;
 }
 
@@ -22,6 +22,7 @@ Base implementation of the render state interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Base/RenderState.h>
+#include <Methane/Graphics/Base/RenderContext.h>
 #include <Methane/Graphics/RHI/IProgram.h>
 
 #include <Methane/Checks.hpp>
@@ -33,6 +34,7 @@ namespace Methane::Graphics::Base
 RenderState::RenderState(const RenderContext& context, const Settings& settings, bool is_deferred)
     : m_context(context)
     , m_settings(settings)
+    , m_compiler(context.GetParallelExecutor(), [this]() { Data::Emitter<Rhi::IRenderStateCallback>::Emit(&Rhi::IRenderStateCallback::OnRenderStateCompiled, *this); })
     , m_is_deferred(is_deferred)
 { }
 
@@ -46,6 +48,12 @@ void RenderState::Reset(const Settings& settings)
     m_settings = settings;
 }
 
+void RenderState::Compile(StateCompiler::CompileFunction&& compile_function)
+{
+    META_FUNCTION_TASK();
+    m_compiler.Compile(std::move(compile_function), m_settings.async_compilation_enabled);
+}
+
 Rhi::IProgram& RenderState::GetProgram()
 {
     META_FUNCTION_TASK();
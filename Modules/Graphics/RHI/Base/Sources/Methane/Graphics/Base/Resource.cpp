@@ -24,6 +24,7 @@ Base implementation of the resource interface.
 #include <Methane/Graphics/Base/Resource.h>
 #include <Methane/Graphics/Base/Texture.h>
 #include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/ResourceBarriers.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -60,6 +61,9 @@ bool Resource::SetState(State state, Ptr<IBarriers>& out_barriers)
         Resource::SetState(state);
 
     std::scoped_lock lock_guard(m_state_mutex);
+    if (!m_subresource_states.empty())
+        return SetSubResourceStatesToState(state, &out_barriers);
+
     if (m_state == state)
     {
         if (out_barriers)
@@ -77,6 +81,8 @@ bool Resource::SetState(State state, Ptr<IBarriers>& out_barriers)
         if (!out_barriers)
             out_barriers = Rhi::IResourceBarriers::Create();
 
+        // Sub-resource transitions left from the finished sub-resource states tracking are replaced with the whole resource transition
+        static_cast<ResourceBarriers&>(*out_barriers).RemoveSubResourceStateTransitions(*this);
         out_barriers->AddStateTransition(*this, m_state, state);
     }
 
@@ -88,6 +94,9 @@ bool Resource::SetState(State state)
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_state_mutex);
+    if (!m_subresource_states.empty())
+        return SetSubResourceStatesToState(state, nullptr);
+
     if (m_state == state)
         return false;
 
@@ -99,6 +108,54 @@ bool Resource::SetState(State state)
     return true;
 }
 
+Resource::State Resource::GetSubResourceState(const SubResource::Index& subresource_index) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_state_mutex);
+    if (m_subresource_states.empty())
+        return m_state;
+
+    const SubResource::Count subresource_count = GetSubresourceCount();
+    META_CHECK_ARG_LESS(subresource_index, subresource_count);
+    return m_subresource_states[subresource_index.GetRawIndex(subresource_count)];
+}
+
+bool Resource::IsSubResourceStateTracked() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_state_mutex);
+    return !m_subresource_states.empty();
+}
+
+bool Resource::SetSubResourceState(const SubResource::Index& subresource_index, State state, Ptr<IBarriers>& out_barriers)
+{
+    META_FUNCTION_TASK();
+    if (!m_is_state_change_updates_barriers)
+        return SetSubResourceState(subresource_index, state);
+
+    if (GetSubresourceCount().GetRawCount() == 1U)
+    {
+        META_CHECK_ARG_LESS(subresource_index, GetSubresourceCount());
+        return SetState(state, out_barriers);
+    }
+
+    std::scoped_lock lock_guard(m_state_mutex);
+    return UpdateSubResourceState(subresource_index, state, &out_barriers);
+}
+
+bool Resource::SetSubResourceState(const SubResource::Index& subresource_index, State state)
+{
+    META_FUNCTION_TASK();
+    if (GetSubresourceCount().GetRawCount() == 1U)
+    {
+        META_CHECK_ARG_LESS(subresource_index, GetSubresourceCount());
+        return SetState(state);
+    }
+
+    std::scoped_lock lock_guard(m_state_mutex);
+    return UpdateSubResourceState(subresource_index, state, nullptr);
+}
+
 bool Resource::SetOwnerQueueFamily(uint32_t family_index, Ptr<IBarriers>& out_barriers)
 {
     META_FUNCTION_TASK();
@@ -142,4 +199,124 @@ bool Resource::SetOwnerQueueFamily(uint32_t family_index)
     return true;
 }
 
+bool Resource::SetSubResourceStatesToState(State state, Ptr<IBarriers>* out_barriers_ptr)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} resource '{}' sub-resource states changed to {}{}",
+             magic_enum::enum_name(GetResourceType()), GetName(),
+             magic_enum::enum_name(state), out_barriers_ptr ? " with barriers update" : "");
+
+    // Transition barriers are added only for sub-resources which are not in the requested state yet
+    if (out_barriers_ptr)
+    {
+        Ptr<IBarriers>& out_barriers = *out_barriers_ptr;
+        if (out_barriers)
+            out_barriers->RemoveStateTransition(*this);
+
+        const SubResource::Count subresource_count = GetSubresourceCount();
+        for(Data::Index raw_index = 0U; raw_index < static_cast<Data::Index>(m_subresource_states.size()); ++raw_index)
+        {
+            const State              subresource_state = m_subresource_states[raw_index];
+            const SubResource::Index subresource_index(raw_index, subresource_count);
+            const Barrier::Id        barrier_id(Barrier::Type::StateTransition, *this, subresource_index);
+            if (subresource_state == state || subresource_state == m_auto_transition_source_state_opt)
+            {
+                if (out_barriers)
+                    out_barriers->Remove(barrier_id);
+                continue;
+            }
+
+            if (!out_barriers)
+                out_barriers = Rhi::IResourceBarriers::Create();
+
+            out_barriers->Add(barrier_id, Barrier(*this, subresource_index, subresource_state, state));
+        }
+    }
+
+    m_subresource_states.clear();
+    m_state = state;
+    return true;
+}
+
+bool Resource::UpdateSubResourceState(const SubResource::Index& subresource_index, State state, Ptr<IBarriers>* out_barriers_ptr)
+{
+    META_FUNCTION_TASK();
+    const SubResource::Count subresource_count = GetSubresourceCount();
+    META_CHECK_ARG_LESS(subresource_index, subresource_count);
+
+    const bool is_tracking_started = m_subresource_states.empty();
+    if (is_tracking_started)
+        m_subresource_states.resize(subresource_count.GetRawCount(), m_state);
+
+    const Barrier::Id barrier_id(Barrier::Type::StateTransition, *this, subresource_index);
+    State& subresource_state = m_subresource_states[subresource_index.GetRawIndex(subresource_count)];
+    if (subresource_state == state)
+    {
+        if (out_barriers_ptr && *out_barriers_ptr)
+            (*out_barriers_ptr)->Remove(barrier_id);
+
+        if (is_tracking_started)
+            m_subresource_states.clear();
+
+        return false;
+    }
+
+    META_LOG("{} resource '{}' sub-resource {} state changed from {} to {}{}",
+             magic_enum::enum_name(GetResourceType()), GetName(), static_cast<std::string>(subresource_index),
+             magic_enum::enum_name(subresource_state), magic_enum::enum_name(state),
+             out_barriers_ptr ? " with barrier update" : "");
+
+    if (out_barriers_ptr && subresource_state != m_auto_transition_source_state_opt)
+    {
+        Ptr<IBarriers>& out_barriers = *out_barriers_ptr;
+        if (!out_barriers)
+            out_barriers = Rhi::IResourceBarriers::Create();
+        else
+            SplitStateTransitionBarrier(*out_barriers);
+
+        // Pending transition of the same sub-resource is merged to a single transition from its original state
+        State state_before = subresource_state;
+        if (const Barrier* pending_barrier_ptr = out_barriers->GetBarrier(barrier_id);
+            pending_barrier_ptr && pending_barrier_ptr->GetStateChange().GetStateAfter() == subresource_state)
+            state_before = pending_barrier_ptr->GetStateChange().GetStateBefore();
+
+        if (state_before == state)
+            out_barriers->Remove(barrier_id);
+        else
+            out_barriers->Add(barrier_id, Barrier(*this, subresource_index, state_before, state));
+    }
+
+    subresource_state = state;
+
+    // Tracking of individual sub-resource states stops when all of them are transitioned to the same state
+    if (std::all_of(m_subresource_states.begin(), m_subresource_states.end(),
+                    [state](State other_state) { return other_state == state; }))
+    {
+        m_subresource_states.clear();
+        m_state = state;
+    }
+    return true;
+}
+
+void Resource::SplitStateTransitionBarrier(IBarriers& barriers)
+{
+    META_FUNCTION_TASK();
+    const Barrier* whole_barrier_ptr = barriers.GetBarrier(Barrier::Id(Barrier::Type::StateTransition, *this));
+    if (!whole_barrier_ptr)
+        return;
+
+    // Whole resource transition is replaced with equal transitions of all sub-resources,
+    // so that it is not mixed with the sub-resource transitions in the same barriers set
+    const Barrier::StateChange whole_state_change = whole_barrier_ptr->GetStateChange();
+    barriers.RemoveStateTransition(*this);
+
+    const SubResource::Count subresource_count = GetSubresourceCount();
+    for(Data::Index raw_index = 0U; raw_index < subresource_count.GetRawCount(); ++raw_index)
+    {
+        const SubResource::Index subresource_index(raw_index, subresource_count);
+        barriers.Add(Barrier::Id(Barrier::Type::StateTransition, *this, subresource_index),
+                     Barrier(*this, subresource_index, whole_state_change.GetStateBefore(), whole_state_change.GetStateAfter()));
+    }
+}
+
 } // namespace Methane::Graphics::Base
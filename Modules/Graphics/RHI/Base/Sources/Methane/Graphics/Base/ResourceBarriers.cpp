@@ -29,6 +29,9 @@ Methane resource barriers base implementation.
 #include <Methane/Checks.hpp>
 
 #include <sstream>
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 namespace Methane::Graphics::Base
 {
@@ -36,45 +39,44 @@ namespace Methane::Graphics::Base
 ResourceBarriers::ResourceBarriers(const Set& barriers)
 {
     META_FUNCTION_TASK();
-    std::transform(barriers.begin(), barriers.end(), std::inserter(m_barriers_map, m_barriers_map.begin()),
-                   [](const Barrier& barrier)
-                   { return std::pair<Barrier::Id, Barrier>(barrier.GetId(), barrier); });
+    m_barriers.reserve(barriers.size());
+    for(const Barrier& barrier : barriers)
+    {
+        META_CHECK_ARG_FALSE_DESCR(HasOtherScopeStateTransition(barrier.GetId()),
+                                   "state transitions of the whole resource '{}' and of its sub-resources can not be mixed in one barriers set",
+                                   barrier.GetId().GetResource().GetName());
+        if (FindBarrier(barrier.GetId()) == m_barriers.end())
+            m_barriers.push_back(barrier);
+    }
 }
 
 ResourceBarriers::Set ResourceBarriers::GetSet() const noexcept
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
-    Set barriers;
-    std::transform(m_barriers_map.begin(), m_barriers_map.end(), std::inserter(barriers, barriers.begin()),
-                   [](const auto& barrier_pair) { return barrier_pair.second; });
-    return barriers;
+    return Set(m_barriers.begin(), m_barriers.end());
 }
 
 const Rhi::ResourceBarrier* ResourceBarriers::GetBarrier(const Barrier::Id& id) const noexcept
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
-    const auto barrier_it = m_barriers_map.find(id);
-    return barrier_it == m_barriers_map.end() ? nullptr : &barrier_it->second;
+    const auto barrier_it = FindBarrier(id);
+    return barrier_it == m_barriers.end() ? nullptr : &*barrier_it;
 }
 
 bool ResourceBarriers::HasStateTransition(Rhi::IResource& resource, State before, State after)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
-    const auto barrier_it = m_barriers_map.find(Barrier::Id(Barrier::Type::StateTransition, resource));
-    return barrier_it != m_barriers_map.end() &&
-           barrier_it->second == Barrier(resource, before, after);
+    const auto barrier_it = FindBarrier(Barrier::Id(Barrier::Type::StateTransition, resource));
+    return barrier_it != m_barriers.end() &&
+           *barrier_it == Barrier(resource, before, after);
 }
 
 bool ResourceBarriers::HasOwnerTransition(Rhi::IResource& resource, uint32_t queue_family_before, uint32_t queue_family_after)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
-    const auto barrier_it = m_barriers_map.find(Barrier::Id(Barrier::Type::OwnerTransition, resource));
-    return barrier_it != m_barriers_map.end() &&
-           barrier_it->second == Barrier(resource, queue_family_before, queue_family_after);
+    const auto barrier_it = FindBarrier(Barrier::Id(Barrier::Type::OwnerTransition, resource));
+    return barrier_it != m_barriers.end() &&
+           *barrier_it == Barrier(resource, queue_family_before, queue_family_after);
 }
 
 ResourceBarriers::AddResult ResourceBarriers::AddStateTransition(Rhi::IResource& resource, State before, State after)
@@ -105,44 +107,121 @@ bool ResourceBarriers::RemoveOwnerTransition(Rhi::IResource& resource)
 ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier::Id& id, const Barrier& barrier)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
+    META_CHECK_ARG_FALSE_DESCR(HasOtherScopeStateTransition(id),
+                               "state transitions of the whole resource '{}' and of its sub-resources can not be mixed in one barriers set",
+                               id.GetResource().GetName());
 
-    const auto [ barrier_id_and_state_change_it, barrier_added ] = m_barriers_map.try_emplace(id, barrier);
-    if (barrier_added)
+    const auto barrier_it = FindBarrier(id);
+    if (barrier_it == m_barriers.end())
+    {
+        m_barriers.emplace_back(barrier);
         return AddResult::Added;
+    }
 
-    if (barrier_id_and_state_change_it->second == barrier)
+    Barrier& existing_barrier = *barrier_it;
+    if (existing_barrier == barrier)
         return AddResult::Existing;
 
-    barrier_id_and_state_change_it->second = barrier;
+    existing_barrier = barrier;
     return AddResult::Updated;
 }
 
 bool ResourceBarriers::Remove(const Barrier::Id& id)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
-    return m_barriers_map.erase(id);
+    const auto barrier_it = FindBarrier(id);
+    if (barrier_it == m_barriers.end())
+        return false;
+
+    // Removed barrier is replaced with the last one to avoid shifting the rest, since barriers order is not significant
+    if (barrier_it != std::prev(m_barriers.end()))
+    {
+        *barrier_it = m_barriers.back();
+    }
+
+    m_barriers.pop_back();
+    return true;
 }
 
 void ResourceBarriers::ApplyTransitions() const
 {
     META_FUNCTION_TASK();
-    for(const auto& [barrier_id, barrier] : m_barriers_map)
+    for(const Barrier& barrier : m_barriers)
     {
          barrier.ApplyTransition();
     }
 }
 
+void ResourceBarriers::Clear()
+{
+    META_FUNCTION_TASK();
+    m_barriers.clear();
+}
+
+void ResourceBarriers::RemoveResourceBarriers(const Rhi::IResource& resource)
+{
+    META_FUNCTION_TASK();
+    // Removes barriers of all types for the whole resource and its sub-resources,
+    // barrier ids are collected in one pass and are removed through virtual method to let derived classes update native barriers
+    std::vector<Barrier::Id> resource_barrier_ids;
+    for(const Barrier& barrier : m_barriers)
+    {
+        if (std::addressof(barrier.GetId().GetResource()) == std::addressof(resource))
+            resource_barrier_ids.push_back(barrier.GetId());
+    }
+
+    for(const Barrier::Id& barrier_id : resource_barrier_ids)
+    {
+        Remove(barrier_id);
+    }
+}
+
+bool ResourceBarriers::HasResourceBarriers(const Rhi::IResource& resource) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::any_of(m_barriers.begin(), m_barriers.end(),
+                       [&resource](const Barrier& barrier)
+                       { return std::addressof(barrier.GetId().GetResource()) == std::addressof(resource); });
+}
+
+bool ResourceBarriers::HasSubResourceStateTransitions(Rhi::IResource& resource) const
+{
+    META_FUNCTION_TASK();
+    return FindSubResourceStateTransition(resource) != m_barriers.end();
+}
+
+bool ResourceBarriers::HasOtherScopeStateTransition(const Barrier::Id& id) const
+{
+    META_FUNCTION_TASK();
+    if (id.GetType() != Barrier::Type::StateTransition)
+        return false;
+
+    return id.GetSubResourceIndex()
+         ? FindBarrier(Barrier::Id(Barrier::Type::StateTransition, id.GetResource())) != m_barriers.end()
+         : FindSubResourceStateTransition(id.GetResource()) != m_barriers.end();
+}
+
+void ResourceBarriers::RemoveSubResourceStateTransitions(Rhi::IResource& resource)
+{
+    META_FUNCTION_TASK();
+    for(auto barrier_it = FindSubResourceStateTransition(resource);
+        barrier_it != m_barriers.end();
+        barrier_it = FindSubResourceStateTransition(resource))
+    {
+        // Barrier id is copied, because the barrier is overwritten on removal
+        const Barrier::Id barrier_id = barrier_it->GetId();
+        Remove(barrier_id);
+    }
+}
+
 ResourceBarriers::operator std::string() const noexcept
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_barriers_mutex);
     std::stringstream ss;
-    for(auto barrier_pair_it = m_barriers_map.begin(); barrier_pair_it != m_barriers_map.end(); ++barrier_pair_it)
+    for(auto barrier_it = m_barriers.begin(); barrier_it != m_barriers.end(); ++barrier_it)
     {
-        ss << "  - " << static_cast<std::string>(barrier_pair_it->second);
-        if (barrier_pair_it != std::prev(m_barriers_map.end()))
+        ss << "  - " << static_cast<std::string>(*barrier_it);
+        if (barrier_it != std::prev(m_barriers.end()))
             ss << ";" << std::endl;
         else
             ss << ".";
@@ -150,4 +229,28 @@ ResourceBarriers::operator std::string() const noexcept
     return ss.str();
 }
 
+ResourceBarriers::Barriers::iterator ResourceBarriers::FindBarrier(const Barrier::Id& id) noexcept
+{
+    return std::find_if(m_barriers.begin(), m_barriers.end(),
+                        [&id](const Barrier& barrier) { return barrier.GetId() == id; });
+}
+
+ResourceBarriers::Barriers::const_iterator ResourceBarriers::FindBarrier(const Barrier::Id& id) const noexcept
+{
+    return std::find_if(m_barriers.begin(), m_barriers.end(),
+                        [&id](const Barrier& barrier) { return barrier.GetId() == id; });
+}
+
+ResourceBarriers::Barriers::const_iterator ResourceBarriers::FindSubResourceStateTransition(const Rhi::IResource& resource) const noexcept
+{
+    return std::find_if(m_barriers.begin(), m_barriers.end(),
+                        [&resource](const Barrier& barrier)
+                        {
+                            const Barrier::Id& barrier_id = barrier.GetId();
+                            return barrier_id.GetType() == Barrier::Type::StateTransition &&
+                                   barrier_id.GetSubResourceIndex().has_value() &&
+                                   std::addressof(barrier_id.GetResource()) == std::addressof(resource);
+                        });
+}
+
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -44,6 +44,12 @@ uint32_t Shader::GetProgramInputBufferIndexByArgumentSemantic(const Program& pro
     return program.GetInputBufferIndexByArgumentSemantic(argument_semantic);
 }
 
+PixelFormat Shader::GetProgramInputArgumentFormatBySemantic(const Program& program, const std::string& argument_semantic) const
+{
+    META_FUNCTION_TASK();
+    return program.GetInputArgumentFormatBySemantic(argument_semantic);
+}
+
 std::string_view Shader::GetCachedArgName(std::string_view arg_name) const
 {
     META_FUNCTION_TASK();
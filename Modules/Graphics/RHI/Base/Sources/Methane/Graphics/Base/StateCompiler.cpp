@@ -0,0 +1,125 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/StateCompiler.cpp
+Pipeline state compiler running compilation tasks synchronously
+or asynchronously on the parallel executor of the context.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/StateCompiler.h>
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <taskflow/core/async.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+StateCompiler::StateCompiler(tf::Executor& parallel_executor, CompletedCallback&& completed_callback)
+    : m_parallel_executor(parallel_executor)
+    , m_completed_callback(std::move(completed_callback))
+{ }
+
+StateCompiler::~StateCompiler()
+{
+    META_FUNCTION_TASK();
+    WaitForCompletion();
+}
+
+void StateCompiler::Compile(CompileFunction&& compile_function, bool is_async)
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_compile_exception_ptr = nullptr;
+    }
+
+    if (!is_async)
+    {
+        compile_function();
+        return;
+    }
+
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_pending_tasks_count++;
+        m_running_tasks_count++;
+    }
+
+    m_parallel_executor.silent_async([this, compile_function = std::move(compile_function)]()
+    {
+        META_FUNCTION_TASK();
+        try
+        {
+            compile_function();
+        }
+        catch(const std::exception& e)
+        {
+            META_UNUSED(e);
+            META_LOG("ERROR: Asynchronous pipeline state compilation has failed: {}", e.what());
+
+            // Exception is stored to be rethrown on the thread applying the state, since it can not be thrown from executor
+            std::scoped_lock lock_guard(m_mutex);
+            if (!m_compile_exception_ptr)
+                m_compile_exception_ptr = std::current_exception();
+        }
+
+        bool is_completed = false;
+        {
+            std::scoped_lock lock_guard(m_mutex);
+            is_completed = --m_pending_tasks_count == 0U && !m_compile_exception_ptr;
+        }
+
+        if (is_completed && m_completed_callback)
+            m_completed_callback();
+
+        std::scoped_lock lock_guard(m_mutex);
+        m_running_tasks_count--;
+        m_completed_condition_var.notify_all();
+    });
+}
+
+void StateCompiler::WaitForCompletion() const
+{
+    META_FUNCTION_TASK();
+    std::unique_lock lock(m_mutex);
+    m_completed_condition_var.wait(lock, [this] { return m_running_tasks_count == 0U; });
+}
+
+bool StateCompiler::IsCompleted() const noexcept
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    return m_pending_tasks_count == 0U && !m_compile_exception_ptr;
+}
+
+void StateCompiler::RethrowCompileError() const
+{
+    META_FUNCTION_TASK();
+    std::exception_ptr compile_exception_ptr;
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        compile_exception_ptr = m_compile_exception_ptr;
+    }
+    if (compile_exception_ptr)
+        std::rethrow_exception(compile_exception_ptr);
+}
+
+} // namespace Methane::Graphics::Base
@@ -23,6 +23,7 @@ Base implementation of the texture interface.
 
 #include <Methane/Graphics/Base/Texture.h>
 #include <Methane/Graphics/Base/RenderContext.h>
+#include <Methane/Graphics/Base/ReadBackRequest.h>
 
 #include <Methane/Graphics/RHI/TypeFormatters.hpp>
 #include <Methane/Graphics/TypeFormatters.hpp>
@@ -128,6 +129,19 @@ void Texture::SetData(Rhi::ICommandQueue&, const SubResources& sub_resources)
     SetInitializedDataSize(sub_resources_data_size);
 }
 
+Ptr<Rhi::IReadBackRequest> Texture::RequestReadBack(Rhi::ICommandList& cmd_list, const SubResource::Index& sub_resource_index,
+                                                    const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    ValidateSubResource(sub_resource_index, data_range);
+
+    // Default implementation without native read-back commands encoding gets texture data synchronously
+    // on the command list queue, when request data is accessed after command list execution completion
+    Rhi::ICommandQueue& cmd_queue = cmd_list.GetCommandQueue();
+    return std::make_shared<ReadBackRequest>(*this, cmd_list,
+        [this, &cmd_queue, sub_resource_index, data_range]() { return GetData(cmd_queue, sub_resource_index, data_range); });
+}
+
 Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const
 {
     META_FUNCTION_TASK();
@@ -109,8 +109,8 @@ public:
     {
         META_FUNCTION_TASK();
         VerifyEncodingState();
-        
-        const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
+        CommandListBaseT::FlushPendingResourceBarriers();
+
         if (resource_barriers.IsEmpty())
             return;
 
@@ -175,7 +175,7 @@ protected:
     void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
     {
         // Optimization to skip dynamic_cast required to call Apply method of the Base::ProgramBinding implementation
-        static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
+        static_cast<ProgramBindings&>(program_bindings).Apply(*this, *this, Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
     }
 
     bool IsNativeCommitted() const             { return m_is_native_committed; }
@@ -47,7 +47,7 @@ public:
     void Reset(const Settings& settings) override;
 
     // Base::ComputeState interface
-    void Apply(Base::ComputeCommandList& command_list) override;
+    bool Apply(Base::ComputeCommandList& command_list) override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
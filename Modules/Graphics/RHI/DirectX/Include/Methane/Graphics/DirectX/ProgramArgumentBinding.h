@@ -80,7 +80,7 @@ public:
     ProgramArgumentBinding& operator=(ProgramArgumentBinding&&) noexcept = default;
 
     // Base::ProgramArgumentBinding interface
-    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy(const Allocator& allocator) const override;
 
     // IArgumentBinding interface
     bool SetResourceViews(const Rhi::ResourceViews& resource_views) override;
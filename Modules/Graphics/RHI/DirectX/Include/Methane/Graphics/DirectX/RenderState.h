@@ -46,7 +46,7 @@ public:
     void Reset(const Settings& settings) override;
 
     // Base::RenderState interface
-    void Apply(Base::RenderCommandList& command_list, Groups state_groups) override;
+    bool Apply(Base::RenderCommandList& command_list, Groups state_groups) override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
@@ -50,6 +50,9 @@ public:
     AddResult Add(const Barrier::Id& id, const Barrier& barrier) override;
     bool Remove(const Barrier::Id& id) override;
 
+    // Base::ResourceBarriers overrides
+    void Clear() override;
+
     [[nodiscard]] const std::vector<D3D12_RESOURCE_BARRIER>& GetNativeResourceBarriers() const
     { return m_native_resource_barriers; }
 
@@ -89,7 +89,7 @@ void ComputeState::Reset(const Settings& settings)
     m_cp_pipeline_state.Reset();
 }
 
-void ComputeState::Apply(Base::ComputeCommandList& command_list)
+bool ComputeState::Apply(Base::ComputeCommandList& command_list)
 {
     META_FUNCTION_TASK();
     const auto& dx_compute_command_list = static_cast<ComputeCommandList&>(command_list);
@@ -97,6 +97,7 @@ void ComputeState::Apply(Base::ComputeCommandList& command_list)
 
     d3d12_command_list.SetPipelineState(GetNativePipelineState().Get());
     d3d12_command_list.SetComputeRootSignature(GetDirectProgram().GetNativeRootSignature().Get());
+    return true;
 }
 
 bool ComputeState::SetName(std::string_view name)
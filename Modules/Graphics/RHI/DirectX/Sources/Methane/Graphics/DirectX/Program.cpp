@@ -173,12 +173,12 @@ void Program::InitRootSignature()
     root_parameters.reserve(binding_by_argument.size());
 
     std::map<DescriptorHeap::Type, DescriptorsCountByAccess> descriptor_offset_by_heap_type;
-    for (const auto& [program_argument, argument_binding_ptr] : binding_by_argument)
+    for (const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : binding_by_argument)
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
         auto& argument_binding = static_cast<DirectArgumentBinding&>(*argument_binding_ptr);
         const DirectArgumentBinding::Settings& bind_settings = argument_binding.GetDirectSettings();
-        const D3D12_SHADER_VISIBILITY shader_visibility = GetShaderVisibilityByType(program_argument.GetShaderType());
+        const D3D12_SHADER_VISIBILITY shader_visibility = GetShaderVisibilityByType(bind_settings.argument.GetShaderType());
 
         argument_binding.SetRootParameterIndex(static_cast<uint32_t>(root_parameters.size()));
         root_parameters.emplace_back();
@@ -207,9 +207,11 @@ void Program::InitRootSignature()
     }
 
     // Replicate descriptor ranges for all frame-constant argument binding instances
-    for (const auto& [program_argument, frame_argument_bindings] : GetFrameArgumentBindings())
+    for (const Ptrs<Base::ProgramArgumentBinding>& frame_argument_bindings : GetFrameArgumentBindings())
     {
-        META_CHECK_ARG_NOT_EMPTY(frame_argument_bindings);
+        if (frame_argument_bindings.empty())
+            continue;
+
         const auto& initial_frame_binding = static_cast<ProgramBindings::ArgumentBinding&>(*frame_argument_bindings.front());
         const ProgramBindings::ArgumentBinding::DescriptorRange& descriptor_range = initial_frame_binding.GetDescriptorRange();
 
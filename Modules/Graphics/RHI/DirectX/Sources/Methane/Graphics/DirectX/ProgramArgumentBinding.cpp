@@ -73,10 +73,10 @@ ProgramArgumentBinding::ProgramArgumentBinding(const ProgramArgumentBinding& oth
     }
 }
 
-Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
+Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy(const Allocator& allocator) const
 {
     META_FUNCTION_TASK();
-    return std::make_shared<ProgramArgumentBinding>(*this);
+    return std::allocate_shared<ProgramArgumentBinding>(allocator, *this);
 }
 
 DescriptorHeapType ProgramArgumentBinding::GetDescriptorHeapType() const
@@ -125,10 +125,11 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
 
 void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
 {
-    Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetProgramBindingsPtr(), apply_behavior);
+    Apply(command_list, dynamic_cast<ICommandList&>(command_list), command_list.GetProgramBindingsPtr(), apply_behavior);
 }
 
-void ProgramBindings::Apply(ICommandList& command_list, const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const
+void ProgramBindings::Apply(Base::CommandList& command_list, ICommandList& dx_command_list,
+                            const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
     Rhi::ProgramArgumentAccessMask apply_access_mask;
@@ -147,7 +148,7 @@ void ProgramBindings::Apply(ICommandList& command_list, const Base::ProgramBindi
     }
 
     // Apply root parameter bindings after resource barriers
-    ApplyRootParameterBindings(apply_access_mask, command_list, applied_program_bindings_ptr,
+    ApplyRootParameterBindings(apply_access_mask, dx_command_list, applied_program_bindings_ptr,
                                apply_behavior.HasAnyBit(ApplyBehavior::ChangesOnly));
 }
 
@@ -155,7 +156,7 @@ template<typename FuncType>
 void ProgramBindings::ForEachArgumentBinding(FuncType argument_binding_function) const
 {
     META_FUNCTION_TASK();
-    for (auto& [program_argument, argument_binding_ptr] : GetArgumentBindings())
+    for (const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
         auto& argument_binding = static_cast<ArgumentBinding&>(*argument_binding_ptr);
@@ -188,9 +189,9 @@ void ProgramBindings::ReserveDescriptorHeapRanges()
 
     // Count the number of constant and mutable descriptors to be allocated in each descriptor heap
     std::map<DescriptorHeap::Type, DescriptorsCountByAccess> descriptors_count_by_heap_type;
-    for (const auto& [program_argument, argument_binding_ptr] : GetArgumentBindings())
+    for (const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
-        META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
+        META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
 
         // NOTE: addressable resource bindings do not require descriptors to be created, instead they use direct GPU memory offset from resource
         const auto& binding_settings = argument_binding_ptr->GetSettings();
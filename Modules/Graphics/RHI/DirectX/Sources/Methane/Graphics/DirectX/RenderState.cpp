@@ -278,7 +278,7 @@ void RenderState::Reset(const Settings& settings)
     m_cp_pipeline_state.Reset();
 }
 
-void RenderState::Apply(Base::RenderCommandList& command_list, Groups state_groups)
+bool RenderState::Apply(Base::RenderCommandList& command_list, Groups state_groups)
 {
     META_FUNCTION_TASK();
     const auto& dx_render_command_list = static_cast<RenderCommandList&>(command_list);
@@ -295,6 +295,7 @@ void RenderState::Apply(Base::RenderCommandList& command_list, Groups state_grou
     {
         d3d12_command_list.OMSetBlendFactor(m_blend_factor.data());
     }
+    return true;
 }
 
 bool RenderState::SetName(std::string_view name)
@@ -23,6 +23,7 @@ DirectX 12 specialization of the resource barriers.
 
 #include <Methane/Graphics/DirectX/ResourceBarriers.h>
 #include <Methane/Graphics/DirectX/IResource.h>
+#include <Methane/Graphics/RHI/ITexture.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -54,18 +55,33 @@ static D3D12_RESOURCE_BARRIER_TYPE GetNativeBarrierType(Rhi::ResourceBarrier::Ty
     }
 }
 
+[[nodiscard]]
+static UINT GetNativeSubresource(const Rhi::ResourceBarrier::Id& id)
+{
+    META_FUNCTION_TASK();
+    const Opt<Rhi::SubResource::Index>& subresource_index_opt = id.GetSubResourceIndex();
+    if (!subresource_index_opt)
+        return D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+
+    // Raw sub-resource index layout matches D3D12CalcSubresource for single plane formats
+    const Rhi::SubResource::Count subresource_count = dynamic_cast<const Rhi::ITexture&>(id.GetResource()).GetSubresourceCount();
+    return subresource_index_opt->GetRawIndex(subresource_count);
+}
+
 [[nodiscard]]
 static std::function<bool(const D3D12_RESOURCE_BARRIER&)> GetNativeResourceBarrierPredicate(D3D12_RESOURCE_BARRIER_TYPE native_barrier_type,
-                                                                                            const ID3D12Resource* native_resource_ptr)
+                                                                                            const ID3D12Resource* native_resource_ptr,
+                                                                                            UINT native_subresource)
 {
     META_FUNCTION_TASK();
     switch (native_barrier_type)
     {
     case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
+        return [native_resource_ptr, native_subresource](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
             {
                 return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
-                       native_resource_barrier.Transition.pResource == native_resource_ptr;
+                       native_resource_barrier.Transition.pResource == native_resource_ptr &&
+                       native_resource_barrier.Transition.Subresource == native_subresource;
             };
     case D3D12_RESOURCE_BARRIER_TYPE_UAV:
         return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
@@ -93,7 +109,8 @@ D3D12_RESOURCE_BARRIER ResourceBarriers::GetNativeResourceBarrier(const Barrier:
         return CD3DX12_RESOURCE_BARRIER::Transition(
             dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource(),
             IResource::GetNativeResourceState(state_change.GetStateBefore()),
-            IResource::GetNativeResourceState(state_change.GetStateAfter())
+            IResource::GetNativeResourceState(state_change.GetStateAfter()),
+            GetNativeSubresource(id)
         );
 
     default:
@@ -114,7 +131,6 @@ ResourceBarriers::ResourceBarriers(const Set& barriers)
 Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier::Id& id, const Barrier& barrier)
 {
     META_FUNCTION_TASK();
-    const auto lock_guard  = Base::ResourceBarriers::Lock();
     const AddResult result = Base::ResourceBarriers::Add(id, barrier);
 
     if (id.GetType() != Barrier::Type::StateTransition)
@@ -133,7 +149,6 @@ Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Barrier::Id& id, c
 bool ResourceBarriers::Remove(const Barrier::Id& id)
 {
     META_FUNCTION_TASK();
-    const auto lock_guard = Base::ResourceBarriers::Lock();
     if (!Base::ResourceBarriers::Remove(id))
         return false;
 
@@ -143,18 +158,32 @@ bool ResourceBarriers::Remove(const Barrier::Id& id)
     const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
+                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr, GetNativeSubresource(id)));
     META_CHECK_ARG_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
     m_native_resource_barriers.erase(native_resource_barrier_it);
 
-    static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
+    if (!HasResourceBarriers(id.GetResource()))
+        static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
     return true;
 }
 
+void ResourceBarriers::Clear()
+{
+    META_FUNCTION_TASK();
+    for(const Barrier& barrier : GetBarriers())
+    {
+        static_cast<Data::IEmitter<IResourceCallback>&>(barrier.GetId().GetResource()).Disconnect(*this);
+    }
+
+    // All native barriers are cleared at once instead of removing them one by one
+    m_native_resource_barriers.clear();
+    Base::ResourceBarriers::Clear();
+}
+
 void ResourceBarriers::OnResourceReleased(Rhi::IResource& resource)
 {
     META_FUNCTION_TASK();
-    RemoveStateTransition(resource);
+    RemoveResourceBarriers(resource);
 }
 
 void ResourceBarriers::AddNativeResourceBarrier(const Barrier::Id& id, const Barrier::StateChange& state_change)
@@ -170,7 +199,7 @@ void ResourceBarriers::UpdateNativeResourceBarrier(const Barrier::Id& id, const
     const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResource&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
+                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr, GetNativeSubresource(id)));
     META_CHECK_ARG_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
 
     switch (native_barrier_type) // NOSONAR - do not replace switch with if
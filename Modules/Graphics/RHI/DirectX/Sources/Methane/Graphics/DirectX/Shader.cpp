@@ -306,6 +306,14 @@ std::vector<D3D12_INPUT_ELEMENT_DESC> Shader::GetNativeProgramInputLayout(const
         element_desc.Format                   = TypeConverter::ParameterDescToDxgiFormatAndSize(param_desc, element_byte_size);
         element_desc.AlignedByteOffset        = buffer_byte_offset;
 
+        // Explicit argument format is used for compact vertex layouts instead of the format reflected from shader parameter type
+        if (const PixelFormat argument_format = GetProgramInputArgumentFormatBySemantic(program, param_desc.SemanticName);
+            argument_format != PixelFormat::Unknown)
+        {
+            element_desc.Format = TypeConverter::PixelFormatToDxgi(argument_format);
+            element_byte_size   = GetPixelSize(argument_format);
+        }
+
         dx_input_layout.push_back(element_desc);
         buffer_byte_offset += element_byte_size;
     }
@@ -57,6 +57,9 @@ DXGI_FORMAT TypeConverter::PixelFormatToDxgi(const PixelFormat& pixel_format)
     case PixelFormat::RGBA8Unorm_sRGB:  return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
     case PixelFormat::BGRA8Unorm:       return DXGI_FORMAT_B8G8R8A8_UNORM;
     case PixelFormat::BGRA8Unorm_sRGB:  return DXGI_FORMAT_B8G8R8A8_UNORM_SRGB;
+    case PixelFormat::RGBA16Float:      return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    case PixelFormat::RG16Unorm:        return DXGI_FORMAT_R16G16_UNORM;
+    case PixelFormat::RG16Snorm:        return DXGI_FORMAT_R16G16_SNORM;
     case PixelFormat::Depth32Float:     return DXGI_FORMAT_D32_FLOAT;
     case PixelFormat::R32Float:         return DXGI_FORMAT_R32_FLOAT;
     case PixelFormat::R32Uint:          return DXGI_FORMAT_R32_UINT;
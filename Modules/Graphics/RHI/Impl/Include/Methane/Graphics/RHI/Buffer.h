@@ -102,6 +102,7 @@ public:
     [[nodiscard]] META_PIMPL_API const Settings& GetSettings() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t GetFormattedItemsCount() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API SubResource GetData(const Rhi::CommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) const;
+    [[nodiscard]] META_PIMPL_API Ptr<IReadBackRequest> RequestReadBack(ICommandList& cmd_list, const BytesRangeOpt& data_range = {}) const;
     META_PIMPL_API void SetData(const CommandQueue& target_cmd_queue, const SubResource& sub_resource) const;
     
 private:
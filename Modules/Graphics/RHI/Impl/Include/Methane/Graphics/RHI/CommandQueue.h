@@ -75,6 +75,7 @@ public:
     [[nodiscard]] META_PIMPL_API TransferCommandList             CreateTransferCommandList() const;
     [[nodiscard]] META_PIMPL_API ComputeCommandList              CreateComputeCommandList() const;
     [[nodiscard]] META_PIMPL_API RenderCommandList               CreateRenderCommandList(const RenderPass& render_pass) const;
+    [[nodiscard]] META_PIMPL_API RenderCommandList               CreateRenderCommandBundle(const RenderPass& render_pass) const;
     [[nodiscard]] META_PIMPL_API ParallelRenderCommandList       CreateParallelRenderCommandList(const RenderPass& render_pass) const;
     [[nodiscard]] META_PIMPL_API const IContext&                 GetContext() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandListType                 GetCommandListType() const META_PIMPL_NOEXCEPT;
@@ -40,6 +40,7 @@ struct ComputeStateSettingsImpl
 {
     Program         program;
     ThreadGroupSize thread_group_size; // Duplicated in HLSL attribute [numthreads(x,y,z)] of compute shader, but Metal does not use it
+    bool            async_compilation_enabled = false;
 
     META_PIMPL_API static ComputeStateSettings Convert(const ComputeStateSettingsImpl& settings);
 };
@@ -72,8 +73,13 @@ public:
     META_PIMPL_API void Connect(Data::Receiver<IObjectCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<IObjectCallback>& receiver) const;
 
+    // Data::IEmitter<IComputeStateCallback> interface methods
+    META_PIMPL_API void Connect(Data::Receiver<IComputeStateCallback>& receiver) const;
+    META_PIMPL_API void Disconnect(Data::Receiver<IComputeStateCallback>& receiver) const;
+
     // IComputeState interface methods
     [[nodiscard]] META_PIMPL_API const ComputeStateSettings& GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API bool IsCompiled() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void Reset(const Settings& settings) const;
     META_PIMPL_API void Reset(const IComputeState::Settings& settings) const;
 
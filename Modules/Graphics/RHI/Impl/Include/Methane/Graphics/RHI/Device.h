@@ -46,6 +46,7 @@ public:
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
     using Capabilities = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
 
     META_PIMPL_METHODS_DECLARE(Device);
     META_PIMPL_METHODS_COMPARE_DECLARE(Device);
@@ -68,6 +69,7 @@ public:
     [[nodiscard]] META_PIMPL_API bool                IsSoftwareAdapter() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Capabilities& GetCapabilities() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API std::string         ToString() const;
+    [[nodiscard]] META_PIMPL_API MemoryStatistics    GetMemoryStatistics() const;
 
     // Data::IEmitter<IDeviceCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IDeviceCallback>& receiver) const;
@@ -63,6 +63,7 @@ public:
     using Arguments               = ProgramArguments;
     using ArgumentAccessor        = ProgramArgumentAccessor;
     using ArgumentAccessors       = ProgramArgumentAccessors;
+    using ArgumentId              = ProgramArgumentId;
     using ResourceViewsByArgument = IProgram::ResourceViewsByArgument;
 
     META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE(Program);
@@ -91,6 +92,7 @@ public:
     [[nodiscard]] META_PIMPL_API const ShaderTypes&     GetShaderTypes() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API Shader                 GetShader(ShaderType shader_type) const;
     [[nodiscard]] META_PIMPL_API Data::Size             GetBindingsCount() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API ArgumentId             GetArgumentId(const Argument& argument) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::Program;
@@ -71,6 +71,7 @@ public:
     // IProgramBindings interface methods
     [[nodiscard]] META_PIMPL_API Program                 GetProgram() const;
     [[nodiscard]] META_PIMPL_API IArgumentBinding&       Get(const ProgramArgument& shader_argument) const;
+    [[nodiscard]] META_PIMPL_API IArgumentBinding&       Get(ProgramArgumentId argument_id) const;
     [[nodiscard]] META_PIMPL_API const ProgramArguments& GetArguments() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API Data::Index             GetFrameIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API Data::Index             GetBindingsIndex() const META_PIMPL_NOEXCEPT;
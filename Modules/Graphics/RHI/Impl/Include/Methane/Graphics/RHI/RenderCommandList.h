@@ -93,6 +93,7 @@ public:
 
     // IRenderCommandList interface methods
     [[nodiscard]] META_PIMPL_API bool IsValidationEnabled() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API bool IsBundle() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void SetValidationEnabled(bool is_validation_enabled) const;
     [[nodiscard]] META_PIMPL_API RenderPass GetRenderPass() const;
     META_PIMPL_API void ResetWithState(const RenderState& render_state, const DebugGroup* debug_group_ptr = nullptr) const;
@@ -105,6 +106,7 @@ public:
                                     uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
     META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
                              uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void ExecuteBundle(const RenderCommandList& bundle) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::RenderCommandList;
@@ -47,6 +47,7 @@ struct RenderStateSettingsImpl
     StencilSettings    stencil;
     BlendingSettings   blending;
     Color4F            blending_color;
+    bool               async_compilation_enabled = false;
 
     META_PIMPL_API static RenderStateSettings Convert(const RenderStateSettingsImpl& settings);
 };
@@ -83,8 +84,13 @@ public:
     META_PIMPL_API void Connect(Data::Receiver<IObjectCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<IObjectCallback>& receiver) const;
 
+    // Data::IEmitter<IRenderStateCallback> interface methods
+    META_PIMPL_API void Connect(Data::Receiver<IRenderStateCallback>& receiver) const;
+    META_PIMPL_API void Disconnect(Data::Receiver<IRenderStateCallback>& receiver) const;
+
     // IRenderState interface methods
     [[nodiscard]] META_PIMPL_API const RenderStateSettings& GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API bool IsCompiled() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void Reset(const Settings& settings) const;
     META_PIMPL_API void Reset(const IRenderState::Settings& settings) const;
 
@@ -43,7 +43,7 @@ class ResourceBarriers // NOSONAR - constructors and assignment operators are re
 public:
     using State     = IResourceBarriers::State;
     using Barrier   = IResourceBarriers::Barrier;
-    using Map       = IResourceBarriers::Map;
+    using Barriers  = IResourceBarriers::Barriers;
     using Set       = IResourceBarriers::Set;
     using AddResult = IResourceBarriers::AddResult;
 
@@ -64,7 +64,7 @@ public:
     // IResourceBarriers interface methods
     [[nodiscard]] META_PIMPL_API bool  IsEmpty() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API Set   GetSet() const META_PIMPL_NOEXCEPT;
-    [[nodiscard]] META_PIMPL_API const Map& GetMap() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API const Barriers& GetBarriers() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Barrier* GetBarrier(const Barrier::Id& id) const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API bool  HasStateTransition(IResource& resource, State before, State after) const;
     [[nodiscard]] META_PIMPL_API bool  HasOwnerTransition(IResource& resource, uint32_t queue_family_before, uint32_t queue_family_after) const;
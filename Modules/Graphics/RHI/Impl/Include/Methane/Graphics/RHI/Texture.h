@@ -82,6 +82,8 @@ public:
     // IResource interface methods
     META_PIMPL_API bool SetState(State state) const;
     META_PIMPL_API bool SetState(State state, Barriers& out_barriers) const;
+    META_PIMPL_API bool SetSubResourceState(const SubResource::Index& sub_resource_index, State state) const;
+    META_PIMPL_API bool SetSubResourceState(const SubResource::Index& sub_resource_index, State state, Barriers& out_barriers) const;
     META_PIMPL_API bool SetOwnerQueueFamily(uint32_t family_index) const;
     META_PIMPL_API bool SetOwnerQueueFamily(uint32_t family_index, Barriers& out_barriers) const;
     META_PIMPL_API void RestoreDescriptorViews(const DescriptorByViewId& descriptor_by_view_id) const;
@@ -91,6 +93,7 @@ public:
     [[nodiscard]] META_PIMPL_API SubResource::Count        GetSubresourceCount() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API ResourceType              GetResourceType() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API State                     GetState() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API State                     GetSubResourceState(const SubResource::Index& sub_resource_index) const;
     [[nodiscard]] META_PIMPL_API ResourceUsageMask         GetUsage() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const DescriptorByViewId& GetDescriptorByViewId() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const IContext&           GetContext() const META_PIMPL_NOEXCEPT;
@@ -105,6 +108,9 @@ public:
     [[nodiscard]] META_PIMPL_API SubResource GetData(const CommandQueue& target_cmd_queue,
                                                      const SubResource::Index& sub_resource_index = SubResource::Index(),
                                                      const BytesRangeOpt& data_range = {}) const;
+    [[nodiscard]] META_PIMPL_API Ptr<IReadBackRequest> RequestReadBack(ICommandList& cmd_list,
+                                                                       const SubResource::Index& sub_resource_index = SubResource::Index(),
+                                                                       const BytesRangeOpt& data_range = {}) const;
     META_PIMPL_API void SetData(const CommandQueue& target_cmd_queue, const SubResources& sub_resources) const;
     
 private:
@@ -148,6 +148,11 @@ SubResource Buffer::GetData(const Rhi::CommandQueue& target_cmd_queue, const Byt
     return GetImpl(m_impl_ptr).GetData(target_cmd_queue.GetInterface(), data_range);
 }
 
+Ptr<IReadBackRequest> Buffer::RequestReadBack(ICommandList& cmd_list, const BytesRangeOpt& data_range) const
+{
+    return GetImpl(m_impl_ptr).RequestReadBack(cmd_list, data_range);
+}
+
 Data::Size Buffer::GetDataSize(Data::MemoryState size_type) const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetDataSize(size_type);
@@ -127,6 +127,11 @@ RenderCommandList CommandQueue::CreateRenderCommandList(const RenderPass& render
     return RenderCommandList(GetImpl(m_impl_ptr).CreateRenderCommandList(render_pass.GetInterface()));
 }
 
+RenderCommandList CommandQueue::CreateRenderCommandBundle(const RenderPass& render_pass) const
+{
+    return RenderCommandList(GetImpl(m_impl_ptr).CreateRenderCommandBundle(render_pass.GetInterface()));
+}
+
 ParallelRenderCommandList CommandQueue::CreateParallelRenderCommandList(const RenderPass& render_pass) const
 {
     return ParallelRenderCommandList(GetImpl(m_impl_ptr).CreateParallelRenderCommandList(render_pass.GetInterface()));
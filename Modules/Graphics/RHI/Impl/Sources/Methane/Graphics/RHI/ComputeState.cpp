@@ -41,7 +41,8 @@ ComputeStateSettings ComputeStateSettingsImpl::Convert(const ComputeStateSetting
     return ComputeStateSettings
     {
         settings.program.GetInterfacePtr(),
-        settings.thread_group_size
+        settings.thread_group_size,
+        settings.async_compilation_enabled
     };
 }
 
@@ -103,11 +104,26 @@ void ComputeState::Disconnect(Data::Receiver<IObjectCallback>& receiver) const
     GetImpl(m_impl_ptr).Data::Emitter<IObjectCallback>::Disconnect(receiver);
 }
 
+void ComputeState::Connect(Data::Receiver<IComputeStateCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IComputeStateCallback>::Connect(receiver);
+}
+
+void ComputeState::Disconnect(Data::Receiver<IComputeStateCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IComputeStateCallback>::Disconnect(receiver);
+}
+
 const ComputeStateSettings& ComputeState::GetSettings() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetSettings();
 }
 
+bool ComputeState::IsCompiled() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsCompiled();
+}
+
 void ComputeState::Reset(const Settings& settings) const
 {
     return GetImpl(m_impl_ptr).Reset(ComputeStateSettingsImpl::Convert(settings));
@@ -102,6 +102,11 @@ std::string Device::ToString() const
     return GetImpl(m_impl_ptr).ToString();
 }
 
+DeviceMemoryStatistics Device::GetMemoryStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetMemoryStatistics();
+}
+
 void Device::Connect(Data::Receiver<IDeviceCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IDeviceCallback>::Connect(receiver);
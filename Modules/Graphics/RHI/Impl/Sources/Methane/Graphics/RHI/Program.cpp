@@ -140,4 +140,9 @@ Data::Size Program::GetBindingsCount() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetBindingsCount();
 }
 
+ProgramArgumentId Program::GetArgumentId(const Argument& argument) const
+{
+    return GetImpl(m_impl_ptr).GetArgumentId(argument);
+}
+
 } // namespace Methane::Graphics::Rhi
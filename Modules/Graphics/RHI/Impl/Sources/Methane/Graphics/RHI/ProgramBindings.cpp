@@ -104,6 +104,11 @@ IProgramArgumentBinding& ProgramBindings::Get(const ProgramArgument& shader_argu
     return GetImpl(m_impl_ptr).Get(shader_argument);
 }
 
+IProgramArgumentBinding& ProgramBindings::Get(ProgramArgumentId argument_id) const
+{
+    return GetImpl(m_impl_ptr).Get(argument_id);
+}
+
 const ProgramArguments& ProgramBindings::GetArguments() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetArguments();
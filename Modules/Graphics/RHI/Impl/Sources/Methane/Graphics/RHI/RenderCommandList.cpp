@@ -166,6 +166,11 @@ bool RenderCommandList::IsValidationEnabled() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).IsValidationEnabled();
 }
 
+bool RenderCommandList::IsBundle() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsBundle();
+}
+
 void RenderCommandList::SetValidationEnabled(bool is_validation_enabled) const
 {
     GetImpl(m_impl_ptr).SetValidationEnabled(is_validation_enabled);
@@ -220,4 +225,9 @@ void RenderCommandList::Draw(Primitive primitive,
     GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
+void RenderCommandList::ExecuteBundle(const RenderCommandList& bundle) const
+{
+    GetImpl(m_impl_ptr).ExecuteBundle(bundle.GetInterface());
+}
+
 } // namespace Methane::Graphics::Rhi
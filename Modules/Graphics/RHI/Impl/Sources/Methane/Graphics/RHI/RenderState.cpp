@@ -45,7 +45,8 @@ RenderStateSettings RenderStateSettingsImpl::Convert(const RenderStateSettingsIm
         settings.depth,
         settings.stencil,
         settings.blending,
-        settings.blending_color
+        settings.blending_color,
+        settings.async_compilation_enabled
     };
 }
 
@@ -102,11 +103,26 @@ void RenderState::Disconnect(Data::Receiver<IObjectCallback>& receiver) const
     GetImpl(m_impl_ptr).Data::Emitter<IObjectCallback>::Disconnect(receiver);
 }
 
+void RenderState::Connect(Data::Receiver<IRenderStateCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IRenderStateCallback>::Connect(receiver);
+}
+
+void RenderState::Disconnect(Data::Receiver<IRenderStateCallback>& receiver) const
+{
+    GetImpl(m_impl_ptr).Data::Emitter<IRenderStateCallback>::Disconnect(receiver);
+}
+
 const RenderStateSettings& RenderState::GetSettings() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetSettings();
 }
 
+bool RenderState::IsCompiled() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsCompiled();
+}
+
 void RenderState::Reset(const Settings& settings) const
 {
     return GetImpl(m_impl_ptr).Reset(RenderStateSettingsImpl::Convert(settings));
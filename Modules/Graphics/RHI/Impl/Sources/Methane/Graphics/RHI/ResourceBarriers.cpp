@@ -85,9 +85,9 @@ ResourceBarriers::Set ResourceBarriers::GetSet() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetSet();
 }
 
-const ResourceBarriers::Map& ResourceBarriers::GetMap() const META_PIMPL_NOEXCEPT
+const ResourceBarriers::Barriers& ResourceBarriers::GetBarriers() const META_PIMPL_NOEXCEPT
 {
-    return GetImpl(m_impl_ptr).GetMap();
+    return GetImpl(m_impl_ptr).GetBarriers();
 }
 
 const ResourceBarriers::Barrier* ResourceBarriers::GetBarrier(const Barrier::Id& id) const META_PIMPL_NOEXCEPT
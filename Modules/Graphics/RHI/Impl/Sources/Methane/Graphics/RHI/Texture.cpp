@@ -117,6 +117,22 @@ bool Texture::SetState(State state, Barriers& out_barriers) const
     return state_changed;
 }
 
+bool Texture::SetSubResourceState(const SubResource::Index& sub_resource_index, State state) const
+{
+    return GetImpl(m_impl_ptr).SetSubResourceState(sub_resource_index, state);
+}
+
+bool Texture::SetSubResourceState(const SubResource::Index& sub_resource_index, State state, Barriers& out_barriers) const
+{
+    Ptr<IResourceBarriers> out_barriers_ptr = out_barriers.GetInterfacePtr();
+    const bool state_changed = GetImpl(m_impl_ptr).SetSubResourceState(sub_resource_index, state, out_barriers_ptr);
+    if (!out_barriers.IsInitialized() && out_barriers_ptr)
+    {
+        out_barriers = ResourceBarriers(out_barriers_ptr);
+    }
+    return state_changed;
+}
+
 bool Texture::SetOwnerQueueFamily(uint32_t family_index) const
 {
     return GetImpl(m_impl_ptr).SetOwnerQueueFamily(family_index);
@@ -148,6 +164,11 @@ SubResource Texture::GetData(const CommandQueue& target_cmd_queue, const SubReso
     return GetImpl(m_impl_ptr).GetData(target_cmd_queue.GetInterface(), sub_resource_index, data_range);
 }
 
+Ptr<IReadBackRequest> Texture::RequestReadBack(ICommandList& cmd_list, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) const
+{
+    return GetImpl(m_impl_ptr).RequestReadBack(cmd_list, sub_resource_index, data_range);
+}
+
 Data::Size Texture::GetDataSize(Data::MemoryState size_type) const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetDataSize(size_type);
@@ -173,6 +194,11 @@ ResourceState Texture::GetState() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetState();
 }
 
+ResourceState Texture::GetSubResourceState(const SubResource::Index& sub_resource_index) const
+{
+    return GetImpl(m_impl_ptr).GetSubResourceState(sub_resource_index);
+}
+
 ResourceUsageMask Texture::GetUsage() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetUsage();
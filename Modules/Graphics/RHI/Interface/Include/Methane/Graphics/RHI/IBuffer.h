@@ -24,11 +24,13 @@ Methane buffer interface: GPU memory buffer resource.
 #pragma once
 
 #include "IResource.h"
+#include "IReadBackRequest.h"
 
 namespace Methane::Graphics::Rhi
 {
 
 struct IContext;
+struct ICommandList;
 
 enum class BufferType
 {
@@ -77,6 +79,7 @@ struct IBuffer
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
     [[nodiscard]] virtual uint32_t        GetFormattedItemsCount() const noexcept = 0;
     [[nodiscard]] virtual SubResource     GetData(ICommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) = 0;
+    [[nodiscard]] virtual Ptr<IReadBackRequest> RequestReadBack(ICommandList& cmd_list, const BytesRangeOpt& data_range = {}) = 0;
     virtual void SetData(ICommandQueue& target_cmd_queue, const SubResource& sub_resource) = 0;
 };
 
@@ -27,6 +27,7 @@ Methane compute state interface: specifies configuration of the compute pipeline
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/Volume.hpp>
+#include <Methane/Data/IEmitter.h>
 #include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Rhi
@@ -41,6 +42,10 @@ struct ComputeStateSettings
     Ptr<IProgram>   program_ptr;
     ThreadGroupSize thread_group_size; // Duplicated in HLSL attribute [numthreads(x,y,z)] of compute shader, but Metal does not use it
 
+    // Pipeline state is compiled on the context parallel executor without blocking state creation or reset,
+    // dispatch calls with compute state which is not compiled yet are skipped
+    bool            async_compilation_enabled = false;
+
     [[nodiscard]] bool operator==(const ComputeStateSettings& other) const noexcept;
     [[nodiscard]] bool operator!=(const ComputeStateSettings& other) const noexcept;
     [[nodiscard]] explicit operator std::string() const;
@@ -48,8 +53,19 @@ struct ComputeStateSettings
 
 struct IContext;
 
+struct IComputeState;
+
+struct IComputeStateCallback
+{
+    // Called from parallel executor thread when asynchronous compilation of compute state pipeline has completed
+    virtual void OnComputeStateCompiled(IComputeState& compute_state) = 0;
+
+    virtual ~IComputeStateCallback() = default;
+};
+
 struct IComputeState
     : virtual IObject // NOSONAR
+    , virtual Data::IEmitter<IComputeStateCallback> // NOSONAR
 {
 public:
     using Settings = ComputeStateSettings;
@@ -59,6 +75,7 @@ public:
 
     // IComputeState interface
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
+    [[nodiscard]] virtual bool IsCompiled() const noexcept = 0;
     virtual void Reset(const Settings& settings) = 0;
 };
 
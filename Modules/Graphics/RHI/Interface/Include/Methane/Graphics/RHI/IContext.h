@@ -66,7 +66,8 @@ enum class ContextOption : uint32_t
 {
     DeferredProgramBindingsInitialization, // Defer program bindings initialization on GPU until Context::CompleteInitialization
     TransferWithD3D12DirectQueue,          // Transfer command lists and queues in DX API are created with DIRECT type instead of COPY type
-    EmulateD3D12RenderPass                 // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    EmulateD3D12RenderPass,                // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+    AsyncResourceUploads                   // Resources are uploaded on transfer queue, other queues acquire them on first execution after upload completion is observed on CPU
 };
 
 using ContextOptionMask = Data::EnumMask<ContextOption>;
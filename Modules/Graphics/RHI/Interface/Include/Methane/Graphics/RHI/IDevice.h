@@ -30,6 +30,7 @@ Methane device interface, used to create graphics context for rendering.
 #include <Methane/Memory.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace tf
 {
@@ -71,6 +72,19 @@ struct DeviceCaps
     DeviceCaps& SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept;
 };
 
+struct DeviceMemoryHeapStatistics
+{
+    uint64_t heap_size                   { 0U };
+    bool     is_device_local             { false };
+    uint64_t allocated_size              { 0U }; // size of native memory allocated from heap for memory blocks and dedicated allocations
+    uint64_t used_size                   { 0U }; // size of memory used by resources
+    uint32_t blocks_count                { 0U };
+    uint32_t allocations_count           { 0U };
+    uint32_t dedicated_allocations_count { 0U };
+};
+
+using DeviceMemoryStatistics = std::vector<DeviceMemoryHeapStatistics>;
+
 struct IDevice;
 
 struct IDeviceCallback
@@ -93,6 +107,7 @@ struct IDevice
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
     using Capabilities = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
 
     [[nodiscard]] virtual Ptr<IRenderContext>  CreateRenderContext(const Platform::AppEnvironment& env, tf::Executor& parallel_executor, const RenderContextSettings& settings) = 0;
     [[nodiscard]] virtual Ptr<IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const ComputeContextSettings& settings) = 0;
@@ -100,6 +115,7 @@ struct IDevice
     [[nodiscard]] virtual bool                 IsSoftwareAdapter() const noexcept = 0;
     [[nodiscard]] virtual const Capabilities&  GetCapabilities() const noexcept = 0;
     [[nodiscard]] virtual std::string          ToString() const = 0;
+    [[nodiscard]] virtual MemoryStatistics     GetMemoryStatistics() const = 0; // per memory heap, empty when not tracked by device
 };
 
 } // namespace Methane::Graphics::Rhi
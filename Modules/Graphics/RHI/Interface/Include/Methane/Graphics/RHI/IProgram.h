@@ -51,10 +51,15 @@ struct ProgramInputBufferLayout
     };
 
     using ArgumentSemantics = std::vector<std::string_view>;
+    using ArgumentFormats   = std::vector<PixelFormat>;
 
     ArgumentSemantics argument_semantics;
     StepType          step_type = StepType::PerVertex;
     uint32_t          step_rate = 1U;
+
+    // Optional vertex formats of arguments in the order of semantics, which are required for compact vertex layouts:
+    // argument format is reflected from vertex shader input type when formats are empty or the format is unknown
+    ArgumentFormats   argument_formats;
 };
 
 using ProgramInputBufferLayouts = std::vector<ProgramInputBufferLayout>;
@@ -113,6 +118,10 @@ using ProgramArgumentAccessMask = Data::EnumMask<ProgramArgumentAccessType>;
 
 using ProgramArguments = std::unordered_set<ProgramArgument, ProgramArgument::Hash>;
 
+// Dense index of program argument, which is assigned by program on shaders reflection
+// and can be cached by application to get argument bindings without hashing argument names
+using ProgramArgumentId = Data::Index;
+
 class ProgramArgumentAccessor : public ProgramArgument
 {
 public:
@@ -159,6 +168,7 @@ struct IProgram
     using Arguments               = ProgramArguments;
     using ArgumentAccessor        = ProgramArgumentAccessor;
     using ArgumentAccessors       = ProgramArgumentAccessors;
+    using ArgumentId              = ProgramArgumentId;
     using ResourceViewsByArgument = std::unordered_map<Argument, ResourceViews, Argument::Hash>;
 
     static ArgumentAccessors::const_iterator FindArgumentAccessor(const ArgumentAccessors& argument_accessors, const Argument& argument);
@@ -172,6 +182,7 @@ struct IProgram
     [[nodiscard]] virtual const ShaderTypes&    GetShaderTypes() const noexcept = 0;
     [[nodiscard]] virtual const Ptr<IShader>&   GetShader(ShaderType shader_type) const = 0;
     [[nodiscard]] virtual Data::Size            GetBindingsCount() const noexcept = 0;
+    [[nodiscard]] virtual ArgumentId            GetArgumentId(const Argument& argument) const = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
@@ -114,6 +114,7 @@ struct IProgramBindings
     [[nodiscard]] virtual Ptr<IProgramBindings>   CreateCopy(const IProgram::ResourceViewsByArgument& replace_resource_views_by_argument = {}, const Opt<Data::Index>& frame_index = {}) = 0;
     [[nodiscard]] virtual IProgram&               GetProgram() const = 0;
     [[nodiscard]] virtual IArgumentBinding&       Get(const ProgramArgument& shader_argument) const = 0;
+    [[nodiscard]] virtual IArgumentBinding&       Get(ProgramArgumentId argument_id) const = 0;
     [[nodiscard]] virtual const ProgramArguments& GetArguments() const noexcept = 0;
     [[nodiscard]] virtual Data::Index             GetFrameIndex() const noexcept = 0;
     [[nodiscard]] virtual Data::Index             GetBindingsIndex() const noexcept = 0;
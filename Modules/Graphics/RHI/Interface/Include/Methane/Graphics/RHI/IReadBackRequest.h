@@ -0,0 +1,48 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/IReadBackRequest.h
+Methane asynchronous resource data read-back request interface: ticket of the
+read-back commands encoded in command list, which can be polled or awaited on CPU.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ResourceView.h"
+
+namespace Methane::Graphics::Rhi
+{
+
+struct IReadBackRequest
+{
+    // Read-back request is ready when its command list has completed execution on GPU
+    [[nodiscard]] virtual bool IsReady() const noexcept = 0;
+
+    // Blocks until read-back command list execution is completed, or timeout is expired;
+    // command list has to be executed before waiting, otherwise exception is thrown
+    virtual bool WaitUntilReady(uint32_t timeout_ms = 0U) = 0;
+
+    // Waits until request is ready and returns read-back data, which may reference host memory of the resource
+    // read-back buffer without copying: such data is valid until the same buffer is reused by following requests
+    [[nodiscard]] virtual const SubResource& GetData() = 0;
+
+    virtual ~IReadBackRequest() = default;
+};
+
+} // namespace Methane::Graphics::Rhi
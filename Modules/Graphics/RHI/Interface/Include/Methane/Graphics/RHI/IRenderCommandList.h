@@ -55,9 +55,14 @@ struct IRenderCommandList
 
     // Create IRenderCommandList instance
     [[nodiscard]] static Ptr<IRenderCommandList> Create(ICommandQueue& command_queue, IRenderPass& render_pass);
-    
+
+    // Create IRenderCommandList instance of render command bundle, which is recorded once
+    // and executed many times by other render command lists with compatible render pass
+    [[nodiscard]] static Ptr<IRenderCommandList> CreateBundle(ICommandQueue& command_queue, IRenderPass& render_pass);
+
     // IRenderCommandList interface
     [[nodiscard]] virtual bool IsValidationEnabled() const noexcept = 0;
+    [[nodiscard]] virtual bool IsBundle() const noexcept = 0;
     virtual void SetValidationEnabled(bool is_validation_enabled) = 0;
     [[nodiscard]] virtual IRenderPass& GetRenderPass() const = 0;
     virtual void ResetWithState(IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) = 0;
@@ -70,6 +75,7 @@ struct IRenderCommandList
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void ExecuteBundle(IRenderCommandList& bundle) = 0;
     
     using ICommandList::Reset;
 };
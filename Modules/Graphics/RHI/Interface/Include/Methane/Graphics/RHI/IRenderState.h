@@ -29,6 +29,7 @@ Methane render state interface: specifies configuration of the graphics pipeline
 #include <Methane/Graphics/Volume.hpp>
 #include <Methane/Graphics/Color.hpp>
 #include <Methane/Data/EnumMask.hpp>
+#include <Methane/Data/IEmitter.h>
 #include <Methane/Memory.hpp>
 #include <vector>
 
@@ -227,14 +228,29 @@ struct RenderStateSettings
     BlendingSettings    blending;
     Color4F             blending_color;
 
+    // Pipeline state is compiled on the context parallel executor without blocking state creation or reset,
+    // draw calls with render state which is not compiled yet are skipped
+    bool                async_compilation_enabled = false;
+
     [[nodiscard]] static GroupMask Compare(const RenderStateSettings& left, const RenderStateSettings& right, GroupMask compare_groups = GroupMask(~0U)) noexcept;
     [[nodiscard]] bool operator==(const RenderStateSettings& other) const noexcept;
     [[nodiscard]] bool operator!=(const RenderStateSettings& other) const noexcept;
     [[nodiscard]] explicit operator std::string() const;
 };
 
+struct IRenderState;
+
+struct IRenderStateCallback
+{
+    // Called from parallel executor thread when asynchronous compilation of render state pipeline has completed
+    virtual void OnRenderStateCompiled(IRenderState& render_state) = 0;
+
+    virtual ~IRenderStateCallback() = default;
+};
+
 struct IRenderState
     : virtual IObject // NOSONAR
+    , virtual Data::IEmitter<IRenderStateCallback> // NOSONAR
 {
 public:
     using Rasterizer = RasterizerSettings;
@@ -250,6 +266,7 @@ public:
 
     // IRenderState interface
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
+    [[nodiscard]] virtual bool IsCompiled() const noexcept = 0;
     virtual void Reset(const Settings& settings) = 0;
 };
 
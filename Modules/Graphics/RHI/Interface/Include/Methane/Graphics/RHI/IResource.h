@@ -93,12 +93,15 @@ struct IResource
     // IResource interface
     virtual bool SetState(State state) = 0;
     virtual bool SetState(State state, Ptr<IBarriers>& out_barriers) = 0;
+    virtual bool SetSubResourceState(const SubResource::Index& subresource_index, State state) = 0;
+    virtual bool SetSubResourceState(const SubResource::Index& subresource_index, State state, Ptr<IBarriers>& out_barriers) = 0;
     virtual bool SetOwnerQueueFamily(uint32_t family_index) = 0;
     virtual bool SetOwnerQueueFamily(uint32_t family_index, Ptr<IBarriers>& out_barriers) = 0;
     virtual void RestoreDescriptorViews(const DescriptorByViewId& descriptor_by_view_id) = 0;
     [[nodiscard]] virtual Data::Size                GetDataSize(Data::MemoryState size_type = Data::MemoryState::Reserved) const noexcept = 0;
     [[nodiscard]] virtual Type                      GetResourceType() const noexcept = 0;
     [[nodiscard]] virtual State                     GetState() const noexcept = 0;
+    [[nodiscard]] virtual State                     GetSubResourceState(const SubResource::Index& subresource_index) const = 0;
     [[nodiscard]] virtual UsageMask                 GetUsage() const noexcept = 0;
     [[nodiscard]] virtual const DescriptorByViewId& GetDescriptorByViewId() const noexcept = 0;
     [[nodiscard]] virtual const IContext&           GetContext() const noexcept = 0;
@@ -23,11 +23,14 @@ Methane resource barriers for manual or automatic resource state synchronization
 
 #pragma once
 
+#include "ResourceView.h"
+
 #include <Methane/Memory.hpp>
 
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace Methane::Graphics::Rhi
 {
@@ -70,17 +73,20 @@ public:
     using Type = ResourceBarrierType;
 
     ResourceBarrierId(Type type, IResource& resource) noexcept;
+    ResourceBarrierId(Type type, IResource& resource, const SubResourceIndex& subresource_index) noexcept;
 
     [[nodiscard]] bool operator<(const ResourceBarrierId& other) const noexcept;
     [[nodiscard]] bool operator==(const ResourceBarrierId& other) const noexcept;
     [[nodiscard]] bool operator!=(const ResourceBarrierId& other) const noexcept;
 
-    [[nodiscard]] Type      GetType() const noexcept     { return m_type; }
+    [[nodiscard]] Type       GetType() const noexcept     { return m_type; }
     [[nodiscard]] IResource& GetResource() const noexcept { return m_resource_ref.get(); }
+    [[nodiscard]] const Opt<SubResourceIndex>& GetSubResourceIndex() const noexcept { return m_subresource_index_opt; }
 
 private:
-    Type           m_type;
-    Ref<IResource> m_resource_ref;
+    Type                  m_type;
+    Ref<IResource>        m_resource_ref;
+    Opt<SubResourceIndex> m_subresource_index_opt; // barrier targets all sub-resources when index is not set
 };
 
 class ResourceStateChange
@@ -130,6 +136,7 @@ public:
     ResourceBarrier(IResource& resource, const StateChange& state_change);
     ResourceBarrier(IResource& resource, const OwnerChange& owner_change);
     ResourceBarrier(IResource& resource, ResourceState state_before, ResourceState state_after);
+    ResourceBarrier(IResource& resource, const SubResourceIndex& subresource_index, ResourceState state_before, ResourceState state_after);
     ResourceBarrier(IResource& resource, uint32_t queue_family_before, uint32_t queue_family_after);
     ResourceBarrier(const ResourceBarrier&) = default;
 
@@ -165,10 +172,10 @@ private:
 
 struct IResourceBarriers
 {
-    using State   = ResourceState;
-    using Barrier = ResourceBarrier;
-    using Set     = std::set<ResourceBarrier>;
-    using Map     = std::map<ResourceBarrier::Id, ResourceBarrier>;
+    using State    = ResourceState;
+    using Barrier  = ResourceBarrier;
+    using Set      = std::set<ResourceBarrier>;
+    using Barriers = std::vector<ResourceBarrier>;
 
     enum class AddResult
     {
@@ -185,7 +192,7 @@ struct IResourceBarriers
     [[nodiscard]] virtual Ptr<IResourceBarriers> GetPtr() = 0;
     [[nodiscard]] virtual bool  IsEmpty() const noexcept = 0;
     [[nodiscard]] virtual Set   GetSet() const noexcept = 0;
-    [[nodiscard]] virtual const Map& GetMap() const noexcept = 0;
+    [[nodiscard]] virtual const Barriers& GetBarriers() const noexcept = 0;
     [[nodiscard]] virtual const Barrier* GetBarrier(const Barrier::Id& id) const noexcept = 0;
     [[nodiscard]] virtual bool  HasStateTransition(IResource& resource, State before, State after) = 0;
     [[nodiscard]] virtual bool  HasOwnerTransition(IResource& resource, uint32_t queue_family_before, uint32_t queue_family_after) = 0;
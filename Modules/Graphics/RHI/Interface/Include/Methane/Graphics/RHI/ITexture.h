@@ -24,6 +24,7 @@ Methane graphics interface: graphics texture.
 #pragma once
 
 #include "IResource.h"
+#include "IReadBackRequest.h"
 
 #include <Methane/Graphics/Volume.hpp>
 #include <Methane/Graphics/Types.h>
@@ -97,6 +98,7 @@ struct TextureSettings
 };
 
 struct IRenderContext;
+struct ICommandList;
 
 struct ITexture
     : virtual IResource // NOSONAR
@@ -118,6 +120,9 @@ struct ITexture
     [[nodiscard]] virtual SubResource        GetData(ICommandQueue& target_cmd_queue,
                                                      const SubResourceIndex& sub_resource_index = {},
                                                      const BytesRangeOpt& data_range = {}) = 0;
+    [[nodiscard]] virtual Ptr<IReadBackRequest> RequestReadBack(ICommandList& cmd_list,
+                                                                const SubResourceIndex& sub_resource_index = {},
+                                                                const BytesRangeOpt& data_range = {}) = 0;
     virtual void SetData(ICommandQueue& target_cmd_queue, const SubResources& sub_resources) = 0;
 };
 
@@ -34,6 +34,7 @@ Methane graphics RHI interfaces: all headers under one umbrella.
 #include "IRenderState.h"
 #include "IViewState.h"
 #include "IResource.h"
+#include "IReadBackRequest.h"
 #include "IBuffer.h"
 #include "IBufferSet.h"
 #include "ITexture.h"
@@ -35,4 +35,10 @@ Ptr<IRenderCommandList> IRenderCommandList::Create(ICommandQueue& command_queue,
     return command_queue.CreateRenderCommandList(render_pass);
 }
 
+Ptr<IRenderCommandList> IRenderCommandList::CreateBundle(ICommandQueue& command_queue, IRenderPass& render_pass)
+{
+    META_FUNCTION_TASK();
+    return command_queue.CreateRenderCommandBundle(render_pass);
+}
+
 } // namespace Methane::Graphics::Rhi
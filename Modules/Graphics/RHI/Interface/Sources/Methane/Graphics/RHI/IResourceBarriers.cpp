@@ -36,12 +36,19 @@ ResourceBarrierId::ResourceBarrierId(Type type, Rhi::IResource& resource) noexce
     , m_resource_ref(resource)
 { }
 
+ResourceBarrierId::ResourceBarrierId(Type type, Rhi::IResource& resource, const SubResourceIndex& subresource_index) noexcept
+    : m_type(type)
+    , m_resource_ref(resource)
+    , m_subresource_index_opt(subresource_index)
+{ }
+
 bool ResourceBarrierId::operator<(const ResourceBarrierId& other) const noexcept
 {
     META_FUNCTION_TASK();
     const Rhi::IResource* p_this_resource  = std::addressof(m_resource_ref.get());
     const Rhi::IResource* p_other_resource = std::addressof(other.GetResource());
-    return std::tie(m_type, p_this_resource) < std::tie(other.m_type, p_other_resource);
+    return std::tie(m_type, p_this_resource, m_subresource_index_opt) <
+           std::tie(other.m_type, p_other_resource, other.m_subresource_index_opt);
 }
 
 bool ResourceBarrierId::operator==(const ResourceBarrierId& other) const noexcept
@@ -49,7 +56,8 @@ bool ResourceBarrierId::operator==(const ResourceBarrierId& other) const noexcep
     META_FUNCTION_TASK();
     const Rhi::IResource* p_this_resource  = std::addressof(m_resource_ref.get());
     const Rhi::IResource* p_other_resource = std::addressof(other.GetResource());
-    return std::tie(m_type, p_this_resource) == std::tie(other.m_type, p_other_resource);
+    return std::tie(m_type, p_this_resource, m_subresource_index_opt) ==
+           std::tie(other.m_type, p_other_resource, other.m_subresource_index_opt);
 }
 
 bool ResourceBarrierId::operator!=(const ResourceBarrierId& other) const noexcept
@@ -120,6 +128,11 @@ ResourceBarrier::ResourceBarrier(IResource& resource, ResourceState state_before
     : ResourceBarrier(resource, StateChange(state_before, state_after))
 { }
 
+ResourceBarrier::ResourceBarrier(IResource& resource, const SubResourceIndex& subresource_index, ResourceState state_before, ResourceState state_after)
+    : m_id(Type::StateTransition, resource, subresource_index)
+    , m_change(StateChange(state_before, state_after))
+{ }
+
 ResourceBarrier::ResourceBarrier(IResource& resource, uint32_t queue_family_before, uint32_t queue_family_after)
     : ResourceBarrier(resource, OwnerChange(queue_family_before, queue_family_after))
 { }
@@ -182,6 +195,14 @@ ResourceBarrier::operator std::string() const noexcept
     switch(m_id.GetType())
     {
     case Type::StateTransition:
+        if (const Opt<SubResourceIndex>& subresource_index_opt = m_id.GetSubResourceIndex();
+            subresource_index_opt)
+            return fmt::format("Resource '{}' sub-resource {} state transition barrier from {} to {} state",
+                               m_id.GetResource().GetName(),
+                               static_cast<std::string>(*subresource_index_opt),
+                               magic_enum::enum_name(m_change.state.GetStateBefore()),
+                               magic_enum::enum_name(m_change.state.GetStateAfter()));
+
         return fmt::format("Resource '{}' state transition barrier from {} to {} state",
                            m_id.GetResource().GetName(),
                            magic_enum::enum_name(m_change.state.GetStateBefore()),
@@ -216,6 +237,15 @@ void ResourceBarrier::ApplyTransition() const
     switch(m_id.GetType())
     {
     case Type::StateTransition:
+        if (const Opt<SubResourceIndex>& subresource_index_opt = m_id.GetSubResourceIndex();
+            subresource_index_opt)
+        {
+            META_CHECK_ARG_EQUAL_DESCR(m_id.GetResource().GetSubResourceState(*subresource_index_opt), m_change.state.GetStateBefore(),
+                                       "state of resource '{}' sub-resource does not match with transition barrier 'before' state",
+                                       m_id.GetResource().GetName());
+            m_id.GetResource().SetSubResourceState(*subresource_index_opt, m_change.state.GetStateAfter());
+            break;
+        }
         META_CHECK_ARG_EQUAL_DESCR(m_id.GetResource().GetState(), m_change.state.GetStateBefore(),
                                    "state of resource '{}' does not match with transition barrier 'before' state",
                                    m_id.GetResource().GetName());
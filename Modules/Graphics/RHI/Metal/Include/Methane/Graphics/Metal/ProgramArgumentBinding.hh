@@ -49,7 +49,7 @@ public:
     ProgramArgumentBinding(const Base::Context& context, const Settings& settings);
 
     // Base::ProgramArgumentBinding interface
-    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy(const Allocator& allocator) const override;
 
     // IArgumentBinding interface
     bool SetResourceViews(const Rhi::IResource::Views& resource_views) override;
@@ -66,12 +66,13 @@ void ComputeState::Reset(const Settings& settings)
     ResetNativeState();
 }
 
-void ComputeState::Apply(Base::ComputeCommandList& command_list)
+bool ComputeState::Apply(Base::ComputeCommandList& command_list)
 {
     META_FUNCTION_TASK();
     auto& metal_command_list = static_cast<ComputeCommandList&>(command_list);
     const id<MTLComputeCommandEncoder>& mtl_cmd_encoder = metal_command_list.GetNativeCommandEncoder();
     [mtl_cmd_encoder setComputePipelineState: GetNativePipelineState()];
+    return true;
 }
 
 bool ComputeState::SetName(std::string_view name)
@@ -39,10 +39,10 @@ ProgramArgumentBinding::ProgramArgumentBinding(const Base::Context& context, con
     , m_settings_mt(settings)
 { }
 
-Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
+Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy(const Allocator& allocator) const
 {
     META_FUNCTION_TASK();
-    return std::make_shared<ProgramArgumentBinding>(*this);
+    return std::allocate_shared<ProgramArgumentBinding>(allocator, *this);
 }
 
 bool ProgramArgumentBinding::SetResourceViews(const Rhi::ResourceViews& resource_views)
@@ -280,9 +280,9 @@ void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask a
 template<typename FuncType> // function void(const ArgumentBinding&)
 void ProgramBindings::ForEachChangedArgumentBinding(const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior, FuncType functor) const
 {
-    for(const auto& binding_by_argument : GetArgumentBindings())
+    for(const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
-        const ArgumentBinding& metal_argument_binding = static_cast<const ArgumentBinding&>(*binding_by_argument.second);
+        const ArgumentBinding& metal_argument_binding = static_cast<const ArgumentBinding&>(*argument_binding_ptr);
         if (apply_behavior.HasAnyBits(g_constant_once_and_changes_only) && applied_program_bindings_ptr &&
             metal_argument_binding.IsAlreadyApplied(GetProgram(), *applied_program_bindings_ptr, apply_behavior.HasAnyBit(ApplyBehavior::ChangesOnly)))
             continue;
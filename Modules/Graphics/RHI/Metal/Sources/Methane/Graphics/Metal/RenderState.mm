@@ -241,7 +241,7 @@ void RenderState::Reset(const Settings& settings)
     ResetNativeState();
 }
 
-void RenderState::Apply(Base::RenderCommandList& command_list, Groups state_groups)
+bool RenderState::Apply(Base::RenderCommandList& command_list, Groups state_groups)
 {
     META_FUNCTION_TASK();
     RenderCommandList& metal_command_list = static_cast<RenderCommandList&>(command_list);
@@ -269,6 +269,7 @@ void RenderState::Apply(Base::RenderCommandList& command_list, Groups state_grou
                                      blue:settings.blending_color.GetBlue()
                                     alpha:settings.blending_color.GetAlpha()];
     }
+    return true;
 }
 
 bool RenderState::SetName(std::string_view name)
@@ -197,9 +197,14 @@ MTLVertexDescriptor* Shader::GetNativeVertexDescriptor(const Program& program) c
         if (!mtl_vertex_attrib.active)
             continue;
         
-        const MTLVertexFormat mtl_vertex_format = TypeConverter::MetalDataTypeToVertexFormat(mtl_vertex_attrib.attributeType);
-        const std::string attrib_name = std::regex_replace(MacOS::ConvertFromNsString(mtl_vertex_attrib.name), s_attr_suffix_regex, "");
-        const uint32_t    attrib_size = TypeConverter::ByteSizeOfVertexFormat(mtl_vertex_format);
+        const std::string attrib_name   = std::regex_replace(MacOS::ConvertFromNsString(mtl_vertex_attrib.name), s_attr_suffix_regex, "");
+        const PixelFormat attrib_format = GetProgramInputArgumentFormatBySemantic(program, attrib_name);
+        const MTLVertexFormat mtl_vertex_format = attrib_format == PixelFormat::Unknown
+                                                ? TypeConverter::MetalDataTypeToVertexFormat(mtl_vertex_attrib.attributeType)
+                                                : TypeConverter::PixelFormatToMetalVertexFormat(attrib_format);
+        const uint32_t    attrib_size = attrib_format == PixelFormat::Unknown
+                                      ? TypeConverter::ByteSizeOfVertexFormat(mtl_vertex_format)
+                                      : GetPixelSize(attrib_format);
         const uint32_t    attrib_slot = GetProgramInputBufferIndexByArgumentSemantic(program, attrib_name);
         
         if (attrib_slot <= input_buffer_byte_offsets.size())
@@ -53,6 +53,9 @@ MTLPixelFormat TypeConverter::DataFormatToMetalPixelType(PixelFormat data_format
     case PixelFormat::RGBA8Unorm_sRGB:  return MTLPixelFormatRGBA8Unorm_sRGB;
     case PixelFormat::BGRA8Unorm:       return MTLPixelFormatBGRA8Unorm;
     case PixelFormat::BGRA8Unorm_sRGB:  return MTLPixelFormatBGRA8Unorm_sRGB;
+    case PixelFormat::RGBA16Float:      return MTLPixelFormatRGBA16Float;
+    case PixelFormat::RG16Unorm:        return MTLPixelFormatRG16Unorm;
+    case PixelFormat::RG16Snorm:        return MTLPixelFormatRG16Snorm;
     case PixelFormat::R32Float:         return MTLPixelFormatR32Float;
     case PixelFormat::R32Uint:          return MTLPixelFormatR32Uint;
     case PixelFormat::R32Sint:          return MTLPixelFormatR32Sint;
@@ -170,6 +173,34 @@ MTLVertexFormat TypeConverter::MetalDataTypeToVertexFormat(MTLDataType data_type
     }
 }
 
+MTLVertexFormat TypeConverter::PixelFormatToMetalVertexFormat(PixelFormat data_format)
+{
+    META_FUNCTION_TASK();
+
+    switch(data_format)
+    {
+        case PixelFormat::RGBA8:        return MTLVertexFormatUChar4;
+        case PixelFormat::RGBA8Unorm:   return MTLVertexFormatUChar4Normalized;
+        case PixelFormat::BGRA8Unorm:   return MTLVertexFormatUChar4Normalized_BGRA;
+        case PixelFormat::RGBA16Float:  return MTLVertexFormatHalf4;
+        case PixelFormat::RG16Unorm:    return MTLVertexFormatUShort2Normalized;
+        case PixelFormat::RG16Snorm:    return MTLVertexFormatShort2Normalized;
+        case PixelFormat::R32Float:     return MTLVertexFormatFloat;
+        case PixelFormat::R32Uint:      return MTLVertexFormatUInt;
+        case PixelFormat::R32Sint:      return MTLVertexFormatInt;
+        case PixelFormat::R16Float:     return MTLVertexFormatHalf;
+        case PixelFormat::R16Uint:      return MTLVertexFormatUShort;
+        case PixelFormat::R16Sint:      return MTLVertexFormatShort;
+        case PixelFormat::R16Unorm:     return MTLVertexFormatUShortNormalized;
+        case PixelFormat::R16Snorm:     return MTLVertexFormatShortNormalized;
+        case PixelFormat::R8Uint:       return MTLVertexFormatUChar;
+        case PixelFormat::R8Sint:       return MTLVertexFormatChar;
+        case PixelFormat::R8Unorm:      return MTLVertexFormatUCharNormalized;
+        case PixelFormat::R8Snorm:      return MTLVertexFormatCharNormalized;
+        default:                        META_UNEXPECTED_ARG_RETURN(data_format, MTLVertexFormatInvalid);
+    }
+}
+
 uint32_t TypeConverter::ByteSizeOfVertexFormat(MTLVertexFormat vertex_format)
 {
     META_FUNCTION_TASK();
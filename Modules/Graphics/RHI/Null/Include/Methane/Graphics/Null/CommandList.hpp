@@ -24,6 +24,8 @@ Null base template implementation of the command list interface.
 #pragma once
 
 #include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Data/Types.h>
 
 namespace Methane::Graphics::Null
 {
@@ -35,10 +37,24 @@ class CommandList
 public:
     using CommandListBaseT::CommandListBaseT;
 
-    void SetResourceBarriers(const Rhi::IResourceBarriers&) final
+    void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) final
     {
         CommandListBaseT::VerifyEncodingState();
+        CommandListBaseT::FlushPendingResourceBarriers();
+
+        if (resource_barriers.IsEmpty())
+            return;
+
+        m_resource_barriers_set_count++;
+        m_resource_barriers_count += static_cast<Data::Size>(resource_barriers.GetBarriers().size());
     }
+
+    Data::Size GetResourceBarriersSetCount() const noexcept { return m_resource_barriers_set_count; }
+    Data::Size GetResourceBarriersCount() const noexcept    { return m_resource_barriers_count; }
+
+private:
+    Data::Size m_resource_barriers_set_count = 0U;
+    Data::Size m_resource_barriers_count     = 0U;
 };
 
 } // namespace Methane::Graphics::Null
@@ -25,6 +25,9 @@ Null implementation of the compute state interface.
 
 #include <Methane/Graphics/Base/ComputeState.h>
 
+#include <stdexcept>
+#include <string>
+
 namespace Methane::Graphics::Null
 {
 
@@ -32,10 +35,37 @@ class ComputeState final
     : public Base::ComputeState
 {
 public:
-    using Base::ComputeState::ComputeState;
+    ComputeState(const Rhi::IContext& context, const Settings& settings)
+        : Base::ComputeState(context, settings)
+    {
+        CompileNull();
+    }
+
+    // IComputeState interface
+    void Reset(const Settings& settings) override
+    {
+        WaitForCompilation();
+        Base::ComputeState::Reset(settings);
+        CompileNull();
+    }
 
     // Base::ComputeState interface
-    void Apply(Base::ComputeCommandList&) override { /* Intentionally unimplemented */ }
+    bool Apply(Base::ComputeCommandList&) override { RethrowCompileError(); return IsCompiled(); }
+
+    // Compilation with non-empty error message fails with exception, which is used in tests of compilation failures
+    void SetCompileErrorMessage(const std::string& error_message) { m_compile_error_message = error_message; }
+
+private:
+    void CompileNull()
+    {
+        Compile([error_message = m_compile_error_message]()
+        {
+            if (!error_message.empty())
+                throw std::runtime_error(error_message);
+        });
+    }
+
+    std::string m_compile_error_message;
 };
 
 } // namespace Methane::Graphics::Null
@@ -33,6 +33,19 @@ class Fence final
 {
 public:
     using Base::Fence::Fence;
+
+    // IFence overrides
+    void WaitOnGpu(Rhi::ICommandQueue& wait_on_command_queue) override
+    {
+        Base::Fence::WaitOnGpu(wait_on_command_queue);
+        m_gpu_waits_count++;
+    }
+
+    // Count of GPU waits is used in tests of command queues synchronization
+    uint32_t GetGpuWaitsCount() const noexcept { return m_gpu_waits_count; }
+
+private:
+    uint32_t m_gpu_waits_count = 0U;
 };
 
 } // namespace Methane::Graphics::Null
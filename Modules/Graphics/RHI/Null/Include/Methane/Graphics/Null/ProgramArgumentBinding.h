@@ -42,7 +42,7 @@ public:
     using Base::ProgramArgumentBinding::ProgramArgumentBinding;
 
     // Base::ProgramArgumentBinding interface
-    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy(const Allocator& allocator) const override;
 };
 
 } // namespace Methane::Graphics::Null
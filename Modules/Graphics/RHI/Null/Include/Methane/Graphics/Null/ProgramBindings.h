@@ -41,7 +41,7 @@ public:
 
     // IProgramBindings interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) override;
-    void Apply(Base::CommandList&, ApplyBehaviorMask) const override { /* Intentionally unimplemented */ }
+    void Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const override;
 
     // Base::ProgramBindings interface
     void CompleteInitialization() override { /* Intentionally unimplemented */ }
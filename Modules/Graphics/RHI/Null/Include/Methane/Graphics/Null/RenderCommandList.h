@@ -27,6 +27,10 @@ Null implementation of the render command list interface.
 #include "RenderPass.h"
 
 #include <Methane/Graphics/Base/RenderCommandList.h>
+#include <Methane/Data/Range.hpp>
+
+#include <functional>
+#include <vector>
 
 namespace Methane::Graphics::Null
 {
@@ -39,19 +43,45 @@ class RenderCommandList final // NOSONAR - inheritance hierarchy is greater than
     : public CommandList<Base::RenderCommandList>
 {
 public:
+    using InstanceRanges = std::vector<Data::Range<uint32_t>>;
+
     explicit RenderCommandList(CommandQueue& command_queue);
     RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass);
+    RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle);
     explicit RenderCommandList(ParallelRenderCommandList& parallel_render_command_list);
 
+    // ICommandList interface
+    void SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) override;
+
     // IRenderCommandList interface
     void Reset(IDebugGroup* debug_group_ptr = nullptr) override;
     void ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr = nullptr) override;
+    void SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups = Rhi::RenderStateGroupMask(~0U)) override;
+    void SetViewState(Rhi::IViewState& view_state) override;
     bool SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers) override;
     bool SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_resource_barriers) override;
     void DrawIndexed(Primitive primitive, uint32_t index_count, uint32_t start_index, uint32_t start_vertex,
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void ExecuteBundle(Rhi::IRenderCommandList& bundle) override;
+
+    size_t   GetRecordedCommandsCount() const noexcept { return m_recorded_commands.size(); }
+    uint32_t GetDrawsCount() const noexcept            { return m_draws_count; }
+
+    // Ranges of instances drawn by every draw call, which was not skipped
+    const InstanceRanges& GetDrawnInstanceRanges() const noexcept { return m_drawn_instance_ranges; }
+
+private:
+    using RecordedCommand = std::function<void(Rhi::IRenderCommandList&)>;
+
+    // Bundle records commands to replay them in the render command lists executing this bundle
+    void RecordCommand(RecordedCommand&& command);
+    void AddDraw(uint32_t instance_count, uint32_t start_instance);
+
+    std::vector<RecordedCommand> m_recorded_commands;
+    uint32_t                     m_draws_count = 0U;
+    InstanceRanges               m_drawn_instance_ranges;
 };
 
 } // namespace Methane::Graphics::Null
@@ -25,6 +25,9 @@ Null implementation of the render state interface.
 
 #include <Methane/Graphics/Base/RenderState.h>
 
+#include <stdexcept>
+#include <string>
+
 namespace Methane::Graphics::Null
 {
 
@@ -32,10 +35,37 @@ class RenderState final
     : public Base::RenderState
 {
 public:
-    using Base::RenderState::RenderState;
+    RenderState(const Base::RenderContext& context, const Settings& settings)
+        : Base::RenderState(context, settings)
+    {
+        CompileNull();
+    }
+
+    // IRenderState interface
+    void Reset(const Settings& settings) override
+    {
+        WaitForCompilation();
+        Base::RenderState::Reset(settings);
+        CompileNull();
+    }
 
     // Base::RenderState interface
-    void Apply(Base::RenderCommandList&, Groups) override { /* Intentionally unimplemented */ }
+    bool Apply(Base::RenderCommandList&, Groups) override { RethrowCompileError(); return IsCompiled(); }
+
+    // Compilation with non-empty error message fails with exception, which is used in tests of compilation failures
+    void SetCompileErrorMessage(const std::string& error_message) { m_compile_error_message = error_message; }
+
+private:
+    void CompileNull()
+    {
+        Compile([error_message = m_compile_error_message]()
+        {
+            if (!error_message.empty())
+                throw std::runtime_error(error_message);
+        });
+    }
+
+    std::string m_compile_error_message;
 };
 
 } // namespace Methane::Graphics::Null
@@ -38,6 +38,12 @@ Ptr<Rhi::IFence> CommandQueue::CreateFence()
     return std::make_shared<Fence>(*this);
 }
 
+uint32_t CommandQueue::GetFamilyIndex() const noexcept
+{
+    // Transfer queue emulates dedicated transfer queue family to exercise queue ownership transfers
+    return GetCommandListType() == Rhi::CommandListType::Transfer ? 1U : 0U;
+}
+
 Ptr<Rhi::ITransferCommandList> CommandQueue::CreateTransferCommandList()
 {
     META_FUNCTION_TASK();
@@ -56,6 +62,12 @@ Ptr<Rhi::IRenderCommandList> CommandQueue::CreateRenderCommandList(Rhi::IRenderP
     return std::make_shared<RenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IRenderCommandList> CommandQueue::CreateRenderCommandBundle(Rhi::IRenderPass& render_pass)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<RenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass), true);
+}
+
 Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass)
 {
     META_FUNCTION_TASK();
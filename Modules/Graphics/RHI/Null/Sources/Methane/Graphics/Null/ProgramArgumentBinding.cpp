@@ -27,10 +27,10 @@ namespace Methane::Graphics::Null
 {
 
 // Base::ProgramArgumentBinding interface
-Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
+Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy(const Allocator& allocator) const
 {
     META_FUNCTION_TASK();
-    return std::make_shared<ProgramArgumentBinding>(*this);
+    return std::allocate_shared<ProgramArgumentBinding>(allocator, *this);
 }
 
 } // namespace Methane::Graphics::Null
@@ -34,4 +34,13 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
     return std::make_shared<ProgramBindings>(*this, replace_resource_views_by_argument, frame_index);
 }
 
+void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
+{
+    META_FUNCTION_TASK();
+    if (apply_behavior.HasAnyBit(ApplyBehavior::StateBarriers))
+    {
+        ApplyResourceTransitionBarriers(command_list);
+    }
+}
+
 } // namespace Methane::Graphics::Null
\ No newline at end of file
@@ -25,6 +25,8 @@ Null implementation of the render command list interface.
 #include <Methane/Graphics/Null/CommandQueue.h>
 #include <Methane/Graphics/Null/ParallelRenderCommandList.h>
 #include <Methane/Graphics/Null/Buffer.h>
+#include <Methane/Graphics/RHI/IProgramBindings.h>
+#include <Methane/Graphics/RHI/IBufferSet.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -51,23 +53,53 @@ RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& re
     : CommandList(command_queue, render_pass)
 { }
 
+RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle)
+    : CommandList(command_queue, render_pass, is_bundle)
+{ }
+
 RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_command_list)
     : CommandList(parallel_render_command_list)
 { }
 
+void RenderCommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior)
+{
+    META_FUNCTION_TASK();
+    CommandList::SetProgramBindings(program_bindings, apply_behavior);
+    RecordCommand([program_bindings_ptr = program_bindings.GetDerivedPtr<Rhi::IProgramBindings>(), apply_behavior](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.SetProgramBindings(*program_bindings_ptr, apply_behavior); });
+}
+
 void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    m_recorded_commands.clear();
+    m_draws_count = 0U;
+    m_drawn_instance_ranges.clear();
 }
 
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
-    CommandList::ResetCommandState();
-    CommandList::Reset(debug_group_ptr);
-    CommandList::SetRenderState(render_state);
+    RenderCommandList::Reset(debug_group_ptr);
+    RenderCommandList::SetRenderState(render_state);
+}
+
+void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::RenderStateGroupMask state_groups)
+{
+    META_FUNCTION_TASK();
+    CommandList::SetRenderState(render_state, state_groups);
+    RecordCommand([render_state_ptr = render_state.GetDerivedPtr<Rhi::IRenderState>(), state_groups](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.SetRenderState(*render_state_ptr, state_groups); });
+}
+
+void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
+{
+    META_FUNCTION_TASK();
+    CommandList::SetViewState(view_state);
+    RecordCommand([view_state_ptr = view_state.GetPtr()](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.SetViewState(*view_state_ptr); });
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
@@ -76,6 +108,8 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
     if (!Base::RenderCommandList::SetVertexBuffers(vertex_buffers, set_resource_barriers))
         return false;
 
+    RecordCommand([vertex_buffers_ptr = vertex_buffers.GetDerivedPtr<Rhi::IBufferSet>(), set_resource_barriers](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.SetVertexBuffers(*vertex_buffers_ptr, set_resource_barriers); });
     return true;
 }
 
@@ -85,6 +119,8 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
     if (!Base::RenderCommandList::SetIndexBuffer(index_buffer, set_resource_barriers))
         return false;
 
+    RecordCommand([index_buffer_ptr = index_buffer.GetDerivedPtr<Rhi::IBuffer>(), set_resource_barriers](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.SetIndexBuffer(*index_buffer_ptr, set_resource_barriers); });
     return true;
 }
 
@@ -99,6 +135,9 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    RecordCommand([=](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance); });
+    AddDraw(instance_count, start_instance);
 }
 
 void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
@@ -106,6 +145,38 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    RecordCommand([=](Rhi::IRenderCommandList& cmd_list)
+                  { cmd_list.Draw(primitive, vertex_count, start_vertex, instance_count, start_instance); });
+    AddDraw(instance_count, start_instance);
+}
+
+void RenderCommandList::ExecuteBundle(Rhi::IRenderCommandList& bundle)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::ExecuteBundle(bundle);
+
+    // Bundle commands are replayed in this command list and drawing state changed by them is reset afterwards
+    for(const RecordedCommand& recorded_command : static_cast<const RenderCommandList&>(bundle).m_recorded_commands)
+    {
+        recorded_command(*this);
+    }
+    ResetDrawingState();
+}
+
+void RenderCommandList::AddDraw(uint32_t instance_count, uint32_t start_instance)
+{
+    // Draw is skipped until render state compilation is completed
+    if (!IsRenderStateApplied())
+        return;
+
+    m_draws_count++;
+    m_drawn_instance_ranges.emplace_back(start_instance, start_instance + instance_count);
+}
+
+void RenderCommandList::RecordCommand(RecordedCommand&& command)
+{
+    if (IsBundle())
+        m_recorded_commands.emplace_back(std::move(command));
 }
 
 } // namespace Methane::Graphics::Null
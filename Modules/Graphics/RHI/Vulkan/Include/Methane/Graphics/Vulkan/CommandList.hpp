@@ -44,11 +44,14 @@ Vulkan base template implementation of the command list interface.
 
 #include <array>
 #include <vector>
+#include <algorithm>
+#include <iterator>
 
 namespace Methane::Graphics::Vulkan
 {
 
 class ParallelRenderCommandList;
+class RenderPass;
 
 template<class CommandListBaseT, vk::PipelineBindPoint pipeline_bind_point, uint32_t command_buffers_count = 1U,
          CommandBufferType default_command_buffer_type = CommandBufferType::Primary,
@@ -63,7 +66,7 @@ public:
     CommandList(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info, ConstructArgs&&... construct_args)
         : CommandListBaseT(std::forward<ConstructArgs>(construct_args)...)
         , m_vk_device(GetVulkanCommandQueue().GetVulkanContext().GetVulkanDevice().GetNativeDevice()) // NOSONAR
-        , m_vk_unique_command_pool(CreateVulkanCommandPool(GetVulkanCommandQueue().GetFamilyIndex()))
+        , m_vk_unique_command_pool(GetVulkanCommandQueue().AcquireNativeCommandPool())
     {
         META_FUNCTION_TASK();
         std::fill(m_vk_command_buffer_encoding_flags.begin(), m_vk_command_buffer_encoding_flags.end(), false);
@@ -82,7 +85,7 @@ public:
     CommandList(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info, ParallelRenderCommandList& parallel_render_command_list, bool is_beginning_cmd_list)
         : CommandListBaseT(parallel_render_command_list)
         , m_vk_device(GetVulkanCommandQueue().GetVulkanContext().GetVulkanDevice().GetNativeDevice()) // NOSONAR
-        , m_vk_unique_command_pool(CreateVulkanCommandPool(GetVulkanCommandQueue().GetFamilyIndex()))
+        , m_vk_unique_command_pool(GetVulkanCommandQueue().AcquireNativeCommandPool())
         , m_debug_group_command_buffer_type(is_beginning_cmd_list ? CommandBufferType::Primary : default_command_buffer_type)
     {
         META_FUNCTION_TASK();
@@ -109,12 +112,31 @@ public:
         CommandListBaseT::SetCommandListState(Rhi::CommandListState::Encoding);
     }
 
+    CommandList(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info, CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle)
+        : CommandListBaseT(command_queue, render_pass, is_bundle)
+        , m_vk_device(GetVulkanCommandQueue().GetVulkanContext().GetVulkanDevice().GetNativeDevice()) // NOSONAR
+        , m_vk_unique_command_pool(GetVulkanCommandQueue().AcquireNativeCommandPool())
+        , m_vk_secondary_usage_flags(is_bundle ? vk::CommandBufferUsageFlagBits::eSimultaneousUse : vk::CommandBufferUsageFlagBits::eOneTimeSubmit)
+    {
+        META_FUNCTION_TASK();
+        std::fill(m_vk_command_buffer_encoding_flags.begin(), m_vk_command_buffer_encoding_flags.end(), false);
+        std::fill(m_vk_command_buffer_primary_flags.begin(), m_vk_command_buffer_primary_flags.end(), false);
+
+        // Bundle command list does not use primary command buffer: its synchronization and render pass secondary command buffers
+        // are executed by other render command lists, which may be pending execution simultaneously for different frames
+        m_vk_command_buffer_begin_infos[0] = vk::CommandBufferBeginInfo(m_vk_secondary_usage_flags);
+        SetCommandBufferInheritInfo(secondary_render_buffer_inherit_info, CommandBufferType::SecondaryRenderPass);
+        InitializeSecondaryCommandBuffers(0U);
+
+        CommandListBaseT::SetCommandListState(Rhi::CommandListState::Encoding);
+    }
+
     template<typename... ConstructArgs, uint32_t buffers_count = command_buffers_count,
              typename = std::enable_if_t<buffers_count == 1>>
     CommandList(const vk::CommandBufferLevel& vk_buffer_level, const vk::CommandBufferBeginInfo& vk_begin_info, ConstructArgs&&... construct_args)
         : CommandListBaseT(std::forward<ConstructArgs>(construct_args)...)
         , m_vk_device(GetVulkanCommandQueue().GetVulkanContext().GetVulkanDevice().GetNativeDevice()) // NOSONAR
-        , m_vk_unique_command_pool(CreateVulkanCommandPool(GetVulkanCommandQueue().GetFamilyIndex()))
+        , m_vk_unique_command_pool(GetVulkanCommandQueue().AcquireNativeCommandPool())
         , m_vk_primary_command_buffer_level(vk_buffer_level)
         , m_vk_command_buffer_begin_infos({ vk_begin_info })
     {
@@ -133,6 +155,24 @@ public:
         CommandListBaseT::SetCommandListState(Rhi::CommandListState::Encoding);
     }
 
+    ~CommandList() override
+    {
+        META_FUNCTION_TASK();
+        // Command buffers are freed before returning command pool for reuse by other command lists of the queue
+        for(vk::UniqueCommandBuffer& vk_unique_command_buffer : m_vk_unique_command_buffers)
+            vk_unique_command_buffer.reset();
+
+        m_vk_retired_command_buffers.clear();
+        m_vk_recycled_command_buffers.clear();
+        GetVulkanCommandQueue().ReleaseNativeCommandPool(std::move(m_vk_unique_command_pool));
+    }
+
+    CommandList(const CommandList&) = delete;
+    CommandList(CommandList&&) = delete;
+
+    CommandList& operator=(const CommandList&) = delete;
+    CommandList& operator=(CommandList&&) = delete;
+
     // ICommandList interface
 
     void PushDebugGroup(Rhi::ICommandListDebugGroup& debug_group) final
@@ -174,8 +214,8 @@ public:
     {
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
+        CommandListBaseT::FlushPendingResourceBarriers();
 
-        const auto lock_guard = static_cast<const Base::ResourceBarriers&>(resource_barriers).Lock();
         if (resource_barriers.IsEmpty())
             return;
 
@@ -208,10 +248,16 @@ public:
 
         m_is_native_committed = false;
 
+        // All command buffers are reset in bulk with the command pool, since previous execution has completed,
+        // so the retired command buffers become available for recycling
+        m_vk_device.resetCommandPool(m_vk_unique_command_pool.get());
+        std::move(m_vk_retired_command_buffers.begin(), m_vk_retired_command_buffers.end(), std::back_inserter(m_vk_recycled_command_buffers));
+        m_vk_retired_command_buffers.clear();
+
         // Begin command buffers encoding
         for (size_t cmd_buffer_index = 0; cmd_buffer_index < command_buffers_count; ++cmd_buffer_index)
         {
-            if (m_vk_command_buffer_encoding_flags[cmd_buffer_index] || !m_vk_unique_command_buffers[cmd_buffer_index])
+            if (!m_vk_unique_command_buffers[cmd_buffer_index])
                 continue;
 
             m_vk_unique_command_buffers[cmd_buffer_index].get().begin(GetCommandBufferBeginInfo(static_cast<CommandBufferType>(cmd_buffer_index)));
@@ -291,7 +337,7 @@ protected:
     void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
     {
         // Optimization to skip dynamic_cast required to call Apply method of the Base::ProgramBinding implementation
-        static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetCommandQueue(),
+        static_cast<ProgramBindings&>(program_bindings).Apply(*this, *this, Base::CommandList::GetCommandQueue(),
                                                                 Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
     }
 
@@ -304,27 +350,17 @@ protected:
         const bool is_secondary_command_buffer = !m_vk_command_buffer_primary_flags[secondary_render_pass_index];
         m_vk_command_buffer_begin_infos[secondary_render_pass_index] = vk::CommandBufferBeginInfo(
             is_secondary_command_buffer && secondary_render_buffer_inherit_info.renderPass
-                ? vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eOneTimeSubmit)
-                : vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit),
+                ? m_vk_secondary_usage_flags | vk::CommandBufferUsageFlagBits::eRenderPassContinue
+                : m_vk_secondary_usage_flags,
             &m_vk_secondary_render_buffer_inherit_info_opt.value()
         );
     }
 
-    vk::UniqueCommandPool CreateVulkanCommandPool(uint32_t queue_family_index)
-    {
-        META_FUNCTION_TASK();
-        vk::CommandPoolCreateInfo vk_command_pool_info(vk::CommandPoolCreateFlags(), queue_family_index);
-        vk_command_pool_info.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer);
-        return m_vk_device.createCommandPoolUnique(vk_command_pool_info);
-    }
-
     void InitializePrimaryCommandBuffer()
     {
         META_FUNCTION_TASK();
         m_vk_command_buffer_primary_flags[0] = true;
-        m_vk_unique_command_buffers[0] = std::move(m_vk_device.allocateCommandBuffersUnique(
-            vk::CommandBufferAllocateInfo(m_vk_unique_command_pool.get(), m_vk_primary_command_buffer_level, 1U)
-        ).back());
+        ReplaceCommandBuffer(0U, m_vk_primary_command_buffer_level);
 
         m_vk_unique_command_buffers[0].get().begin(m_vk_command_buffer_begin_infos[0]);
         m_vk_command_buffer_encoding_flags[0] = true;
@@ -333,17 +369,10 @@ protected:
     void InitializeSecondaryCommandBuffers(uint32_t offset_primary_count)
     {
         META_FUNCTION_TASK();
-        std::vector<vk::UniqueCommandBuffer> secondary_cmd_buffers = m_vk_device.allocateCommandBuffersUnique(
-            vk::CommandBufferAllocateInfo(
-                m_vk_unique_command_pool.get(),
-                vk::CommandBufferLevel::eSecondary,
-                command_buffers_count - offset_primary_count
-            ));
-
         for (uint32_t cmd_buffer_index = offset_primary_count; cmd_buffer_index < command_buffers_count; ++cmd_buffer_index)
         {
+            ReplaceCommandBuffer(cmd_buffer_index, vk::CommandBufferLevel::eSecondary);
             vk::UniqueCommandBuffer& vk_unique_command_buffer = m_vk_unique_command_buffers[cmd_buffer_index];
-            vk_unique_command_buffer = std::move(secondary_cmd_buffers[cmd_buffer_index - offset_primary_count]);
 
             const vk::CommandBufferBeginInfo& secondary_begin_info = GetCommandBufferBeginInfo(static_cast<CommandBufferType>(cmd_buffer_index));
             if (!secondary_begin_info.pInheritanceInfo)
@@ -364,13 +393,51 @@ protected:
     }
 
 private:
+    struct LeveledCommandBuffer
+    {
+        vk::CommandBufferLevel  level;
+        vk::UniqueCommandBuffer vk_unique_buffer;
+    };
+
+    void ReplaceCommandBuffer(uint32_t cmd_buffer_index, vk::CommandBufferLevel vk_level)
+    {
+        META_FUNCTION_TASK();
+        // Replaced command buffer may still be executed on GPU, so it is retired until the next command pool reset
+        if (vk::UniqueCommandBuffer& vk_unique_command_buffer = m_vk_unique_command_buffers[cmd_buffer_index];
+            vk_unique_command_buffer)
+        {
+            m_vk_retired_command_buffers.push_back({ m_vk_command_buffer_levels[cmd_buffer_index], std::move(vk_unique_command_buffer) });
+            m_vk_command_buffer_encoding_flags[cmd_buffer_index] = false;
+        }
+
+        m_vk_command_buffer_levels[cmd_buffer_index] = vk_level;
+
+        // Reuse recycled command buffer of the same level, which was reset with the command pool, or allocate a new one
+        if (const auto recycled_buffer_it = std::find_if(m_vk_recycled_command_buffers.begin(), m_vk_recycled_command_buffers.end(),
+                                                         [vk_level](const LeveledCommandBuffer& buffer) { return buffer.level == vk_level; });
+            recycled_buffer_it != m_vk_recycled_command_buffers.end())
+        {
+            m_vk_unique_command_buffers[cmd_buffer_index] = std::move(recycled_buffer_it->vk_unique_buffer);
+            m_vk_recycled_command_buffers.erase(recycled_buffer_it);
+            return;
+        }
+
+        m_vk_unique_command_buffers[cmd_buffer_index] = std::move(m_vk_device.allocateCommandBuffersUnique(
+            vk::CommandBufferAllocateInfo(m_vk_unique_command_pool.get(), vk_level, 1U)
+        ).back());
+    }
+
     vk::Device                   m_vk_device;
     vk::UniqueCommandPool        m_vk_unique_command_pool;
     bool                         m_is_native_committed = false;
     const vk::CommandBufferLevel m_vk_primary_command_buffer_level = vk::CommandBufferLevel::ePrimary;
+    const vk::CommandBufferUsageFlags m_vk_secondary_usage_flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
 
     // Unique command buffers and corresponding begin flags are indexed by the value of CommandBufferType enum
     std::array<vk::UniqueCommandBuffer, command_buffers_count>    m_vk_unique_command_buffers;
+    std::array<vk::CommandBufferLevel, command_buffers_count>     m_vk_command_buffer_levels;
+    std::vector<LeveledCommandBuffer>                             m_vk_retired_command_buffers;  // replaced buffers waiting for the pool reset
+    std::vector<LeveledCommandBuffer>                             m_vk_recycled_command_buffers; // reset buffers available for reuse
     std::array<bool, command_buffers_count>                       m_vk_command_buffer_primary_flags;
     std::array<bool, command_buffers_count>                       m_vk_command_buffer_encoding_flags;
     std::array<vk::CommandBufferBeginInfo, command_buffers_count> m_vk_command_buffer_begin_infos;
@@ -56,6 +56,7 @@ public:
     [[nodiscard]] Ptr<Rhi::ITransferCommandList>       CreateTransferCommandList() override;
     [[nodiscard]] Ptr<Rhi::IComputeCommandList>        CreateComputeCommandList() override;
     [[nodiscard]] Ptr<Rhi::IRenderCommandList>         CreateRenderCommandList(Rhi::IRenderPass& render_pass) override;
+    [[nodiscard]] Ptr<Rhi::IRenderCommandList>         CreateRenderCommandBundle(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] Ptr<Rhi::IParallelRenderCommandList> CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] Ptr<Rhi::ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) override;
     uint32_t GetFamilyIndex() const noexcept override { return m_queue_family_index; }
@@ -73,6 +74,10 @@ public:
     const WaitInfo& GetWaitForFrameExecutionCompleted(Data::Index frame_index) const;
     void ResetWaitForFrameExecution(Data::Index frame_index);
 
+    // Command pools are recycled between command lists of this queue instead of being created for each command list
+    [[nodiscard]] vk::UniqueCommandPool AcquireNativeCommandPool();
+    void ReleaseNativeCommandPool(vk::UniqueCommandPool&& vk_unique_command_pool) noexcept;
+
     uint32_t GetNativeQueueFamilyIndex() const noexcept { return m_queue_family_index; }
     uint32_t GetNativeQueueIndex() const noexcept       { return m_queue_index; }
 
@@ -108,6 +113,8 @@ private:
     mutable WaitInfo       m_wait_execution_completed;
     FrameWaitInfos         m_wait_frame_execution_completed;
     mutable TracyLockable(std::mutex, m_wait_frame_execution_completed_mutex);
+    std::vector<vk::UniqueCommandPool> m_vk_free_command_pools;
+    TracyLockable(std::mutex,          m_command_pools_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
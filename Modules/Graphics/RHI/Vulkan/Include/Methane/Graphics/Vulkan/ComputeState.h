@@ -25,8 +25,12 @@ Vulkan implementation of the compute state interface.
 
 #include <Methane/Graphics/Base/ComputeState.h>
 
+#include <Methane/Instrumentation.h>
+
 #include <vulkan/vulkan.hpp>
 
+#include <mutex>
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -38,25 +42,31 @@ class ComputeState final
 {
 public:
     ComputeState(const Rhi::IContext& context, const Settings& settings);
-    
+    ~ComputeState() override;
+
+    ComputeState(const ComputeState&) = delete;
+    ComputeState(ComputeState&&) = delete;
+
+    ComputeState& operator=(const ComputeState&) = delete;
+    ComputeState& operator=(ComputeState&&) = delete;
+
     // IComputeState interface
     void Reset(const Settings& settings) override;
 
     // Base::ComputeState interface
-    void Apply(Base::ComputeCommandList& compute_command_list) override;
+    bool Apply(Base::ComputeCommandList& compute_command_list) override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
 
-    const vk::Pipeline& GetNativePipeline() const noexcept
-    {
-        return m_vk_unique_pipeline.get();
-    }
+    // Returns null pipeline handle, while it is being compiled asynchronously
+    vk::Pipeline GetNativePipeline() const;
 
 private:
-    const Device&      m_device;
-    const IContext&    m_vk_context;
-    vk::UniquePipeline m_vk_unique_pipeline;
+    const Device&             m_device;
+    const IContext&           m_vk_context;
+    vk::UniquePipeline        m_vk_unique_pipeline;
+    mutable TracyLockable(std::mutex, m_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -33,6 +33,7 @@ Vulkan template implementation of the base context interface.
 #include "Texture.h"
 #include "Sampler.h"
 #include "DescriptorManager.h"
+#include "StagingRingBuffer.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -40,6 +41,7 @@ Vulkan template implementation of the base context interface.
 
 #include <string>
 #include <map>
+#include <mutex>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -62,6 +64,12 @@ public:
         // to release all descriptor sets using live device instance
         ContextBaseT::GetDescriptorManager().Release();
 
+        // Staging ring buffer is re-created on demand with the device of re-initialized context
+        {
+            std::scoped_lock lock_guard(m_staging_ring_buffer_mutex);
+            m_staging_ring_buffer_ptr.reset();
+        }
+
         ContextBaseT::Release();
     }
 
@@ -125,6 +133,21 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    StagingRingBuffer& GetVulkanStagingRingBuffer() const final
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_staging_ring_buffer_mutex);
+        if (!m_staging_ring_buffer_ptr)
+        {
+            m_staging_ring_buffer_ptr = std::make_unique<StagingRingBuffer>(GetVulkanDevice(), StagingRingBuffer::default_size);
+        }
+        return *m_staging_ring_buffer_ptr;
+    }
+
+private:
+    mutable UniquePtr<StagingRingBuffer>      m_staging_ring_buffer_ptr;
+    mutable TracyLockable(std::mutex,         m_staging_ring_buffer_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -24,12 +24,16 @@ Vulkan descriptor manager with descriptor sets allocator.
 #pragma once
 
 #include <Methane/Graphics/Base/DescriptorManager.h>
+#include <Methane/Data/PoolSizeEstimator.hpp>
+#include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
 #include <map>
+#include <atomic>
 #include <optional>
 #include <mutex>
+#include <thread>
 
 namespace Methane::Graphics::Rhi
 {
@@ -54,7 +58,8 @@ class DescriptorManager final
     : public Base::DescriptorManager
 {
 public:
-    using PoolSizeRatioByDescType = std::map<vk::DescriptorType, float>;
+    using PoolSizeEstimator       = Data::PoolSizeEstimator<vk::DescriptorType>;
+    using PoolSizeRatioByDescType = PoolSizeEstimator::SizeRatioByType;
 
     DescriptorManager(Base::Context& context, uint32_t pool_sets_count = 1000U,
                         const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type = {
@@ -75,21 +80,34 @@ public:
     void Release() override;
 
     void SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio);
+
+    // Descriptor set layouts of created programs are used to learn descriptor pool sizes for the actual descriptor types usage
+    void AddDescriptorSetLayout(const std::vector<vk::DescriptorSetLayoutBinding>& layout_bindings);
+
+    // Descriptor sets are allocated from the pools chain of the calling thread without locking
     vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout);
 
 private:
+    struct PoolsChain
+    {
+        vk::DescriptorPool              current_pool;
+        std::vector<vk::DescriptorPool> used_pools;
+    };
+
+    vk::DescriptorSet  AllocDescriptorSetFromChain(PoolsChain& pools_chain, vk::DescriptorSetLayout layout);
     vk::DescriptorPool CreateDescriptorPool();
-    vk::DescriptorPool AcquireDescriptorPool();
+    vk::DescriptorPool AcquireDescriptorPool(PoolsChain& pools_chain);
+    void               ResetPoolsChain(PoolsChain& pools_chain);
+    PoolsChain&        GetThreadPoolsChain();
     const IContext&    GetContextVk();
 
-    const IContext*                       m_vk_context_ptr = nullptr;
-    uint32_t                              m_pool_sets_count;
-    PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
-    std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
-    std::vector<vk::DescriptorPool>       m_vk_used_pools;
-    std::vector<vk::DescriptorPool>       m_vk_free_pools;
-    vk::DescriptorPool                    m_vk_current_pool;
-    TracyLockable(std::mutex,             m_descriptor_pool_mutex);
+    std::atomic<const IContext*>                     m_vk_context_ptr{ nullptr };
+    const uint64_t                                   m_instance_id;
+    PoolSizeEstimator                                m_pool_size_estimator;
+    std::map<std::thread::id, UniquePtr<PoolsChain>> m_thread_pools_chains;
+    std::vector<vk::UniqueDescriptorPool>            m_vk_descriptor_pools;
+    std::vector<vk::DescriptorPool>                  m_vk_free_pools;
+    TracyLockable(std::mutex,                        m_descriptor_pool_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
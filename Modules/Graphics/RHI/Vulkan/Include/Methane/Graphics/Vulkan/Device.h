@@ -23,6 +23,9 @@ Vulkan implementation of the device interface.
 
 #pragma once
 
+#include "MemoryAllocator.h"
+#include "PipelineCache.h"
+
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -87,6 +90,7 @@ public:
     // IDevice interface
     [[nodiscard]] Ptr<Rhi::IRenderContext> CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings) override;
     [[nodiscard]] Ptr<Rhi::IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const Rhi::ComputeContextSettings& settings) override;
+    [[nodiscard]] MemoryStatistics GetMemoryStatistics() const override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
@@ -101,6 +105,8 @@ public:
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
     bool                             IsExtensionSupported(std::string_view required_extension) const;
     bool                             IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    MemoryAllocator&                 GetMemoryAllocator() const noexcept      { return *m_memory_allocator_ptr; }
+    const vk::PipelineCache&         GetNativePipelineCache() const noexcept  { return m_pipeline_cache_ptr->GetNativePipelineCache(); }
 
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
@@ -117,6 +123,8 @@ private:
     const bool                             m_is_dynamic_state_supported = false;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
+    UniquePtr<MemoryAllocator>             m_memory_allocator_ptr; // released before the device
+    UniquePtr<PipelineCache>               m_pipeline_cache_ptr;   // saved to file and released before the device
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
 };
 
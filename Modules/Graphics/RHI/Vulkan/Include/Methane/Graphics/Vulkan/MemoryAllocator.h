@@ -0,0 +1,160 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.h
+Vulkan device memory allocator, which sub-allocates resource memory from large
+memory blocks with buddy allocation or allocates dedicated memory for big resources.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IDevice.h>
+#include <Methane/Data/Types.h>
+#include <Methane/Data/BuddyAllocator.hpp>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Vulkan
+{
+
+// Buffers and optimal tiling images are placed in separate memory blocks to respect buffer-image granularity
+enum class MemoryResourceType : uint32_t
+{
+    Buffer,
+    Image
+};
+
+class MemoryAllocator;
+
+class MemoryBlock // NOSONAR - custom destructor is required
+{
+public:
+    MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, vk::DeviceSize size, uint32_t min_order, bool is_host_visible);
+    ~MemoryBlock();
+
+    MemoryBlock(const MemoryBlock&) = delete;
+    MemoryBlock(MemoryBlock&&) = delete;
+
+    MemoryBlock& operator=(const MemoryBlock&) = delete;
+    MemoryBlock& operator=(MemoryBlock&&) = delete;
+
+    [[nodiscard]] Opt<vk::DeviceSize>     Allocate(uint32_t order);
+    void                                  Free(vk::DeviceSize offset, uint32_t order);
+
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_memory; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept               { return m_buddy_allocator.GetSize(); }
+    [[nodiscard]] Data::RawPtr            GetMappedDataPtr() const noexcept      { return m_mapped_data_ptr; }
+    [[nodiscard]] bool                    IsEmpty() const noexcept               { return m_buddy_allocator.IsEmpty(); }
+
+private:
+    const vk::Device                     m_vk_device;
+    Data::BuddyAllocator<vk::DeviceSize> m_buddy_allocator;
+    vk::DeviceMemory                     m_vk_memory;
+    Data::RawPtr                         m_mapped_data_ptr = nullptr;
+};
+
+class MemoryAllocation // NOSONAR - custom destructor and move semantics are required
+{
+    friend class MemoryAllocator;
+
+public:
+    MemoryAllocation() = default;
+    ~MemoryAllocation();
+
+    MemoryAllocation(const MemoryAllocation&) = delete;
+    MemoryAllocation(MemoryAllocation&& other) noexcept;
+
+    MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+    MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+
+    explicit operator bool() const noexcept { return static_cast<bool>(m_vk_memory); }
+
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_memory; }
+    [[nodiscard]] vk::DeviceSize          GetOffset() const noexcept             { return m_offset; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept               { return m_size; }
+    [[nodiscard]] bool                    IsDedicated() const noexcept           { return !m_block_ptr; }
+    [[nodiscard]] bool                    IsMapped() const noexcept              { return m_mapped_data_ptr != nullptr; }
+    [[nodiscard]] Data::RawPtr            GetMappedDataPtr(vk::DeviceSize offset, vk::DeviceSize size) const;
+
+    void Release() noexcept;
+
+private:
+    MemoryAllocation(MemoryAllocator& allocator, uint32_t memory_type_index, MemoryBlock* block_ptr, uint32_t order,
+                     const vk::DeviceMemory& vk_memory, vk::DeviceSize offset, vk::DeviceSize size, Data::RawPtr mapped_data_ptr) noexcept;
+
+    MemoryAllocator* m_allocator_ptr     = nullptr;
+    uint32_t         m_memory_type_index = 0U;
+    MemoryBlock*     m_block_ptr         = nullptr; // null for dedicated allocation
+    uint32_t         m_order             = 0U;
+    vk::DeviceMemory m_vk_memory;
+    vk::DeviceSize   m_offset            = 0U;
+    vk::DeviceSize   m_size              = 0U;
+    Data::RawPtr     m_mapped_data_ptr   = nullptr;
+};
+
+class MemoryAllocator
+{
+    friend class MemoryAllocation;
+
+public:
+    struct Settings
+    {
+        vk::DeviceSize max_block_size      = 64U * 1024U * 1024U;
+        vk::DeviceSize min_allocation_size = 256U;
+        uint32_t       heap_block_fraction = 8U; // block size is limited by the fraction of heap size for small heaps
+    };
+
+    MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings);
+    MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device);
+
+    // Allocations of big size or with dedicated flag (used for render targets) get their own device memory
+    [[nodiscard]] MemoryAllocation Allocate(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index,
+                                            MemoryResourceType resource_type, bool is_dedicated = false);
+
+    [[nodiscard]] Rhi::DeviceMemoryStatistics GetStatistics() const;
+    [[nodiscard]] const Settings&             GetSettings() const noexcept { return m_settings; }
+
+private:
+    struct MemoryPool
+    {
+        vk::DeviceSize          block_size = 0U;
+        UniquePtrs<MemoryBlock> blocks;
+    };
+
+    [[nodiscard]] MemoryAllocation AllocateDedicated(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index);
+    [[nodiscard]] MemoryPool& GetMemoryPool(uint32_t memory_type_index, MemoryResourceType resource_type);
+    [[nodiscard]] bool IsHostVisible(uint32_t memory_type_index) const noexcept;
+    [[nodiscard]] Rhi::DeviceMemoryHeapStatistics& GetHeapStatistics(uint32_t memory_type_index);
+
+    void Free(const MemoryAllocation& allocation) noexcept;
+
+    const Settings                     m_settings;
+    const vk::Device                   m_vk_device;
+    vk::PhysicalDeviceMemoryProperties m_vk_memory_properties;
+    std::vector<MemoryPool>            m_memory_pools; // indexed with (memory_type_index * 2 + resource_type)
+    Rhi::DeviceMemoryStatistics        m_heap_statistics;
+    mutable TracyLockable(std::mutex,  m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
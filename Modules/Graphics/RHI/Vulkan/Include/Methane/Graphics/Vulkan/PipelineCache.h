@@ -0,0 +1,69 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.h
+Vulkan device-level pipeline cache, which is loaded from the user cache directory
+on device creation and saved back on device destruction.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <string>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class PipelineCache // NOSONAR - custom destructor is required
+{
+public:
+    // Returns pipeline cache file path unique for the running executable in the user cache directory
+    [[nodiscard]] static std::string GetDefaultFilePath();
+
+    // Validates pipeline cache header version, vendor, device and pipeline cache UUID against physical device properties
+    [[nodiscard]] static bool IsCacheDataCompatible(const Data::Bytes& cache_data, const vk::PhysicalDeviceProperties& vk_device_props) noexcept;
+
+    PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, std::string file_path);
+    PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device);
+    ~PipelineCache();
+
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache(PipelineCache&&) = delete;
+
+    PipelineCache& operator=(const PipelineCache&) = delete;
+    PipelineCache& operator=(PipelineCache&&) = delete;
+
+    bool Save() const noexcept;
+
+    [[nodiscard]] const vk::PipelineCache& GetNativePipelineCache() const noexcept { return m_vk_unique_pipeline_cache.get(); }
+    [[nodiscard]] const std::string&       GetFilePath() const noexcept            { return m_file_path; }
+    [[nodiscard]] bool                     IsLoadedFromFile() const noexcept       { return m_is_loaded_from_file; }
+
+private:
+    [[nodiscard]] Data::Bytes LoadCacheData(const vk::PhysicalDevice& vk_physical_device) const;
+
+    const std::string       m_file_path;
+    bool                    m_is_loaded_from_file = false;
+    vk::UniquePipelineCache m_vk_unique_pipeline_cache;
+};
+
+} // namespace Methane::Graphics::Vulkan
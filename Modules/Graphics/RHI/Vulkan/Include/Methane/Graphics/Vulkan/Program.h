@@ -54,6 +54,15 @@ public:
         std::vector<vk::DescriptorSetLayoutBinding> bindings;
         std::vector<Argument>                       arguments;                    // related arguments for each layout binding
         std::vector<ByteCodeMaps>                   byte_code_maps_for_arguments; // related bytecode maps for each binding/argument
+        std::vector<uint32_t>                       descriptor_offsets;           // first descriptor index in update template data for each binding
+    };
+
+    // Descriptor of any type in the data of descriptor update template, so that all descriptors have the same stride
+    union DescriptorUpdateTemplateData
+    {
+        VkDescriptorImageInfo  image_info;
+        VkDescriptorBufferInfo buffer_info;
+        VkBufferView           buffer_view;
     };
 
     Program(const Base::Context& context, const Settings& settings);
@@ -72,6 +81,7 @@ public:
     const std::vector<vk::DescriptorSetLayout>& GetNativeDescriptorSetLayouts() const;
     const vk::DescriptorSetLayout& GetNativeDescriptorSetLayout(ArgumentAccessor::Type argument_access_type) const;
     const DescriptorSetLayoutInfo& GetDescriptorSetLayoutInfo(ArgumentAccessor::Type argument_access_type) const;
+    const vk::DescriptorUpdateTemplate& GetNativeDescriptorUpdateTemplate(ArgumentAccessor::Type argument_access_type) const;
     const vk::PipelineLayout& GetNativePipelineLayout() const;
     const vk::PipelineLayout& AcquireNativePipelineLayout();
     const vk::DescriptorSet& AcquireConstantDescriptorSet();
@@ -79,8 +89,10 @@ public:
 
 private:
     using DescriptorSetLayoutInfoByAccessType = std::array<DescriptorSetLayoutInfo, magic_enum::enum_count<ArgumentAccessor::Type>()>;
+    using DescriptorUpdateTemplateByAccessType = std::array<vk::UniqueDescriptorUpdateTemplate, magic_enum::enum_count<ArgumentAccessor::Type>()>;
 
     void InitializeDescriptorSetLayouts();
+    void InitializeDescriptorUpdateTemplates();
     void UpdatePipelineName();
     void UpdateDescriptorSetLayoutNames() const;
     void UpdateConstantDescriptorSetName();
@@ -90,6 +102,7 @@ private:
     DescriptorSetLayoutInfoByAccessType        m_descriptor_set_layout_info_by_access_type;
     std::vector<vk::UniqueDescriptorSetLayout> m_vk_unique_descriptor_set_layouts;
     std::vector<vk::DescriptorSetLayout>       m_vk_descriptor_set_layouts;
+    DescriptorUpdateTemplateByAccessType       m_vk_unique_descriptor_update_templates;
     vk::UniquePipelineLayout                   m_vk_unique_pipeline_layout;
     std::optional<vk::DescriptorSet>           m_vk_constant_descriptor_set_opt;
     std::vector<vk::DescriptorSet>             m_vk_frame_constant_descriptor_sets;
@@ -64,23 +64,34 @@ public:
     void SetDescriptorSet(const vk::DescriptorSet& descriptor_set) noexcept;
 
     // Base::ProgramArgumentBinding interface
-    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
+    [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy(const Allocator& allocator) const override;
     void MergeSettings(const Base::ProgramArgumentBinding& other) override;
 
     // IArgumentBinding interface
     const Settings& GetSettings() const noexcept override { return m_settings_vk; }
     bool SetResourceViews(const Rhi::IResource::Views& resource_views) override;
 
-    void UpdateDescriptorSetsOnGpu();
+    // Descriptors of resource views written to the descriptor set of argument binding
+    struct Descriptors
+    {
+        std::vector<vk::DescriptorImageInfo>  images;
+        std::vector<vk::DescriptorBufferInfo> buffers;
+        std::vector<vk::BufferView>           buffer_views;
+
+        [[nodiscard]] size_t GetCount() const noexcept { return images.size() + buffers.size() + buffer_views.size(); }
+    };
+
+    // Resource views are set without updating descriptors on GPU, which is done by program bindings in a batch with other arguments
+    bool SetResourceViewsWithoutUpdate(const Rhi::IResource::Views& resource_views) { return Base::ProgramArgumentBinding::SetResourceViews(resource_views); }
+
+    [[nodiscard]] Descriptors GetDescriptors(const Rhi::IResource::Views& resource_views) const;
+    [[nodiscard]] vk::WriteDescriptorSet GetDescriptorWrite(const Descriptors& descriptors) const;
+    [[nodiscard]] uint32_t GetBindingValue() const noexcept { return m_vk_binding_value; }
 
 private:
-    Settings                              m_settings_vk;
-    const vk::DescriptorSet*              m_vk_descriptor_set_ptr = nullptr;
-    uint32_t                              m_vk_binding_value      = 0U;
-    vk::WriteDescriptorSet                m_vk_write_descriptor_set;
-    std::vector<vk::DescriptorImageInfo>  m_vk_descriptor_images;
-    std::vector<vk::DescriptorBufferInfo> m_vk_descriptor_buffers;
-    std::vector<vk::BufferView>           m_vk_buffer_views;
+    Settings                 m_settings_vk;
+    const vk::DescriptorSet* m_vk_descriptor_set_ptr = nullptr;
+    uint32_t                 m_vk_binding_value      = 0U;
 };
 
 } // namespace Methane::Graphics::Vulkan
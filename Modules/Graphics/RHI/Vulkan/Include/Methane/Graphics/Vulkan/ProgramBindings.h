@@ -56,14 +56,32 @@ public:
     // Base::ProgramBindings interface
     void CompleteInitialization() override;
 
-    void Apply(ICommandList& command_list, const Rhi::ICommandQueue& command_queue,
+    void Apply(Base::CommandList& command_list, ICommandList& command_list_vk, const Rhi::ICommandQueue& command_queue,
                const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const;
 
+protected:
+    // Base::ProgramBindings overrides
+    bool SetArgumentResourceViews(IArgumentBinding& argument_binding, const Rhi::IResource::Views& resource_views) override;
+
+    // IProgramBindings::IProgramArgumentBindingCallback
+    void OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                      const Rhi::IResource::Views& old_resource_views,
+                                                      const Rhi::IResource::Views& new_resource_views) override;
+
 private:
+    struct PendingDescriptorWrite
+    {
+        const ArgumentBinding*       argument_binding_ptr;
+        ArgumentBinding::Descriptors descriptors;
+    };
+
     // IObjectCallback interface
     void OnObjectNameChanged(Rhi::IObject&, const std::string&) override; // IProgram name changed
 
     void SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument);
+    void AddPendingDescriptorWrite(const ArgumentBinding& argument_binding, ArgumentBinding::Descriptors&& descriptors);
+    const PendingDescriptorWrite* FindPendingDescriptorWrite(const ArgumentBinding& argument_binding) const;
+    void UpdateDescriptorSetsOnGpu();
 
     template<typename FuncType> // function void(const IProgram::Argument&, ArgumentBinding&)
     void ForEachArgumentBinding(FuncType argument_binding_function) const;
@@ -74,6 +92,8 @@ private:
     bool                                m_has_mutable_descriptor_set = false; // if true, then m_descriptor_sets.back() is mutable descriptor set
     std::vector<uint32_t>               m_dynamic_offsets; // dynamic buffer offsets for all descriptor sets from the bound ResourceView::Settings::offset
     std::vector<uint32_t>               m_dynamic_offset_index_by_set_index; // beginning index in dynamic buffer offsets corresponding to the particular descriptor set or access type
+    std::vector<PendingDescriptorWrite> m_pending_descriptor_writes; // kept per program bindings, since constant argument bindings are shared between copies
+    bool                                m_is_setting_resources = false; // descriptor writes are added in batch by SetArgumentResourceViews
 };
 
 } // namespace Methane::Graphics::Vulkan
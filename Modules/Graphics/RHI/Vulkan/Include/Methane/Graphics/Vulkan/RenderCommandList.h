@@ -31,6 +31,8 @@ Vulkan implementation of the render command list interface.
 
 #include <vulkan/vulkan.hpp>
 
+#include <vector>
+
 namespace Methane::Graphics::Vulkan
 {
 
@@ -46,6 +48,7 @@ class RenderCommandList final // NOSONAR - inheritance hierarchy is greater than
 public:
     explicit RenderCommandList(CommandQueue& command_queue);
     RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass);
+    RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle);
     explicit RenderCommandList(ParallelRenderCommandList& parallel_render_command_list, bool is_beginning_cmd_list);
 
     // ICommandList interface
@@ -60,6 +63,7 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void ExecuteBundle(Rhi::IRenderCommandList& bundle) override;
 
     bool IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
 
@@ -72,6 +76,9 @@ private:
     RenderPass& GetVulkanPass();
 
     const bool m_is_dynamic_state_supported;
+
+    // Render pass secondary command buffers split by executed bundles, which are executed in order on commit
+    std::vector<vk::CommandBuffer> m_vk_render_pass_command_buffers;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -31,6 +31,7 @@ Vulkan implementation of the render state interface.
 #include <vulkan/vulkan.hpp>
 
 #include <map>
+#include <set>
 #include <mutex>
 
 namespace Methane::Graphics::Rhi
@@ -59,35 +60,46 @@ public:
     static vk::PrimitiveTopology GetVulkanPrimitiveTopology(Rhi::RenderPrimitive primitive_type);
 
     RenderState(const Base::RenderContext& context, const Settings& settings);
-    
+    ~RenderState() override;
+
+    RenderState(const RenderState&) = delete;
+    RenderState(RenderState&&) = delete;
+
+    RenderState& operator=(const RenderState&) = delete;
+    RenderState& operator=(RenderState&&) = delete;
+
     // IRenderState interface
     void Reset(const Settings& settings) override;
 
     // Base::RenderState interface
-    void Apply(Base::RenderCommandList& render_command_list, Groups state_groups) override;
+    bool Apply(Base::RenderCommandList& render_command_list, Groups state_groups) override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
 
-    bool                IsNativePipelineDynamic() const noexcept  { return !Base::RenderState::IsDeferred(); }
-    const vk::Pipeline& GetNativePipelineDynamic() const;
-    const vk::Pipeline& GetNativePipelineMonolithic(ViewState& viewState, Rhi::RenderPrimitive renderPrimitive);
-    const vk::Pipeline& GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
+    // Native pipeline getters return null pipeline handle, while it is being compiled asynchronously
+    bool         IsNativePipelineDynamic() const noexcept  { return !Base::RenderState::IsDeferred(); }
+    vk::Pipeline GetNativePipelineDynamic() const;
+    vk::Pipeline GetNativePipelineMonolithic(ViewState& viewState, Rhi::RenderPrimitive renderPrimitive);
+    vk::Pipeline GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
 
 private:
+    using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
+    using MonolithicPipelineById = std::map<PipelineId, vk::UniquePipeline>;
+    using PipelineIds = std::set<PipelineId>;
+
     vk::UniquePipeline CreateNativePipeline(const ViewState* viewState = nullptr, Opt<Rhi::RenderPrimitive> renderPrimitive = {}) const;
+    void CompileNativePipelineMonolithic(const PipelineId& pipeline_id);
 
     // IViewStateCallback overrides
     void OnViewStateChanged(Rhi::IViewState& view_state) override;
     void OnViewStateDestroyed(Rhi::IViewState& view_state) override;
 
-    using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
-    using MonolithicPipelineById = std::map<PipelineId, vk::UniquePipeline>;
-
     const RenderContext&      m_vk_render_context;
     vk::UniquePipeline        m_vk_pipeline_dynamic;
     MonolithicPipelineById    m_vk_pipeline_monolithic_by_id;
-    TracyLockable(std::mutex, m_mutex);
+    PipelineIds               m_vk_pipeline_monolithic_compiling_ids;
+    mutable TracyLockable(std::mutex, m_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -26,19 +26,26 @@ Vulkan implementation of the resource interface.
 #include "IResource.h"
 #include "IContext.h"
 #include "Device.h"
+#include "MemoryAllocator.h"
+#include "StagingRingBuffer.h"
 #include "TransferCommandList.h"
 #include "Utils.hpp"
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/Base/ReadBackRequest.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Data/EnumMaskUtil.hpp>
+#include <Methane/Data/Receiver.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
 #include <fmt/format.h>
 
 #include <type_traits>
+#include <array>
+#include <atomic>
 #include <cassert>
 
 namespace Methane::Graphics::Vulkan
@@ -73,6 +80,8 @@ public:
         META_FUNCTION_TASK();
         m_upload_begin_transition_barriers_ptr.reset();
         m_upload_end_transition_barriers_ptr.reset();
+        m_read_back_begin_transition_barriers_ptr.reset();
+        m_read_back_end_transition_barriers_ptr.reset();
 
         try
         {
@@ -144,7 +153,7 @@ public:
 
     const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept final
     {
-        return m_vk_unique_device_memory.get();
+        return m_memory_allocation.GetNativeDeviceMemory();
     }
 
     const vk::Device& GetNativeDevice() const noexcept final
@@ -176,16 +185,18 @@ public:
     }
 
 protected:
-    vk::UniqueDeviceMemory AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    MemoryAllocation AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                          MemoryResourceType memory_resource_type, bool is_dedicated = false)
     {
         META_FUNCTION_TASK();
-        const Opt<uint32_t> memory_type_opt = GetVulkanContext().GetVulkanDevice().FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
+        const Device& device = GetVulkanContext().GetVulkanDevice();
+        const Opt<uint32_t> memory_type_opt = device.FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
         if (!memory_type_opt)
             throw IResource::AllocationError(*this, "suitable memory type was not found");
 
         try
         {
-            return GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(memory_requirements.size, *memory_type_opt));
+            return device.GetMemoryAllocator().Allocate(memory_requirements, *memory_type_opt, memory_resource_type, is_dedicated);
         }
         catch(const vk::SystemError& error)
         {
@@ -193,11 +204,131 @@ protected:
         }
     }
 
-    void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags, bool is_dedicated = false)
     {
         META_FUNCTION_TASK();
-        m_vk_unique_device_memory.release();
-        m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        constexpr MemoryResourceType memory_resource_type = std::is_same_v<NativeResourceType, vk::Image>
+                                                          ? MemoryResourceType::Image
+                                                          : MemoryResourceType::Buffer;
+        m_memory_allocation = AllocateDeviceMemory(memory_requirements, memory_property_flags, memory_resource_type, is_dedicated);
+    }
+
+    const MemoryAllocation& GetMemoryAllocation() const noexcept { return m_memory_allocation; }
+
+    struct ReadBackBuffer
+    {
+        MemoryAllocation memory_allocation;
+        vk::UniqueBuffer vk_unique_buffer;
+    };
+
+    // Temporary host-visible buffer for reading back resource data, which should be kept alive until read-back commands completion
+    ReadBackBuffer CreateReadBackBuffer(vk::DeviceSize size)
+    {
+        META_FUNCTION_TASK();
+        ReadBackBuffer read_back_buffer;
+        read_back_buffer.vk_unique_buffer = GetNativeDevice().createBufferUnique(
+            vk::BufferCreateInfo(vk::BufferCreateFlags{},
+                                 size,
+                                 vk::BufferUsageFlagBits::eTransferDst,
+                                 vk::SharingMode::eExclusive)
+        );
+
+        const vk::MemoryPropertyFlags vk_read_back_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+        read_back_buffer.memory_allocation = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(read_back_buffer.vk_unique_buffer.get()),
+                                                                  vk_read_back_memory_flags, MemoryResourceType::Buffer);
+        GetNativeDevice().bindBufferMemory(read_back_buffer.vk_unique_buffer.get(), read_back_buffer.memory_allocation.GetNativeDeviceMemory(),
+                                           read_back_buffer.memory_allocation.GetOffset());
+        return read_back_buffer;
+    }
+
+    // Persistently mapped read-back buffers are reused in round-robin order by asynchronous read-back requests,
+    // so that data of the previous request can be read on CPU while commands of the next request are executed on GPU
+    static constexpr uint32_t read_back_buffers_count = 3U;
+
+    const ReadBackBuffer& AcquireReadBackBuffer(vk::DeviceSize size)
+    {
+        META_FUNCTION_TASK();
+        ReadBackSlot& read_back_slot = m_read_back_slots[m_read_back_slot_index];
+        m_read_back_slot_index = (m_read_back_slot_index + 1U) % read_back_buffers_count;
+
+        // Read-back buffer can be reused or destroyed only after execution completion of the previous copy commands writing to it,
+        // which is tracked by the slot even when the previous read-back request was already released
+        read_back_slot.WaitUntilAvailable();
+
+        if (read_back_slot.size < size)
+        {
+            read_back_slot.buffer = CreateReadBackBuffer(size);
+            read_back_slot.size   = size;
+        }
+        return read_back_slot.buffer;
+    }
+
+    // Creates read-back request for the last acquired read-back buffer with data available at the given offset
+    Ptr<Rhi::IReadBackRequest> CreateReadBackRequest(Rhi::ICommandList& cmd_list, vk::DeviceSize data_offset, vk::DeviceSize data_size,
+                                                     const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
+    {
+        META_FUNCTION_TASK();
+        ReadBackSlot& read_back_slot = m_read_back_slots[(m_read_back_slot_index + read_back_buffers_count - 1U) % read_back_buffers_count];
+        const Data::ConstRawPtr data_ptr = read_back_slot.buffer.memory_allocation.GetMappedDataPtr(data_offset, data_size);
+        auto read_back_request_ptr = std::make_shared<Base::ReadBackRequest>(*this, cmd_list,
+            [data_ptr, data_size, sub_resource_index, data_range]()
+            {
+                // Read-back data is not copied from the persistently mapped buffer memory
+                return Rhi::SubResource(data_ptr, static_cast<Data::Size>(data_size), sub_resource_index, data_range);
+            });
+        read_back_slot.SetInUse(cmd_list);
+        return read_back_request_ptr;
+    }
+
+    // Transitions resource to the copy source state in the command list before encoding read-back copy commands
+    const vk::CommandBuffer& BeginReadBackCommands(Rhi::ICommandList& cmd_list)
+    {
+        META_FUNCTION_TASK();
+        if (SetState(State::CopySource, m_read_back_begin_transition_barriers_ptr) &&
+            m_read_back_begin_transition_barriers_ptr && !m_read_back_begin_transition_barriers_ptr->IsEmpty())
+        {
+            cmd_list.SetResourceBarriers(*m_read_back_begin_transition_barriers_ptr);
+        }
+        return dynamic_cast<const ICommandList&>(cmd_list).GetNativeCommandBufferDefault();
+    }
+
+    // Makes read-back data visible to host and transitions resource back to its state before read-back commands
+    void EndReadBackCommands(Rhi::ICommandList& cmd_list, State final_resource_state)
+    {
+        META_FUNCTION_TASK();
+        const vk::CommandBuffer& vk_cmd_buffer = dynamic_cast<const ICommandList&>(cmd_list).GetNativeCommandBufferDefault();
+        const vk::MemoryBarrier vk_host_read_barrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eHostRead);
+        vk_cmd_buffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost,
+                                      vk::DependencyFlags{}, vk_host_read_barrier, {}, {});
+
+        if (SetState(final_resource_state, m_read_back_end_transition_barriers_ptr) &&
+            m_read_back_end_transition_barriers_ptr && !m_read_back_end_transition_barriers_ptr->IsEmpty())
+        {
+            cmd_list.SetResourceBarriers(*m_read_back_end_transition_barriers_ptr);
+        }
+        dynamic_cast<Base::CommandList&>(cmd_list).RetainResource(*this);
+    }
+
+    // Allocates range of the context staging ring buffer for the upload commands encoded in the given command list
+    StagingRingBuffer::Range AllocateStagingRange(TransferCommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment)
+    {
+        META_FUNCTION_TASK();
+        StagingRingBuffer& staging_ring_buffer = GetVulkanContext().GetVulkanStagingRingBuffer();
+        if (const Opt<StagingRingBuffer::Range> staging_range_opt = staging_ring_buffer.Allocate(upload_cmd_list, size, alignment);
+            staging_range_opt)
+            return *staging_range_opt;
+
+        // When staging ring buffer is full, already encoded uploads are executed to reclaim ring space on completion
+        // and the same upload command list is reset for encoding of the remaining upload commands
+        Base::Resource::GetBaseContext().UploadResources();
+        const Rhi::ICommandList& encoding_cmd_list = Base::Resource::GetContext().GetUploadCommandKit().GetListForEncoding();
+        META_CHECK_ARG_TRUE_DESCR(std::addressof(encoding_cmd_list) == static_cast<Rhi::ICommandList*>(&upload_cmd_list),
+                                  "upload command list has changed on staging ring buffer reclaim");
+        upload_cmd_list.RetainResource(*this);
+
+        const Opt<StagingRingBuffer::Range> staging_range_opt = staging_ring_buffer.Allocate(upload_cmd_list, size, alignment);
+        META_CHECK_ARG_TRUE_DESCR(staging_range_opt.has_value(), "failed to allocate staging ring buffer range after uploads completion");
+        return *staging_range_opt;
     }
 
     template<typename T = ResourceStorageType>
@@ -260,13 +391,90 @@ protected:
 private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceView::ViewDescriptorVariant>>;
 
+    // Read-back slot is in use from encoding of the copy commands to its buffer until their command list execution is completed
+    class ReadBackSlot final
+        : private Data::Receiver<Rhi::ICommandListCallback>
+    {
+    public:
+        ReadBackBuffer buffer;
+        vk::DeviceSize size = 0U;
+
+        void SetInUse(Rhi::ICommandList& cmd_list)
+        {
+            META_FUNCTION_TASK();
+            if (const Ptr<Rhi::ICommandList> prev_cmd_list_ptr = m_cmd_list_wptr.lock();
+                prev_cmd_list_ptr && prev_cmd_list_ptr.get() != std::addressof(cmd_list))
+            {
+                prev_cmd_list_ptr->Disconnect(*this);
+            }
+            m_cmd_list_wptr = cmd_list.GetDerivedPtr<Rhi::ICommandList>();
+            m_is_executing  = false;
+            m_is_in_use     = true;
+            cmd_list.Connect(*this);
+        }
+
+        void WaitUntilAvailable()
+        {
+            META_FUNCTION_TASK();
+            if (!m_is_in_use)
+                return;
+
+            // Released command list is not executed anymore, so its copy commands can not write to the buffer
+            const Ptr<Rhi::ICommandList> cmd_list_ptr = m_cmd_list_wptr.lock();
+            if (!cmd_list_ptr)
+            {
+                m_is_in_use = false;
+                return;
+            }
+
+            META_CHECK_ARG_TRUE_DESCR(m_is_executing.load(),
+                                      "read-back buffer is used by command list '{}' which was not executed yet",
+                                      cmd_list_ptr->GetName());
+            while (m_is_in_use && cmd_list_ptr->GetState() == Rhi::CommandListState::Executing)
+            {
+                cmd_list_ptr->WaitUntilCompleted();
+            }
+            m_is_executing = false;
+            m_is_in_use    = false;
+        }
+
+    private:
+        // ICommandListCallback overrides
+        void OnCommandListStateChanged(Rhi::ICommandList& cmd_list) override
+        {
+            META_FUNCTION_TASK();
+            if (!m_is_in_use)
+                return;
+
+            if (cmd_list.GetState() == Rhi::CommandListState::Executing)
+            {
+                m_is_executing = true;
+            }
+            else if (cmd_list.GetState() == Rhi::CommandListState::Pending && m_is_executing)
+            {
+                m_is_executing = false;
+                m_is_in_use    = false;
+            }
+        }
+
+        WeakPtr<Rhi::ICommandList> m_cmd_list_wptr;
+        std::atomic<bool>          m_is_executing{ false };
+        std::atomic<bool>          m_is_in_use{ false };
+    };
+
+    using ReadBackSlots = std::array<ReadBackSlot, read_back_buffers_count>;
+
     vk::Device                   m_vk_device;
-    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    MemoryAllocation             m_memory_allocation;
     ResourceStorageType          m_vk_resource;
     ViewDescriptorByViewId       m_view_descriptor_by_view_id;
     Opt<uint32_t>                m_owner_queue_family_index_opt;
     Ptr<Rhi::IResourceBarriers>  m_upload_begin_transition_barriers_ptr;
     Ptr<Rhi::IResourceBarriers>  m_upload_end_transition_barriers_ptr;
+    Ptr<Rhi::IResourceBarriers>  m_read_back_begin_transition_barriers_ptr;
+    Ptr<Rhi::IResourceBarriers>  m_read_back_end_transition_barriers_ptr;
+    ReadBackSlots                m_read_back_slots;
+    uint32_t                     m_read_back_slot_index = 0U;
 };
 
 } // namespace Methane::Graphics::Vulkan
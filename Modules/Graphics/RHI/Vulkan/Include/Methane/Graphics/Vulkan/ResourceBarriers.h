@@ -56,6 +56,9 @@ public:
     AddResult Add(const Barrier::Id& id, const Barrier& barrier) override;
     bool Remove(const Barrier::Id& id) override;
 
+    // Base::ResourceBarriers overrides
+    void Clear() override;
+
     const NativePipelineBarrier& GetNativePipelineBarrierData(const CommandQueue& target_cmd_queue) const;
 
 private:
@@ -68,11 +71,11 @@ private:
 
     void AddBufferMemoryStateChangeBarrier(const Buffer& buffer, const Barrier::StateChange& state_change);
     void AddBufferMemoryOwnerChangeBarrier(const Buffer& buffer, const Barrier::OwnerChange& owner_change);
-    void AddImageMemoryStateChangeBarrier(const Texture& texture, const Barrier::StateChange& state_change);
-    void AddImageMemoryOwnerChangeBarrier(const Texture& texture, const Barrier::OwnerChange& owner_change);
+    void AddImageMemoryStateChangeBarrier(const Texture& texture, const vk::ImageSubresourceRange& vk_subresource_range, const Barrier::StateChange& state_change);
+    void AddImageMemoryOwnerChangeBarrier(const Texture& texture, const vk::ImageSubresourceRange& vk_subresource_range, const Barrier::OwnerChange& owner_change);
 
     void RemoveBufferMemoryBarrier(const vk::Buffer& vk_buffer, Barrier::Type barrier_type);
-    void RemoveImageMemoryBarrier(const vk::Image& vk_image, Barrier::Type barrier_type);
+    void RemoveImageMemoryBarrier(const vk::Image& vk_image, const vk::ImageSubresourceRange& vk_subresource_range, Barrier::Type barrier_type);
 
     void UpdateStageMasks();
     void UpdateStageMasks(const Barrier& barrier);
@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRingBuffer.h
+Vulkan context-wide persistently mapped staging ring buffer used for resource uploads.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MemoryAllocator.h"
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <deque>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+class StagingRingBuffer final // NOSONAR - custom destructor is required
+    : private Data::Receiver<Rhi::ICommandListCallback>
+{
+public:
+    struct Range
+    {
+        vk::Buffer     vk_buffer;
+        vk::DeviceSize offset   = 0U;
+        vk::DeviceSize size     = 0U;
+        Data::RawPtr   data_ptr = nullptr;
+    };
+
+    static constexpr vk::DeviceSize default_size = 32U * 1024U * 1024U;
+
+    StagingRingBuffer(const Device& device, vk::DeviceSize size);
+    ~StagingRingBuffer() override;
+
+    StagingRingBuffer(const StagingRingBuffer&) = delete;
+    StagingRingBuffer(StagingRingBuffer&&) = delete;
+
+    StagingRingBuffer& operator=(const StagingRingBuffer&) = delete;
+    StagingRingBuffer& operator=(StagingRingBuffer&&) = delete;
+
+    // Allocated range is reclaimed when upload command list, which copies data from it, completes execution;
+    // empty result is returned when ring has no free space until pending uploads are completed
+    [[nodiscard]] Opt<Range> Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment);
+
+    [[nodiscard]] vk::DeviceSize    GetSize() const noexcept          { return m_size; }
+    [[nodiscard]] vk::DeviceSize    GetMaxChunkSize() const noexcept  { return m_size / 2U; }
+    [[nodiscard]] const vk::Buffer& GetNativeBuffer() const noexcept  { return m_vk_unique_buffer.get(); }
+
+private:
+    struct PendingRange
+    {
+        vk::DeviceSize           begin;
+        vk::DeviceSize           end;
+        const Rhi::ICommandList* cmd_list_ptr;
+        bool                     is_released;
+    };
+
+    // ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& command_list) override;
+
+    [[nodiscard]] Opt<vk::DeviceSize> AllocateOffset(vk::DeviceSize size, vk::DeviceSize alignment) const noexcept;
+
+    const vk::DeviceSize     m_size;
+    MemoryAllocation         m_memory_allocation;
+    vk::UniqueBuffer         m_vk_unique_buffer;
+    std::deque<PendingRange> m_pending_ranges;
+    vk::DeviceSize           m_head = 0U; // offset of the next allocation
+    vk::DeviceSize           m_tail = 0U; // offset of the oldest pending range
+    TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -54,9 +54,9 @@ public:
     SubResource GetData(Rhi::ICommandQueue& target_cmd_queue,
                         const SubResource::Index& sub_resource_index = {},
                         const BytesRangeOpt& data_range = {}) override;
-
-    // IObject overide
-    bool SetName(std::string_view name) override;
+    Ptr<Rhi::IReadBackRequest> RequestReadBack(Rhi::ICommandList& cmd_list,
+                                               const SubResource::Index& sub_resource_index = {},
+                                               const BytesRangeOpt& data_range = {}) override;
 
     // ITexture overrides
     const vk::Image& GetNativeImage() const noexcept { return GetNativeResource(); }
@@ -74,10 +74,7 @@ private:
 
     void GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state);
 
-    vk::UniqueImage                  m_vk_unique_image;
-    vk::UniqueBuffer                 m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
-    std::vector<vk::BufferImageCopy> m_vk_copy_regions;
+    vk::UniqueImage m_vk_unique_image;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -29,10 +29,13 @@ Vulkan implementation of the buffer interface.
 #include <Methane/Instrumentation.h>
 
 #include <iterator>
+#include <algorithm>
 
 namespace Methane::Graphics::Vulkan
 {
 
+static constexpr vk::DeviceSize g_staging_data_alignment = 16U;
+
 static vk::BufferUsageFlags GetVulkanBufferUsageFlags(Rhi::BufferType buffer_type, Rhi::BufferStorageMode storage_mode)
 {
     META_FUNCTION_TASK();
@@ -78,26 +81,12 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 {
     META_FUNCTION_TASK();
     const bool is_private_storage = settings.storage_mode == Rhi::BufferStorageMode::Private;
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_staging_memory_flags;
+    const vk::MemoryPropertyFlags vk_shared_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_shared_memory_flags;
 
-    // Allocate resource primary memory
+    // Allocate resource primary memory, private buffer data is uploaded through the context staging ring buffer
     AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
-    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    if (!is_private_storage)
-        return;
-
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-            settings.size,
-            vk::BufferUsageFlagBits::eTransferSrc,
-            vk::SharingMode::eExclusive)
-    );
-
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResource& sub_resource)
@@ -106,31 +95,28 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
     Base::Buffer::SetData(target_cmd_queue, sub_resource);
 
     const Settings& buffer_settings = GetSettings();
-    const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
-
-    const vk::DeviceSize sub_resource_offset = 0U;
-    Data::RawPtr sub_resource_data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    if (is_private_storage)
+    if (buffer_settings.storage_mode != Rhi::IBuffer::StorageMode::Private)
     {
-        m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
-    }
-
-    if (!is_private_storage)
+        // Host visible memory is persistently mapped by memory allocator
+        Data::RawPtr sub_resource_data_ptr = GetMemoryAllocation().GetMappedDataPtr(0U, sub_resource.GetDataSize());
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
         return;
+    }
 
-    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
+    // In case of private GPU storage, copy buffer data to the device-local GPU resource through the context staging ring buffer,
+    // large buffer data is split into chunks, so that ring space can be reclaimed between them
     TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), 1U, &m_vk_copy_region);
+    const vk::DeviceSize max_chunk_size = GetVulkanContext().GetVulkanStagingRingBuffer().GetMaxChunkSize();
+    const vk::DeviceSize data_size      = sub_resource.GetDataSize();
+    for(vk::DeviceSize chunk_offset = 0U; chunk_offset < data_size; chunk_offset += max_chunk_size)
+    {
+        const vk::DeviceSize chunk_size = std::min(max_chunk_size, data_size - chunk_offset);
+        const StagingRingBuffer::Range staging_range = AllocateStagingRange(upload_cmd_list, chunk_size, g_staging_data_alignment);
+        std::copy(sub_resource.GetDataPtr() + chunk_offset, sub_resource.GetDataPtr() + chunk_offset + chunk_size, staging_range.data_ptr);
+
+        const vk::BufferCopy vk_copy_region(staging_range.offset, chunk_offset, chunk_size);
+        upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(staging_range.vk_buffer, GetNativeResource(), 1U, &vk_copy_region);
+    }
     CompleteResourceTransfer(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
     GetContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
 }
@@ -155,59 +141,56 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue& target_cmd_queue, const Byt
     return Rhi::SubResource(std::move(data), Rhi::SubResourceIndex(), data_range);
 }
 
-Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
+Ptr<Rhi::IReadBackRequest> Buffer::RequestReadBack(Rhi::ICommandList& cmd_list, const BytesRangeOpt& data_range)
 {
     META_FUNCTION_TASK();
-    Data::RawPtr data_ptr = nullptr;
-    const vk::DeviceMemory& vk_device_memory = GetNativeDeviceMemory();
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, data_range.GetStart(), data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
+    if (GetSettings().storage_mode != IBuffer::StorageMode::Private)
+        return Base::Buffer::RequestReadBack(cmd_list, data_range);
 
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(vk_device_memory);
+    const BytesRange buffer_data_range(data_range ? data_range->GetStart() : 0U,
+                                       data_range ? data_range->GetEnd()   : GetDataSize());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(buffer_data_range.GetEnd(), GetDataSize(), "read-back data range is out of buffer bounds");
+
+    // Buffer data range is copied to the next persistently mapped read-back buffer in the given command list,
+    // so read-back does not require separate commands execution and CPU-GPU synchronization
+    const ReadBackBuffer& read_back_buffer = AcquireReadBackBuffer(GetDataSize());
+    Ptr<Rhi::IReadBackRequest> read_back_request_ptr = CreateReadBackRequest(cmd_list, 0U, buffer_data_range.GetLength(), {}, data_range);
 
-    return data;
+    const State initial_buffer_state = GetState();
+    const vk::CommandBuffer& vk_cmd_buffer = BeginReadBackCommands(cmd_list);
+    const vk::BufferCopy vk_buffer_copy(buffer_data_range.GetStart(), 0U, buffer_data_range.GetLength());
+    vk_cmd_buffer.copyBuffer(GetNativeResource(), read_back_buffer.vk_unique_buffer.get(), 1U, &vk_buffer_copy);
+    EndReadBackCommands(cmd_list, initial_buffer_state);
+
+    return read_back_request_ptr;
+}
+
+Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
+{
+    META_FUNCTION_TASK();
+    const Data::RawPtr data_ptr = GetMemoryAllocation().GetMappedDataPtr(data_range.GetStart(), data_range.GetLength());
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue)
 {
     META_FUNCTION_TASK();
     const State       initial_buffer_state = GetState();
+    const ReadBackBuffer  read_back_buffer = CreateReadBackBuffer(data_range.GetLength());
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), 0U, data_range.GetLength());
-    vk_cmd_buffer.copyBuffer(GetNativeResource(), m_vk_unique_staging_buffer.get(), 1U, &vk_buffer_copy);
+    vk_cmd_buffer.copyBuffer(GetNativeResource(), read_back_buffer.vk_unique_buffer.get(), 1U, &vk_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_buffer_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Copy buffer data from mapped staging resource
-    Data::RawPtr data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(m_vk_unique_staging_memory.get(), 0U, data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(m_vk_unique_staging_memory.get());
-
-    return data;
-}
-
-bool Buffer::SetName(std::string_view name)
-{
-    META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
-
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    // Copy buffer data from mapped read-back buffer, which is released after that
+    const Data::RawPtr data_ptr = read_back_buffer.memory_allocation.GetMappedDataPtr(0U, data_range.GetLength());
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 Ptr<ResourceView::ViewDescriptorVariant> Buffer::CreateNativeViewDescriptor(const ResourceView::Id& view_id)
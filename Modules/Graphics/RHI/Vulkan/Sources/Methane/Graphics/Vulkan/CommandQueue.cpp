@@ -158,6 +158,12 @@ Ptr<Rhi::IRenderCommandList> CommandQueue::CreateRenderCommandList(Rhi::IRenderP
     return std::make_shared<RenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass));
 }
 
+Ptr<Rhi::IRenderCommandList> CommandQueue::CreateRenderCommandBundle(Rhi::IRenderPass& render_pass)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<RenderCommandList>(*this, dynamic_cast<RenderPass&>(render_pass), true);
+}
+
 Ptr<Rhi::IParallelRenderCommandList> CommandQueue::CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass)
 {
     META_FUNCTION_TASK();
@@ -174,6 +180,8 @@ void CommandQueue::Execute(Rhi::ICommandListSet& command_list_set, const Rhi::IC
 {
     META_FUNCTION_TASK();
 
+    // Asynchronous upload synchronization executes its own command lists, so it goes before adding waits of these command lists
+    GetBaseContext().CompleteAsyncUploads(*this);
     AddWaitForFrameExecution(command_list_set);
     Base::CommandQueueTracking::Execute(command_list_set, completed_callback);
 
@@ -260,6 +268,41 @@ void CommandQueue::AddWaitForFrameExecution(const Rhi::ICommandListSet& command_
     frame_wait_info.stages.emplace_back(vk::PipelineStageFlagBits::eBottomOfPipe);
 }
 
+vk::UniqueCommandPool CommandQueue::AcquireNativeCommandPool()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_command_pools_mutex);
+    if (!m_vk_free_command_pools.empty())
+    {
+        vk::UniqueCommandPool vk_unique_command_pool = std::move(m_vk_free_command_pools.back());
+        m_vk_free_command_pools.pop_back();
+        return vk_unique_command_pool;
+    }
+
+    // Command buffers are not individually resettable, instead all buffers of the pool are reset in bulk with the pool reset
+    return GetVulkanDevice().GetNativeDevice().createCommandPoolUnique(
+        vk::CommandPoolCreateInfo(vk::CommandPoolCreateFlagBits::eTransient, m_queue_family_index));
+}
+
+void CommandQueue::ReleaseNativeCommandPool(vk::UniqueCommandPool&& vk_unique_command_pool) noexcept
+{
+    META_FUNCTION_TASK();
+    if (!vk_unique_command_pool)
+        return;
+
+    try
+    {
+        GetVulkanDevice().GetNativeDevice().resetCommandPool(vk_unique_command_pool.get());
+        std::scoped_lock lock_guard(m_command_pools_mutex);
+        m_vk_free_command_pools.emplace_back(std::move(vk_unique_command_pool));
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("Failed to reset released command pool, it will be destroyed: {}", e.what());
+    }
+}
+
 void CommandQueue::CompleteCommandListSetExecution(Base::CommandListSet& executing_command_list_set)
 {
     META_FUNCTION_TASK();
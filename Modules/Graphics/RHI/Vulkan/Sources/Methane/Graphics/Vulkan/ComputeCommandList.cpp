@@ -38,6 +38,9 @@ void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_co
 {
     META_FUNCTION_TASK();
     Base::ComputeCommandList::Dispatch(thread_groups_count);
+    if (!IsComputeStateApplied())
+        return; // Dispatch is skipped until compute state compilation is completed
+
     GetNativeCommandBufferDefault().dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
 }
 
@@ -61,35 +61,59 @@ ComputeState::ComputeState(const Rhi::IContext& context, const Settings& setting
     Reset(settings);
 }
 
+ComputeState::~ComputeState()
+{
+    META_FUNCTION_TASK();
+    // Asynchronous compilation task must be completed before release of the native pipeline
+    WaitForCompilation();
+}
+
 void ComputeState::Reset(const Settings& settings)
 {
     META_FUNCTION_TASK();
+    WaitForCompilation();
     Base::ComputeState::Reset(settings);
 
-    auto& program = static_cast<Program&>(*GetSettings().program_ptr);
-    const std::vector<vk::PipelineShaderStageCreateInfo> vk_stages_info = program.GetNativeShaderStageCreateInfos();
-
-    const vk::ComputePipelineCreateInfo vk_pipeline_create_info(
-        vk::PipelineCreateFlags(),
-        vk_stages_info.back(),
-        program.AcquireNativePipelineLayout()
-    );
-
-    auto pipe = m_vk_context.GetVulkanDevice().GetNativeDevice().createComputePipelineUnique(nullptr, vk_pipeline_create_info);
-    META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-    m_vk_unique_pipeline = std::move(pipe.value);
+    Compile([this]()
+    {
+        auto& program = static_cast<Program&>(*GetSettings().program_ptr);
+        const std::vector<vk::PipelineShaderStageCreateInfo> vk_stages_info = program.GetNativeShaderStageCreateInfos();
+
+        const vk::ComputePipelineCreateInfo vk_pipeline_create_info(
+            vk::PipelineCreateFlags(),
+            vk_stages_info.back(),
+            program.AcquireNativePipelineLayout()
+        );
+
+        META_SCOPE_TIMER("Vulkan::ComputeState::CreatePipeline");
+        const Device& device = m_vk_context.GetVulkanDevice();
+        auto pipe = device.GetNativeDevice().createComputePipelineUnique(device.GetNativePipelineCache(), vk_pipeline_create_info);
+        META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
+
+        std::lock_guard lock(m_mutex);
+        SetVulkanObjectName(device.GetNativeDevice(), pipe.value.get(), Base::Object::GetName());
+        m_vk_unique_pipeline = std::move(pipe.value);
+    });
 }
 
-void ComputeState::Apply(Base::ComputeCommandList& compute_command_list)
+bool ComputeState::Apply(Base::ComputeCommandList& compute_command_list)
 {
     META_FUNCTION_TASK();
+    RethrowCompileError();
+
+    const vk::Pipeline vk_pipeline = GetNativePipeline();
+    if (!vk_pipeline)
+        return false;
+
     const auto& vulkan_compute_command_list = static_cast<ComputeCommandList&>(compute_command_list);
-    vulkan_compute_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eCompute, GetNativePipeline());
+    vulkan_compute_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eCompute, vk_pipeline);
+    return true;
 }
 
 bool ComputeState::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
     if (!Base::ComputeState::SetName(name))
         return false;
 
@@ -97,4 +121,14 @@ bool ComputeState::SetName(std::string_view name)
     return true;
 }
 
+vk::Pipeline ComputeState::GetNativePipeline() const
+{
+    META_FUNCTION_TASK();
+    if (!IsCompiled())
+        return {};
+
+    std::lock_guard lock(m_mutex);
+    return m_vk_unique_pipeline.get();
+}
+
 } // namespace Methane::Graphics::Vulkan
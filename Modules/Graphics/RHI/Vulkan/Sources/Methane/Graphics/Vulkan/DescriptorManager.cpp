@@ -31,13 +31,17 @@ Vulkan descriptor manager with descriptor sets allocator.
 #include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Instrumentation.h>
 
+#include <atomic>
+
 namespace Methane::Graphics::Vulkan
 {
 
+static std::atomic<uint64_t> g_descriptor_managers_count{ 0U };
+
 DescriptorManager::DescriptorManager(Base::Context& context, uint32_t pool_sets_count, const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type)
     : Base::DescriptorManager(context, false)
-    , m_pool_sets_count(pool_sets_count)
-    , m_pool_size_ratio_by_desc_type(pool_size_ratio_by_desc_type)
+    , m_instance_id(++g_descriptor_managers_count)
+    , m_pool_size_estimator(pool_sets_count, pool_size_ratio_by_desc_type)
 { }
 
 void DescriptorManager::Release()
@@ -46,92 +50,140 @@ void DescriptorManager::Release()
     Base::DescriptorManager::Release();
 
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
-    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    for(vk::DescriptorPool& vk_pool : m_vk_used_pools)
+    for(const auto& [thread_id, pools_chain_ptr] : m_thread_pools_chains)
     {
-        vk_device.resetDescriptorPool(vk_pool);
-        m_vk_free_pools.emplace_back(vk_pool);
+        ResetPoolsChain(*pools_chain_ptr);
     }
-    m_vk_used_pools.clear();
-    m_vk_current_pool = nullptr;
 }
 
 void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
 {
     META_FUNCTION_TASK();
-    m_pool_size_ratio_by_desc_type[descriptor_type] = size_ratio;
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    m_pool_size_estimator.SetSizeRatio(descriptor_type, size_ratio);
 }
 
-vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout)
+void DescriptorManager::AddDescriptorSetLayout(const std::vector<vk::DescriptorSetLayoutBinding>& layout_bindings)
 {
     META_FUNCTION_TASK();
+    PoolSizeEstimator::CountByType descriptors_count_by_type;
+    for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_bindings)
+    {
+        descriptors_count_by_type[layout_binding.descriptorType] += layout_binding.descriptorCount;
+    }
+
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
-    if (!m_vk_current_pool)
-        m_vk_current_pool = AcquireDescriptorPool();
+    m_pool_size_estimator.AddSetLayout(descriptors_count_by_type);
+}
+
+vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout)
+{
+    META_FUNCTION_TASK();
+    return AllocDescriptorSetFromChain(GetThreadPoolsChain(), layout);
+}
+
+vk::DescriptorSet DescriptorManager::AllocDescriptorSetFromChain(PoolsChain& pools_chain, vk::DescriptorSetLayout layout)
+{
+    META_FUNCTION_TASK();
+    if (!pools_chain.current_pool)
+        pools_chain.current_pool = AcquireDescriptorPool(pools_chain);
 
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    vk::DescriptorSetAllocateInfo vk_alloc_info(pools_chain.current_pool, 1, &layout);
+    vk::DescriptorSet vk_descriptor_set;
 
-    try
-    {
-        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-        if (!descriptor_sets.empty())
-            return descriptor_sets.back();
-    }
-    catch(const vk::OutOfPoolMemoryError&)
+    // Non-throwing allocation is used to detect pool exhaustion by result code without exceptions handling overhead
+    vk::Result vk_result = vk_device.allocateDescriptorSets(&vk_alloc_info, &vk_descriptor_set);
+    if (vk_result == vk::Result::eErrorOutOfPoolMemory ||
+        vk_result == vk::Result::eErrorFragmentedPool)
     {
-        // Exception is handled below try-catch block
-        META_LOG("Out of descriptor pool memory, reallocating.");
-    }
-    catch(const vk::FragmentedPoolError&)
-    {
-        // Exception is handled below try-catch block
-        META_LOG("Fragmented descriptor pool, reallocating.");
+        META_LOG("Descriptor pool allocation failed with result '{}', switching to the next pool.", vk::to_string(vk_result));
+        pools_chain.current_pool = AcquireDescriptorPool(pools_chain);
+        vk_alloc_info.descriptorPool = pools_chain.current_pool;
+        vk_result = vk_device.allocateDescriptorSets(&vk_alloc_info, &vk_descriptor_set);
     }
 
-    // Reallocate descriptor set for the new pool
-    m_vk_current_pool = AcquireDescriptorPool();
-    const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-    META_CHECK_ARG_NOT_EMPTY(descriptor_sets);
-    return descriptor_sets.back();
+    META_CHECK_ARG_TRUE_DESCR(vk_result == vk::Result::eSuccess, "failed to allocate descriptor set with result '{}'", vk::to_string(vk_result));
+    return vk_descriptor_set;
 }
 
 vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
 {
     META_FUNCTION_TASK();
+    // Pool sizes are learned from the descriptor set layouts of created programs
+    const PoolSizeEstimator::CountByType pool_size_by_desc_type = m_pool_size_estimator.GetPoolSizes();
     std::vector<vk::DescriptorPoolSize> pool_sizes;
-    pool_sizes.reserve(m_pool_size_ratio_by_desc_type.size());
-    for (const auto& [desc_type, size_ratio] : m_pool_size_ratio_by_desc_type)
+    pool_sizes.reserve(pool_size_by_desc_type.size());
+    for (const auto& [desc_type, pool_size] : pool_size_by_desc_type)
     {
-        pool_sizes.emplace_back(desc_type, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio));
+        pool_sizes.emplace_back(desc_type, pool_size);
     }
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_sets_count, pool_sizes)));
+    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_size_estimator.GetPoolSetsCount(), pool_sizes)));
     return m_vk_descriptor_pools.back().get();
 }
 
-vk::DescriptorPool DescriptorManager::AcquireDescriptorPool()
+vk::DescriptorPool DescriptorManager::AcquireDescriptorPool(PoolsChain& pools_chain)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    vk::DescriptorPool vk_pool;
     if (m_vk_free_pools.empty())
     {
-        vk::DescriptorPool new_pool = CreateDescriptorPool();
-        m_vk_used_pools.emplace_back(new_pool);
-        return new_pool;
+        vk_pool = CreateDescriptorPool();
+    }
+    else
+    {
+        vk_pool = m_vk_free_pools.back();
+        m_vk_free_pools.pop_back();
+    }
+    pools_chain.used_pools.emplace_back(vk_pool);
+    return vk_pool;
+}
+
+void DescriptorManager::ResetPoolsChain(PoolsChain& pools_chain)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    for(const vk::DescriptorPool& vk_pool : pools_chain.used_pools)
+    {
+        vk_device.resetDescriptorPool(vk_pool);
+        m_vk_free_pools.emplace_back(vk_pool);
     }
+    pools_chain.used_pools.clear();
+    pools_chain.current_pool = nullptr;
+}
+
+DescriptorManager::PoolsChain& DescriptorManager::GetThreadPoolsChain()
+{
+    META_FUNCTION_TASK();
+    // Pools chain of the last used descriptor manager is cached in thread local storage,
+    // so that descriptor sets allocation does not lock the mutex shared between threads
+    thread_local uint64_t    tls_descriptor_manager_id = 0U;
+    thread_local PoolsChain* tls_pools_chain_ptr       = nullptr;
+    if (tls_descriptor_manager_id == m_instance_id)
+        return *tls_pools_chain_ptr;
+
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    UniquePtr<PoolsChain>& pools_chain_ptr = m_thread_pools_chains[std::this_thread::get_id()];
+    if (!pools_chain_ptr)
+        pools_chain_ptr = std::make_unique<PoolsChain>();
 
-    vk::DescriptorPool free_pool = m_vk_free_pools.back();
-    m_vk_free_pools.pop_back();
-    return free_pool;
+    tls_descriptor_manager_id = m_instance_id;
+    tls_pools_chain_ptr       = pools_chain_ptr.get();
+    return *pools_chain_ptr;
 }
 
 const IContext& DescriptorManager::GetContextVk()
 {
     META_FUNCTION_TASK();
-    if (m_vk_context_ptr)
-        return *m_vk_context_ptr;
+    if (const IContext* vk_context_ptr = m_vk_context_ptr.load();
+        vk_context_ptr)
+        return *vk_context_ptr;
 
-    m_vk_context_ptr = dynamic_cast<const IContext*>(&GetContext());
-    return *m_vk_context_ptr;
+    const auto* vk_context_ptr = dynamic_cast<const IContext*>(&GetContext());
+    m_vk_context_ptr.store(vk_context_ptr);
+    return *vk_context_ptr;
 }
 
 } // namespace Methane::Graphics::Vulkan
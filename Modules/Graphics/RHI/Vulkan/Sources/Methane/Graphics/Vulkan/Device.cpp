@@ -278,6 +278,9 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
 
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
+
+    m_memory_allocator_ptr = std::make_unique<MemoryAllocator>(m_vk_physical_device, m_vk_unique_device.get());
+    m_pipeline_cache_ptr   = std::make_unique<PipelineCache>(m_vk_physical_device, m_vk_unique_device.get());
 }
 
 Ptr<Rhi::IRenderContext> Device::CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings)
@@ -296,6 +299,12 @@ Ptr<Rhi::IComputeContext> Device::CreateComputeContext(tf::Executor& parallel_ex
     return compute_context_ptr;
 }
 
+Rhi::DeviceMemoryStatistics Device::GetMemoryStatistics() const
+{
+    META_FUNCTION_TASK();
+    return m_memory_allocator_ptr->GetStatistics();
+}
+
 bool Device::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,333 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.cpp
+Vulkan device memory allocator, which sub-allocates resource memory from large
+memory blocks with buddy allocation or allocates dedicated memory for big resources.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/MemoryAllocator.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace Methane::Graphics::Vulkan
+{
+
+using BuddyAllocator = Data::BuddyAllocator<vk::DeviceSize>;
+
+MemoryBlock::MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, vk::DeviceSize size, uint32_t min_order, bool is_host_visible)
+    : m_vk_device(vk_device)
+    , m_buddy_allocator(size, min_order)
+    , m_vk_memory(vk_device.allocateMemory(vk::MemoryAllocateInfo(size, memory_type_index)))
+{
+    META_FUNCTION_TASK();
+    if (!is_host_visible)
+        return;
+
+    // Host visible memory block is mapped persistently, because device memory object can not be mapped more than once at a time
+    try
+    {
+        m_mapped_data_ptr = static_cast<Data::RawPtr>(m_vk_device.mapMemory(m_vk_memory, 0U, VK_WHOLE_SIZE));
+    }
+    catch(...)
+    {
+        m_vk_device.freeMemory(m_vk_memory);
+        throw;
+    }
+}
+
+MemoryBlock::~MemoryBlock()
+{
+    META_FUNCTION_TASK();
+    // Mapped memory is unmapped implicitly on free
+    m_vk_device.freeMemory(m_vk_memory);
+}
+
+Opt<vk::DeviceSize> MemoryBlock::Allocate(uint32_t order)
+{
+    META_FUNCTION_TASK();
+    return m_buddy_allocator.Allocate(order);
+}
+
+void MemoryBlock::Free(vk::DeviceSize offset, uint32_t order)
+{
+    META_FUNCTION_TASK();
+    m_buddy_allocator.Free(offset, order);
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocator& allocator, uint32_t memory_type_index, MemoryBlock* block_ptr, uint32_t order,
+                                   const vk::DeviceMemory& vk_memory, vk::DeviceSize offset, vk::DeviceSize size, Data::RawPtr mapped_data_ptr) noexcept
+    : m_allocator_ptr(&allocator)
+    , m_memory_type_index(memory_type_index)
+    , m_block_ptr(block_ptr)
+    , m_order(order)
+    , m_vk_memory(vk_memory)
+    , m_offset(offset)
+    , m_size(size)
+    , m_mapped_data_ptr(mapped_data_ptr)
+{ }
+
+MemoryAllocation::~MemoryAllocation()
+{
+    Release();
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_allocator_ptr(std::exchange(other.m_allocator_ptr, nullptr))
+    , m_memory_type_index(other.m_memory_type_index)
+    , m_block_ptr(std::exchange(other.m_block_ptr, nullptr))
+    , m_order(other.m_order)
+    , m_vk_memory(std::exchange(other.m_vk_memory, vk::DeviceMemory()))
+    , m_offset(std::exchange(other.m_offset, 0U))
+    , m_size(std::exchange(other.m_size, 0U))
+    , m_mapped_data_ptr(std::exchange(other.m_mapped_data_ptr, nullptr))
+{ }
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_allocator_ptr     = std::exchange(other.m_allocator_ptr, nullptr);
+    m_memory_type_index = other.m_memory_type_index;
+    m_block_ptr         = std::exchange(other.m_block_ptr, nullptr);
+    m_order             = other.m_order;
+    m_vk_memory         = std::exchange(other.m_vk_memory, vk::DeviceMemory());
+    m_offset            = std::exchange(other.m_offset, 0U);
+    m_size              = std::exchange(other.m_size, 0U);
+    m_mapped_data_ptr   = std::exchange(other.m_mapped_data_ptr, nullptr);
+    return *this;
+}
+
+Data::RawPtr MemoryAllocation::GetMappedDataPtr(vk::DeviceSize offset, vk::DeviceSize size) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_mapped_data_ptr, "memory allocation is not mapped to the host address space");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(offset + size, m_size, "mapped memory range is out of allocation bounds");
+    return m_mapped_data_ptr + offset;
+}
+
+void MemoryAllocation::Release() noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_allocator_ptr)
+        return;
+
+    m_allocator_ptr->Free(*this);
+    m_allocator_ptr   = nullptr;
+    m_block_ptr       = nullptr;
+    m_vk_memory       = vk::DeviceMemory();
+    m_offset          = 0U;
+    m_size            = 0U;
+    m_mapped_data_ptr = nullptr;
+}
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device)
+    : MemoryAllocator(vk_physical_device, vk_device, Settings{})
+{ }
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings)
+    : m_settings(settings)
+    , m_vk_device(vk_device)
+    , m_vk_memory_properties(vk_physical_device.getMemoryProperties())
+    , m_memory_pools(m_vk_memory_properties.memoryTypeCount * 2U)
+    , m_heap_statistics(m_vk_memory_properties.memoryHeapCount)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_OR_EQUAL(m_settings.max_block_size, m_settings.min_allocation_size);
+    META_CHECK_ARG_NOT_ZERO(m_settings.heap_block_fraction);
+
+    for(uint32_t heap_index = 0U; heap_index < m_vk_memory_properties.memoryHeapCount; ++heap_index)
+    {
+        const vk::MemoryHeap& vk_memory_heap = m_vk_memory_properties.memoryHeaps[heap_index];
+        Rhi::DeviceMemoryHeapStatistics& heap_statistics = m_heap_statistics[heap_index];
+        heap_statistics.heap_size       = vk_memory_heap.size;
+        heap_statistics.is_device_local = static_cast<bool>(vk_memory_heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal);
+    }
+
+    // Block size is a power of two, limited with a fraction of the heap size to keep small heaps (like BAR memory) usable
+    const vk::DeviceSize min_block_size = vk::DeviceSize(1U) << BuddyAllocator::GetCeilOrder(m_settings.min_allocation_size);
+    for(uint32_t type_index = 0U; type_index < m_vk_memory_properties.memoryTypeCount; ++type_index)
+    {
+        const uint32_t heap_index = m_vk_memory_properties.memoryTypes[type_index].heapIndex;
+        const vk::DeviceSize heap_block_size = m_vk_memory_properties.memoryHeaps[heap_index].size / m_settings.heap_block_fraction;
+        const vk::DeviceSize max_block_size  = std::max(min_block_size, std::min(m_settings.max_block_size, heap_block_size));
+        const vk::DeviceSize block_size      = vk::DeviceSize(1U) << BuddyAllocator::GetFloorOrder(max_block_size);
+        m_memory_pools[type_index * 2U].block_size      = block_size;
+        m_memory_pools[type_index * 2U + 1U].block_size = block_size;
+    }
+}
+
+MemoryAllocation MemoryAllocator::Allocate(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index,
+                                           MemoryResourceType resource_type, bool is_dedicated)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(memory_type_index, m_vk_memory_properties.memoryTypeCount);
+
+    // Buddy offsets are aligned to the buddy size, so it should not be smaller than the required alignment
+    const vk::DeviceSize buddy_size = std::max({ memory_requirements.size, memory_requirements.alignment, m_settings.min_allocation_size });
+    const uint32_t       order      = BuddyAllocator::GetCeilOrder(buddy_size);
+
+    std::scoped_lock lock_guard(m_mutex);
+    MemoryPool& memory_pool = GetMemoryPool(memory_type_index, resource_type);
+    if (is_dedicated || (vk::DeviceSize(1U) << order) > memory_pool.block_size / 2U)
+        return AllocateDedicated(memory_requirements, memory_type_index);
+
+    Opt<vk::DeviceSize> offset_opt;
+    MemoryBlock* block_ptr = nullptr;
+    for(const UniquePtr<MemoryBlock>& memory_block_ptr : memory_pool.blocks)
+    {
+        offset_opt = memory_block_ptr->Allocate(order);
+        if (offset_opt)
+        {
+            block_ptr = memory_block_ptr.get();
+            break;
+        }
+    }
+
+    Rhi::DeviceMemoryHeapStatistics& heap_statistics = GetHeapStatistics(memory_type_index);
+    if (!offset_opt)
+    {
+        const uint32_t min_order = BuddyAllocator::GetCeilOrder(m_settings.min_allocation_size);
+        block_ptr  = memory_pool.blocks.emplace_back(std::make_unique<MemoryBlock>(m_vk_device, memory_type_index, memory_pool.block_size,
+                                                                                   min_order, IsHostVisible(memory_type_index))).get();
+        offset_opt = block_ptr->Allocate(order);
+        META_CHECK_ARG_TRUE_DESCR(offset_opt.has_value(), "failed to allocate memory from the new memory block");
+        heap_statistics.allocated_size += memory_pool.block_size;
+        heap_statistics.blocks_count++;
+    }
+
+    heap_statistics.used_size += memory_requirements.size;
+    heap_statistics.allocations_count++;
+
+    Data::RawPtr mapped_data_ptr = block_ptr->GetMappedDataPtr() ? block_ptr->GetMappedDataPtr() + *offset_opt : nullptr;
+    return MemoryAllocation(*this, memory_type_index, block_ptr, order, block_ptr->GetNativeDeviceMemory(),
+                            *offset_opt, memory_requirements.size, mapped_data_ptr);
+}
+
+Rhi::DeviceMemoryStatistics MemoryAllocator::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    return m_heap_statistics;
+}
+
+MemoryAllocation MemoryAllocator::AllocateDedicated(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index)
+{
+    META_FUNCTION_TASK();
+    const vk::DeviceMemory vk_memory = m_vk_device.allocateMemory(vk::MemoryAllocateInfo(memory_requirements.size, memory_type_index));
+
+    Data::RawPtr mapped_data_ptr = nullptr;
+    if (IsHostVisible(memory_type_index))
+    {
+        try
+        {
+            mapped_data_ptr = static_cast<Data::RawPtr>(m_vk_device.mapMemory(vk_memory, 0U, VK_WHOLE_SIZE));
+        }
+        catch(...)
+        {
+            m_vk_device.freeMemory(vk_memory);
+            throw;
+        }
+    }
+
+    Rhi::DeviceMemoryHeapStatistics& heap_statistics = GetHeapStatistics(memory_type_index);
+    heap_statistics.allocated_size += memory_requirements.size;
+    heap_statistics.used_size      += memory_requirements.size;
+    heap_statistics.allocations_count++;
+    heap_statistics.dedicated_allocations_count++;
+
+    return MemoryAllocation(*this, memory_type_index, nullptr, 0U, vk_memory, 0U, memory_requirements.size, mapped_data_ptr);
+}
+
+MemoryAllocator::MemoryPool& MemoryAllocator::GetMemoryPool(uint32_t memory_type_index, MemoryResourceType resource_type)
+{
+    META_FUNCTION_TASK();
+    return m_memory_pools[memory_type_index * 2U + static_cast<uint32_t>(resource_type)];
+}
+
+bool MemoryAllocator::IsHostVisible(uint32_t memory_type_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    return static_cast<bool>(m_vk_memory_properties.memoryTypes[memory_type_index].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible);
+}
+
+Rhi::DeviceMemoryHeapStatistics& MemoryAllocator::GetHeapStatistics(uint32_t memory_type_index)
+{
+    META_FUNCTION_TASK();
+    return m_heap_statistics[m_vk_memory_properties.memoryTypes[memory_type_index].heapIndex];
+}
+
+void MemoryAllocator::Free(const MemoryAllocation& allocation) noexcept
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    Rhi::DeviceMemoryHeapStatistics& heap_statistics = GetHeapStatistics(allocation.m_memory_type_index);
+    heap_statistics.used_size -= allocation.m_size;
+    heap_statistics.allocations_count--;
+
+    if (allocation.IsDedicated())
+    {
+        m_vk_device.freeMemory(allocation.m_vk_memory);
+        heap_statistics.allocated_size -= allocation.m_size;
+        heap_statistics.dedicated_allocations_count--;
+        return;
+    }
+
+    try
+    {
+        allocation.m_block_ptr->Free(allocation.m_offset, allocation.m_order);
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during memory allocation release: {}", e.what());
+        assert(false);
+        return;
+    }
+
+    if (!allocation.m_block_ptr->IsEmpty())
+        return;
+
+    // Empty memory block is released, unless it is the last block in the pool which is kept to avoid allocation thrashing
+    for(MemoryResourceType resource_type : { MemoryResourceType::Buffer, MemoryResourceType::Image })
+    {
+        MemoryPool& memory_pool = GetMemoryPool(allocation.m_memory_type_index, resource_type);
+        const auto block_it = std::find_if(memory_pool.blocks.begin(), memory_pool.blocks.end(),
+                                           [&allocation](const UniquePtr<MemoryBlock>& block_ptr)
+                                           { return block_ptr.get() == allocation.m_block_ptr; });
+        if (block_it == memory_pool.blocks.end())
+            continue;
+
+        if (memory_pool.blocks.size() > 1U)
+        {
+            heap_statistics.allocated_size -= memory_pool.block_size;
+            heap_statistics.blocks_count--;
+            memory_pool.blocks.erase(block_it);
+        }
+        break;
+    }
+}
+
+} // namespace Methane::Graphics::Vulkan
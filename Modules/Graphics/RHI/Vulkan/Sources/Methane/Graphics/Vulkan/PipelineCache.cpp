@@ -0,0 +1,155 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.cpp
+Vulkan device-level pipeline cache, which is loaded from the user cache directory
+on device creation and saved back on device destruction.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
+
+#include <Methane/Platform/Utils.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+
+namespace Methane::Graphics::Vulkan
+{
+
+std::string PipelineCache::GetDefaultFilePath()
+{
+    META_FUNCTION_TASK();
+    const std::filesystem::path app_name = std::filesystem::path(Platform::GetExecutableFileName()).stem();
+    const std::filesystem::path cache_path = std::filesystem::path(Platform::GetUserCacheDir()) / "Methane" / app_name / "VulkanPipelineCache.bin";
+    return cache_path.string();
+}
+
+bool PipelineCache::IsCacheDataCompatible(const Data::Bytes& cache_data, const vk::PhysicalDeviceProperties& vk_device_props) noexcept
+{
+    META_FUNCTION_TASK();
+    VkPipelineCacheHeaderVersionOne cache_header{};
+    if (cache_data.size() < sizeof(cache_header))
+        return false;
+
+    std::memcpy(&cache_header, cache_data.data(), sizeof(cache_header));
+    return cache_header.headerSize >= sizeof(cache_header) &&
+           cache_header.headerSize <= cache_data.size() &&
+           cache_header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           cache_header.vendorID == vk_device_props.vendorID &&
+           cache_header.deviceID == vk_device_props.deviceID &&
+           std::memcmp(cache_header.pipelineCacheUUID, vk_device_props.pipelineCacheUUID.data(), VK_UUID_SIZE) == 0;
+}
+
+PipelineCache::PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, std::string file_path)
+    : m_file_path(std::move(file_path))
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("Vulkan::PipelineCache::Load");
+    const Data::Bytes cache_data = LoadCacheData(vk_physical_device);
+    m_is_loaded_from_file = !cache_data.empty();
+    m_vk_unique_pipeline_cache = vk_device.createPipelineCacheUnique(
+        vk::PipelineCacheCreateInfo(vk::PipelineCacheCreateFlags{}, cache_data.size(), cache_data.data())
+    );
+}
+
+PipelineCache::PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device)
+    : PipelineCache(vk_physical_device, vk_device, GetDefaultFilePath())
+{ }
+
+PipelineCache::~PipelineCache()
+{
+    META_FUNCTION_TASK();
+    Save();
+}
+
+bool PipelineCache::Save() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_file_path.empty() || !m_vk_unique_pipeline_cache)
+        return false;
+
+    try
+    {
+        META_SCOPE_TIMER("Vulkan::PipelineCache::Save");
+        const std::vector<uint8_t> cache_data = m_vk_unique_pipeline_cache.getOwner().getPipelineCacheData(m_vk_unique_pipeline_cache.get());
+        if (cache_data.size() <= sizeof(VkPipelineCacheHeaderVersionOne))
+            return false;
+
+        // Cache data is written to temporary file first and then renamed to prevent loading of partially written cache
+        const std::filesystem::path cache_path(m_file_path);
+        const std::filesystem::path temp_cache_path = std::filesystem::path(cache_path).concat(".tmp");
+        std::filesystem::create_directories(cache_path.parent_path());
+        {
+            std::ofstream cache_file(temp_cache_path, std::ios::binary | std::ios::trunc);
+            cache_file.write(reinterpret_cast<const char*>(cache_data.data()), static_cast<std::streamsize>(cache_data.size())); // NOSONAR
+            if (!cache_file.good())
+            {
+                META_LOG("WARNING: Failed to write Vulkan pipeline cache to file '{}'", temp_cache_path.string());
+                return false;
+            }
+        }
+        std::filesystem::rename(temp_cache_path, cache_path);
+        META_LOG("Vulkan pipeline cache of {} bytes was saved to file '{}'", cache_data.size(), m_file_path);
+        return true;
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Failed to save Vulkan pipeline cache: {}", e.what());
+        return false;
+    }
+}
+
+Data::Bytes PipelineCache::LoadCacheData(const vk::PhysicalDevice& vk_physical_device) const
+{
+    META_FUNCTION_TASK();
+    if (m_file_path.empty())
+        return {};
+
+    std::ifstream cache_file(m_file_path, std::ios::binary | std::ios::ate);
+    if (!cache_file.is_open())
+        return {};
+
+    const std::streamsize cache_size = cache_file.tellg();
+    if (cache_size <= 0)
+        return {};
+
+    Data::Bytes cache_data(static_cast<size_t>(cache_size));
+    cache_file.seekg(0, std::ios::beg);
+    if (!cache_file.read(reinterpret_cast<char*>(cache_data.data()), cache_size)) // NOSONAR
+    {
+        META_LOG("WARNING: Failed to read Vulkan pipeline cache from file '{}'", m_file_path);
+        return {};
+    }
+
+    // Pipeline cache created by another driver version or GPU is discarded, since it can not be reused
+    if (!IsCacheDataCompatible(cache_data, vk_physical_device.getProperties()))
+    {
+        META_LOG("Vulkan pipeline cache in file '{}' is incompatible with device and is discarded", m_file_path);
+        return {};
+    }
+
+    META_LOG("Vulkan pipeline cache of {} bytes was loaded from file '{}'", cache_data.size(), m_file_path);
+    return cache_data;
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -47,6 +47,7 @@ Program::Program(const Base::Context& context, const Settings& settings)
     META_FUNCTION_TASK();
     InitArgumentBindings(settings.argument_accessors);
     InitializeDescriptorSetLayouts();
+    InitializeDescriptorUpdateTemplates();
 }
 
 Ptr<Rhi::IProgramBindings> Program::CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index)
@@ -115,6 +116,12 @@ const Program::DescriptorSetLayoutInfo& Program::GetDescriptorSetLayoutInfo(Rhi:
     return m_descriptor_set_layout_info_by_access_type[*magic_enum::enum_index(argument_access_type)];
 }
 
+const vk::DescriptorUpdateTemplate& Program::GetNativeDescriptorUpdateTemplate(Rhi::ProgramArgumentAccessType argument_access_type) const
+{
+    META_FUNCTION_TASK();
+    return m_vk_unique_descriptor_update_templates[*magic_enum::enum_index(argument_access_type)].get();
+}
+
 const vk::PipelineLayout& Program::GetNativePipelineLayout() const
 {
     META_FUNCTION_TASK();
@@ -190,7 +197,7 @@ const vk::DescriptorSet& Program::AcquireFrameConstantDescriptorSet(Data::Index
 void Program::InitializeDescriptorSetLayouts()
 {
     META_FUNCTION_TASK();
-    for (const auto& [program_argument, argument_binding_ptr] : GetArgumentBindings())
+    for (const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
         const auto& vulkan_argument_binding = dynamic_cast<const ProgramBindings::ArgumentBinding&>(*argument_binding_ptr);
@@ -198,6 +205,7 @@ void Program::InitializeDescriptorSetLayouts()
         const size_t accessor_type_index = magic_enum::enum_index(vulkan_binding_settings.argument.GetAccessorType()).value();
 
         DescriptorSetLayoutInfo& layout_info = m_descriptor_set_layout_info_by_access_type[accessor_type_index];
+        layout_info.descriptor_offsets.emplace_back(layout_info.descriptors_count);
         layout_info.descriptors_count += vulkan_binding_settings.resource_count;
         layout_info.arguments.emplace_back(vulkan_binding_settings.argument);
         layout_info.byte_code_maps_for_arguments.emplace_back(vulkan_binding_settings.byte_code_maps);
@@ -205,7 +213,7 @@ void Program::InitializeDescriptorSetLayouts()
             static_cast<uint32_t>(layout_info.bindings.size()),
             vulkan_binding_settings.descriptor_type,
             vulkan_binding_settings.resource_count,
-            Shader::ConvertTypeToStageFlagBits(program_argument.GetShaderType())
+            Shader::ConvertTypeToStageFlagBits(vulkan_binding_settings.argument.GetShaderType())
         );
     }
 
@@ -253,6 +261,7 @@ void Program::InitializeDescriptorSetLayouts()
             vk_device.createDescriptorSetLayoutUnique(
                 vk::DescriptorSetLayoutCreateInfo({}, layout_info.bindings)
             ));
+        GetVulkanContext().GetVulkanDescriptorManager().AddDescriptorSetLayout(layout_info.bindings);
     }
 
     META_LOG("{}", log_ss.str());
@@ -262,6 +271,43 @@ void Program::InitializeDescriptorSetLayouts()
     UpdateDescriptorSetLayoutNames();
 }
 
+void Program::InitializeDescriptorUpdateTemplates()
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetVulkanContext().GetVulkanDevice().GetNativeDevice();
+    constexpr auto descriptor_stride = static_cast<uint32_t>(sizeof(DescriptorUpdateTemplateData));
+
+    // Update templates allow to write all descriptors of the set in a single call from the packed descriptors data,
+    // which is used for mutable descriptor sets of program bindings sharing the same layout
+    for(size_t access_type_index = 0; access_type_index < m_descriptor_set_layout_info_by_access_type.size(); ++access_type_index)
+    {
+        const DescriptorSetLayoutInfo& layout_info = m_descriptor_set_layout_info_by_access_type[access_type_index];
+        if (!layout_info.index_opt)
+            continue;
+
+        std::vector<vk::DescriptorUpdateTemplateEntry> vk_template_entries;
+        vk_template_entries.reserve(layout_info.bindings.size());
+        for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_info.bindings)
+        {
+            vk_template_entries.emplace_back(
+                layout_binding.binding, 0U,
+                layout_binding.descriptorCount,
+                layout_binding.descriptorType,
+                layout_info.descriptor_offsets.at(layout_binding.binding) * descriptor_stride,
+                descriptor_stride
+            );
+        }
+
+        m_vk_unique_descriptor_update_templates[access_type_index] = vk_device.createDescriptorUpdateTemplateUnique(
+            vk::DescriptorUpdateTemplateCreateInfo(
+                vk::DescriptorUpdateTemplateCreateFlags{},
+                vk_template_entries,
+                vk::DescriptorUpdateTemplateType::eDescriptorSet,
+                m_vk_unique_descriptor_set_layouts.at(*layout_info.index_opt).get()
+            ));
+    }
+}
+
 void Program::UpdatePipelineName()
 {
     if (!m_vk_unique_pipeline_layout)
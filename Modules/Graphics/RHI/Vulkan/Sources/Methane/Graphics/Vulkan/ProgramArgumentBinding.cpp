@@ -62,10 +62,10 @@ void ProgramArgumentBinding::SetDescriptorSet(const vk::DescriptorSet& descripto
     m_vk_descriptor_set_ptr = &descriptor_set;
 }
 
-Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy() const
+Ptr<Base::ProgramArgumentBinding> ProgramArgumentBinding::CreateCopy(const Allocator& allocator) const
 {
     META_FUNCTION_TASK();
-    return std::make_shared<ProgramArgumentBinding>(*this);
+    return std::allocate_shared<ProgramArgumentBinding>(allocator, *this);
 }
 
 void ProgramArgumentBinding::MergeSettings(const Base::ProgramArgumentBinding& other)
@@ -98,12 +98,21 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
     if (!Base::ProgramArgumentBinding::SetResourceViews(resource_views))
         return false;
 
-    META_CHECK_ARG_NOT_NULL(m_vk_descriptor_set_ptr);
+    // Descriptors of mutable argument binding are updated on GPU by the program bindings owning it,
+    // which is notified about resource views change with callback and keeps pending descriptor writes
+    if (m_settings_vk.argument.GetAccessorType() == Rhi::ProgramArgumentAccessType::Mutable)
+        return true;
 
-    m_vk_descriptor_images.clear();
-    m_vk_descriptor_buffers.clear();
-    m_vk_buffer_views.clear();
+    const Descriptors descriptors = GetDescriptors(resource_views);
+    const auto& vulkan_context = dynamic_cast<const IContext&>(GetContext());
+    vulkan_context.GetVulkanDevice().GetNativeDevice().updateDescriptorSets(GetDescriptorWrite(descriptors), {});
+    return true;
+}
 
+ProgramArgumentBinding::Descriptors ProgramArgumentBinding::GetDescriptors(const Rhi::IResource::Views& resource_views) const
+{
+    META_FUNCTION_TASK();
+    Descriptors descriptors;
     const size_t total_resources_count = resource_views.size();
     const Rhi::ResourceUsageMask resource_usage = GetResourceUsageByDescriptorType(m_settings_vk.descriptor_type);
 
@@ -111,49 +120,31 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
     {
         const ResourceView resource_view_vk(resource_view, resource_usage);
 
-        if (AddDescriptor(m_vk_descriptor_images, total_resources_count, resource_view_vk.GetNativeDescriptorImageInfoPtr()))
+        if (AddDescriptor(descriptors.images, total_resources_count, resource_view_vk.GetNativeDescriptorImageInfoPtr()))
             continue;
 
-        if (AddDescriptor(m_vk_descriptor_buffers, total_resources_count, resource_view_vk.GetNativeDescriptorBufferInfoPtr()))
+        if (AddDescriptor(descriptors.buffers, total_resources_count, resource_view_vk.GetNativeDescriptorBufferInfoPtr()))
             continue;
 
-        AddDescriptor(m_vk_buffer_views, total_resources_count, resource_view_vk.GetNativeBufferViewPtr());
+        AddDescriptor(descriptors.buffer_views, total_resources_count, resource_view_vk.GetNativeBufferViewPtr());
     }
+    return descriptors;
+}
 
-    m_vk_write_descriptor_set = vk::WriteDescriptorSet(
+vk::WriteDescriptorSet ProgramArgumentBinding::GetDescriptorWrite(const Descriptors& descriptors) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_vk_descriptor_set_ptr);
+    // Write descriptor set references descriptors vectors, which should be kept alive until descriptor sets are updated
+    return vk::WriteDescriptorSet(
         *m_vk_descriptor_set_ptr,
         m_vk_binding_value,
         0U,
         m_settings_vk.descriptor_type,
-        m_vk_descriptor_images,
-        m_vk_descriptor_buffers,
-        m_vk_buffer_views
+        descriptors.images,
+        descriptors.buffers,
+        descriptors.buffer_views
     );
-
-    // Descriptions are updated on GPU during context initialization complete
-    if (GetContext().GetOptions().HasBit(Rhi::ContextOption::DeferredProgramBindingsInitialization))
-    {
-        GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
-    }
-    else
-    {
-        UpdateDescriptorSetsOnGpu();
-    }
-    return true;
-}
-
-void ProgramArgumentBinding::UpdateDescriptorSetsOnGpu()
-{
-    META_FUNCTION_TASK();
-    if (m_vk_descriptor_images.empty() && m_vk_descriptor_buffers.empty() && m_vk_buffer_views.empty())
-        return;
-
-    const auto& vulkan_context = dynamic_cast<const IContext&>(GetContext());
-    vulkan_context.GetVulkanDevice().GetNativeDevice().updateDescriptorSets(m_vk_write_descriptor_set, {});
-
-    m_vk_descriptor_images.clear();
-    m_vk_descriptor_buffers.clear();
-    m_vk_buffer_views.clear();
 }
 
 } // namespace Methane::Graphics::Vulkan
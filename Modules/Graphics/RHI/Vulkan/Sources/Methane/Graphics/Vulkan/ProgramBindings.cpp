@@ -122,25 +122,18 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
         auto& program = static_cast<Program&>(GetProgram());
         const vk::DescriptorSetLayout& vk_mutable_desc_set_layout = program.GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Mutable);
         META_CHECK_ARG_NOT_NULL(vk_mutable_desc_set_layout);
-        vk::DescriptorSet copy_mutable_descriptor_set = program.GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(vk_mutable_desc_set_layout);
-
-        // Copy descriptors from original to new mutable descriptor set
-        const vk::Device& vk_device = program.GetVulkanContext().GetVulkanDevice().GetNativeDevice();
-        const Program::DescriptorSetLayoutInfo& mutable_desc_set_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
-        vk_device.updateDescriptorSets({}, {
-            vk::CopyDescriptorSet(other_program_bindings.m_descriptor_sets.back(), {}, {}, copy_mutable_descriptor_set, {}, mutable_desc_set_layout_info.descriptors_count)
-        });
-
         vk::DescriptorSet& vk_mutable_descriptor_set = m_descriptor_sets.back();
-        vk_mutable_descriptor_set = copy_mutable_descriptor_set;
+        vk_mutable_descriptor_set = program.GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(vk_mutable_desc_set_layout);
 
-        // Update mutable argument bindings with a pointer to the copied descriptor set
-        ForEachArgumentBinding([&vk_mutable_descriptor_set](const Rhi::IProgram::Argument&, ArgumentBinding& argument_binding)
+        // Update mutable argument bindings with a pointer to the new descriptor set and add pending writes of all their descriptors,
+        // instead of copying descriptors from the original set, so that the whole set is written with update template in one call
+        ForEachArgumentBinding([this, &vk_mutable_descriptor_set](const Rhi::IProgram::Argument&, ArgumentBinding& argument_binding)
         {
             if (argument_binding.GetVulkanSettings().argument.GetAccessorType() != Rhi::ProgramArgumentAccessType::Mutable)
                 return;
 
             argument_binding.SetDescriptorSet(vk_mutable_descriptor_set);
+            AddPendingDescriptorWrite(argument_binding, argument_binding.GetDescriptors(argument_binding.GetResourceViews()));
         });
     }
 
@@ -160,7 +153,10 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
 void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument)
 {
     META_FUNCTION_TASK();
+    // Descriptor writes of all changed argument bindings are accumulated and updated on GPU in a batch below
+    m_is_setting_resources = true;
     Base::ProgramBindings::SetResourcesForArguments(resource_views_by_argument);
+    m_is_setting_resources = false;
 
     auto& program = static_cast<Program&>(GetProgram());
     const Rhi::ProgramArgumentAccessors& program_argument_accessors = program.GetSettings().argument_accessors;
@@ -195,33 +191,171 @@ void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& re
         m_dynamic_offset_index_by_set_index.emplace_back(static_cast<uint32_t>(m_dynamic_offsets.size()));
         m_dynamic_offsets.insert(m_dynamic_offsets.end(), dynamic_offsets.begin(), dynamic_offsets.end());
     }
+
+    // Descriptions are updated on GPU during context initialization complete
+    if (const Base::Context& context = program.GetContext();
+        context.GetOptions().HasBit(Rhi::ContextOption::DeferredProgramBindingsInitialization))
+    {
+        context.RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
+    }
+    else
+    {
+        UpdateDescriptorSetsOnGpu();
+    }
 }
 
-void ProgramBindings::Initialize()
+bool ProgramBindings::SetArgumentResourceViews(IArgumentBinding& argument_binding, const Rhi::IResource::Views& resource_views)
 {
     META_FUNCTION_TASK();
-    static_cast<Program&>(GetProgram()).GetVulkanContext().GetVulkanDescriptorManager().AddProgramBindings(*this);
+    auto& argument_binding_vk = static_cast<ArgumentBinding&>(argument_binding);
+    if (!argument_binding_vk.SetResourceViewsWithoutUpdate(resource_views))
+        return false;
+
+    AddPendingDescriptorWrite(argument_binding_vk, argument_binding_vk.GetDescriptors(resource_views));
+    return true;
 }
 
-void ProgramBindings::CompleteInitialization()
+void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgumentBinding& argument_binding,
+                                                                   const Rhi::IResource::Views& old_resource_views,
+                                                                   const Rhi::IResource::Views& new_resource_views)
+{
+    META_FUNCTION_TASK();
+    Base::ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(argument_binding, old_resource_views, new_resource_views);
+    if (m_is_setting_resources)
+        return;
+
+    // Resource views of mutable argument binding were changed directly, not with program bindings
+    const auto& argument_binding_vk = static_cast<const ArgumentBinding&>(argument_binding);
+    AddPendingDescriptorWrite(argument_binding_vk, argument_binding_vk.GetDescriptors(new_resource_views));
+
+    // Descriptions are updated on GPU during context initialization complete
+    if (const Base::Context& context = static_cast<const Program&>(GetProgram()).GetContext();
+        context.GetOptions().HasBit(Rhi::ContextOption::DeferredProgramBindingsInitialization))
+    {
+        context.RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
+    }
+    else
+    {
+        UpdateDescriptorSetsOnGpu();
+    }
+}
+
+void ProgramBindings::AddPendingDescriptorWrite(const ArgumentBinding& argument_binding, ArgumentBinding::Descriptors&& descriptors)
+{
+    META_FUNCTION_TASK();
+    const auto pending_write_it = std::find_if(m_pending_descriptor_writes.begin(), m_pending_descriptor_writes.end(),
+                                               [&argument_binding](const PendingDescriptorWrite& pending_write)
+                                               { return pending_write.argument_binding_ptr == &argument_binding; });
+    if (pending_write_it != m_pending_descriptor_writes.end())
+        pending_write_it->descriptors = std::move(descriptors);
+    else
+        m_pending_descriptor_writes.push_back({ &argument_binding, std::move(descriptors) });
+}
+
+const ProgramBindings::PendingDescriptorWrite* ProgramBindings::FindPendingDescriptorWrite(const ArgumentBinding& argument_binding) const
+{
+    META_FUNCTION_TASK();
+    const auto pending_write_it = std::find_if(m_pending_descriptor_writes.begin(), m_pending_descriptor_writes.end(),
+                                               [&argument_binding](const PendingDescriptorWrite& pending_write)
+                                               { return pending_write.argument_binding_ptr == &argument_binding; });
+    return pending_write_it != m_pending_descriptor_writes.end() ? &*pending_write_it : nullptr;
+}
+
+template<typename VkDescriptorType, typename VkNativeDescriptorType>
+static void CopyDescriptorsToTemplateData(const std::vector<VkDescriptorType>& descriptors,
+                                          VkNativeDescriptorType Program::DescriptorUpdateTemplateData::* descriptor_member_ptr,
+                                          Program::DescriptorUpdateTemplateData* template_data_ptr)
 {
     META_FUNCTION_TASK();
-    META_LOG("Update descriptor sets on GPU for program bindings '{}'", GetName());
+    for(const VkDescriptorType& descriptor : descriptors)
+    {
+        template_data_ptr->*descriptor_member_ptr = static_cast<VkNativeDescriptorType>(descriptor);
+        ++template_data_ptr;
+    }
+}
 
-    ForEachArgumentBinding([](const Rhi::IProgram::Argument&, ArgumentBinding& argument_binding)
+void ProgramBindings::UpdateDescriptorSetsOnGpu()
+{
+    META_FUNCTION_TASK();
+    META_SCOPE_TIMER("Vulkan::ProgramBindings::UpdateDescriptorSetsOnGpu");
+    if (m_pending_descriptor_writes.empty())
+        return;
+
+    const auto& program = static_cast<const Program&>(GetProgram());
+    const Program::DescriptorSetLayoutInfo& mutable_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
+
+    // Mutable descriptor set is written with update template only when descriptors of all its bindings are pending
+    bool is_mutable_set_updated_with_template = m_has_mutable_descriptor_set;
+    ForEachArgumentBinding([this, &mutable_layout_info, &is_mutable_set_updated_with_template]
+                           (const Rhi::IProgram::Argument&, const ArgumentBinding& argument_binding)
     {
-        argument_binding.UpdateDescriptorSetsOnGpu();
+        if (argument_binding.GetVulkanSettings().argument.GetAccessorType() != Rhi::ProgramArgumentAccessType::Mutable)
+            return;
+
+        const uint32_t layout_descriptors_count = mutable_layout_info.bindings.at(argument_binding.GetBindingValue()).descriptorCount;
+        const PendingDescriptorWrite* pending_write_ptr = FindPendingDescriptorWrite(argument_binding);
+        if (!pending_write_ptr || pending_write_ptr->descriptors.GetCount() != layout_descriptors_count)
+            is_mutable_set_updated_with_template = false;
     });
+
+    std::vector<Program::DescriptorUpdateTemplateData> mutable_template_data;
+    if (is_mutable_set_updated_with_template)
+        mutable_template_data.resize(mutable_layout_info.descriptors_count);
+
+    std::vector<vk::WriteDescriptorSet> vk_write_descriptor_sets;
+    vk_write_descriptor_sets.reserve(m_pending_descriptor_writes.size());
+    for(const PendingDescriptorWrite& pending_write : m_pending_descriptor_writes)
+    {
+        const ArgumentBinding& argument_binding = *pending_write.argument_binding_ptr;
+        if (!is_mutable_set_updated_with_template ||
+            argument_binding.GetVulkanSettings().argument.GetAccessorType() != Rhi::ProgramArgumentAccessType::Mutable)
+        {
+            vk_write_descriptor_sets.emplace_back(argument_binding.GetDescriptorWrite(pending_write.descriptors));
+            continue;
+        }
+
+        Program::DescriptorUpdateTemplateData* template_data_ptr = mutable_template_data.data() +
+                                                                   mutable_layout_info.descriptor_offsets.at(argument_binding.GetBindingValue());
+        CopyDescriptorsToTemplateData(pending_write.descriptors.images,       &Program::DescriptorUpdateTemplateData::image_info,  template_data_ptr);
+        CopyDescriptorsToTemplateData(pending_write.descriptors.buffers,      &Program::DescriptorUpdateTemplateData::buffer_info, template_data_ptr);
+        CopyDescriptorsToTemplateData(pending_write.descriptors.buffer_views, &Program::DescriptorUpdateTemplateData::buffer_view, template_data_ptr);
+    }
+
+    const vk::Device& vk_device = program.GetVulkanContext().GetVulkanDevice().GetNativeDevice();
+    if (!vk_write_descriptor_sets.empty())
+    {
+        vk_device.updateDescriptorSets(vk_write_descriptor_sets, {});
+    }
+    if (is_mutable_set_updated_with_template)
+    {
+        vk_device.updateDescriptorSetWithTemplate(m_descriptor_sets.back(),
+                                                  program.GetNativeDescriptorUpdateTemplate(Rhi::ProgramArgumentAccessType::Mutable),
+                                                  mutable_template_data.data());
+    }
+
+    m_pending_descriptor_writes.clear();
+}
+
+void ProgramBindings::Initialize()
+{
+    META_FUNCTION_TASK();
+    static_cast<Program&>(GetProgram()).GetVulkanContext().GetVulkanDescriptorManager().AddProgramBindings(*this);
+}
+
+void ProgramBindings::CompleteInitialization()
+{
+    META_FUNCTION_TASK();
+    UpdateDescriptorSetsOnGpu();
 }
 
 void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
-    Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetCommandQueue(),
+    Apply(command_list, dynamic_cast<ICommandList&>(command_list), command_list.GetCommandQueue(),
           command_list.GetProgramBindingsPtr(), apply_behavior);
 }
 
-void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQueue& command_queue,
+void ProgramBindings::Apply(Base::CommandList& command_list, ICommandList& command_list_vk, const Rhi::ICommandQueue& command_queue,
                             const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
@@ -247,7 +381,7 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
     // Set resource transition barriers before applying resource bindings
     if (apply_behavior.HasAnyBit(ApplyBehavior::StateBarriers))
     {
-        Base::ProgramBindings::ApplyResourceTransitionBarriers(command_list_vk, apply_access, &command_queue);
+        Base::ProgramBindings::ApplyResourceTransitionBarriers(command_list, apply_access, &command_queue);
     }
 
     const vk::CommandBuffer&    vk_command_buffer      = command_list_vk.GetNativeCommandBufferDefault();
@@ -275,10 +409,10 @@ template<typename FuncType> // function void(const Rhi::IProgram::Argument&, Arg
 void ProgramBindings::ForEachArgumentBinding(FuncType argument_binding_function) const
 {
     META_FUNCTION_TASK();
-    for (auto& [program_argument, argument_binding_ptr] : GetArgumentBindings())
+    for (const Ptr<Base::ProgramArgumentBinding>& argument_binding_ptr : GetArgumentBindings())
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
-        argument_binding_function(program_argument, static_cast<ArgumentBinding&>(*argument_binding_ptr));
+        argument_binding_function(argument_binding_ptr->GetSettings().argument, static_cast<ArgumentBinding&>(*argument_binding_ptr));
     }
 }
 
@@ -70,6 +70,16 @@ static vk::CommandBufferInheritanceInfo CreateCommandBufferInheritInfo(const Ren
     );
 }
 
+static vk::CommandBufferInheritanceInfo CreateBundleCommandBufferInheritInfo(const RenderPass& render_pass) noexcept
+{
+    META_FUNCTION_TASK();
+    // Frame buffer is not specified for bundles, since they are executed with render passes of different frames
+    return vk::CommandBufferInheritanceInfo(
+        render_pass.GetVulkanPattern().GetNativeRenderPass(),
+        0U // sub-pass
+    );
+}
+
 RenderCommandList::RenderCommandList(CommandQueue& command_queue)
     : CommandList(vk::CommandBufferInheritanceInfo(), command_queue)
     , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
@@ -83,6 +93,18 @@ RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& re
     static_cast<Data::IEmitter<IRenderPassCallback>&>(render_pass).Connect(*this);
 }
 
+RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass, bool is_bundle)
+    : CommandList(is_bundle ? CreateBundleCommandBufferInheritInfo(render_pass) : CreateCommandBufferInheritInfo(render_pass),
+                  command_queue, render_pass, is_bundle)
+    , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
+{
+    META_FUNCTION_TASK();
+    if (!is_bundle)
+    {
+        static_cast<Data::IEmitter<IRenderPassCallback>&>(render_pass).Connect(*this);
+    }
+}
+
 RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_command_list, bool is_beginning_cmd_list)
     : CommandList(CreateCommandBufferInheritInfo(parallel_render_command_list.GetVulkanRenderPass()), parallel_render_command_list, is_beginning_cmd_list)
     , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
@@ -93,16 +115,22 @@ RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_
 void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
+    CommandList::ResetCommittedBundle();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    CommandList::ReleaseExecutedBundles();
+    m_vk_render_pass_command_buffers.clear();
 }
 
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
 {
     META_FUNCTION_TASK();
+    CommandList::ResetCommittedBundle();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    CommandList::ReleaseExecutedBundles();
     CommandList::SetRenderState(render_state);
+    m_vk_render_pass_command_buffers.clear();
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
@@ -152,6 +180,8 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    if (!IsRenderStateApplied())
+        return; // Draw is skipped until render state compilation is completed
 
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().drawIndexed(index_count, instance_count, start_index, start_vertex, start_instance);
@@ -162,25 +192,57 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    if (!IsRenderStateApplied())
+        return; // Draw is skipped until render state compilation is completed
 
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::ExecuteBundle(Rhi::IRenderCommandList& bundle)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::ExecuteBundle(bundle);
+
+    // Bundle synchronization commands are executed in primary command buffer before render pass begin
+    const auto& vk_bundle = static_cast<const RenderCommandList&>(bundle);
+    GetNativeCommandBuffer(CommandBufferType::Primary).executeCommands(vk_bundle.GetNativeCommandBuffer(CommandBufferType::Primary));
+
+    // Render pass commands encoded before the bundle are committed to the separate secondary command buffer
+    // and encoding continues to the new secondary command buffer, so that all of them are executed in order on commit
+    CommitCommandBuffer(CommandBufferType::SecondaryRenderPass);
+    m_vk_render_pass_command_buffers.push_back(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+    m_vk_render_pass_command_buffers.push_back(vk_bundle.GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+    UpdateCommandBufferInheritInfo<CommandBufferType::SecondaryRenderPass>(CreateCommandBufferInheritInfo(GetVulkanPass()), false);
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_FALSE(IsCommitted());
 
-    if (!IsParallel())
+    if (!IsParallel() && !IsBundle())
     {
+        // Pending barriers are written to the primary command buffer before render pass begin,
+        // since barriers can not be set after render pass commands, which are executed from secondary command buffers
+        FlushPendingResourceBarriers();
         CommitCommandBuffer(CommandBufferType::SecondaryRenderPass);
 
         auto render_pass_ptr = static_cast<RenderPass*>(GetPassPtr());
         if (render_pass_ptr)
             render_pass_ptr->Begin(*this);
 
-        GetNativeCommandBuffer(CommandBufferType::Primary).executeCommands(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+        const vk::CommandBuffer& vk_primary_cmd_buffer = GetNativeCommandBuffer(CommandBufferType::Primary);
+        if (m_vk_render_pass_command_buffers.empty())
+        {
+            vk_primary_cmd_buffer.executeCommands(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+        }
+        else
+        {
+            m_vk_render_pass_command_buffers.push_back(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+            vk_primary_cmd_buffer.executeCommands(m_vk_render_pass_command_buffers);
+            m_vk_render_pass_command_buffers.clear();
+        }
 
         if (render_pass_ptr)
             render_pass_ptr->End(*this);
@@ -200,34 +200,57 @@ RenderState::RenderState(const Base::RenderContext& context, const Settings& set
     Reset(settings);
 }
 
+RenderState::~RenderState()
+{
+    META_FUNCTION_TASK();
+    // Asynchronous compilation tasks must be completed before release of the native pipelines
+    WaitForCompilation();
+}
+
 void RenderState::Reset(const Settings& settings)
 {
     META_FUNCTION_TASK();
+    WaitForCompilation();
     Base::RenderState::Reset(settings);
 
     if (IsNativePipelineDynamic())
     {
-        m_vk_pipeline_dynamic = CreateNativePipeline();
+        Compile([this]()
+        {
+            vk::UniquePipeline vk_pipeline_dynamic = CreateNativePipeline();
+            std::lock_guard lock(m_mutex);
+            SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_dynamic.get(), Base::Object::GetName());
+            m_vk_pipeline_dynamic = std::move(vk_pipeline_dynamic);
+        });
     }
     else
     {
+        std::lock_guard lock(m_mutex);
         m_vk_pipeline_monolithic_by_id.clear();
+        m_vk_pipeline_monolithic_compiling_ids.clear();
     }
 }
 
-void RenderState::Apply(Base::RenderCommandList& render_command_list, Groups /*state_groups*/)
+bool RenderState::Apply(Base::RenderCommandList& render_command_list, Groups /*state_groups*/)
 {
     META_FUNCTION_TASK();
+    RethrowCompileError();
+
     const auto& vulkan_render_command_list = static_cast<RenderCommandList&>(render_command_list);
-    const vk::Pipeline& vk_pipeline_state = IsNativePipelineDynamic()
-                                          ? GetNativePipelineDynamic()
-                                          : GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
+    const vk::Pipeline vk_pipeline_state = IsNativePipelineDynamic()
+                                         ? GetNativePipelineDynamic()
+                                         : GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
+    if (!vk_pipeline_state)
+        return false;
+
     vulkan_render_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eGraphics, vk_pipeline_state);
+    return true;
 }
 
 bool RenderState::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
     if (!Base::RenderState::SetName(name))
         return false;
 
@@ -245,31 +268,46 @@ bool RenderState::SetName(std::string_view name)
     return true;
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineDynamic() const
+vk::Pipeline RenderState::GetNativePipelineDynamic() const
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_TRUE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline is not supported by device");
+    if (!IsCompiled())
+        return {};
+
+    std::lock_guard lock(m_mutex);
     return m_vk_pipeline_dynamic.get();
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
+vk::Pipeline RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_FALSE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline should be used");
-    std::lock_guard lock(m_mutex);
+    std::unique_lock lock(m_mutex);
 
     const PipelineId pipeline_id(static_cast<Rhi::IViewState*>(&view_state), render_primitive);
     const auto pipeline_monolithic_by_id_it = m_vk_pipeline_monolithic_by_id.find(pipeline_id);
-    if (pipeline_monolithic_by_id_it == m_vk_pipeline_monolithic_by_id.end())
+    if (pipeline_monolithic_by_id_it != m_vk_pipeline_monolithic_by_id.end())
+        return pipeline_monolithic_by_id_it->second.get();
+
+    if (m_vk_pipeline_monolithic_compiling_ids.count(pipeline_id))
+        return {};
+
+    view_state.Connect(*this);
+
+    if (!GetSettings().async_compilation_enabled)
     {
-        view_state.Connect(*this);
-        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, CreateNativePipeline(&view_state, render_primitive)).first->second.get();
+        vk::UniquePipeline vk_pipeline_monolithic = CreateNativePipeline(&view_state, render_primitive);
+        SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_monolithic.get(), Base::Object::GetName());
+        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, std::move(vk_pipeline_monolithic)).first->second.get();
     }
 
-    return pipeline_monolithic_by_id_it->second.get();
+    lock.unlock();
+    CompileNativePipelineMonolithic(pipeline_id);
+    return {};
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
+vk::Pipeline RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.view_state_ptr, "view state is not set in render command list drawing state");
@@ -277,6 +315,39 @@ const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderD
     return GetNativePipelineMonolithic(static_cast<ViewState&>(*drawing_state.view_state_ptr), drawing_state.primitive_type_opt.value());
 }
 
+void RenderState::CompileNativePipelineMonolithic(const PipelineId& pipeline_id)
+{
+    META_FUNCTION_TASK();
+    {
+        // Pipeline id is marked as compiling instead of caching null pipeline for it,
+        // so that failed compilation is not cached and is retried on the next draw
+        std::lock_guard lock(m_mutex);
+        m_vk_pipeline_monolithic_compiling_ids.insert(pipeline_id);
+    }
+
+    Compile([this, pipeline_id]()
+    {
+        vk::UniquePipeline vk_pipeline_monolithic;
+        try
+        {
+            vk_pipeline_monolithic = CreateNativePipeline(static_cast<const ViewState*>(std::get<0>(pipeline_id)), std::get<1>(pipeline_id));
+        }
+        catch(...)
+        {
+            std::lock_guard lock(m_mutex);
+            m_vk_pipeline_monolithic_compiling_ids.erase(pipeline_id);
+            throw;
+        }
+
+        std::lock_guard lock(m_mutex);
+        if (!m_vk_pipeline_monolithic_compiling_ids.erase(pipeline_id))
+            return;
+
+        SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_monolithic.get(), Base::Object::GetName());
+        m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, std::move(vk_pipeline_monolithic));
+    });
+}
+
 vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state_ptr, Opt<Rhi::RenderPrimitive> render_primitive_opt) const
 {
     META_FUNCTION_TASK();
@@ -414,29 +485,47 @@ vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state
         render_pattern.GetNativeRenderPass()
     );
 
-    auto pipe = m_vk_render_context.GetVulkanDevice().GetNativeDevice().createGraphicsPipelineUnique(nullptr, vk_pipeline_create_info);
+    META_SCOPE_TIMER("Vulkan::RenderState::CreatePipeline");
+    const Device& device = m_vk_render_context.GetVulkanDevice();
+    auto pipe = device.GetNativeDevice().createGraphicsPipelineUnique(device.GetNativePipelineCache(), vk_pipeline_create_info);
     META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-
-    SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), pipe.value.get(), Base::Object::GetName());
     return std::move(pipe.value);
 }
 
 void RenderState::OnViewStateChanged(Rhi::IViewState& view_state)
 {
     META_FUNCTION_TASK();
-    std::lock_guard lock(m_mutex);
+    WaitForCompilation();
 
-    for(auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
-        if (std::get<0>(pipeline_id) == &view_state)
+    std::vector<PipelineId> changed_pipeline_ids;
+    {
+        std::lock_guard lock(m_mutex);
+        for(auto vk_pipeline_it = m_vk_pipeline_monolithic_by_id.begin();
+            vk_pipeline_it != m_vk_pipeline_monolithic_by_id.end();)
         {
-            m_vk_render_context.DeferredRelease(std::move(vk_pipeline_monolithic));
-            vk_pipeline_monolithic = CreateNativePipeline(static_cast<const ViewState*>(&view_state), std::get<1>(pipeline_id));
+            if (std::get<0>(vk_pipeline_it->first) != &view_state)
+            {
+                vk_pipeline_it++;
+                continue;
+            }
+
+            m_vk_render_context.DeferredRelease(std::move(vk_pipeline_it->second));
+            changed_pipeline_ids.emplace_back(vk_pipeline_it->first);
+            vk_pipeline_it = m_vk_pipeline_monolithic_by_id.erase(vk_pipeline_it);
         }
+    }
+
+    for(const PipelineId& pipeline_id : changed_pipeline_ids)
+    {
+        CompileNativePipelineMonolithic(pipeline_id);
+    }
 }
 
 void RenderState::OnViewStateDestroyed(Rhi::IViewState& view_state)
 {
     META_FUNCTION_TASK();
+    // Wait for asynchronous compilation tasks which may use destroyed view state
+    WaitForCompilation();
     std::lock_guard lock(m_mutex);
 
     for(auto vk_pipeline_it = m_vk_pipeline_monolithic_by_id.begin();
@@ -76,6 +76,23 @@ static void UpdateImageMemoryOwnerChangeBarrier(vk::ImageMemoryBarrier& vk_image
     vk_image_memory_barrier.setDstQueueFamilyIndex(owner_change.GetQueueFamilyAfter());
 }
 
+static vk::ImageSubresourceRange GetNativeImageSubresourceRange(const Texture& texture, const Rhi::ResourceBarrier::Id& id)
+{
+    META_FUNCTION_TASK();
+    vk::ImageSubresourceRange vk_subresource_range = texture.GetNativeSubresourceRange();
+    const Opt<Rhi::SubResource::Index>& subresource_index_opt = id.GetSubResourceIndex();
+    if (!subresource_index_opt)
+        return vk_subresource_range;
+
+    // Depth slices of 3D texture can not be transitioned separately, so sub-resource barrier selects single mip of single layer
+    const Rhi::SubResource::Count subresource_count = texture.GetSubresourceCount();
+    vk_subresource_range.setBaseMipLevel(subresource_index_opt->GetMipLevel());
+    vk_subresource_range.setLevelCount(1U);
+    vk_subresource_range.setBaseArrayLayer(subresource_index_opt->GetBaseLayerIndex(subresource_count));
+    vk_subresource_range.setLayerCount(1U);
+    return vk_subresource_range;
+}
+
 ResourceBarriers::ResourceBarriers(const Set& barriers)
     : Base::ResourceBarriers(barriers)
 {
@@ -89,8 +106,7 @@ ResourceBarriers::ResourceBarriers(const Set& barriers)
 Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Rhi::ResourceBarrier::Id& id, const Rhi::ResourceBarrier& barrier)
 {
     META_FUNCTION_TASK();
-    const auto      lock_guard = Base::ResourceBarriers::Lock();
-    const AddResult result     = Base::ResourceBarriers::Add(id, barrier);
+    const AddResult result = Base::ResourceBarriers::Add(id, barrier);
 
     switch (result)
     {
@@ -106,7 +122,6 @@ Base::ResourceBarriers::AddResult ResourceBarriers::Add(const Rhi::ResourceBarri
 bool ResourceBarriers::Remove(const Rhi::ResourceBarrier::Id& id)
 {
     META_FUNCTION_TASK();
-    const auto lock_guard = Base::ResourceBarriers::Lock();
     if (!Base::ResourceBarriers::Remove(id))
         return false;
 
@@ -117,20 +132,39 @@ bool ResourceBarriers::Remove(const Rhi::ResourceBarrier::Id& id)
             resource_type)
     {
     case Rhi::ResourceType::Buffer:  RemoveBufferMemoryBarrier(dynamic_cast<const Buffer&>(resource).GetNativeResource(), barrier_type); break;
-    case Rhi::ResourceType::Texture: RemoveImageMemoryBarrier(dynamic_cast<const Texture&>(resource).GetNativeImage(), barrier_type); break;
+    case Rhi::ResourceType::Texture:
+    {
+        const auto& texture = dynamic_cast<const Texture&>(resource);
+        RemoveImageMemoryBarrier(texture.GetNativeImage(), GetNativeImageSubresourceRange(texture, id), barrier_type);
+    } break;
     default: META_UNEXPECTED_ARG_DESCR(resource_type, "resource type is not supported by transitions");
     }
 
     if (barrier_type == Rhi::ResourceBarrier::Type::StateTransition)
     {
         UpdateStageMasks();
-        static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
+        if (!HasResourceBarriers(resource))
+            static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
     }
 
     m_vk_barrier_by_queue_family.clear();
     return true;
 }
 
+void ResourceBarriers::Clear()
+{
+    META_FUNCTION_TASK();
+    for(const Rhi::ResourceBarrier& barrier : GetBarriers())
+    {
+        static_cast<Data::IEmitter<IResourceCallback>&>(barrier.GetId().GetResource()).Disconnect(*this);
+    }
+
+    // All native barriers are cleared at once instead of removing them one by one
+    m_vk_default_barrier = NativePipelineBarrier();
+    m_vk_barrier_by_queue_family.clear();
+    Base::ResourceBarriers::Clear();
+}
+
 template<typename T>
 void UpdateNativeBarrierAccessFlags(std::vector<T>& vk_native_barriers, vk::AccessFlags vk_supported_access_flags)
 {
@@ -166,7 +200,7 @@ const ResourceBarriers::NativePipelineBarrier& ResourceBarriers::GetNativePipeli
 void ResourceBarriers::OnResourceReleased(Rhi::IResource& resource)
 {
     META_FUNCTION_TASK();
-    RemoveStateTransition(resource);
+    RemoveResourceBarriers(resource);
 }
 
 void ResourceBarriers::SetResourceBarrier(const Rhi::ResourceBarrier::Id& id, const Rhi::ResourceBarrier& barrier, bool is_new_barrier)
@@ -225,17 +259,19 @@ void ResourceBarriers::SetImageMemoryBarrier(const Texture& texture, const Rhi::
 {
     META_FUNCTION_TASK();
     const vk::Image& vk_image = texture.GetNativeImage();
+    const vk::ImageSubresourceRange vk_subresource_range = GetNativeImageSubresourceRange(texture, barrier.GetId());
     const auto vk_image_memory_barrier_it = std::find_if(m_vk_default_barrier.vk_image_memory_barriers.begin(),
                                                          m_vk_default_barrier.vk_image_memory_barriers.end(),
-                                                         [&vk_image](const vk::ImageMemoryBarrier& vk_image_barrier)
-                                                         { return vk_image_barrier.image == vk_image; });
+                                                         [&vk_image, &vk_subresource_range](const vk::ImageMemoryBarrier& vk_image_barrier)
+                                                         { return vk_image_barrier.image == vk_image &&
+                                                                  vk_image_barrier.subresourceRange == vk_subresource_range; });
 
     if (vk_image_memory_barrier_it == m_vk_default_barrier.vk_image_memory_barriers.end())
     {
         switch(barrier.GetId().GetType())
         {
-        case Rhi::ResourceBarrier::Type::StateTransition: AddImageMemoryStateChangeBarrier(texture, barrier.GetStateChange()); break;
-        case Rhi::ResourceBarrier::Type::OwnerTransition: AddImageMemoryOwnerChangeBarrier(texture, barrier.GetOwnerChange()); break;
+        case Rhi::ResourceBarrier::Type::StateTransition: AddImageMemoryStateChangeBarrier(texture, vk_subresource_range, barrier.GetStateChange()); break;
+        case Rhi::ResourceBarrier::Type::OwnerTransition: AddImageMemoryOwnerChangeBarrier(texture, vk_subresource_range, barrier.GetOwnerChange()); break;
         }
     }
     else
@@ -281,7 +317,8 @@ void ResourceBarriers::AddBufferMemoryOwnerChangeBarrier(const Buffer& buffer, c
     );
 }
 
-void ResourceBarriers::AddImageMemoryStateChangeBarrier(const Texture& texture, const Rhi::ResourceBarrier::StateChange& state_change)
+void ResourceBarriers::AddImageMemoryStateChangeBarrier(const Texture& texture, const vk::ImageSubresourceRange& vk_subresource_range,
+                                                        const Rhi::ResourceBarrier::StateChange& state_change)
 {
     META_FUNCTION_TASK();
     m_vk_default_barrier.vk_image_memory_barriers.emplace_back(
@@ -292,11 +329,12 @@ void ResourceBarriers::AddImageMemoryStateChangeBarrier(const Texture& texture,
         VK_QUEUE_FAMILY_IGNORED,
         VK_QUEUE_FAMILY_IGNORED,
         texture.GetNativeImage(),
-        texture.GetNativeSubresourceRange()
+        vk_subresource_range
     );
 }
 
-void ResourceBarriers::AddImageMemoryOwnerChangeBarrier(const Texture& texture, const Rhi::ResourceBarrier::OwnerChange& owner_change)
+void ResourceBarriers::AddImageMemoryOwnerChangeBarrier(const Texture& texture, const vk::ImageSubresourceRange& vk_subresource_range,
+                                                        const Rhi::ResourceBarrier::OwnerChange& owner_change)
 {
     META_FUNCTION_TASK();
     const uint32_t family_index_before = owner_change.GetQueueFamilyBefore();
@@ -313,7 +351,7 @@ void ResourceBarriers::AddImageMemoryOwnerChangeBarrier(const Texture& texture,
         family_index_before,
         family_index_after,
         texture.GetNativeImage(),
-        texture.GetNativeSubresourceRange()
+        vk_subresource_range
     );
 }
 
@@ -338,13 +376,15 @@ void ResourceBarriers::RemoveBufferMemoryBarrier(const vk::Buffer& vk_buffer, Rh
     }
 }
 
-void ResourceBarriers::RemoveImageMemoryBarrier(const vk::Image& vk_image, Rhi::ResourceBarrier::Type barrier_type)
+void ResourceBarriers::RemoveImageMemoryBarrier(const vk::Image& vk_image, const vk::ImageSubresourceRange& vk_subresource_range,
+                                                Rhi::ResourceBarrier::Type barrier_type)
 {
     META_FUNCTION_TASK();
     const auto vk_image_memory_barrier_it = std::find_if(m_vk_default_barrier.vk_image_memory_barriers.begin(),
                                                          m_vk_default_barrier.vk_image_memory_barriers.end(),
-                                                         [&vk_image](const vk::ImageMemoryBarrier& vk_image_barrier)
-                                                         { return vk_image_barrier.image == vk_image; });
+                                                         [&vk_image, &vk_subresource_range](const vk::ImageMemoryBarrier& vk_image_barrier)
+                                                         { return vk_image_barrier.image == vk_image &&
+                                                                  vk_image_barrier.subresourceRange == vk_subresource_range; });
     if (vk_image_memory_barrier_it == m_vk_default_barrier.vk_image_memory_barriers.end())
         return;
 
@@ -364,7 +404,7 @@ void ResourceBarriers::UpdateStageMasks()
     META_FUNCTION_TASK();
     m_vk_default_barrier.vk_src_stage_mask = {};
     m_vk_default_barrier.vk_dst_stage_mask = {};
-    for(const auto& [barrier_id, barrier] : Base::ResourceBarriers::GetMap())
+    for(const Rhi::ResourceBarrier& barrier : Base::ResourceBarriers::GetBarriers())
     {
         UpdateStageMasks(barrier);
     }
@@ -26,6 +26,7 @@ Vulkan implementation of the shader interface.
 #include <Methane/Graphics/Vulkan/IContext.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/ProgramBindings.h>
+#include <Methane/Graphics/Vulkan/Types.h>
 
 #include <Methane/Data/IProvider.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -352,7 +353,10 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
         const std::string&           semantic_name    = spirv_compiler.get_decoration_string(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
         const uint32_t               input_location   = spirv_compiler.get_decoration(input_resource.id, spv::DecorationLocation);
         const spirv_cross::SPIRType& attribute_type   = spirv_compiler.get_type(input_resource.base_type_id);
-        const vk::Format             attribute_format = GetVertexAttributeFormatFromSpirvType(attribute_type);
+        const PixelFormat            argument_format  = GetProgramInputArgumentFormatBySemantic(program, semantic_name);
+        const vk::Format             attribute_format = argument_format == PixelFormat::Unknown
+                                                      ? GetVertexAttributeFormatFromSpirvType(attribute_type)
+                                                      : TypeConverter::PixelFormatToVulkan(argument_format);
 
         const uint32_t buffer_index = GetProgramInputBufferIndexByArgumentSemantic(program, semantic_name);
         META_CHECK_ARG_LESS(buffer_index, m_vertex_input_binding_descriptions.size());
@@ -374,8 +378,10 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
                << ";" << std::endl;
 #endif
 
-        // Tight packing of attributes in vertex buffer is assumed
-        input_binding_desc.stride += attribute_type.vecsize * 4;
+        // Tight packing of attributes in vertex buffer is assumed, explicit formats are used for compact vertex layouts
+        input_binding_desc.stride += argument_format == PixelFormat::Unknown
+                                   ? attribute_type.vecsize * 4
+                                   : GetPixelSize(argument_format);
     }
 
     META_LOG("{}", log_ss.str());
@@ -0,0 +1,138 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRingBuffer.cpp
+Vulkan context-wide persistently mapped staging ring buffer used for resource uploads.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/StagingRingBuffer.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Vulkan
+{
+
+StagingRingBuffer::StagingRingBuffer(const Device& device, vk::DeviceSize size)
+    : m_size(size)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = device.GetNativeDevice();
+    m_vk_unique_buffer = vk_device.createBufferUnique(
+        vk::BufferCreateInfo(vk::BufferCreateFlags{},
+                             size,
+                             vk::BufferUsageFlagBits::eTransferSrc,
+                             vk::SharingMode::eExclusive)
+    );
+
+    const vk::MemoryRequirements  vk_memory_requirements = vk_device.getBufferMemoryRequirements(m_vk_unique_buffer.get());
+    const vk::MemoryPropertyFlags vk_memory_flags        = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    const Opt<uint32_t> memory_type_opt = device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_memory_flags);
+    META_CHECK_ARG_TRUE_DESCR(memory_type_opt.has_value(), "suitable memory type for staging ring buffer was not found");
+
+    m_memory_allocation = device.GetMemoryAllocator().Allocate(vk_memory_requirements, *memory_type_opt, MemoryResourceType::Buffer, true);
+    vk_device.bindBufferMemory(m_vk_unique_buffer.get(), m_memory_allocation.GetNativeDeviceMemory(), m_memory_allocation.GetOffset());
+    SetVulkanObjectName(vk_device, m_vk_unique_buffer.get(), "Staging Ring Buffer");
+}
+
+StagingRingBuffer::~StagingRingBuffer() = default;
+
+Opt<StagingRingBuffer::Range> StagingRingBuffer::Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(size);
+    META_CHECK_ARG_NOT_ZERO(alignment);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(size, GetMaxChunkSize(), "staging data chunk size exceeds the limit of staging ring buffer");
+
+    // Command list is connected before ring lock, because its state change is emitted under command list emitter lock
+    upload_cmd_list.Connect(*this);
+
+    std::scoped_lock lock_guard(m_mutex);
+    const Opt<vk::DeviceSize> offset_opt = AllocateOffset(size, alignment);
+    if (!offset_opt)
+        return std::nullopt;
+
+    if (m_pending_ranges.empty())
+        m_tail = *offset_opt;
+
+    m_head = *offset_opt + size;
+    m_pending_ranges.push_back({ *offset_opt, m_head, &upload_cmd_list, false });
+    return Range{ m_vk_unique_buffer.get(), *offset_opt, size, m_memory_allocation.GetMappedDataPtr(*offset_opt, size) };
+}
+
+Opt<vk::DeviceSize> StagingRingBuffer::AllocateOffset(vk::DeviceSize size, vk::DeviceSize alignment) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_pending_ranges.empty())
+        return vk::DeviceSize(0U);
+
+    const vk::DeviceSize aligned_head = (m_head + alignment - 1U) / alignment * alignment;
+    if (m_head > m_tail)
+    {
+        // Pending ranges are not wrapped: free space is at the end and at the beginning of the buffer
+        if (aligned_head + size <= m_size)
+            return aligned_head;
+
+        if (size <= m_tail)
+            return vk::DeviceSize(0U);
+
+        return std::nullopt;
+    }
+
+    // Pending ranges are wrapped: free space is between head and tail
+    if (aligned_head + size <= m_tail)
+        return aligned_head;
+
+    return std::nullopt;
+}
+
+void StagingRingBuffer::OnCommandListStateChanged(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    // Command list goes to pending state on execution completion, so its staging data is not used by GPU anymore
+    if (command_list.GetState() != Rhi::CommandListState::Pending)
+        return;
+
+    std::scoped_lock lock_guard(m_mutex);
+    for(PendingRange& pending_range : m_pending_ranges)
+    {
+        if (pending_range.cmd_list_ptr == &command_list)
+            pending_range.is_released = true;
+    }
+
+    // Ring space is reclaimed in allocation order, so ranges released by other command lists wait for the oldest ones
+    while(!m_pending_ranges.empty() && m_pending_ranges.front().is_released)
+    {
+        m_pending_ranges.pop_front();
+    }
+
+    if (m_pending_ranges.empty())
+    {
+        m_head = 0U;
+        m_tail = 0U;
+    }
+    else
+    {
+        m_tail = m_pending_ranges.front().begin;
+    }
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -24,6 +24,8 @@ Vulkan implementation of the texture interface.
 #include <Methane/Graphics/Vulkan/Texture.h>
 #include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
+#include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/ResourceBarriers.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/Types.h>
 
@@ -32,10 +34,31 @@ Vulkan implementation of the texture interface.
 #include <Methane/Checks.hpp>
 
 #include <algorithm>
+#include <numeric>
 
 namespace Methane::Graphics::Vulkan
 {
 
+// Barriers are recorded to the given command buffer to keep their order with commands encoded in it
+static void SetNativeResourceBarriers(const vk::CommandBuffer& vk_cmd_buffer, const CommandQueue& cmd_queue,
+                                      const Ptr<Rhi::IResourceBarriers>& resource_barriers_ptr)
+{
+    META_FUNCTION_TASK();
+    if (!resource_barriers_ptr || resource_barriers_ptr->IsEmpty())
+        return;
+
+    const auto& vulkan_resource_barriers = static_cast<const ResourceBarriers&>(*resource_barriers_ptr);
+    const ResourceBarriers::NativePipelineBarrier& pipeline_barrier = vulkan_resource_barriers.GetNativePipelineBarrierData(cmd_queue);
+    vk_cmd_buffer.pipelineBarrier(
+        pipeline_barrier.vk_src_stage_mask,
+        pipeline_barrier.vk_dst_stage_mask,
+        vk::DependencyFlags{},
+        pipeline_barrier.vk_memory_barriers,
+        pipeline_barrier.vk_buffer_memory_barriers,
+        pipeline_barrier.vk_image_memory_barriers
+    );
+}
+
 vk::ImageAspectFlags Texture::GetNativeImageAspectFlags(const Rhi::TextureSettings& settings)
 {
     META_FUNCTION_TASK();
@@ -265,23 +288,10 @@ void Texture::InitializeAsImage()
     const Settings& settings = GetSettings();
     META_CHECK_ARG_EQUAL(settings.type, Rhi::TextureType::Image);
 
-    // Allocate resource primary memory
+    // Allocate resource primary memory, image data is uploaded through the context staging ring buffer
     const vk::Device& vk_device = GetNativeDevice();
-    const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
-    AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = vk_device.createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-                             vk_image_memory_requirements.size,
-                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
-                             vk::SharingMode::eExclusive)
-    );
-
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -290,10 +300,10 @@ void Texture::InitializeAsRenderTarget()
     const Settings& settings = GetSettings();
     META_CHECK_ARG_EQUAL(settings.type, Rhi::TextureType::RenderTarget);
 
-    // Allocate resource primary memory
+    // Allocate dedicated resource primary memory, since render targets are big and rarely re-created
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal, true);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::InitializeAsDepthStencil()
@@ -307,10 +317,10 @@ void Texture::InitializeAsDepthStencil()
     META_CHECK_ARG_FALSE_DESCR(settings.mipmapped, "depth-stencil texture does not support mip-map mode");
     META_CHECK_ARG_EQUAL_DESCR(settings.array_length, 1U, "depth-stencil texture does not support arrays");
 
-    // Allocate resource primary memory
+    // Allocate dedicated resource primary memory, since render targets are big and rarely re-created
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal, true);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::ResetNativeFrameImage()
@@ -335,46 +345,55 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
 
     Base::Texture::SetData(target_cmd_queue, sub_resources);
 
-    m_vk_copy_regions.clear();
-    m_vk_copy_regions.reserve(sub_resources.size());
-
+    const Settings&           settings          = GetSettings();
     const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    vk::DeviceSize sub_resource_offset = 0U;
-
+    const vk::Extent3D        image_extent      = TypeConverter::FrameSizeToExtent3D(settings.dimensions.AsRectSize());
+    const vk::DeviceSize      pixel_size        = GetPixelSize(settings.pixel_format);
+    const vk::DeviceSize      bytes_per_row     = image_extent.width * pixel_size;
+    const vk::DeviceSize      staging_alignment = std::lcm(vk::DeviceSize(4U), pixel_size); // copy offset should be aligned to texel size
+    const vk::DeviceSize      max_chunk_size    = GetVulkanContext().GetVulkanStagingRingBuffer().GetMaxChunkSize();
+
+    // Copy sub-resources data to the device-local GPU resource through the context staging ring buffer,
+    // large sub-resource data is split into chunks of image rows, so that ring space can be reclaimed between them
+    TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-        META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-        META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-        GetNativeDevice().unmapMemory(vk_device_memory);
-
-        m_vk_copy_regions.emplace_back(
-            sub_resource_offset, 0, 0,
-            vk::ImageSubresourceLayers(
-                vk::ImageAspectFlagBits::eColor,
-                sub_resource.GetIndex().GetMipLevel(),
-                sub_resource.GetIndex().GetBaseLayerIndex(subresource_count),
-                1U
-            ),
-            vk::Offset3D(),
-            TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
+        const vk::ImageSubresourceLayers vk_image_subresource_layers(
+            vk::ImageAspectFlagBits::eColor,
+            sub_resource.GetIndex().GetMipLevel(),
+            sub_resource.GetIndex().GetBaseLayerIndex(subresource_count),
+            1U
         );
 
-        sub_resource_offset += sub_resource.GetDataSize();
-    }
+        const vk::DeviceSize data_size = sub_resource.GetDataSize();
+        uint32_t rows_per_chunk = image_extent.height;
+        if (data_size > max_chunk_size)
+        {
+            META_CHECK_ARG_EQUAL_DESCR(data_size, bytes_per_row * image_extent.height,
+                                       "texture sub-resource data exceeding staging chunk size can be split only by rows of 2D image");
+            rows_per_chunk = static_cast<uint32_t>(max_chunk_size / bytes_per_row);
+            META_CHECK_ARG_NOT_ZERO_DESCR(rows_per_chunk, "texture row size exceeds staging chunk size");
+        }
 
-    // Copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
-    const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
-                                    vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
+        for(uint32_t first_row = 0U; first_row < image_extent.height; first_row += rows_per_chunk)
+        {
+            const uint32_t       chunk_rows   = std::min(rows_per_chunk, image_extent.height - first_row);
+            const vk::DeviceSize chunk_offset = first_row * bytes_per_row;
+            const vk::DeviceSize chunk_size   = rows_per_chunk == image_extent.height ? data_size : chunk_rows * bytes_per_row;
+            const StagingRingBuffer::Range staging_range = AllocateStagingRange(upload_cmd_list, chunk_size, staging_alignment);
+            std::copy(sub_resource.GetDataPtr() + chunk_offset, sub_resource.GetDataPtr() + chunk_offset + chunk_size, staging_range.data_ptr);
+
+            const vk::BufferImageCopy vk_copy_region(
+                staging_range.offset, 0U, 0U,
+                vk_image_subresource_layers,
+                vk::Offset3D(0, static_cast<int32_t>(first_row), 0),
+                vk::Extent3D(image_extent.width, chunk_rows, image_extent.depth)
+            );
+            upload_cmd_list.GetNativeCommandBufferDefault().copyBufferToImage(staging_range.vk_buffer, GetNativeResource(),
+                                                                              vk::ImageLayout::eTransferDstOptimal, 1U, &vk_copy_region);
+        }
+    }
 
     if (GetSettings().mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
     {
@@ -412,49 +431,72 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
         vk::Offset3D(),
         TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
     );
+    const ReadBackBuffer  read_back_buffer = CreateReadBackBuffer(bytes_per_image);
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     vk_cmd_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal,
-                                    m_vk_unique_staging_buffer.get(), image_to_buffer_copy);
+                                    read_back_buffer.vk_unique_buffer.get(), image_to_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_texture_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Map staging buffer memory and copy texture subresource data
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
+    // Copy texture subresource data from mapped read-back buffer, which is released after that
     Data::Size   staging_data_offset = 0U;
     Data::Size   staging_data_size   = bytes_per_image;
-    Data::RawPtr staging_data_ptr    = nullptr;
     if (data_range)
     {
         META_CHECK_ARG_LESS_DESCR(data_range->GetEnd(), staging_data_size, "provided texture subresource data range is out of bounds");
         staging_data_offset = data_range->GetStart();
         staging_data_size   = data_range->GetLength();
     }
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, staging_data_offset, staging_data_size, vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&staging_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(staging_data_ptr, "failed to map buffer subresource");
-    Rhi::SubResource sub_resource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-    return sub_resource;
+    const Data::RawPtr staging_data_ptr = read_back_buffer.memory_allocation.GetMappedDataPtr(staging_data_offset, staging_data_size);
+    return Rhi::SubResource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
 }
 
-bool Texture::SetName(std::string_view name)
+Ptr<Rhi::IReadBackRequest> Texture::RequestReadBack(Rhi::ICommandList& cmd_list, const SubResource::Index& sub_resource_index,
+                                                    const BytesRangeOpt& data_range)
 {
     META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
+    META_CHECK_ARG_EQUAL_DESCR(GetSettings().type, Rhi::TextureType::Image, "only image textures support data read-back from CPU");
+    ValidateSubResource(sub_resource_index, data_range);
 
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    const Settings&           settings          = GetSettings();
+    const SubResource::Count& subresource_count = GetSubresourceCount();
+    const uint32_t            mip_level         = sub_resource_index.GetMipLevel();
+    const vk::DeviceSize      sub_resource_size = GetSubResourceDataSize(sub_resource_index);
+    const vk::Extent3D        mip_extent(std::max(1U, settings.dimensions.GetWidth()  >> mip_level),
+                                         std::max(1U, settings.dimensions.GetHeight() >> mip_level),
+                                         1U);
+
+    // Texture sub-resource is copied to the next persistently mapped read-back buffer in the given command list,
+    // so read-back does not require separate commands execution and CPU-GPU synchronization
+    const ReadBackBuffer& read_back_buffer = AcquireReadBackBuffer(GetSubResourceDataSize({}));
+    Ptr<Rhi::IReadBackRequest> read_back_request_ptr = data_range
+        ? CreateReadBackRequest(cmd_list, data_range->GetStart(), data_range->GetLength(), sub_resource_index, data_range)
+        : CreateReadBackRequest(cmd_list, 0U, sub_resource_size, sub_resource_index, data_range);
+
+    const vk::BufferImageCopy image_to_buffer_copy(
+        0U, 0U, 0U,
+        vk::ImageSubresourceLayers(
+            Texture::GetNativeImageAspectFlags(settings),
+            mip_level,
+            sub_resource_index.GetBaseLayerIndex(subresource_count),
+            1U
+        ),
+        vk::Offset3D(),
+        mip_extent
+    );
+
+    const State initial_texture_state = GetState();
+    const vk::CommandBuffer& vk_cmd_buffer = BeginReadBackCommands(cmd_list);
+    vk_cmd_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal,
+                                    read_back_buffer.vk_unique_buffer.get(), image_to_buffer_copy);
+    EndReadBackCommands(cmd_list, initial_texture_state);
+
+    return read_back_request_ptr;
 }
 
 void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state)
@@ -470,38 +512,16 @@ void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State targ
                               "texture pixel format does not support linear blitting");
 
     constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
-    const Rhi::ICommandList     & target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
+    const Rhi::ICommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
     const vk::CommandBuffer& vk_cmd_buffer   = dynamic_cast<const RenderCommandList&>(target_cmd_list).GetNativeCommandBufferDefault();
+    const auto&              vulkan_cmd_queue = dynamic_cast<const CommandQueue&>(target_cmd_queue);
 
     const SubResource::Count& subresource_count = GetSubresourceCount();
     const uint32_t mip_levels_count = subresource_count.GetMipLevelsCount();
-    const State source_resource_state = GetState();
-
-    const vk::ImageLayout        vk_old_image_layout = IResource::GetNativeImageLayoutByResourceState(source_resource_state);
-    const vk::AccessFlags        vk_src_access_mask  = IResource::GetNativeAccessFlagsByResourceState(source_resource_state);
-    const vk::PipelineStageFlags vk_src_stage_mask   = IResource::GetNativePipelineStageFlagsByResourceState(source_resource_state);
-
-    const vk::ImageLayout        vk_new_image_layout = IResource::GetNativeImageLayoutByResourceState(target_resource_state);
-    const vk::AccessFlags        vk_dst_access_mask  = IResource::GetNativeAccessFlagsByResourceState(target_resource_state);
-    const vk::PipelineStageFlags vk_dst_stage_mask   = IResource::GetNativePipelineStageFlagsByResourceState(target_resource_state);
-
-    const vk::ImageLayout   vk_blit_old_image_layout = vk::ImageLayout::eTransferSrcOptimal;
-    const vk::ImageLayout   vk_blit_new_image_layout = vk::ImageLayout::eTransferDstOptimal;
-    const vk::AccessFlags   vk_blit_src_access_mask  = vk::AccessFlagBits::eTransferRead;
-
     const vk::Image& vk_image = GetNativeImage();
 
     for(uint32_t base_layer_index = 0U; base_layer_index < subresource_count.GetBaseLayerCount(); ++base_layer_index)
     {
-        vk::ImageMemoryBarrier vk_image_barrier;
-        vk_image_barrier.image                           = vk_image;
-        vk_image_barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-        vk_image_barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
-        vk_image_barrier.subresourceRange.aspectMask     = vk::ImageAspectFlagBits::eColor;
-        vk_image_barrier.subresourceRange.baseArrayLayer = base_layer_index;
-        vk_image_barrier.subresourceRange.layerCount     = 1U;
-        vk_image_barrier.subresourceRange.levelCount     = 1U;
-
         auto prev_mip_width  = static_cast<int32_t>(texture_settings.dimensions.GetWidth());
         auto prev_mip_height = static_cast<int32_t>(texture_settings.dimensions.GetHeight());
 
@@ -511,20 +531,11 @@ void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State targ
             const int32_t  curr_mip_height      = prev_mip_height > 1 ? prev_mip_height / 2 : 1;
             const uint32_t prev_mip_level_index = mip_level_index - 1U;
 
-            vk_image_barrier.subresourceRange.baseMipLevel = prev_mip_level_index;
-            vk_image_barrier.oldLayout                     = vk_old_image_layout;
-            vk_image_barrier.newLayout                     = vk_blit_old_image_layout;
-            vk_image_barrier.srcAccessMask                 = vk_src_access_mask;
-            vk_image_barrier.dstAccessMask                 = vk_blit_src_access_mask;
-
-            vk_cmd_buffer.pipelineBarrier(
-                vk_src_stage_mask,
-                vk_src_stage_mask,
-                vk::DependencyFlags{},
-                0U, nullptr,
-                0U, nullptr,
-                1U, &vk_image_barrier
-            );
+            // Only the previous mip level is transitioned to copy source state, while the other mip levels stay in copy destination state
+            Ptr<Rhi::IResourceBarriers> mip_barriers_ptr;
+            SetSubResourceState(SubResource::Index(base_layer_index * mip_levels_count + prev_mip_level_index, subresource_count), State::CopySource, mip_barriers_ptr);
+            SetSubResourceState(SubResource::Index(base_layer_index * mip_levels_count + mip_level_index, subresource_count), State::CopyDest, mip_barriers_ptr);
+            SetNativeResourceBarriers(vk_cmd_buffer, vulkan_cmd_queue, mip_barriers_ptr);
 
             const vk::ImageBlit vk_image_blit(
                 vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, prev_mip_level_index, base_layer_index, 1U),
@@ -534,46 +545,21 @@ void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State targ
             );
 
             vk_cmd_buffer.blitImage(
-                vk_image, vk_blit_old_image_layout,
-                vk_image, vk_blit_new_image_layout,
+                vk_image, vk::ImageLayout::eTransferSrcOptimal,
+                vk_image, vk::ImageLayout::eTransferDstOptimal,
                 1U, &vk_image_blit,
                 vk::Filter::eLinear
             );
 
-            vk_image_barrier.oldLayout     = vk_blit_old_image_layout;
-            vk_image_barrier.newLayout     = vk_new_image_layout;
-            vk_image_barrier.srcAccessMask = vk_blit_src_access_mask;
-            vk_image_barrier.dstAccessMask = vk_dst_access_mask;
-
-            vk_cmd_buffer.pipelineBarrier(
-                vk_src_stage_mask,
-                vk_dst_stage_mask,
-                vk::DependencyFlags{},
-                0U, nullptr,
-                0U, nullptr,
-                1U, &vk_image_barrier
-            );
-
             prev_mip_width  = curr_mip_width;
             prev_mip_height = curr_mip_height;
         }
-
-        vk_image_barrier.subresourceRange.baseMipLevel = mip_levels_count - 1U;
-        vk_image_barrier.oldLayout                     = vk_blit_new_image_layout;
-        vk_image_barrier.newLayout                     = vk_new_image_layout;
-        vk_image_barrier.srcAccessMask                 = vk_blit_src_access_mask;
-        vk_image_barrier.dstAccessMask                 = vk_dst_access_mask;
-
-        vk_cmd_buffer.pipelineBarrier(
-            vk_src_stage_mask,
-            vk_dst_stage_mask,
-            vk::DependencyFlags{},
-            0U, nullptr,
-            0U, nullptr,
-            1U, &vk_image_barrier);
     }
 
-    SetState(target_resource_state);
+    // All mip levels are transitioned to the target state with a single pipeline barrier of sub-resource transitions
+    Ptr<Rhi::IResourceBarriers> target_barriers_ptr;
+    SetState(target_resource_state, target_barriers_ptr);
+    SetNativeResourceBarriers(vk_cmd_buffer, vulkan_cmd_queue, target_barriers_ptr);
 }
 
 vk::ImageSubresourceRange Texture::GetNativeSubresourceRange() const
@@ -40,6 +40,9 @@ vk::Format TypeConverter::PixelFormatToVulkan(PixelFormat pixel_format)
     case PixelFormat::RGBA8Unorm_sRGB:  return vk::Format::eR8G8B8A8Srgb;
     case PixelFormat::BGRA8Unorm:       return vk::Format::eB8G8R8A8Unorm;
     case PixelFormat::BGRA8Unorm_sRGB:  return vk::Format::eB8G8R8A8Srgb;
+    case PixelFormat::RGBA16Float:      return vk::Format::eR16G16B16A16Sfloat;
+    case PixelFormat::RG16Unorm:        return vk::Format::eR16G16Unorm;
+    case PixelFormat::RG16Snorm:        return vk::Format::eR16G16Snorm;
     case PixelFormat::Depth32Float:     return vk::Format::eD32Sfloat;
     case PixelFormat::R32Float:         return vk::Format::eR32Sfloat;
     case PixelFormat::R32Uint:          return vk::Format::eR32Uint;
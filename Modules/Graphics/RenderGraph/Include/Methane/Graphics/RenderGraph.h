@@ -0,0 +1,150 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RenderGraph.h
+Render graph of passes with declared resource reads and writes, which are ordered
+by dependencies, culled when unused and executed with automatic resource barriers.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
+#include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <variant>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class RenderGraph
+{
+public:
+    using ResourceId      = Data::Index;
+    using PassId          = Data::Index;
+    using ExecuteFunction = std::function<void(Rhi::ICommandList& command_list)>;
+
+    enum class Access : uint32_t
+    {
+        Read,
+        Write
+    };
+
+    struct ResourceUse
+    {
+        ResourceId         resource_id;
+        Rhi::ResourceState state;
+        Access             access;
+    };
+
+    class PassBuilder
+    {
+    public:
+        PassBuilder(RenderGraph& graph, PassId pass_id) noexcept;
+
+        PassBuilder& Read(ResourceId resource_id, Rhi::ResourceState state);
+        PassBuilder& Write(ResourceId resource_id, Rhi::ResourceState state);
+        PassBuilder& SetSideEffects(bool has_side_effects = true);
+
+        [[nodiscard]] PassId GetId() const noexcept { return m_pass_id; }
+
+    private:
+        RenderGraph& m_graph;
+        PassId       m_pass_id;
+    };
+
+    explicit RenderGraph(const Rhi::IContext& context);
+
+    // Imported resources are owned outside of the graph, so passes writing to them are never culled
+    [[nodiscard]] ResourceId ImportResource(Rhi::IResource& resource);
+
+    // Transient resources are created by the graph on compile and may share one physical resource when their lifetimes do not overlap
+    [[nodiscard]] ResourceId CreateTexture(std::string_view name, const Rhi::TextureSettings& settings);
+    [[nodiscard]] ResourceId CreateBuffer(std::string_view name, const Rhi::BufferSettings& settings);
+
+    // Passes sharing one command list have to be contiguous in execution order, command list is reset and committed by the graph
+    [[nodiscard]] PassBuilder AddPass(std::string_view name, Rhi::ICommandList& command_list, const ExecuteFunction& execute_function);
+
+    void Compile();
+    void Execute();
+    void Clear();
+
+    [[nodiscard]] bool                           IsCompiled() const noexcept        { return m_is_compiled; }
+    [[nodiscard]] bool                           IsPassCulled(PassId pass_id) const;
+    [[nodiscard]] const std::vector<PassId>&     GetExecutionOrder() const noexcept { return m_execution_order; }
+    [[nodiscard]] const Refs<Rhi::ICommandList>& GetCommandLists() const noexcept   { return m_command_lists; }
+    [[nodiscard]] Data::Size                     GetPhysicalResourcesCount() const noexcept;
+    [[nodiscard]] Rhi::IResource&                GetResource(ResourceId resource_id) const;
+    [[nodiscard]] Rhi::ITexture&                 GetTexture(ResourceId resource_id) const;
+    [[nodiscard]] Rhi::IBuffer&                  GetBuffer(ResourceId resource_id) const;
+
+private:
+    using ResourceSettings = std::variant<std::monostate, Rhi::TextureSettings, Rhi::BufferSettings>;
+
+    struct Resource
+    {
+        std::string      name;
+        ResourceSettings settings;               // empty for imported resources
+        Rhi::IResource*  resource_ptr = nullptr; // physical resource is assigned to transient resource on compile
+    };
+
+    struct Pass
+    {
+        std::string                 name;
+        Ref<Rhi::ICommandList>      command_list_ref;
+        ExecuteFunction             execute_function;
+        std::vector<ResourceUse>    resource_uses;
+        bool                        has_side_effects = false;
+        bool                        is_culled        = false;
+        Ptr<Rhi::IResourceBarriers> barriers_ptr;
+    };
+
+    struct PhysicalResource
+    {
+        ResourceSettings    settings;
+        Ptr<Rhi::IResource> resource_ptr;
+        Opt<Data::Index>    last_use_position;
+    };
+
+    void AddResourceUse(PassId pass_id, ResourceId resource_id, Rhi::ResourceState state, Access access);
+    void CullPasses();
+    void SortPasses();
+    void AllocateTransientResources();
+
+    [[nodiscard]] ResourceId AddResource(std::string_view name, ResourceSettings&& settings, Rhi::IResource* resource_ptr);
+    [[nodiscard]] Ptr<Rhi::IResource> CreatePhysicalResource(const ResourceSettings& settings) const;
+
+    const Rhi::IContext&          m_context;
+    std::vector<Resource>         m_resources;
+    std::vector<Pass>             m_passes;
+    std::vector<PassId>           m_execution_order;
+    Refs<Rhi::ICommandList>       m_command_lists;
+    std::vector<PhysicalResource> m_physical_resources;
+    bool                          m_is_compiled = false;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,465 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RenderGraph.cpp
+Render graph of passes with declared resource reads and writes, which are ordered
+by dependencies, culled when unused and executed with automatic resource barriers.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RenderGraph.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+RenderGraph::PassBuilder::PassBuilder(RenderGraph& graph, PassId pass_id) noexcept
+    : m_graph(graph)
+    , m_pass_id(pass_id)
+{ }
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Read(ResourceId resource_id, Rhi::ResourceState state)
+{
+    META_FUNCTION_TASK();
+    m_graph.AddResourceUse(m_pass_id, resource_id, state, Access::Read);
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Write(ResourceId resource_id, Rhi::ResourceState state)
+{
+    META_FUNCTION_TASK();
+    m_graph.AddResourceUse(m_pass_id, resource_id, state, Access::Write);
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::SetSideEffects(bool has_side_effects)
+{
+    META_FUNCTION_TASK();
+    m_graph.m_passes[m_pass_id].has_side_effects = has_side_effects;
+    m_graph.m_is_compiled = false;
+    return *this;
+}
+
+RenderGraph::RenderGraph(const Rhi::IContext& context)
+    : m_context(context)
+{ }
+
+RenderGraph::ResourceId RenderGraph::ImportResource(Rhi::IResource& resource)
+{
+    META_FUNCTION_TASK();
+    return AddResource(resource.GetName(), ResourceSettings(), std::addressof(resource));
+}
+
+RenderGraph::ResourceId RenderGraph::CreateTexture(std::string_view name, const Rhi::TextureSettings& settings)
+{
+    META_FUNCTION_TASK();
+    return AddResource(name, ResourceSettings(settings), nullptr);
+}
+
+RenderGraph::ResourceId RenderGraph::CreateBuffer(std::string_view name, const Rhi::BufferSettings& settings)
+{
+    META_FUNCTION_TASK();
+    return AddResource(name, ResourceSettings(settings), nullptr);
+}
+
+RenderGraph::PassBuilder RenderGraph::AddPass(std::string_view name, Rhi::ICommandList& command_list, const ExecuteFunction& execute_function)
+{
+    META_FUNCTION_TASK();
+    const auto pass_id = static_cast<PassId>(m_passes.size());
+    m_passes.push_back(Pass{ std::string(name), command_list, execute_function, {}, false, false, {} });
+    m_is_compiled = false;
+    return PassBuilder(*this, pass_id);
+}
+
+void RenderGraph::Compile()
+{
+    META_FUNCTION_TASK();
+    CullPasses();
+    SortPasses();
+    AllocateTransientResources();
+    m_is_compiled = true;
+}
+
+void RenderGraph::Execute()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(m_is_compiled, "render graph has to be compiled before execution");
+
+    const auto passes_count = static_cast<Data::Size>(m_execution_order.size());
+    for(Data::Index position = 0U; position < passes_count; ++position)
+    {
+        Pass& pass = m_passes[m_execution_order[position]];
+        Rhi::ICommandList& command_list = pass.command_list_ref.get();
+        command_list.ResetOnce();
+
+        // Resource states are tracked by resources, so barriers are added only for the actually changing states
+        for(const ResourceUse& resource_use : pass.resource_uses)
+        {
+            GetResource(resource_use.resource_id).SetState(resource_use.state, pass.barriers_ptr);
+        }
+        if (pass.barriers_ptr && !pass.barriers_ptr->IsEmpty())
+        {
+            command_list.SetResourceBarriers(*pass.barriers_ptr);
+        }
+
+        if (pass.execute_function)
+        {
+            pass.execute_function(command_list);
+        }
+
+        if (const Data::Index next_position = position + 1U;
+            next_position == passes_count ||
+            std::addressof(m_passes[m_execution_order[next_position]].command_list_ref.get()) != std::addressof(command_list))
+        {
+            command_list.Commit();
+        }
+    }
+}
+
+void RenderGraph::Clear()
+{
+    META_FUNCTION_TASK();
+    // Physical resources are kept to be reused by transient resources after the next compile
+    m_resources.clear();
+    m_passes.clear();
+    m_execution_order.clear();
+    m_command_lists.clear();
+    m_is_compiled = false;
+}
+
+bool RenderGraph::IsPassCulled(PassId pass_id) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(pass_id, m_passes.size());
+    return m_passes[pass_id].is_culled;
+}
+
+Data::Size RenderGraph::GetPhysicalResourcesCount() const noexcept
+{
+    return static_cast<Data::Size>(m_physical_resources.size());
+}
+
+Rhi::IResource& RenderGraph::GetResource(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(resource_id, m_resources.size());
+    const Resource& resource = m_resources[resource_id];
+    META_CHECK_ARG_NOT_NULL_DESCR(resource.resource_ptr, "render graph resource '{}' is not used by any executed pass or graph is not compiled", resource.name);
+    return *resource.resource_ptr;
+}
+
+Rhi::ITexture& RenderGraph::GetTexture(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    return dynamic_cast<Rhi::ITexture&>(GetResource(resource_id));
+}
+
+Rhi::IBuffer& RenderGraph::GetBuffer(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    return dynamic_cast<Rhi::IBuffer&>(GetResource(resource_id));
+}
+
+void RenderGraph::AddResourceUse(PassId pass_id, ResourceId resource_id, Rhi::ResourceState state, Access access)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(pass_id, m_passes.size());
+    META_CHECK_ARG_LESS(resource_id, m_resources.size());
+
+    Pass& pass = m_passes[pass_id];
+    META_CHECK_ARG_TRUE_DESCR(std::none_of(pass.resource_uses.begin(), pass.resource_uses.end(),
+                                           [resource_id](const ResourceUse& resource_use)
+                                           { return resource_use.resource_id == resource_id; }),
+                              "resource '{}' can be used only once in render graph pass '{}'",
+                              m_resources[resource_id].name, pass.name);
+
+    pass.resource_uses.push_back(ResourceUse{ resource_id, state, access });
+    m_is_compiled = false;
+}
+
+void RenderGraph::CullPasses()
+{
+    META_FUNCTION_TASK();
+    // Passes are culled with reference counting: pass is referenced by the number of its written resources,
+    // resource is referenced by the number of passes reading it, imported resources are always referenced
+    std::vector<Data::Size> pass_ref_counts(m_passes.size(), 0U);
+    std::vector<Data::Size> resource_ref_counts(m_resources.size(), 0U);
+    for(PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        Pass& pass = m_passes[pass_id];
+        pass.is_culled = false;
+        for(const ResourceUse& resource_use : pass.resource_uses)
+        {
+            if (resource_use.access == Access::Write)
+                pass_ref_counts[pass_id]++;
+            else
+                resource_ref_counts[resource_use.resource_id]++;
+        }
+    }
+
+    std::vector<ResourceId> unreferenced_resource_ids;
+    for(ResourceId resource_id = 0U; resource_id < m_resources.size(); ++resource_id)
+    {
+        if (std::holds_alternative<std::monostate>(m_resources[resource_id].settings))
+            resource_ref_counts[resource_id]++;
+        else if (!resource_ref_counts[resource_id])
+            unreferenced_resource_ids.push_back(resource_id);
+    }
+
+    const auto cull_pass = [&resource_ref_counts, &unreferenced_resource_ids](Pass& pass)
+    {
+        pass.is_culled = true;
+        for(const ResourceUse& resource_use : pass.resource_uses)
+        {
+            if (resource_use.access == Access::Read && !--resource_ref_counts[resource_use.resource_id])
+                unreferenced_resource_ids.push_back(resource_use.resource_id);
+        }
+    };
+
+    for(PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        if (Pass& pass = m_passes[pass_id]; !pass_ref_counts[pass_id] && !pass.has_side_effects)
+            cull_pass(pass);
+    }
+
+    while(!unreferenced_resource_ids.empty())
+    {
+        const ResourceId resource_id = unreferenced_resource_ids.back();
+        unreferenced_resource_ids.pop_back();
+
+        for(PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+        {
+            Pass& pass = m_passes[pass_id];
+            if (pass.is_culled || pass.has_side_effects ||
+                std::none_of(pass.resource_uses.begin(), pass.resource_uses.end(),
+                             [resource_id](const ResourceUse& resource_use)
+                             { return resource_use.resource_id == resource_id && resource_use.access == Access::Write; }))
+                continue;
+
+            if (!--pass_ref_counts[pass_id])
+                cull_pass(pass);
+        }
+    }
+}
+
+void RenderGraph::SortPasses()
+{
+    META_FUNCTION_TASK();
+    // Collect uses of every resource by not culled passes in declaration order
+    std::vector<std::vector<std::pair<PassId, Access>>> accesses_by_resource(m_resources.size());
+    Data::Size active_passes_count = 0U;
+    for(PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        const Pass& pass = m_passes[pass_id];
+        if (pass.is_culled)
+            continue;
+
+        active_passes_count++;
+        for(const ResourceUse& resource_use : pass.resource_uses)
+        {
+            accesses_by_resource[resource_use.resource_id].emplace_back(pass_id, resource_use.access);
+        }
+    }
+
+    std::vector<std::vector<PassId>> dependent_pass_ids(m_passes.size());
+    std::vector<Data::Size>          dependencies_counts(m_passes.size(), 0U);
+    const auto add_dependency = [&dependent_pass_ids, &dependencies_counts](PassId pass_id, PassId dependent_pass_id)
+    {
+        dependent_pass_ids[pass_id].push_back(dependent_pass_id);
+        dependencies_counts[dependent_pass_id]++;
+    };
+
+    for(std::vector<std::pair<PassId, Access>>& resource_accesses : accesses_by_resource)
+    {
+        // Reads declared before the first write of the resource consume the result of that write
+        if (const auto first_write_it = std::find_if(resource_accesses.begin(), resource_accesses.end(),
+                                                     [](const std::pair<PassId, Access>& access) { return access.second == Access::Write; });
+            first_write_it != resource_accesses.end())
+        {
+            std::rotate(resource_accesses.begin(), first_write_it, std::next(first_write_it));
+        }
+
+        // Read-after-write, write-after-read and write-after-write dependencies
+        Opt<PassId>         last_writer_pass_id;
+        std::vector<PassId> reader_pass_ids;
+        for(const auto& [pass_id, access] : resource_accesses)
+        {
+            if (access == Access::Read)
+            {
+                if (last_writer_pass_id)
+                    add_dependency(*last_writer_pass_id, pass_id);
+
+                reader_pass_ids.push_back(pass_id);
+                continue;
+            }
+
+            if (reader_pass_ids.empty() && last_writer_pass_id)
+                add_dependency(*last_writer_pass_id, pass_id);
+
+            for(const PassId reader_pass_id : reader_pass_ids)
+            {
+                add_dependency(reader_pass_id, pass_id);
+            }
+
+            reader_pass_ids.clear();
+            last_writer_pass_id = pass_id;
+        }
+    }
+
+    // Topological sort of passes preferring declaration order of independent passes
+    std::priority_queue<PassId, std::vector<PassId>, std::greater<PassId>> ready_pass_ids;
+    for(PassId pass_id = 0U; pass_id < m_passes.size(); ++pass_id)
+    {
+        if (!m_passes[pass_id].is_culled && !dependencies_counts[pass_id])
+            ready_pass_ids.push(pass_id);
+    }
+
+    m_execution_order.clear();
+    while(!ready_pass_ids.empty())
+    {
+        const PassId pass_id = ready_pass_ids.top();
+        ready_pass_ids.pop();
+        m_execution_order.push_back(pass_id);
+
+        for(const PassId dependent_pass_id : dependent_pass_ids[pass_id])
+        {
+            if (!--dependencies_counts[dependent_pass_id])
+                ready_pass_ids.push(dependent_pass_id);
+        }
+    }
+
+    META_CHECK_ARG_EQUAL_DESCR(m_execution_order.size(), active_passes_count,
+                               "render graph passes can not be ordered because of cyclic dependencies");
+
+    m_command_lists.clear();
+    for(const PassId pass_id : m_execution_order)
+    {
+        Rhi::ICommandList& command_list = m_passes[pass_id].command_list_ref.get();
+        if (!m_command_lists.empty() && std::addressof(m_command_lists.back().get()) == std::addressof(command_list))
+            continue;
+
+        META_CHECK_ARG_TRUE_DESCR(std::none_of(m_command_lists.begin(), m_command_lists.end(),
+                                               [&command_list](const Ref<Rhi::ICommandList>& command_list_ref)
+                                               { return std::addressof(command_list_ref.get()) == std::addressof(command_list); }),
+                                  "render graph passes encoded in command list '{}' are not contiguous in execution order",
+                                  command_list.GetName());
+        m_command_lists.emplace_back(command_list);
+    }
+}
+
+void RenderGraph::AllocateTransientResources()
+{
+    META_FUNCTION_TASK();
+    // Lifetime of transient resource is a range of positions in execution order of passes using it
+    std::vector<Opt<std::pair<Data::Index, Data::Index>>> lifetime_by_resource(m_resources.size());
+    for(Data::Index position = 0U; position < m_execution_order.size(); ++position)
+    {
+        for(const ResourceUse& resource_use : m_passes[m_execution_order[position]].resource_uses)
+        {
+            Opt<std::pair<Data::Index, Data::Index>>& lifetime_opt = lifetime_by_resource[resource_use.resource_id];
+            if (lifetime_opt)
+                lifetime_opt->second = position;
+            else
+                lifetime_opt = std::make_pair(position, position);
+        }
+    }
+
+    std::vector<ResourceId> transient_resource_ids;
+    for(ResourceId resource_id = 0U; resource_id < m_resources.size(); ++resource_id)
+    {
+        Resource& resource = m_resources[resource_id];
+        if (std::holds_alternative<std::monostate>(resource.settings))
+            continue;
+
+        resource.resource_ptr = nullptr;
+        if (lifetime_by_resource[resource_id])
+            transient_resource_ids.push_back(resource_id);
+    }
+
+    std::sort(transient_resource_ids.begin(), transient_resource_ids.end(),
+              [&lifetime_by_resource](ResourceId left_id, ResourceId right_id)
+              { return lifetime_by_resource[left_id]->first < lifetime_by_resource[right_id]->first; });
+
+    for(PhysicalResource& physical_resource : m_physical_resources)
+    {
+        physical_resource.last_use_position.reset();
+    }
+
+    // Transient resources with equal settings and not overlapping lifetimes are aliased with one physical resource
+    for(const ResourceId resource_id : transient_resource_ids)
+    {
+        Resource& resource = m_resources[resource_id];
+        const auto [first_use_position, last_use_position] = *lifetime_by_resource[resource_id];
+        auto physical_resource_it = std::find_if(m_physical_resources.begin(), m_physical_resources.end(),
+            [&resource, first_use_position = first_use_position](const PhysicalResource& physical_resource)
+            {
+                return physical_resource.settings == resource.settings &&
+                       (!physical_resource.last_use_position || *physical_resource.last_use_position < first_use_position);
+            });
+
+        if (physical_resource_it == m_physical_resources.end())
+        {
+            m_physical_resources.push_back(PhysicalResource{ resource.settings, CreatePhysicalResource(resource.settings), {} });
+            physical_resource_it = std::prev(m_physical_resources.end());
+        }
+
+        if (!physical_resource_it->last_use_position)
+        {
+            physical_resource_it->resource_ptr->SetName(resource.name);
+        }
+
+        physical_resource_it->last_use_position = last_use_position;
+        resource.resource_ptr = physical_resource_it->resource_ptr.get();
+    }
+
+    // Physical resources which were not needed by this compile are released
+    m_physical_resources.erase(std::remove_if(m_physical_resources.begin(), m_physical_resources.end(),
+                                              [](const PhysicalResource& physical_resource)
+                                              { return !physical_resource.last_use_position; }),
+                               m_physical_resources.end());
+}
+
+RenderGraph::ResourceId RenderGraph::AddResource(std::string_view name, ResourceSettings&& settings, Rhi::IResource* resource_ptr)
+{
+    META_FUNCTION_TASK();
+    const auto resource_id = static_cast<ResourceId>(m_resources.size());
+    m_resources.push_back(Resource{ std::string(name), std::move(settings), resource_ptr });
+    m_is_compiled = false;
+    return resource_id;
+}
+
+Ptr<Rhi::IResource> RenderGraph::CreatePhysicalResource(const ResourceSettings& settings) const
+{
+    META_FUNCTION_TASK();
+    if (const auto* texture_settings_ptr = std::get_if<Rhi::TextureSettings>(&settings))
+        return m_context.CreateTexture(*texture_settings_ptr);
+
+    if (const auto* buffer_settings_ptr = std::get_if<Rhi::BufferSettings>(&settings))
+        return m_context.CreateBuffer(*buffer_settings_ptr);
+
+    META_UNEXPECTED_ARG_DESCR_RETURN(settings.index(), nullptr, "imported render graph resource can not be created");
+}
+
+} // namespace Methane::Graphics
@@ -67,6 +67,9 @@ enum class PixelFormat : uint32_t
     RGBA8Unorm_sRGB,
     BGRA8Unorm,
     BGRA8Unorm_sRGB,
+    RGBA16Float,
+    RG16Unorm,
+    RG16Snorm,
     R32Float,
     R32Uint,
     R32Sint,
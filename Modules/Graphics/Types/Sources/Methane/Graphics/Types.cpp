@@ -80,11 +80,16 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     META_FUNCTION_TASK();
     switch(pixel_format)
     {
+    case PixelFormat::RGBA16Float:
+        return 8;
+
     case PixelFormat::RGBA8:
     case PixelFormat::RGBA8Unorm:
     case PixelFormat::RGBA8Unorm_sRGB:
     case PixelFormat::BGRA8Unorm:
     case PixelFormat::BGRA8Unorm_sRGB:
+    case PixelFormat::RG16Unorm:
+    case PixelFormat::RG16Snorm:
     case PixelFormat::R32Float:
     case PixelFormat::R32Uint:
     case PixelFormat::R32Sint:
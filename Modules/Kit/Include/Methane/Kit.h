@@ -30,6 +30,7 @@ Methane kit interfaces: all headers under one umbrella.
 #include <Methane/Graphics/RHI/Implementations.h>
 #include <Methane/Graphics/Primitives.h>
 #include <Methane/Graphics/ActionCamera.h>
+#include <Methane/Graphics/BoundingVolumeHierarchy.h>
 
 // Methane User Interface Headers
 
@@ -83,4 +83,16 @@ std::string GetResourceDir()
     return res_dir;
 }
 
+std::string GetUserCacheDir()
+{
+    META_FUNCTION_TASK();
+    std::string cache_dir;
+    @autoreleasepool
+    {
+        NSArray<NSString*>* cache_paths = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES);
+        cache_dir = cache_paths.count > 0 ? [cache_paths.firstObject UTF8String] : GetExecutableDir();
+    }
+    return cache_dir;
+}
+
 } // namespace Methane::Platform
@@ -26,6 +26,7 @@ MacOS platform utility functions.
 
 #include <string_view>
 #include <iostream>
+#include <cstdlib>
 
 #include <libgen.h>
 #include <unistd.h>
@@ -68,4 +69,18 @@ std::string GetResourceDir()
     return GetExecutableDir();
 }
 
+std::string GetUserCacheDir()
+{
+    META_FUNCTION_TASK();
+    if (const char* xdg_cache_dir = std::getenv("XDG_CACHE_HOME");
+        xdg_cache_dir && *xdg_cache_dir)
+        return xdg_cache_dir;
+
+    if (const char* home_dir = std::getenv("HOME");
+        home_dir && *home_dir)
+        return std::string(home_dir) + "/.cache";
+
+    return GetExecutableDir();
+}
+
 } // namespace Methane::Platform
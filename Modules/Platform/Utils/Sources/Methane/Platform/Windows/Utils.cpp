@@ -78,6 +78,16 @@ std::string GetResourceDir()
     return GetExecutableDir();
 }
 
+std::string GetUserCacheDir()
+{
+    META_FUNCTION_TASK();
+    if (const wchar_t* local_app_data_dir = _wgetenv(L"LOCALAPPDATA"); // NOSONAR
+        local_app_data_dir && *local_app_data_dir)
+        return nowide::narrow(local_app_data_dir);
+
+    return GetExecutableDir();
+}
+
 namespace Windows
 {
 
@@ -0,0 +1,180 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/BuddyAllocatorTest.cpp
+Unit tests of the buddy allocator used for device memory blocks sub-allocation
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/BuddyAllocator.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+using TestBuddyAllocator = BuddyAllocator<uint64_t>;
+
+TEST_CASE("Buddy allocator orders", "[buddy][allocator]")
+{
+    SECTION("Ceil order of value")
+    {
+        CHECK(TestBuddyAllocator::GetCeilOrder(1U) == 0U);
+        CHECK(TestBuddyAllocator::GetCeilOrder(256U) == 8U);
+        CHECK(TestBuddyAllocator::GetCeilOrder(257U) == 9U);
+    }
+
+    SECTION("Floor order of value")
+    {
+        CHECK(TestBuddyAllocator::GetFloorOrder(1U) == 0U);
+        CHECK(TestBuddyAllocator::GetFloorOrder(256U) == 8U);
+        CHECK(TestBuddyAllocator::GetFloorOrder(511U) == 8U);
+    }
+
+    SECTION("Size should be a power of two")
+    {
+        CHECK_THROWS(TestBuddyAllocator(1000U, 4U));
+        CHECK_THROWS(TestBuddyAllocator(1024U, 11U));
+        CHECK_NOTHROW(TestBuddyAllocator(1024U, 10U));
+    }
+}
+
+TEST_CASE("Buddy allocator allocation and release", "[buddy][allocator]")
+{
+    TestBuddyAllocator allocator(1024U, 4U);
+    REQUIRE(allocator.GetMinOrder() == 4U);
+    REQUIRE(allocator.GetMaxOrder() == 10U);
+    REQUIRE(allocator.IsEmpty());
+    REQUIRE(allocator.GetFreeRangesCount(10U) == 1U);
+
+    SECTION("Split free range down to requested order")
+    {
+        const Opt<uint64_t> offset_opt = allocator.Allocate(4U);
+        REQUIRE(offset_opt.has_value());
+        CHECK(*offset_opt == 0U);
+        CHECK(allocator.GetAllocationsCount() == 1U);
+        CHECK(allocator.GetFreeRangesCount(10U) == 0U);
+        for(uint32_t order = 4U; order < 10U; ++order)
+        {
+            CHECK(allocator.GetFreeRangesCount(order) == 1U);
+        }
+    }
+
+    SECTION("Allocate smallest free range first")
+    {
+        const Opt<uint64_t> small_offset_opt = allocator.Allocate(4U);
+        const Opt<uint64_t> large_offset_opt = allocator.Allocate(8U);
+        const Opt<uint64_t> next_offset_opt  = allocator.Allocate(4U);
+        REQUIRE(small_offset_opt.has_value());
+        REQUIRE(large_offset_opt.has_value());
+        REQUIRE(next_offset_opt.has_value());
+        CHECK(*small_offset_opt == 0U);
+        CHECK(*large_offset_opt == 256U);
+        CHECK(*next_offset_opt == 16U);
+    }
+
+    SECTION("Allocated offsets are aligned to range size")
+    {
+        for(uint32_t order : { 4U, 6U, 5U, 8U, 4U, 7U })
+        {
+            const Opt<uint64_t> offset_opt = allocator.Allocate(order);
+            REQUIRE(offset_opt.has_value());
+            CHECK(*offset_opt % (uint64_t(1U) << order) == 0U);
+        }
+    }
+
+    SECTION("Coalesce freed buddies back to the whole range")
+    {
+        const Opt<uint64_t> offset_a_opt = allocator.Allocate(4U);
+        const Opt<uint64_t> offset_b_opt = allocator.Allocate(4U);
+        const Opt<uint64_t> offset_c_opt = allocator.Allocate(5U);
+        REQUIRE(offset_a_opt.has_value());
+        REQUIRE(offset_b_opt.has_value());
+        REQUIRE(offset_c_opt.has_value());
+
+        allocator.Free(*offset_a_opt, 4U);
+        CHECK(allocator.GetFreeRangesCount(4U) == 1U);
+        CHECK(allocator.GetFreeRangesCount(10U) == 0U);
+
+        allocator.Free(*offset_b_opt, 4U);
+        CHECK(allocator.GetFreeRangesCount(4U) == 0U);
+
+        allocator.Free(*offset_c_opt, 5U);
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetFreeRangesCount(10U) == 1U);
+        for(uint32_t order = 4U; order < 10U; ++order)
+        {
+            CHECK(allocator.GetFreeRangesCount(order) == 0U);
+        }
+    }
+
+    SECTION("Freed range is not merged with allocated buddy")
+    {
+        const Opt<uint64_t> offset_a_opt = allocator.Allocate(9U);
+        const Opt<uint64_t> offset_b_opt = allocator.Allocate(9U);
+        REQUIRE(offset_a_opt.has_value());
+        REQUIRE(offset_b_opt.has_value());
+
+        allocator.Free(*offset_b_opt, 9U);
+        CHECK(allocator.GetFreeRangesCount(9U) == 1U);
+        CHECK(allocator.GetFreeRangesCount(10U) == 0U);
+        CHECK(allocator.GetAllocationsCount() == 1U);
+    }
+
+    SECTION("Allocation fails when block is exhausted")
+    {
+        std::vector<uint64_t> offsets;
+        for(uint32_t index = 0U; index < 64U; ++index)
+        {
+            const Opt<uint64_t> offset_opt = allocator.Allocate(4U);
+            REQUIRE(offset_opt.has_value());
+            offsets.push_back(*offset_opt);
+        }
+        CHECK_FALSE(allocator.Allocate(4U).has_value());
+        CHECK(allocator.GetAllocationsCount() == 64U);
+
+        allocator.Free(offsets[17], 4U);
+        const Opt<uint64_t> offset_opt = allocator.Allocate(4U);
+        REQUIRE(offset_opt.has_value());
+        CHECK(*offset_opt == offsets[17]);
+        CHECK_FALSE(allocator.Allocate(5U).has_value());
+    }
+
+    SECTION("Fragmented block can not fit larger range")
+    {
+        const Opt<uint64_t> offset_a_opt = allocator.Allocate(9U);
+        const Opt<uint64_t> offset_b_opt = allocator.Allocate(4U);
+        REQUIRE(offset_a_opt.has_value());
+        REQUIRE(offset_b_opt.has_value());
+        CHECK_FALSE(allocator.Allocate(9U).has_value());
+        CHECK(allocator.Allocate(8U).has_value());
+    }
+
+    SECTION("Invalid allocation and release arguments")
+    {
+        CHECK_THROWS(allocator.Allocate(3U));
+        CHECK_THROWS(allocator.Allocate(11U));
+        CHECK_THROWS(allocator.Free(0U, 4U));
+
+        const Opt<uint64_t> offset_opt = allocator.Allocate(5U);
+        REQUIRE(offset_opt.has_value());
+        CHECK_THROWS(allocator.Free(*offset_opt + 16U, 5U));
+    }
+}
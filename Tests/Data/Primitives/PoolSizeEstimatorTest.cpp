@@ -0,0 +1,119 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/PoolSizeEstimatorTest.cpp
+Unit tests of the pool size estimator used for descriptor pools sizing
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/PoolSizeEstimator.hpp>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+enum class TestItemType
+{
+    Sampler,
+    Texture,
+    Buffer
+};
+
+using TestPoolSizeEstimator = PoolSizeEstimator<TestItemType>;
+
+TEST_CASE("Pool size estimator with size ratios", "[pool][size]")
+{
+    TestPoolSizeEstimator estimator(100U, {
+        { TestItemType::Sampler, 0.5F },
+        { TestItemType::Texture, 4.F  }
+    });
+    REQUIRE(estimator.GetPoolSetsCount() == 100U);
+    REQUIRE(estimator.GetLayoutsCount() == 0U);
+
+    SECTION("Pool sizes are calculated from ratios without layouts")
+    {
+        const TestPoolSizeEstimator::CountByType pool_sizes = estimator.GetPoolSizes();
+        CHECK(pool_sizes == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Sampler, 50U  },
+            { TestItemType::Texture, 400U }
+        });
+    }
+
+    SECTION("Size ratio can be changed and added")
+    {
+        estimator.SetSizeRatio(TestItemType::Texture, 2.F);
+        estimator.SetSizeRatio(TestItemType::Buffer, 1.F);
+        CHECK(estimator.GetPoolSizes() == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Sampler, 50U  },
+            { TestItemType::Texture, 200U },
+            { TestItemType::Buffer,  100U }
+        });
+    }
+
+    SECTION("Size ratios are not used after first layout is added")
+    {
+        estimator.AddSetLayout({ { TestItemType::Buffer, 2U } });
+        CHECK(estimator.GetLayoutsCount() == 1U);
+        CHECK(estimator.GetPoolSizes() == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Buffer, 200U }
+        });
+    }
+}
+
+TEST_CASE("Pool size estimator learned from layouts", "[pool][size]")
+{
+    TestPoolSizeEstimator estimator(10U, { { TestItemType::Sampler, 1.F } });
+
+    SECTION("Pool sizes are averaged over all layouts")
+    {
+        estimator.AddSetLayout({ { TestItemType::Texture, 2U }, { TestItemType::Buffer, 1U } });
+        estimator.AddSetLayout({ { TestItemType::Texture, 4U } });
+        estimator.AddSetLayout({ { TestItemType::Buffer, 2U } });
+        estimator.AddSetLayout({ { TestItemType::Buffer, 1U } });
+        CHECK(estimator.GetLayoutsCount() == 4U);
+        CHECK(estimator.GetPoolSizes() == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Texture, 15U },
+            { TestItemType::Buffer,  10U }
+        });
+    }
+
+    SECTION("Pool size is not less than the largest single layout")
+    {
+        estimator.AddSetLayout({ { TestItemType::Texture, 64U } });
+        for(uint32_t layout_index = 0U; layout_index < 99U; ++layout_index)
+        {
+            estimator.AddSetLayout({ { TestItemType::Buffer, 1U } });
+        }
+        CHECK(estimator.GetPoolSizes() == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Texture, 64U },
+            { TestItemType::Buffer,  9U  }
+        });
+    }
+
+    SECTION("Empty layouts reduce average pool sizes")
+    {
+        estimator.AddSetLayout({ { TestItemType::Texture, 3U } });
+        estimator.AddSetLayout({});
+        estimator.AddSetLayout({});
+        CHECK(estimator.GetLayoutsCount() == 3U);
+        CHECK(estimator.GetPoolSizes() == TestPoolSizeEstimator::CountByType{
+            { TestItemType::Texture, 10U }
+        });
+    }
+}
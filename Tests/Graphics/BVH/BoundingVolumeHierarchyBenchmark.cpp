@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/BoundingVolumeHierarchyBenchmark.cpp
+Benchmark of the bounding volume hierarchy construction, refit and queries
+in comparison with brute-force frustum culling
+
+******************************************************************************/
+
+#include <Methane/Graphics/BoundingVolumeHierarchy.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+using BVH = BoundingVolumeHierarchy;
+
+static constexpr Data::Size g_instances_count = 100000U;
+
+static tf::Executor g_benchmark_executor;
+
+// NOTE: benchmark is hidden from default test runs because of its duration,
+//       run it explicitly with "[bvh][benchmark]" tags filter
+TEST_CASE("Benchmark bounding volume hierarchy of 100K instances", "[.][bvh][benchmark]")
+{
+    Camera camera;
+    camera.Resize(Data::FloatSize{ 1920.F, 1080.F });
+    camera.ResetOrientation({ { 0.F, 50.F, -100.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } });
+    const Frustum& frustum = camera.GetFrustum();
+
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-200.F, 200.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 2.F);
+
+    BVH::InstanceBounds    instance_bounds(g_instances_count);
+    Frustum::BoundingBoxes bounding_boxes;
+    bounding_boxes.Resize(g_instances_count);
+    for (Data::Index instance_index = 0U; instance_index < g_instances_count; ++instance_index)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const float extent = extent_distribution(rng);
+        instance_bounds[instance_index] = BVH::Bounds{ center - extent, center + extent };
+        bounding_boxes.Set(instance_index, center - extent, center + extent);
+    }
+
+    BENCHMARK("Build hierarchy")
+    {
+        return BVH(instance_bounds).GetNodes().size();
+    };
+
+    BENCHMARK("Build hierarchy in parallel")
+    {
+        return BVH(instance_bounds, &g_benchmark_executor).GetNodes().size();
+    };
+
+    BVH bvh(instance_bounds, &g_benchmark_executor);
+
+    BENCHMARK("Refit hierarchy with 10% of moved instances")
+    {
+        for (Data::Index instance_index = 0U; instance_index < g_instances_count; instance_index += 10U)
+            bvh.SetInstanceBounds(instance_index, instance_bounds[instance_index]);
+        bvh.Refit();
+        return bvh.GetNodes().size();
+    };
+
+    BVH::Indices visible_indices;
+    visible_indices.reserve(g_instances_count);
+
+    BENCHMARK("Cull bounding boxes in SIMD batch in parallel")
+    {
+        return frustum.CullBoxes(bounding_boxes, visible_indices, &g_benchmark_executor);
+    };
+
+    BENCHMARK("Cull bounding boxes with hierarchy")
+    {
+        return bvh.QueryFrustum(frustum, visible_indices);
+    };
+
+    BENCHMARK("Pick 1000 instances with screen rays")
+    {
+        Data::Size hits_count = 0U;
+        for (int32_t ray_index = 0; ray_index < 1000; ++ray_index)
+        {
+            const Data::Point2I screen_pos(ray_index * 37 % 1920, ray_index * 53 % 1080);
+            hits_count += static_cast<Data::Size>(bvh.QueryScreenRay(camera, screen_pos).has_value());
+        }
+        return hits_count;
+    };
+}
@@ -0,0 +1,306 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/BoundingVolumeHierarchyTest.cpp
+Bounding volume hierarchy construction, refit, frustum and ray queries tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/BoundingVolumeHierarchy.h>
+#include <Methane/HlslCatchHelpers.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+using BVH = BoundingVolumeHierarchy;
+
+static const Data::FloatSize     g_test_screen_size    { 640.F, 480.F };
+static const Camera::Orientation g_test_orientation    { { 0.F, 20.F, -60.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } };
+static constexpr Data::Size      g_test_instances_count = 20000U; // large enough to be built in parallel
+
+static Camera CreateTestCamera(const Camera::Orientation& orientation = g_test_orientation)
+{
+    Camera camera;
+    camera.Resize(g_test_screen_size);
+    camera.ResetOrientation(orientation);
+    return camera;
+}
+
+static BVH::InstanceBounds GenerateRandomBounds(Data::Size count, uint32_t seed = 1234U)
+{
+    std::mt19937 rng(seed); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-100.F, 100.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 2.F);
+
+    BVH::InstanceBounds instance_bounds(count);
+    for (BVH::Bounds& bounds : instance_bounds)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 extent(extent_distribution(rng), extent_distribution(rng), extent_distribution(rng));
+        bounds.min = center - extent;
+        bounds.max = center + extent;
+    }
+    return instance_bounds;
+}
+
+static BVH::Indices GetVisibleInstances(const BVH::InstanceBounds& instance_bounds, const Frustum& frustum)
+{
+    BVH::Indices visible_indices;
+    for (Data::Index instance_index = 0U; instance_index < instance_bounds.size(); ++instance_index)
+    {
+        if (frustum.IsBoxVisible(instance_bounds[instance_index].min, instance_bounds[instance_index].max))
+            visible_indices.push_back(instance_index);
+    }
+    return visible_indices;
+}
+
+static std::array<float, 3> GetComponents(const hlslpp::float3& vector)
+{
+    return { vector.x, vector.y, vector.z };
+}
+
+static std::optional<float> GetRayDistance(const Camera::Ray& ray, const BVH::Bounds& bounds)
+{
+    const std::array<float, 3> origin    = GetComponents(ray.origin);
+    const std::array<float, 3> direction = GetComponents(ray.direction);
+    const std::array<float, 3> min       = GetComponents(bounds.min);
+    const std::array<float, 3> max       = GetComponents(bounds.max);
+
+    float enter_distance = 0.F;
+    float exit_distance  = std::numeric_limits<float>::max();
+    for (size_t axis = 0U; axis < 3U; ++axis)
+    {
+        const float distance_1 = (min[axis] - origin[axis]) / direction[axis];
+        const float distance_2 = (max[axis] - origin[axis]) / direction[axis];
+        enter_distance = std::max(enter_distance, std::min(distance_1, distance_2));
+        exit_distance  = std::min(exit_distance,  std::max(distance_1, distance_2));
+    }
+    return enter_distance <= exit_distance ? std::optional<float>(enter_distance) : std::nullopt;
+}
+
+static std::optional<float> GetClosestRayDistance(const BVH::InstanceBounds& instance_bounds, const Camera::Ray& ray)
+{
+    std::optional<float> closest_distance;
+    for (const BVH::Bounds& bounds : instance_bounds)
+    {
+        if (const std::optional<float> distance = GetRayDistance(ray, bounds);
+            distance && (!closest_distance || *distance < *closest_distance))
+            closest_distance = distance;
+    }
+    return closest_distance;
+}
+
+static void CheckHierarchyBounds(const BVH& bvh)
+{
+    const BVH::Nodes& nodes = bvh.GetNodes();
+    REQUIRE_FALSE(nodes.empty());
+    CHECK(nodes.front().instance_count == bvh.GetInstanceCount());
+
+    Data::Size leaf_instances_count = 0U;
+    BVH::Indices nodes_stack{ 0U };
+    while (!nodes_stack.empty())
+    {
+        const Data::Index node_index = nodes_stack.back();
+        nodes_stack.pop_back();
+
+        const BVH::Node& node = nodes[node_index];
+        for (Data::Index instance_offset = node.first_instance; instance_offset < node.first_instance + node.instance_count; ++instance_offset)
+        {
+            CHECK(node.bounds.Contains(bvh.GetInstanceBounds()[bvh.GetInstanceIndices()[instance_offset]]));
+        }
+
+        if (node.IsLeaf())
+        {
+            CHECK(node.instance_count <= bvh.GetSettings().max_leaf_size);
+            leaf_instances_count += node.instance_count;
+            continue;
+        }
+
+        const BVH::Node& left_node  = nodes[node.GetLeftChildIndex(node_index)];
+        const BVH::Node& right_node = nodes[node.right_child_index];
+        CHECK(left_node.first_instance == node.first_instance);
+        CHECK(right_node.first_instance == node.first_instance + left_node.instance_count);
+        CHECK(left_node.instance_count + right_node.instance_count == node.instance_count);
+        nodes_stack.push_back(node.GetLeftChildIndex(node_index));
+        nodes_stack.push_back(node.right_child_index);
+    }
+    CHECK(leaf_instances_count == bvh.GetInstanceCount());
+}
+
+TEST_CASE("Bounding volume hierarchy construction", "[bvh]")
+{
+    const BVH::InstanceBounds instance_bounds = GenerateRandomBounds(g_test_instances_count);
+
+    SECTION("Empty hierarchy")
+    {
+        const BVH bvh;
+        BVH::Indices visible_indices{ 1U, 2U };
+        CHECK(bvh.QueryFrustum(CreateTestCamera().GetFrustum(), visible_indices) == 0U);
+        CHECK(visible_indices.empty());
+        CHECK_FALSE(bvh.QueryRay({ { 0.F, 0.F, 0.F }, { 0.F, 0.F, 1.F } }).has_value());
+    }
+
+    SECTION("Sequential construction")
+    {
+        const BVH bvh(instance_bounds);
+        CheckHierarchyBounds(bvh);
+
+        BVH::Indices sorted_instance_indices = bvh.GetInstanceIndices();
+        std::sort(sorted_instance_indices.begin(), sorted_instance_indices.end());
+        for (Data::Index instance_index = 0U; instance_index < g_test_instances_count; ++instance_index)
+        {
+            REQUIRE(sorted_instance_indices[instance_index] == instance_index);
+        }
+    }
+
+    SECTION("Parallel construction")
+    {
+        tf::Executor executor;
+        const BVH sequential_bvh(instance_bounds);
+        const BVH parallel_bvh(instance_bounds, &executor);
+        CheckHierarchyBounds(parallel_bvh);
+        CHECK(parallel_bvh.GetInstanceIndices() == sequential_bvh.GetInstanceIndices());
+        CHECK(parallel_bvh.GetNodes().front().bounds == sequential_bvh.GetNodes().front().bounds);
+    }
+
+    SECTION("Construction with custom settings")
+    {
+        const BVH bvh(instance_bounds, BVH::Settings{ 1U, 8U });
+        CheckHierarchyBounds(bvh);
+        CHECK_THROWS_AS(BVH(instance_bounds, BVH::Settings{ 0U, 8U }), Methane::ZeroArgumentException<Data::Size>);
+    }
+
+    SECTION("Construction with coincident instances")
+    {
+        const BVH bvh(BVH::InstanceBounds(100U, BVH::Bounds{ { -1.F, -1.F, -1.F }, { 1.F, 1.F, 1.F } }));
+        CheckHierarchyBounds(bvh);
+    }
+}
+
+TEST_CASE("Bounding volume hierarchy queries", "[bvh][culling][picking]")
+{
+    BVH::InstanceBounds instance_bounds = GenerateRandomBounds(g_test_instances_count);
+    BVH bvh(instance_bounds);
+    const Camera camera = CreateTestCamera();
+
+    SECTION("Frustum query matches brute-force culling")
+    {
+        const BVH::Indices reference_indices = GetVisibleInstances(instance_bounds, camera.GetFrustum());
+        REQUIRE_FALSE(reference_indices.empty());
+        REQUIRE(reference_indices.size() < g_test_instances_count);
+
+        BVH::Indices visible_indices;
+        CHECK(bvh.QueryFrustum(camera.GetFrustum(), visible_indices) == reference_indices.size());
+        CHECK(visible_indices == reference_indices);
+    }
+
+    SECTION("Ray query returns closest instance")
+    {
+        std::mt19937 rng(4321U); // NOSONAR - using pseudorandom generator is safe here
+        std::uniform_real_distribution<float> direction_distribution(-1.F, 1.F);
+        for (uint32_t ray_index = 0U; ray_index < 100U; ++ray_index)
+        {
+            const Camera::Ray ray{
+                { 0.F, 0.F, 0.F },
+                hlslpp::normalize(hlslpp::float3(direction_distribution(rng), direction_distribution(rng), direction_distribution(rng)))
+            };
+            const std::optional<float> reference_distance = GetClosestRayDistance(instance_bounds, ray);
+            const std::optional<BVH::RayHit> ray_hit = bvh.QueryRay(ray);
+            REQUIRE(ray_hit.has_value() == reference_distance.has_value());
+            if (!ray_hit)
+                continue;
+
+            CHECK_THAT(ray_hit->distance, Catch::Matchers::WithinAbs(*reference_distance, 1E-4F));
+            const std::optional<float> hit_instance_distance = GetRayDistance(ray, instance_bounds[ray_hit->instance_index]);
+            REQUIRE(hit_instance_distance.has_value());
+            CHECK_THAT(*hit_instance_distance, Catch::Matchers::WithinAbs(*reference_distance, 1E-4F));
+        }
+    }
+
+    SECTION("Ray query is limited by maximum distance")
+    {
+        const hlslpp::float3 ray_origin(0.F, 0.F, -200.F);
+        const Camera::Ray ray{ ray_origin, hlslpp::normalize(instance_bounds.front().GetCenter() - ray_origin) };
+        const std::optional<float> reference_distance = GetClosestRayDistance(instance_bounds, ray);
+        REQUIRE(reference_distance.has_value());
+        CHECK(bvh.QueryRay(ray, *reference_distance + 0.01F).has_value());
+        CHECK_FALSE(bvh.QueryRay(ray, *reference_distance - 0.01F).has_value());
+    }
+
+    SECTION("Refit of moving instances")
+    {
+        std::mt19937 rng(5678U); // NOSONAR - using pseudorandom generator is safe here
+        std::uniform_real_distribution<float> offset_distribution(-10.F, 10.F);
+        for (Data::Index instance_index = 0U; instance_index < g_test_instances_count; instance_index += 7U)
+        {
+            const hlslpp::float3 offset(offset_distribution(rng), offset_distribution(rng), offset_distribution(rng));
+            BVH::Bounds& bounds = instance_bounds[instance_index];
+            bounds.min += offset;
+            bounds.max += offset;
+            bvh.SetInstanceBounds(instance_index, bounds);
+        }
+
+        CHECK(bvh.IsRefitRequired());
+        BVH::Indices visible_indices;
+        CHECK_THROWS(bvh.QueryFrustum(camera.GetFrustum(), visible_indices));
+
+        bvh.Refit();
+        CHECK_FALSE(bvh.IsRefitRequired());
+        CheckHierarchyBounds(bvh);
+
+        bvh.QueryFrustum(camera.GetFrustum(), visible_indices);
+        CHECK(visible_indices == GetVisibleInstances(instance_bounds, camera.GetFrustum()));
+    }
+}
+
+TEST_CASE("Bounding volume hierarchy screen picking", "[bvh][picking]")
+{
+    const Camera camera = CreateTestCamera({ { 0.F, 0.F, -10.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } });
+    const Data::Point2I screen_center(static_cast<int32_t>(g_test_screen_size.GetWidth() / 2.F),
+                                      static_cast<int32_t>(g_test_screen_size.GetHeight() / 2.F));
+
+    SECTION("Camera screen ray")
+    {
+        const Camera::Ray ray = camera.GetScreenRay(screen_center);
+        CHECK_THAT(ray.direction, HlslVectorApproxEquals(hlslpp::float3(0.F, 0.F, 1.F), 0.01F));
+        CHECK_THAT(ray.origin,    HlslVectorApproxEquals(hlslpp::float3(0.F, 0.F, -10.F), 0.1F));
+    }
+
+    SECTION("Instance under screen position is picked")
+    {
+        const BVH bvh(BVH::InstanceBounds{
+            BVH::Bounds{ { -1.F, -1.F,  4.F }, { 1.F, 1.F,  6.F } },
+            BVH::Bounds{ { -1.F, -1.F, -1.F }, { 1.F, 1.F,  1.F } },
+            BVH::Bounds{ {  5.F,  5.F, -1.F }, { 7.F, 7.F,  1.F } },
+        });
+
+        const std::optional<BVH::RayHit> center_hit = bvh.QueryScreenRay(camera, screen_center);
+        REQUIRE(center_hit.has_value());
+        CHECK(center_hit->instance_index == 1U);
+        CHECK_THAT(center_hit->distance, Catch::Matchers::WithinAbs(9.F, 0.1F));
+
+        CHECK_FALSE(bvh.QueryScreenRay(camera, Data::Point2I(0, static_cast<int32_t>(g_test_screen_size.GetHeight()) - 1)).has_value());
+    }
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FrustumCullingBenchmark.cpp
+Benchmark of the camera frustum culling of bounding volumes one by one,
+in SIMD batches and in parallel SIMD batches
+
+******************************************************************************/
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/Frustum.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+static constexpr Data::Size g_objects_count = 100000U;
+
+static tf::Executor g_benchmark_executor;
+
+// NOTE: benchmark is hidden from default test runs because of its duration,
+//       run it explicitly with "[frustum][benchmark]" tags filter
+TEST_CASE("Benchmark frustum culling of 100K objects", "[.][camera][frustum][culling][benchmark]")
+{
+    Camera camera;
+    camera.Resize(Data::FloatSize{ 1920.F, 1080.F });
+    camera.ResetOrientation({ { 0.F, 50.F, -100.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } });
+    const Frustum& frustum = camera.GetFrustum();
+
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-200.F, 200.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 2.F);
+
+    Frustum::BoundingSpheres spheres;
+    Frustum::BoundingBoxes   boxes;
+    spheres.Resize(g_objects_count);
+    boxes.Resize(g_objects_count);
+    for (Data::Index index = 0U; index < g_objects_count; ++index)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const float extent = extent_distribution(rng);
+        spheres.Set(index, center, extent);
+        boxes.Set(index, center - extent, center + extent);
+    }
+
+    Frustum::VisibleIndices visible_indices;
+    visible_indices.reserve(g_objects_count);
+
+    BENCHMARK("Cull bounding spheres one by one")
+    {
+        visible_indices.clear();
+        for (Data::Index index = 0U; index < g_objects_count; ++index)
+        {
+            if (frustum.IsSphereVisible({ spheres.center_x[index], spheres.center_y[index], spheres.center_z[index] }, spheres.radius[index]))
+                visible_indices.push_back(index);
+        }
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Cull bounding spheres in SIMD batch")
+    {
+        return frustum.CullSpheres(spheres, visible_indices);
+    };
+
+    BENCHMARK("Cull bounding spheres in SIMD batch in parallel")
+    {
+        return frustum.CullSpheres(spheres, visible_indices, &g_benchmark_executor);
+    };
+
+    BENCHMARK("Cull bounding boxes one by one")
+    {
+        visible_indices.clear();
+        for (Data::Index index = 0U; index < g_objects_count; ++index)
+        {
+            if (frustum.IsBoxVisible({ boxes.min_x[index], boxes.min_y[index], boxes.min_z[index] },
+                                     { boxes.max_x[index], boxes.max_y[index], boxes.max_z[index] }))
+                visible_indices.push_back(index);
+        }
+        return visible_indices.size();
+    };
+
+    BENCHMARK("Cull bounding boxes in SIMD batch")
+    {
+        return frustum.CullBoxes(boxes, visible_indices);
+    };
+
+    BENCHMARK("Cull bounding boxes in SIMD batch in parallel")
+    {
+        return frustum.CullBoxes(boxes, visible_indices, &g_benchmark_executor);
+    };
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FrustumCullingTest.cpp
+Camera frustum visibility tests and batch culling of bounding volumes
+
+******************************************************************************/
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/Frustum.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane;
+
+static const Data::FloatSize     g_test_screen_size { 640.F, 480.F };
+static const Camera::Orientation g_test_orientation { { 0.F, 0.F, -10.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } };
+static const Camera::Parameters  g_test_parameters  { 0.01F, 125.F, 90.F };
+static constexpr Data::Size      g_test_volumes_count = 10007U; // not aligned to SIMD width and culling blocks size
+
+static Camera CreateTestCamera()
+{
+    Camera camera;
+    camera.Resize(g_test_screen_size);
+    camera.SetParameters(g_test_parameters);
+    camera.ResetOrientation(g_test_orientation);
+    return camera;
+}
+
+static Frustum::BoundingSpheres GenerateRandomSpheres(Data::Size count)
+{
+    std::mt19937 rng(1234U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-40.F, 40.F);
+    std::uniform_real_distribution<float> radius_distribution(0.1F, 3.F);
+
+    Frustum::BoundingSpheres spheres;
+    spheres.Resize(count);
+    for (Data::Index index = 0U; index < count; ++index)
+    {
+        spheres.Set(index, { position_distribution(rng), position_distribution(rng), position_distribution(rng) }, radius_distribution(rng));
+    }
+    return spheres;
+}
+
+static Frustum::BoundingBoxes GenerateRandomBoxes(Data::Size count)
+{
+    std::mt19937 rng(4321U); // NOSONAR - using pseudorandom generator is safe here
+    std::uniform_real_distribution<float> position_distribution(-40.F, 40.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 3.F);
+
+    Frustum::BoundingBoxes boxes;
+    boxes.Resize(count);
+    for (Data::Index index = 0U; index < count; ++index)
+    {
+        const hlslpp::float3 center(position_distribution(rng), position_distribution(rng), position_distribution(rng));
+        const hlslpp::float3 extent(extent_distribution(rng), extent_distribution(rng), extent_distribution(rng));
+        boxes.Set(index, center - extent, center + extent);
+    }
+    return boxes;
+}
+
+TEST_CASE("Camera frustum visibility tests", "[camera][frustum]")
+{
+    Camera camera = CreateTestCamera();
+    const Frustum& frustum = camera.GetFrustum();
+
+    SECTION("Point visibility")
+    {
+        CHECK(frustum.IsPointVisible({ 0.F, 0.F, 0.F }));
+        CHECK(frustum.IsPointVisible({ 0.F, 0.F, 100.F }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.F, 0.F, -20.F }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.F, 0.F, 200.F }));
+        CHECK_FALSE(frustum.IsPointVisible({ 20.F, 0.F, 0.F }));
+        CHECK_FALSE(frustum.IsPointVisible({ 0.F, 12.F, 0.F }));
+    }
+
+    SECTION("Sphere visibility")
+    {
+        CHECK(frustum.IsSphereVisible({ 0.F, 0.F, 0.F }, 1.F));
+        CHECK(frustum.IsSphereVisible({ 0.F, 12.F, 0.F }, 3.F));
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.F, 12.F, 0.F }, 1.F));
+        CHECK(frustum.IsSphereVisible({ 0.F, 0.F, -12.F }, 5.F));
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.F, 0.F, -20.F }, 5.F));
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.F, 0.F, 200.F }, 50.F));
+    }
+
+    SECTION("Box visibility")
+    {
+        CHECK(frustum.IsBoxVisible({ -1.F, -1.F, -1.F }, { 1.F, 1.F, 1.F }));
+        CHECK(frustum.IsBoxVisible({ -100.F, -1.F, -1.F }, { 100.F, 1.F, 1.F }));
+        CHECK(frustum.IsBoxVisible({ 11.F, -1.F, -1.F }, { 20.F, 1.F, 1.F }));
+        CHECK_FALSE(frustum.IsBoxVisible({ 20.F, -1.F, -1.F }, { 22.F, 1.F, 1.F }));
+        CHECK_FALSE(frustum.IsBoxVisible({ -1.F, -1.F, -30.F }, { 1.F, 1.F, -20.F }));
+    }
+
+    SECTION("Frustum is updated with camera orientation")
+    {
+        camera.SetOrientationEye({ 0.F, 0.F, 10.F });
+        camera.SetOrientationAim({ 0.F, 0.F, 20.F });
+        CHECK_FALSE(camera.GetFrustum().IsPointVisible({ 0.F, 0.F, 0.F }));
+        CHECK(camera.GetFrustum().IsPointVisible({ 0.F, 0.F, 30.F }));
+    }
+
+    SECTION("Default frustum does not cull anything")
+    {
+        CHECK(Frustum().IsSphereVisible({ 1000.F, -1000.F, 1000.F }, 0.F));
+    }
+}
+
+TEST_CASE("Camera frustum batch culling", "[camera][frustum][culling]")
+{
+    const Camera   camera  = CreateTestCamera();
+    const Frustum& frustum = camera.GetFrustum();
+    tf::Executor   executor;
+    Frustum::VisibleIndices visible_indices;
+
+    SECTION("Empty batch culling")
+    {
+        CHECK(frustum.CullSpheres(Frustum::BoundingSpheres(), visible_indices) == 0U);
+        CHECK(visible_indices.empty());
+    }
+
+    SECTION("Bounding spheres batch culling")
+    {
+        const Frustum::BoundingSpheres spheres = GenerateRandomSpheres(g_test_volumes_count);
+        Frustum::VisibleIndices reference_indices;
+        for (Data::Index index = 0U; index < spheres.GetCount(); ++index)
+        {
+            if (frustum.IsSphereVisible({ spheres.center_x[index], spheres.center_y[index], spheres.center_z[index] }, spheres.radius[index]))
+                reference_indices.push_back(index);
+        }
+        REQUIRE_FALSE(reference_indices.empty());
+        REQUIRE(reference_indices.size() < g_test_volumes_count);
+
+        CHECK(frustum.CullSpheres(spheres, visible_indices) == reference_indices.size());
+        CHECK(visible_indices == reference_indices);
+
+        CHECK(frustum.CullSpheres(spheres, visible_indices, &executor) == reference_indices.size());
+        CHECK(visible_indices == reference_indices);
+    }
+
+    SECTION("Bounding boxes batch culling")
+    {
+        const Frustum::BoundingBoxes boxes = GenerateRandomBoxes(g_test_volumes_count);
+        Frustum::VisibleIndices reference_indices;
+        for (Data::Index index = 0U; index < boxes.GetCount(); ++index)
+        {
+            if (frustum.IsBoxVisible({ boxes.min_x[index], boxes.min_y[index], boxes.min_z[index] },
+                                     { boxes.max_x[index], boxes.max_y[index], boxes.max_z[index] }))
+                reference_indices.push_back(index);
+        }
+        REQUIRE_FALSE(reference_indices.empty());
+        REQUIRE(reference_indices.size() < g_test_volumes_count);
+
+        CHECK(frustum.CullBoxes(boxes, visible_indices) == reference_indices.size());
+        CHECK(visible_indices == reference_indices);
+
+        CHECK(frustum.CullBoxes(boxes, visible_indices, &executor) == reference_indices.size());
+        CHECK(visible_indices == reference_indices);
+    }
+}
@@ -0,0 +1,198 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshCacheTest.cpp
+Unit-tests of the binary mesh cache serialization and loading
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/MeshCache.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstring>
+#include <filesystem>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static bool AreBytesEqual(Data::ConstRawPtr data_ptr, Data::Size data_size, const Data::Bytes& bytes)
+{
+    return data_size == bytes.size() && std::memcmp(data_ptr, bytes.data(), data_size) == 0;
+}
+
+static void CheckSubsetsEqual(const Mesh::Subsets& subsets, const Mesh::Subsets& ref_subsets)
+{
+    REQUIRE(subsets.size() == ref_subsets.size());
+    for (size_t subset_index = 0U; subset_index < subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& subset     = subsets[subset_index];
+        const Mesh::Subset& ref_subset = ref_subsets[subset_index];
+        CHECK(subset.mesh_type == ref_subset.mesh_type);
+        CHECK(subset.vertices.offset == ref_subset.vertices.offset);
+        CHECK(subset.vertices.count == ref_subset.vertices.count);
+        CHECK(subset.indices.offset == ref_subset.indices.offset);
+        CHECK(subset.indices.count == ref_subset.indices.count);
+        CHECK(subset.indices_adjusted == ref_subset.indices_adjusted);
+        CHECK(subset.lod_index == ref_subset.lod_index);
+        CHECK(subset.lod_error == ref_subset.lod_error);
+    }
+}
+
+TEST_CASE("Mesh Cache Serialization", "[mesh][cache]")
+{
+    const SphereMesh<TexturedTestVertex> sphere_mesh(TexturedTestVertex::layout, 2.F, 16U, 32U);
+    const CubeMesh<TexturedTestVertex>   cube_mesh(TexturedTestVertex::layout);
+
+    SECTION("Mesh is loaded from serialized data")
+    {
+        const MeshCache mesh_cache(Data::Chunk(MeshCache::Serialize(sphere_mesh)));
+        CHECK(mesh_cache.GetType() == Mesh::Type::Sphere);
+        CHECK(mesh_cache.GetVertexLayout() == TexturedTestVertex::layout);
+        CHECK(mesh_cache.GetVertexSize() == sphere_mesh.GetVertexSize());
+        CHECK(mesh_cache.GetVertexCount() == sphere_mesh.GetVertexCount());
+        CHECK(mesh_cache.GetIndexCount() == sphere_mesh.GetIndexCount());
+        CHECK(mesh_cache.GetIndexFormat() == sphere_mesh.GetIndexFormat());
+        CHECK(mesh_cache.GetGenerationKey() == 0U);
+        CHECK(std::memcmp(mesh_cache.GetVertexData(), sphere_mesh.GetVertexData(), sphere_mesh.GetVertexDataSize()) == 0);
+        CHECK(AreBytesEqual(mesh_cache.GetIndexData(), mesh_cache.GetIndexDataSize(), sphere_mesh.GetIndexData()));
+        CHECK_THAT(mesh_cache.GetBoundingRadius(), Catch::Matchers::WithinAbs(sphere_mesh.GetBoundingRadius(), 1E-5F));
+        CheckSubsetsEqual(mesh_cache.GetSubsets(), {
+            Mesh::Subset(Mesh::Type::Sphere, { 0U, sphere_mesh.GetVertexCount() }, { 0U, sphere_mesh.GetIndexCount() }, true)
+        });
+    }
+
+    SECTION("Vertex and index data are aligned views of the cache data")
+    {
+        const Data::Bytes mesh_data = MeshCache::Serialize(sphere_mesh);
+        const MeshCache mesh_cache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size())));
+        CHECK_FALSE(mesh_cache.GetData().IsDataStored());
+        CHECK(mesh_cache.GetVertexData() > mesh_data.data());
+        CHECK(mesh_cache.GetIndexData() + mesh_cache.GetIndexDataSize() <= mesh_data.data() + mesh_data.size());
+        CHECK((mesh_cache.GetVertexData() - mesh_data.data()) % MeshCache::data_alignment == 0);
+        CHECK((mesh_cache.GetIndexData() - mesh_data.data()) % MeshCache::data_alignment == 0);
+    }
+
+    SECTION("Uber-mesh subsets with levels of detail are preserved")
+    {
+        UberMesh<TexturedTestVertex> uber_mesh(TexturedTestVertex::layout);
+        uber_mesh.AddSubMesh(cube_mesh, false);
+        uber_mesh.AddSubMeshWithLods(sphere_mesh, false, { 3U, 0.5F, 1.F });
+
+        const MeshCache mesh_cache(Data::Chunk(MeshCache::Serialize(uber_mesh, uber_mesh.GetSubsets(), 42U)));
+        CHECK(mesh_cache.GetType() == Mesh::Type::Uber);
+        CHECK(mesh_cache.GetGenerationKey() == 42U);
+        CheckSubsetsEqual(mesh_cache.GetSubsets(), uber_mesh.GetSubsets());
+        CHECK(AreBytesEqual(mesh_cache.GetIndexData(), mesh_cache.GetIndexDataSize(), uber_mesh.GetIndexData()));
+    }
+
+    SECTION("Compact mesh layout and position encoding are preserved")
+    {
+        Mesh::VertexLayout compact_layout(TexturedTestVertex::layout);
+        compact_layout.SetFieldFormat(Mesh::VertexField::Position, Mesh::VertexFieldFormat::Half)
+                      .SetFieldFormat(Mesh::VertexField::Normal, Mesh::VertexFieldFormat::Octahedral);
+        const CompactMesh compact_mesh(cube_mesh, compact_layout);
+
+        const MeshCache mesh_cache(Data::Chunk(MeshCache::Serialize(compact_mesh)));
+        CHECK(mesh_cache.GetVertexLayout() == compact_layout);
+        CHECK(mesh_cache.GetVertexSize() == compact_mesh.GetVertexSize());
+        CHECK(mesh_cache.GetPositionEncoding().scale == compact_mesh.GetPositionEncoding().scale);
+        CHECK(mesh_cache.GetPositionEncoding().bias == compact_mesh.GetPositionEncoding().bias);
+        CHECK(mesh_cache.GetTexCoordEncoding().scale == compact_mesh.GetTexCoordEncoding().scale);
+        CHECK(mesh_cache.GetTexCoordEncoding().bias == compact_mesh.GetTexCoordEncoding().bias);
+        CHECK_THAT(mesh_cache.GetBoundingRadius(), Catch::Matchers::WithinAbs(cube_mesh.GetBoundingRadius(), 1E-5F));
+        CHECK(std::memcmp(mesh_cache.GetVertexData(), compact_mesh.GetVertexData(), compact_mesh.GetVertexDataSize()) == 0);
+    }
+
+    SECTION("Corrupted or truncated data is rejected")
+    {
+        Data::Bytes mesh_data = MeshCache::Serialize(cube_mesh);
+        CHECK(MeshCache::IsValidData(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size()))));
+        CHECK_FALSE(MeshCache::IsValidData(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size() - MeshCache::data_alignment))));
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(mesh_data.data(), 16U)), std::invalid_argument);
+
+        mesh_data[4] = Data::Byte{ 0xFF }; // format version
+        CHECK_THROWS_AS(MeshCache(Data::Chunk(std::move(mesh_data))), std::invalid_argument);
+    }
+
+    SECTION("Index data referencing vertex out of range is rejected")
+    {
+        Data::Bytes mesh_data = MeshCache::Serialize(cube_mesh);
+        const auto index_data_offset = static_cast<size_t>(MeshCache(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size()))).GetIndexData() - mesh_data.data());
+        REQUIRE(cube_mesh.GetIndexSize() == sizeof(Mesh::Index16));
+
+        const auto out_of_range_index = static_cast<Mesh::Index16>(cube_mesh.GetVertexCount());
+        std::memcpy(mesh_data.data() + index_data_offset + (cube_mesh.GetIndexCount() - 1U) * sizeof(Mesh::Index16), &out_of_range_index, sizeof(out_of_range_index));
+        CHECK_FALSE(MeshCache::IsValidData(Data::Chunk(mesh_data.data(), static_cast<Data::Size>(mesh_data.size()))));
+    }
+}
+
+TEST_CASE("Mesh Cache of Procedural Meshes", "[mesh][cache]")
+{
+    SECTION("Generation key depends on mesh type, vertex layout and generation parameters")
+    {
+        const uint64_t sphere_key = MeshCache::GetGenerationKey(Mesh::Type::Sphere, TexturedTestVertex::layout, 1.F, 16U, 32U);
+        CHECK(sphere_key == MeshCache::GetGenerationKey(Mesh::Type::Sphere, TexturedTestVertex::layout, 1.F, 16U, 32U));
+        CHECK(sphere_key != MeshCache::GetGenerationKey(Mesh::Type::Sphere, TexturedTestVertex::layout, 1.F, 16U, 33U));
+        CHECK(sphere_key != MeshCache::GetGenerationKey(Mesh::Type::Icosahedron, TexturedTestVertex::layout, 1.F, 16U, 32U));
+
+        Mesh::VertexLayout compact_layout(TexturedTestVertex::layout);
+        compact_layout.SetFieldFormat(Mesh::VertexField::TexCoord, Mesh::VertexFieldFormat::Unorm16);
+        CHECK(sphere_key != MeshCache::GetGenerationKey(Mesh::Type::Sphere, compact_layout, 1.F, 16U, 32U));
+    }
+
+    SECTION("Generated mesh is saved to cache file and loaded on next request")
+    {
+        const std::filesystem::path cache_file_path = std::filesystem::temp_directory_path() / "MethaneMeshCacheTest" / "Sphere.mesh";
+        std::filesystem::remove(cache_file_path);
+
+        uint32_t generated_count = 0U;
+        const auto generate_sphere = [&generated_count](uint32_t long_lines_count)
+        {
+            generated_count++;
+            return SphereMesh<TexturedTestVertex>(TexturedTestVertex::layout, 1.F, 16U, long_lines_count);
+        };
+
+        const uint64_t sphere_key = MeshCache::GetGenerationKey(Mesh::Type::Sphere, TexturedTestVertex::layout, 1.F, 16U, 32U);
+        const MeshCache generated_cache = MeshCache::LoadOrGenerate(cache_file_path, sphere_key, [&generate_sphere] { return generate_sphere(32U); });
+        CHECK(generated_count == 1U);
+        CHECK(std::filesystem::exists(cache_file_path));
+        CHECK_FALSE(std::filesystem::exists(std::filesystem::path(cache_file_path).concat(".tmp")));
+
+        const MeshCache loaded_cache = MeshCache::LoadOrGenerate(cache_file_path, sphere_key, [&generate_sphere] { return generate_sphere(32U); });
+        CHECK(generated_count == 1U);
+        CHECK(loaded_cache.GetVertexCount() == generated_cache.GetVertexCount());
+        CHECK(std::memcmp(loaded_cache.GetVertexData(), generated_cache.GetVertexData(), generated_cache.GetVertexDataSize()) == 0);
+
+        const MeshCache file_cache = MeshCache::Load(Data::FileProvider::Get(), std::filesystem::absolute(cache_file_path).string());
+        CHECK(file_cache.GetGenerationKey() == sphere_key);
+
+        const uint64_t new_sphere_key = MeshCache::GetGenerationKey(Mesh::Type::Sphere, TexturedTestVertex::layout, 1.F, 16U, 24U);
+        const MeshCache regenerated_cache = MeshCache::LoadOrGenerate(cache_file_path, new_sphere_key, [&generate_sphere] { return generate_sphere(24U); });
+        CHECK(generated_count == 2U);
+        CHECK(regenerated_cache.GetVertexCount() < generated_cache.GetVertexCount());
+
+        std::filesystem::remove_all(cache_file_path.parent_path());
+    }
+}
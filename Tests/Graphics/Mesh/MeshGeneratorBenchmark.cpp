@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshGeneratorBenchmark.cpp
+Benchmark of the mesh generators with reflected and runtime vertex field access,
+sequential and parallel subdivision and normals generation
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+namespace
+{
+
+// Vertex structure with custom field names is accessed with runtime field offsets
+struct CustomVertex
+{
+    Mesh::Position pos;
+    Mesh::Normal   norm;
+    Mesh::TexCoord uv;
+};
+
+} // anonymous namespace
+
+static constexpr Mesh::Index g_sphere_lines_count       = 1000U; // ~1M vertices
+static constexpr uint32_t    g_icosahedron_subdivisions = 8U;    // ~655K vertices, ~1.3M triangles
+
+static tf::Executor g_benchmark_executor;
+
+// NOTE: benchmark is hidden from default test runs because of its duration,
+//       run it explicitly with "[mesh][benchmark]" tags filter
+TEST_CASE("Benchmark generation of large meshes", "[.][mesh][generator][benchmark]")
+{
+    BENCHMARK("Generate 1M vertices sphere mesh with reflected vertex")
+    {
+        return SphereMesh<TexturedTestVertex>(TexturedTestVertex::layout, 1.F, g_sphere_lines_count, g_sphere_lines_count).GetVertexCount();
+    };
+
+    BENCHMARK("Generate 1M vertices sphere mesh with runtime vertex layout")
+    {
+        return SphereMesh<CustomVertex>(TexturedTestVertex::layout, 1.F, g_sphere_lines_count, g_sphere_lines_count).GetVertexCount();
+    };
+
+    BENCHMARK("Generate subdivided icosahedron mesh with reflected vertex")
+    {
+        return IcosahedronMesh<TexturedTestVertex>(TexturedTestVertex::layout, 1.F, g_icosahedron_subdivisions, true).GetVertexCount();
+    };
+
+    BENCHMARK("Generate subdivided icosahedron mesh with runtime vertex layout")
+    {
+        return IcosahedronMesh<CustomVertex>(TexturedTestVertex::layout, 1.F, g_icosahedron_subdivisions, true).GetVertexCount();
+    };
+
+    BENCHMARK("Generate subdivided icosahedron mesh in parallel")
+    {
+        return IcosahedronMesh<TexturedTestVertex>(TexturedTestVertex::layout, 1.F, g_icosahedron_subdivisions, true, g_benchmark_executor).GetVertexCount();
+    };
+
+    IcosahedronMesh<TexturedTestVertex> icosahedron_mesh(TexturedTestVertex::layout, 1.F, g_icosahedron_subdivisions, true);
+
+    BENCHMARK("Compute average normals of subdivided icosahedron mesh")
+    {
+        icosahedron_mesh.ComputeAverageNormals();
+        return icosahedron_mesh.GetVertexCount();
+    };
+
+    BENCHMARK("Compute average normals of subdivided icosahedron mesh in parallel")
+    {
+        icosahedron_mesh.ComputeAverageNormals(&g_benchmark_executor);
+        return icosahedron_mesh.GetVertexCount();
+    };
+}
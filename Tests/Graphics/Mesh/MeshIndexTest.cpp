@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshIndexTest.cpp
+Unit-tests of the mesh index data with automatic 16 or 32-bit index format selection
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+template<typename IndexType>
+static std::vector<Mesh::Index> GetIndicesFromData(const Data::Bytes& index_data)
+{
+    const auto* index_data_ptr = reinterpret_cast<const IndexType*>(index_data.data()); // NOSONAR
+    return std::vector<Mesh::Index>(index_data_ptr, index_data_ptr + index_data.size() / sizeof(IndexType));
+}
+
+template<typename VType>
+static bool AreIndicesInVertexBounds(const BaseMesh<VType>& mesh)
+{
+    const Mesh::Indices& indices = mesh.GetIndices();
+    return std::all_of(indices.begin(), indices.end(),
+                       [vertex_count = mesh.GetVertexCount()](Mesh::Index index) { return index < vertex_count; });
+}
+
+TEST_CASE("Mesh Index Format Selection", "[mesh][index]")
+{
+    SECTION("Small mesh has 16-bit index data")
+    {
+        const CubeMesh<TestVertex> cube_mesh(TestVertex::layout);
+        CHECK(cube_mesh.HasIndex16Data());
+        CHECK(cube_mesh.GetIndexFormat() == PixelFormat::R16Uint);
+        CHECK(cube_mesh.GetIndexSize() == sizeof(Mesh::Index16));
+        CHECK(cube_mesh.GetIndexDataSize() == cube_mesh.GetIndexCount() * sizeof(Mesh::Index16));
+
+        const Data::Bytes index_data = cube_mesh.GetIndexData();
+        CHECK(index_data.size() == cube_mesh.GetIndexDataSize());
+        CHECK(GetIndicesFromData<Mesh::Index16>(index_data) == cube_mesh.GetIndices());
+    }
+
+    SECTION("Large sphere mesh has 32-bit index data")
+    {
+        const SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 300U, 300U);
+        REQUIRE(sphere_mesh.GetVertexCount() > Mesh::max_index16_vertex_count);
+        CHECK_FALSE(sphere_mesh.HasIndex16Data());
+        CHECK(sphere_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(sphere_mesh.GetIndexDataSize() == sphere_mesh.GetIndexCount() * sizeof(Mesh::Index));
+        CHECK(AreIndicesInVertexBounds(sphere_mesh));
+
+        const Data::Bytes index_data = sphere_mesh.GetIndexData();
+        CHECK(index_data.size() == sphere_mesh.GetIndexDataSize());
+        CHECK(GetIndicesFromData<Mesh::Index>(index_data) == sphere_mesh.GetIndices());
+    }
+
+    SECTION("Highly subdivided icosahedron mesh has 32-bit index data")
+    {
+        const IcosahedronMesh<TestVertex> icosahedron_mesh(TestVertex::layout, 1.F, 7U, true);
+        REQUIRE(icosahedron_mesh.GetVertexCount() > Mesh::max_index16_vertex_count);
+        CHECK(icosahedron_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(AreIndicesInVertexBounds(icosahedron_mesh));
+    }
+
+    SECTION("Uber mesh merged beyond 16-bit vertex count has 32-bit index data")
+    {
+        const SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 100U, 200U);
+        REQUIRE(sphere_mesh.HasIndex16Data());
+
+        UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+        for (uint32_t sub_mesh_index = 0U; sub_mesh_index < 4U; ++sub_mesh_index)
+        {
+            REQUIRE_NOTHROW(uber_mesh.AddSubMesh(sphere_mesh, true));
+        }
+
+        REQUIRE(uber_mesh.GetVertexCount() == sphere_mesh.GetVertexCount() * 4U);
+        CHECK(uber_mesh.GetSubsetCount() == 4U);
+        CHECK(uber_mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(AreIndicesInVertexBounds(uber_mesh));
+
+        const auto [last_subset_indices_ptr, last_subset_indices_count] = uber_mesh.GetSubsetIndices(3U);
+        CHECK(last_subset_indices_count == sphere_mesh.GetIndexCount());
+        CHECK(*std::min_element(last_subset_indices_ptr, last_subset_indices_ptr + last_subset_indices_count) >= sphere_mesh.GetVertexCount() * 3U);
+    }
+}
@@ -0,0 +1,202 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshOptimizationTest.cpp
+Unit-tests of the mesh vertex cache, vertex fetch and overdraw optimization
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <tuple>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using TrianglePositions = std::array<float, 9>;
+
+// Sorted list of triangle vertex positions, which does not depend on triangles and vertices order
+template<typename VType>
+static std::vector<TrianglePositions> GetTrianglePositions(const BaseMesh<VType>& mesh)
+{
+    const Mesh::Indices& indices = mesh.GetIndices();
+    std::vector<TrianglePositions> triangles;
+    for (size_t index = 0; index < indices.size(); index += 3)
+    {
+        // Rotate triangle vertices to start from the minimal vertex position, which keeps triangle winding
+        std::array<Mesh::Position, 3> positions{
+            mesh.GetVertices()[indices[index]].position,
+            mesh.GetVertices()[indices[index + 1]].position,
+            mesh.GetVertices()[indices[index + 2]].position,
+        };
+        const auto position_less = [](const Mesh::Position& left, const Mesh::Position& right)
+        {
+            return std::make_tuple(left.GetX(), left.GetY(), left.GetZ()) < std::make_tuple(right.GetX(), right.GetY(), right.GetZ());
+        };
+        std::rotate(positions.begin(), std::min_element(positions.begin(), positions.end(), position_less), positions.end());
+
+        TrianglePositions triangle{};
+        for (size_t vertex_index = 0; vertex_index < 3; ++vertex_index)
+        {
+            triangle[vertex_index * 3]     = positions[vertex_index].GetX();
+            triangle[vertex_index * 3 + 1] = positions[vertex_index].GetY();
+            triangle[vertex_index * 3 + 2] = positions[vertex_index].GetZ();
+        }
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// Regular grid of quads with triangles listed row by row, which is the worst case for FIFO vertex cache smaller than grid row
+class GridMesh : public BaseMesh<TestVertex>
+{
+public:
+    explicit GridMesh(Mesh::Index cells_count)
+        : BaseMesh<TestVertex>(Mesh::Type::Rect, TestVertex::layout)
+    {
+        const Mesh::Index row_vertices_count = cells_count + 1U;
+        for (Mesh::Index y = 0U; y < row_vertices_count; ++y)
+            for (Mesh::Index x = 0U; x < row_vertices_count; ++x)
+            {
+                AddVertex(TestVertex{ Mesh::Position(static_cast<float>(x), static_cast<float>(y), 0.F), Mesh::Normal(0.F, 0.F, 1.F) });
+            }
+
+        for (Mesh::Index y = 0U; y < cells_count; ++y)
+            for (Mesh::Index x = 0U; x < cells_count; ++x)
+            {
+                const Mesh::Index vertex_index = y * row_vertices_count + x;
+                AppendIndices({
+                    vertex_index, vertex_index + row_vertices_count, vertex_index + 1U,
+                    vertex_index + 1U, vertex_index + row_vertices_count, vertex_index + row_vertices_count + 1U
+                });
+            }
+    }
+};
+
+static bool AreVerticesInFirstUseOrder(const Mesh::Indices& indices)
+{
+    Mesh::Index next_vertex_index = 0U;
+    for (Mesh::Index index : indices)
+    {
+        if (index > next_vertex_index)
+            return false;
+        if (index == next_vertex_index)
+            next_vertex_index++;
+    }
+    return true;
+}
+
+TEST_CASE("Mesh Optimization", "[mesh][optimization]")
+{
+    SECTION("Vertex cache statistics of unoptimized triangles list")
+    {
+        const SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 64U, 64U);
+        const Mesh::VertexCacheStatistics cache_stats = sphere_mesh.GetVertexCacheStatistics();
+        CHECK(cache_stats.acmr >= 0.5F);
+        CHECK(cache_stats.acmr <= 3.F);
+        CHECK(cache_stats.atvr >= 1.F);
+    }
+
+    SECTION("Vertex cache optimization reduces ACMR and ATVR without changing geometry")
+    {
+        SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 64U, 64U);
+        const Mesh::VertexCacheStatistics orig_cache_stats = sphere_mesh.GetVertexCacheStatistics();
+        const std::vector<TrianglePositions> orig_triangles = GetTrianglePositions(sphere_mesh);
+        const Mesh::Indices orig_indices = sphere_mesh.GetIndices();
+
+        sphere_mesh.Optimize();
+
+        const Mesh::VertexCacheStatistics opt_cache_stats = sphere_mesh.GetVertexCacheStatistics();
+        CHECK(opt_cache_stats.acmr < orig_cache_stats.acmr);
+        CHECK(opt_cache_stats.atvr < orig_cache_stats.atvr);
+        CHECK(sphere_mesh.GetIndices().size() == orig_indices.size());
+        CHECK(GetTrianglePositions(sphere_mesh) == orig_triangles);
+        CHECK(AreVerticesInFirstUseOrder(sphere_mesh.GetIndices()));
+    }
+
+    SECTION("Vertex cache optimization of grid mesh reduces ACMR relative to rows order")
+    {
+        GridMesh grid_mesh(64U);
+        const Mesh::VertexCacheStatistics orig_cache_stats = grid_mesh.GetVertexCacheStatistics();
+        const std::vector<TrianglePositions> orig_triangles = GetTrianglePositions(grid_mesh);
+
+        grid_mesh.Optimize();
+
+        const Mesh::VertexCacheStatistics opt_cache_stats = grid_mesh.GetVertexCacheStatistics();
+        CHECK(orig_cache_stats.acmr > 1.F);
+        CHECK(opt_cache_stats.acmr < 0.7F);
+        CHECK(opt_cache_stats.acmr < orig_cache_stats.acmr);
+        CHECK(GetTrianglePositions(grid_mesh) == orig_triangles);
+    }
+
+    SECTION("Optimization is deterministic")
+    {
+        IcosahedronMesh<TestVertex> icosahedron_mesh_1(TestVertex::layout, 1.F, 3U, true);
+        IcosahedronMesh<TestVertex> icosahedron_mesh_2(TestVertex::layout, 1.F, 3U, true);
+        const Mesh::OptimizationSettings settings{ 32U, true, true };
+        icosahedron_mesh_1.Optimize(settings);
+        icosahedron_mesh_2.Optimize(settings);
+        CHECK(icosahedron_mesh_1.GetIndices() == icosahedron_mesh_2.GetIndices());
+        CHECK(GetTrianglePositions(icosahedron_mesh_1) == GetTrianglePositions(icosahedron_mesh_2));
+    }
+
+    SECTION("Overdraw optimization keeps geometry and vertex cache efficiency")
+    {
+        IcosahedronMesh<TestVertex> icosahedron_mesh(TestVertex::layout, 1.F, 4U, true);
+        const Mesh::VertexCacheStatistics orig_cache_stats = icosahedron_mesh.GetVertexCacheStatistics();
+        const std::vector<TrianglePositions> orig_triangles = GetTrianglePositions(icosahedron_mesh);
+
+        icosahedron_mesh.Optimize({ Mesh::default_vertex_cache_size, true, true });
+
+        CHECK(icosahedron_mesh.GetVertexCacheStatistics().acmr < orig_cache_stats.acmr);
+        CHECK(GetTrianglePositions(icosahedron_mesh) == orig_triangles);
+    }
+
+    SECTION("Uber mesh subsets are optimized in their own ranges")
+    {
+        const SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 16U, 16U);
+        const IcosahedronMesh<TestVertex> icosahedron_mesh(TestVertex::layout, 1.F, 2U, true);
+
+        UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+        uber_mesh.AddSubMesh(sphere_mesh, true);
+        uber_mesh.AddSubMesh(icosahedron_mesh, false);
+        uber_mesh.Optimize();
+
+        for (size_t subset_index = 0; subset_index < uber_mesh.GetSubsetCount(); ++subset_index)
+        {
+            const Mesh::Subset& subset = uber_mesh.GetSubset(subset_index);
+            const Mesh::Index index_base = subset.indices_adjusted ? subset.vertices.offset : 0U;
+            const auto [subset_indices_ptr, subset_indices_count] = uber_mesh.GetSubsetIndices(subset_index);
+
+            Mesh::Indices subset_indices(subset_indices_ptr, subset_indices_ptr + subset_indices_count);
+            std::transform(subset_indices.begin(), subset_indices.end(), subset_indices.begin(),
+                           [index_base](Mesh::Index index) { return index - index_base; });
+
+            CHECK(*std::max_element(subset_indices.begin(), subset_indices.end()) < subset.vertices.count);
+            CHECK(AreVerticesInFirstUseOrder(subset_indices));
+        }
+    }
+}
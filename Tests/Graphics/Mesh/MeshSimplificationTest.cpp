@@ -0,0 +1,230 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshSimplificationTest.cpp
+Unit-tests of the mesh simplification with quadric error metric and levels of detail generation
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using SphereMeshT = SphereMesh<TestVertex>;
+
+static hlslpp::float3 GetPosition(const SphereMeshT& mesh, Mesh::Index vertex_index)
+{
+    return mesh.GetVertices()[vertex_index].position.AsHlsl();
+}
+
+// Maximum distance from the centroids of simplified triangles to the sphere surface relative to mesh bounding radius
+static float GetMaxSphereDeviation(const SphereMeshT& sphere_mesh, const Mesh::Indices& indices, float sphere_radius)
+{
+    float max_deviation = 0.F;
+    for (size_t index = 0; index < indices.size(); index += 3)
+    {
+        const hlslpp::float3 centroid = (GetPosition(sphere_mesh, indices[index]) +
+                                             GetPosition(sphere_mesh, indices[index + 1]) +
+                                             GetPosition(sphere_mesh, indices[index + 2])) / 3.F;
+        max_deviation = std::max(max_deviation, sphere_radius - static_cast<float>(hlslpp::length(centroid)));
+    }
+    return max_deviation / sphere_mesh.GetBoundingRadius();
+}
+
+// All triangles of simplified sphere should keep facing outward
+static bool AreTrianglesFacingOutward(const SphereMeshT& sphere_mesh, const Mesh::Indices& indices)
+{
+    for (size_t index = 0; index < indices.size(); index += 3)
+    {
+        const hlslpp::float3 p1 = GetPosition(sphere_mesh, indices[index]);
+        const hlslpp::float3 p2 = GetPosition(sphere_mesh, indices[index + 1]);
+        const hlslpp::float3 p3 = GetPosition(sphere_mesh, indices[index + 2]);
+        if (static_cast<float>(hlslpp::dot(hlslpp::cross(p2 - p1, p3 - p1), p1 + p2 + p3)) <= 0.F)
+            return false;
+    }
+    return true;
+}
+
+static Mesh::Indices GetSortedSubsetIndices(const UberMesh<TestVertex>& uber_mesh, Data::Index subset_index)
+{
+    const auto [subset_indices_ptr, subset_indices_count] = uber_mesh.GetSubsetIndices(subset_index);
+    Mesh::Indices subset_indices(subset_indices_ptr, subset_indices_ptr + subset_indices_count);
+    std::sort(subset_indices.begin(), subset_indices.end());
+    return subset_indices;
+}
+
+TEST_CASE("Mesh Simplification", "[mesh][simplification]")
+{
+    const float       sphere_radius = 2.F;
+    const SphereMeshT sphere_mesh(TestVertex::layout, sphere_radius, 32U, 64U);
+    const Data::Size  sphere_triangles_count = sphere_mesh.GetIndexCount() / 3U;
+
+    SECTION("Simplification reduces triangles count to target")
+    {
+        for (const Data::Size target_triangles_count : { sphere_triangles_count / 2U, sphere_triangles_count / 4U, sphere_triangles_count / 8U })
+        {
+            float result_error = 0.F;
+            const Mesh::Indices simplified_indices = sphere_mesh.GetSimplifiedIndices(target_triangles_count * 3U, 1.F, result_error);
+            CHECK(simplified_indices.size() % 3U == 0U);
+            CHECK(simplified_indices.size() / 3U <= target_triangles_count);
+            CHECK(simplified_indices.size() / 3U + 2U >= target_triangles_count);
+            CHECK(result_error > 0.F);
+            CHECK(result_error <= 1.F);
+            CHECK(AreTrianglesFacingOutward(sphere_mesh, simplified_indices));
+        }
+    }
+
+    SECTION("Simplified indices reference original vertices")
+    {
+        float result_error = 0.F;
+        const Mesh::Indices simplified_indices = sphere_mesh.GetSimplifiedIndices(sphere_mesh.GetIndexCount() / 4U, 1.F, result_error);
+        REQUIRE_FALSE(simplified_indices.empty());
+        CHECK(*std::max_element(simplified_indices.begin(), simplified_indices.end()) < sphere_mesh.GetVertexCount());
+    }
+
+    SECTION("Simplification error does not exceed maximum error")
+    {
+        const float max_error = 0.01F;
+        float result_error = 0.F;
+        const Mesh::Indices simplified_indices = sphere_mesh.GetSimplifiedIndices(0U, max_error, result_error);
+        CHECK(result_error <= max_error);
+        CHECK(simplified_indices.size() < sphere_mesh.GetIndexCount());
+        CHECK(simplified_indices.size() > sphere_mesh.GetIndexCount() / 4U);
+        CHECK(GetMaxSphereDeviation(sphere_mesh, simplified_indices, sphere_radius) <= result_error);
+    }
+
+    SECTION("Simplification error bounds geometric deviation")
+    {
+        float prev_result_error = 0.F;
+        for (const Data::Size target_triangles_count : { sphere_triangles_count / 2U, sphere_triangles_count / 4U, sphere_triangles_count / 8U })
+        {
+            float result_error = 0.F;
+            const Mesh::Indices simplified_indices = sphere_mesh.GetSimplifiedIndices(target_triangles_count * 3U, 1.F, result_error);
+            CHECK(result_error >= prev_result_error);
+            CHECK(GetMaxSphereDeviation(sphere_mesh, simplified_indices, sphere_radius) <= result_error);
+            prev_result_error = result_error;
+        }
+    }
+
+    SECTION("Curved mesh is not simplified with zero error")
+    {
+        float result_error = 1.F;
+        const Mesh::Indices simplified_indices = sphere_mesh.GetSimplifiedIndices(0U, 0.F, result_error);
+        CHECK(simplified_indices == sphere_mesh.GetIndices());
+        CHECK(result_error == 0.F);
+    }
+
+    SECTION("Border vertices are not collapsed")
+    {
+        // Cube faces do not share vertices, so all cube edges are borders
+        const CubeMesh<TestVertex> cube_mesh(TestVertex::layout);
+        float result_error = 1.F;
+        CHECK(cube_mesh.GetSimplifiedIndices(0U, 1.F, result_error) == cube_mesh.GetIndices());
+        CHECK(result_error == 0.F);
+    }
+
+    SECTION("Simplification is deterministic")
+    {
+        float result_error_1 = 0.F;
+        float result_error_2 = 0.F;
+        CHECK(sphere_mesh.GetSimplifiedIndices(sphere_mesh.GetIndexCount() / 8U, 1.F, result_error_1) ==
+              sphere_mesh.GetSimplifiedIndices(sphere_mesh.GetIndexCount() / 8U, 1.F, result_error_2));
+        CHECK(result_error_1 == result_error_2);
+    }
+}
+
+TEST_CASE("Mesh Levels of Detail", "[mesh][simplification][lod]")
+{
+    const SphereMeshT sphere_mesh(TestVertex::layout, 1.F, 32U, 64U);
+    const Mesh::LodSettings lod_settings{ 4U, 0.5F, 1.F };
+
+    SECTION("Levels of detail are added as consecutive subsets sharing vertices")
+    {
+        const CubeMesh<TestVertex> cube_mesh(TestVertex::layout);
+        UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+        uber_mesh.AddSubMesh(cube_mesh, true);
+
+        const Data::Size lods_count = uber_mesh.AddSubMeshWithLods(sphere_mesh, true, lod_settings);
+        REQUIRE(lods_count == lod_settings.lods_count);
+        REQUIRE(uber_mesh.GetSubsetCount() == lods_count + 1U);
+        CHECK(uber_mesh.GetVertexCount() == cube_mesh.GetVertexCount() + sphere_mesh.GetVertexCount());
+
+        const Mesh::Subset& full_subset = uber_mesh.GetSubset(1U);
+        CHECK(full_subset.lod_index == 0U);
+        CHECK(full_subset.lod_error == 0.F);
+        CHECK(full_subset.indices.count == sphere_mesh.GetIndexCount());
+
+        for (Data::Index lod_index = 1U; lod_index < lods_count; ++lod_index)
+        {
+            const Mesh::Subset& lod_subset  = uber_mesh.GetSubset(lod_index + 1U);
+            const Mesh::Subset& prev_subset = uber_mesh.GetSubset(lod_index);
+            CHECK(lod_subset.lod_index == lod_index);
+            CHECK(lod_subset.lod_error >= prev_subset.lod_error);
+            CHECK(lod_subset.lod_error <= lod_settings.max_error);
+            CHECK(lod_subset.vertices.offset == full_subset.vertices.offset);
+            CHECK(lod_subset.vertices.count == full_subset.vertices.count);
+            CHECK(lod_subset.indices.offset == prev_subset.indices.offset + prev_subset.indices.count);
+            CHECK(lod_subset.indices.count <= prev_subset.indices.count / 2U);
+
+            const auto [lod_indices_ptr, lod_indices_count] = uber_mesh.GetSubsetIndices(lod_index + 1U);
+            CHECK(*std::min_element(lod_indices_ptr, lod_indices_ptr + lod_indices_count) >= full_subset.vertices.offset);
+            CHECK(*std::max_element(lod_indices_ptr, lod_indices_ptr + lod_indices_count) < full_subset.vertices.offset + full_subset.vertices.count);
+        }
+    }
+
+    SECTION("Levels of detail chain ends when maximum error is reached")
+    {
+        UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+        const Data::Size lods_count = uber_mesh.AddSubMeshWithLods(sphere_mesh, false, { 8U, 0.5F, 0.05F });
+        CHECK(lods_count > 1U);
+        CHECK(lods_count < 8U);
+        CHECK(uber_mesh.GetSubsetCount() == lods_count);
+        for (const Mesh::Subset& lod_subset : uber_mesh.GetSubsets())
+        {
+            CHECK(lod_subset.lod_error <= 0.05F);
+        }
+    }
+
+    SECTION("Optimization keeps triangles of levels of detail")
+    {
+        UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+        const Data::Size lods_count = uber_mesh.AddSubMeshWithLods(sphere_mesh, false, lod_settings);
+        std::vector<Mesh::Indices> orig_lod_indices;
+        for (Data::Index lod_index = 0U; lod_index < lods_count; ++lod_index)
+        {
+            orig_lod_indices.push_back(GetSortedSubsetIndices(uber_mesh, lod_index));
+        }
+
+        uber_mesh.Optimize();
+
+        // Vertices shared by levels of detail are not reordered, so only triangles order is changed in each level
+        for (Data::Index lod_index = 0U; lod_index < lods_count; ++lod_index)
+        {
+            CHECK(GetSortedSubsetIndices(uber_mesh, lod_index) == orig_lod_indices[lod_index]);
+        }
+    }
+}
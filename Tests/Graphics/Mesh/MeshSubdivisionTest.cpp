@@ -0,0 +1,93 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshSubdivisionTest.cpp
+Unit-tests of the sequential and parallel mesh subdivision and normals generation
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_test_executor;
+
+static Data::Size GetIcosahedronVertexCount(uint32_t subdivisions_count)
+{
+    // Each subdivision splits every edge once: V' = V + E, where E = 3 * V - 6 for a closed triangle mesh of genus 0
+    Data::Size vertex_count = 12U;
+    for (uint32_t subdivision = 0; subdivision < subdivisions_count; ++subdivision)
+    {
+        vertex_count += 3U * vertex_count - 6U;
+    }
+    return vertex_count;
+}
+
+static bool AreVertexDataEqual(const Mesh& mesh1, const Mesh& mesh2)
+{
+    return mesh1.GetVertexDataSize() == mesh2.GetVertexDataSize() &&
+           std::memcmp(mesh1.GetVertexData(), mesh2.GetVertexData(), mesh1.GetVertexDataSize()) == 0;
+}
+
+TEST_CASE("Mesh Subdivision", "[mesh][subdivision]")
+{
+    SECTION("Subdivision shares edge midpoints between adjacent triangles")
+    {
+        for (uint32_t subdivisions_count = 0U; subdivisions_count <= 4U; ++subdivisions_count)
+        {
+            const IcosahedronMesh<TexturedTestVertex> icosahedron_mesh(TexturedTestVertex::layout, 1.F, subdivisions_count);
+            CHECK(icosahedron_mesh.GetVertexCount() == GetIcosahedronVertexCount(subdivisions_count));
+            CHECK(icosahedron_mesh.GetIndexCount() == 60U << (2U * subdivisions_count));
+        }
+    }
+
+    SECTION("Parallel subdivision is identical to sequential subdivision")
+    {
+        const IcosahedronMesh<TexturedTestVertex> sequential_mesh(TexturedTestVertex::layout, 2.F, 5U, true);
+        const IcosahedronMesh<TexturedTestVertex> parallel_mesh(TexturedTestVertex::layout, 2.F, 5U, true, g_test_executor);
+        CHECK(AreVertexDataEqual(sequential_mesh, parallel_mesh));
+        CHECK(sequential_mesh.GetIndices() == parallel_mesh.GetIndices());
+    }
+
+    SECTION("Parallel average normals are identical to sequential average normals")
+    {
+        IcosahedronMesh<TexturedTestVertex> sequential_mesh(TexturedTestVertex::layout, 1.F, 4U);
+        IcosahedronMesh<TexturedTestVertex> parallel_mesh(TexturedTestVertex::layout, 1.F, 4U);
+        sequential_mesh.ComputeAverageNormals();
+        parallel_mesh.ComputeAverageNormals(&g_test_executor);
+        CHECK(AreVertexDataEqual(sequential_mesh, parallel_mesh));
+    }
+
+    SECTION("Average normals of spherified mesh point outside")
+    {
+        IcosahedronMesh<TexturedTestVertex> sphere_mesh(TexturedTestVertex::layout, 1.F, 3U, true);
+        sphere_mesh.ComputeAverageNormals(&g_test_executor);
+        for (const TexturedTestVertex& vertex : sphere_mesh.GetVertices())
+        {
+            const float normal_position_cos = hlslpp::dot(vertex.normal.AsHlsl(), vertex.position.AsHlsl());
+            CHECK(normal_position_cos > 0.9F);
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshTestVertices.hpp
+Vertex structures shared by mesh unit-tests and benchmarks
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Mesh.h>
+
+namespace Methane::Graphics
+{
+
+struct TestVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+struct TexturedTestVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+    Mesh::TexCoord texcoord;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+        Mesh::VertexField::TexCoord,
+    };
+};
+
+} // namespace Methane::Graphics
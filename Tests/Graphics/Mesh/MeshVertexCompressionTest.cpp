@@ -0,0 +1,285 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshVertexCompressionTest.cpp
+Unit-tests of the compact mesh vertex field encodings
+
+******************************************************************************/
+
+#include "MeshTestVertices.hpp"
+
+#include <Methane/Graphics/CompactMesh.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/QuadMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+struct FullVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+    Mesh::TexCoord texcoord;
+    Mesh::Color    color;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+        Mesh::VertexField::TexCoord,
+        Mesh::VertexField::Color,
+    };
+};
+
+static Mesh::VertexLayout GetCompactLayout()
+{
+    Mesh::VertexLayout compact_layout(FullVertex::layout);
+    compact_layout.SetFieldFormat(Mesh::VertexField::Position, Mesh::VertexFieldFormat::Half)
+                  .SetFieldFormat(Mesh::VertexField::Normal,   Mesh::VertexFieldFormat::Octahedral)
+                  .SetFieldFormat(Mesh::VertexField::TexCoord, Mesh::VertexFieldFormat::Unorm16)
+                  .SetFieldFormat(Mesh::VertexField::Color,    Mesh::VertexFieldFormat::Unorm8);
+    return compact_layout;
+}
+
+template<typename T>
+static T ReadCompactField(const CompactMesh& mesh, Data::Index vertex_index, size_t field_offset)
+{
+    T field_value;
+    std::memcpy(&field_value, mesh.GetVertexData() + vertex_index * mesh.GetVertexSize() + field_offset, sizeof(T));
+    return field_value;
+}
+
+// Quad mesh with texture coordinates tiled and shifted out of [0, 1] range
+class TiledQuadMesh : public QuadMesh<FullVertex>
+{
+public:
+    TiledQuadMesh(float tiles_count, float tiles_offset)
+        : QuadMesh<FullVertex>(FullVertex::layout)
+    {
+        for (size_t vertex_index = 0U; vertex_index < GetVertexCount(); ++vertex_index)
+        {
+            Mesh::TexCoord& texcoord = GetMutableVertex(vertex_index).texcoord;
+            texcoord = Mesh::TexCoord(texcoord.GetX() * tiles_count + tiles_offset, texcoord.GetY() * tiles_count - tiles_offset);
+        }
+    }
+};
+
+TEST_CASE("Mesh Vertex Field Encoders", "[mesh][vertex][compact]")
+{
+    SECTION("Half float encodes exactly representable values")
+    {
+        for (const float value : { 0.F, 1.F, -1.F, 0.5F, -2.F, 1024.F, 65504.F, 6.103515625e-05F, 5.9604645e-08F })
+        {
+            CHECK(CompactMesh::DecodeHalf(CompactMesh::EncodeHalf(value)) == value);
+        }
+        CHECK(CompactMesh::EncodeHalf(1.F)  == 0x3C00U);
+        CHECK(CompactMesh::EncodeHalf(-0.F) == 0x8000U);
+    }
+
+    SECTION("Half float rounds to nearest even")
+    {
+        CHECK(CompactMesh::EncodeHalf(1.F + 1.F / 2048.F) == 0x3C00U);
+        CHECK(CompactMesh::EncodeHalf(1.F + 3.F / 2048.F) == 0x3C02U);
+        CHECK(CompactMesh::EncodeHalf(1.F + 1.1F / 2048.F) == 0x3C01U);
+        for (float value = -1.F; value <= 1.F; value += 0.001F)
+        {
+            CHECK(std::abs(CompactMesh::DecodeHalf(CompactMesh::EncodeHalf(value)) - value) <= 1.F / 2048.F);
+        }
+    }
+
+    SECTION("Half float handles out of range values")
+    {
+        CHECK(CompactMesh::EncodeHalf(65520.F)   == 0x7C00U);
+        CHECK(CompactMesh::EncodeHalf(-1.0e10F)  == 0xFC00U);
+        CHECK(CompactMesh::EncodeHalf(std::numeric_limits<float>::infinity()) == 0x7C00U);
+        CHECK(std::isnan(CompactMesh::DecodeHalf(CompactMesh::EncodeHalf(std::numeric_limits<float>::quiet_NaN()))));
+        CHECK(CompactMesh::EncodeHalf(1.0e-8F) == 0U);
+    }
+
+    SECTION("Octahedral normal encoding keeps direction")
+    {
+        const SphereMesh<TestVertex> sphere_mesh(TestVertex::layout, 1.F, 16U, 32U);
+        for (const TestVertex& vertex : sphere_mesh.GetVertices())
+        {
+            const Mesh::Normal normal         = vertex.normal;
+            const Mesh::Normal decoded_normal = CompactMesh::DecodeOctahedralNormal(CompactMesh::EncodeOctahedralNormal(normal));
+            CHECK_THAT(decoded_normal.GetLength(), Catch::Matchers::WithinAbs(1.F, 1E-5F));
+            CHECK(hlslpp::dot(normal.AsHlsl(), decoded_normal.AsHlsl()) / normal.GetLength() > 0.9999F);
+        }
+    }
+
+    SECTION("Octahedral normal encoding of axis directions is exact")
+    {
+        for (const Mesh::Normal& normal : { Mesh::Normal(1.F, 0.F, 0.F), Mesh::Normal(0.F, -1.F, 0.F), Mesh::Normal(0.F, 0.F, -1.F) })
+        {
+            const Mesh::Normal decoded_normal = CompactMesh::DecodeOctahedralNormal(CompactMesh::EncodeOctahedralNormal(normal));
+            CHECK(decoded_normal == normal);
+        }
+    }
+
+    SECTION("Normalized integers are clamped and rounded")
+    {
+        CHECK(CompactMesh::EncodeUnorm16(0.F)   == 0U);
+        CHECK(CompactMesh::EncodeUnorm16(1.F)   == 65535U);
+        CHECK(CompactMesh::EncodeUnorm16(2.F)   == 65535U);
+        CHECK(CompactMesh::EncodeUnorm16(0.5F)  == 32768U);
+        CHECK(CompactMesh::EncodeUnorm8(-1.F)   == 0U);
+        CHECK(CompactMesh::EncodeUnorm8(1.F)    == 255U);
+        CHECK(CompactMesh::EncodeUnorm8(0.5F)   == 128U);
+    }
+}
+
+TEST_CASE("Mesh Compact Vertex Layout", "[mesh][vertex][compact]")
+{
+    SECTION("Compact layout fields have reduced size")
+    {
+        const Mesh::VertexLayout compact_layout = GetCompactLayout();
+        CHECK(compact_layout.IsCompact());
+        CHECK_FALSE(FullVertex::layout.IsCompact());
+        CHECK(compact_layout != FullVertex::layout);
+        CHECK(compact_layout == GetCompactLayout());
+        CHECK(compact_layout.GetFormats() == std::vector<PixelFormat>{
+            PixelFormat::RGBA16Float, PixelFormat::RG16Snorm, PixelFormat::RG16Unorm, PixelFormat::RGBA8Unorm
+        });
+        CHECK(FullVertex::layout.GetFormats() == std::vector<PixelFormat>(4U, PixelFormat::Unknown));
+    }
+
+    SECTION("Field format incompatible with field type is rejected")
+    {
+        Mesh::VertexLayout layout(FullVertex::layout);
+        CHECK_THROWS_AS(layout.SetFieldFormat(Mesh::VertexField::Normal, Mesh::VertexFieldFormat::Half), std::invalid_argument);
+        CHECK_THROWS_AS(layout.SetFieldFormat(Mesh::VertexField::Position, Mesh::VertexFieldFormat::Unorm8), std::invalid_argument);
+    }
+
+    SECTION("Format of field missing in layout is rejected")
+    {
+        Mesh::VertexLayout layout{ Mesh::VertexField::Position };
+        CHECK_THROWS_AS(layout.SetFieldFormat(Mesh::VertexField::Color, Mesh::VertexFieldFormat::Unorm8), Mesh::VertexLayout::IncompatibleException);
+    }
+
+    SECTION("Generated mesh can not have compact layout")
+    {
+        CHECK_THROWS_AS(CubeMesh<FullVertex>(GetCompactLayout()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Mesh Compact Vertex Encoding", "[mesh][vertex][compact]")
+{
+    const CubeMesh<FullVertex> cube_mesh(FullVertex::layout, 6.F, 4.F, 2.F);
+    const CompactMesh compact_mesh(cube_mesh, GetCompactLayout());
+
+    SECTION("Compact mesh has less than half vertex size and the same indices")
+    {
+        CHECK(cube_mesh.GetVertexSize() == 44U);
+        CHECK(compact_mesh.GetVertexSize() == 20U);
+        CHECK(compact_mesh.GetVertexCount() == cube_mesh.GetVertexCount());
+        CHECK(compact_mesh.GetVertexDataSize() == compact_mesh.GetVertexCount() * 20U);
+        CHECK(compact_mesh.GetIndices() == cube_mesh.GetIndices());
+        CHECK(compact_mesh.GetIndexFormat() == cube_mesh.GetIndexFormat());
+    }
+
+    SECTION("Position encoding is computed from mesh bounding box")
+    {
+        const CompactMesh::PositionEncoding& position_encoding = compact_mesh.GetPositionEncoding();
+        CHECK(position_encoding.scale == Mesh::Position(3.F, 2.F, 1.F));
+        CHECK(position_encoding.bias  == Mesh::Position(0.F, 0.F, 0.F));
+    }
+
+    SECTION("Decoded vertex fields are close to original")
+    {
+        const CompactMesh::PositionEncoding& position_encoding = compact_mesh.GetPositionEncoding();
+        for (Data::Index vertex_index = 0U; vertex_index < cube_mesh.GetVertexCount(); ++vertex_index)
+        {
+            const FullVertex& vertex = cube_mesh.GetVertices()[vertex_index];
+            const auto encoded_position = ReadCompactField<std::array<uint16_t, 4>>(compact_mesh, vertex_index, 0U);
+            for (size_t component = 0U; component < 3U; ++component)
+            {
+                const float decoded_position = CompactMesh::DecodeHalf(encoded_position[component]) * position_encoding.scale[component]
+                                             + position_encoding.bias[component];
+                CHECK(std::abs(decoded_position - vertex.position[component]) <= position_encoding.scale[component] * 1E-3F);
+            }
+            CHECK(CompactMesh::DecodeHalf(encoded_position[3]) == 1.F);
+
+            const auto encoded_normal = ReadCompactField<CompactMesh::OctahedralNormal>(compact_mesh, vertex_index, 8U);
+            CHECK(hlslpp::dot(vertex.normal.AsHlsl(), CompactMesh::DecodeOctahedralNormal(encoded_normal).AsHlsl()) > 0.9999F);
+
+            const auto encoded_texcoord = ReadCompactField<std::array<uint16_t, 2>>(compact_mesh, vertex_index, 12U);
+            CHECK(std::abs(static_cast<float>(encoded_texcoord[0]) / 65535.F - vertex.texcoord.GetX()) <= 0.5F / 65535.F + 1E-7F);
+            CHECK(std::abs(static_cast<float>(encoded_texcoord[1]) / 65535.F - vertex.texcoord.GetY()) <= 0.5F / 65535.F + 1E-7F);
+
+            const auto encoded_color = ReadCompactField<std::array<uint8_t, 4>>(compact_mesh, vertex_index, 16U);
+            for (size_t component = 0U; component < 3U; ++component)
+            {
+                CHECK(std::abs(static_cast<float>(encoded_color[component]) / 255.F - vertex.color[component]) <= 0.5F / 255.F + 1E-6F);
+            }
+            CHECK(encoded_color[3] == 255U);
+        }
+    }
+
+    SECTION("Texture coordinates in [0, 1] range are encoded without scale and bias")
+    {
+        const CompactMesh::TexCoordEncoding& texcoord_encoding = compact_mesh.GetTexCoordEncoding();
+        CHECK(texcoord_encoding.scale == Mesh::TexCoord(1.F, 1.F));
+        CHECK(texcoord_encoding.bias  == Mesh::TexCoord(0.F, 0.F));
+    }
+
+    SECTION("Texture coordinates out of [0, 1] range are not clamped")
+    {
+        const TiledQuadMesh tiled_quad_mesh(4.F, -1.5F);
+        const CompactMesh compact_quad_mesh(tiled_quad_mesh, GetCompactLayout());
+        const CompactMesh::TexCoordEncoding& texcoord_encoding = compact_quad_mesh.GetTexCoordEncoding();
+        CHECK(texcoord_encoding.scale == Mesh::TexCoord(4.F, 4.F));
+        CHECK(texcoord_encoding.bias  == Mesh::TexCoord(-1.5F, 1.5F));
+
+        for (Data::Index vertex_index = 0U; vertex_index < tiled_quad_mesh.GetVertexCount(); ++vertex_index)
+        {
+            const Mesh::TexCoord& texcoord = tiled_quad_mesh.GetVertices()[vertex_index].texcoord;
+            const auto encoded_texcoord = ReadCompactField<std::array<uint16_t, 2>>(compact_quad_mesh, vertex_index, 12U);
+            for (size_t component = 0U; component < 2U; ++component)
+            {
+                const float decoded_texcoord = static_cast<float>(encoded_texcoord[component]) / 65535.F * texcoord_encoding.scale[component]
+                                             + texcoord_encoding.bias[component];
+                CHECK(std::abs(decoded_texcoord - texcoord[component]) <= texcoord_encoding.scale[component] * (0.5F / 65535.F + 1E-6F));
+            }
+        }
+    }
+
+    SECTION("Compact mesh can keep full precision fields")
+    {
+        Mesh::VertexLayout partial_layout(FullVertex::layout);
+        partial_layout.SetFieldFormat(Mesh::VertexField::Normal, Mesh::VertexFieldFormat::Octahedral);
+        const CompactMesh partial_mesh(cube_mesh, partial_layout);
+        CHECK(partial_mesh.GetVertexSize() == 36U);
+        CHECK(partial_mesh.GetPositionEncoding().scale == Mesh::Position(1.F, 1.F, 1.F));
+        CHECK(ReadCompactField<Mesh::Position>(partial_mesh, 1U, 0U) == cube_mesh.GetVertices()[1].position);
+        CHECK(ReadCompactField<Mesh::Color>(partial_mesh, 1U, 24U) == cube_mesh.GetVertices()[1].color);
+    }
+
+    SECTION("Compact layout with field missing in the source mesh is rejected")
+    {
+        const CubeMesh<TestVertex> normal_cube_mesh(TestVertex::layout);
+        CHECK_THROWS_AS(CompactMesh(normal_cube_mesh, GetCompactLayout()), Mesh::VertexLayout::IncompatibleException);
+    }
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Mesh/MeshVertexLayoutTest.cpp
+Unit-tests of the mesh vertex layout reflected from vertex structure at compile time
+
+******************************************************************************/
+
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+namespace
+{
+
+struct ReflectedVertex
+{
+    Mesh::Position position;
+    Mesh::TexCoord texcoord;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::TexCoord,
+        Mesh::VertexField::Normal,
+    };
+};
+
+// Vertex structure with custom field names is not reflected and accessed with runtime field offsets
+struct CustomVertex
+{
+    Mesh::Position pos;
+    Mesh::TexCoord uv;
+    Mesh::Normal   norm;
+};
+
+struct PaddedVertex
+{
+    Mesh::Position position;
+    float          padding;
+};
+
+} // anonymous namespace
+
+static_assert(MeshVertexTraits<ReflectedVertex>::is_reflected);
+static_assert(!MeshVertexTraits<CustomVertex>::is_reflected);
+static_assert(!MeshVertexTraits<PaddedVertex>::is_reflected);
+static_assert(MeshVertexTraits<ReflectedVertex>::GetFields()[1] == Mesh::VertexField::TexCoord);
+
+template<typename VType1, typename VType2>
+static bool AreVertexDataEqual(const BaseMesh<VType1>& mesh1, const BaseMesh<VType2>& mesh2)
+{
+    return mesh1.GetVertexDataSize() == mesh2.GetVertexDataSize() &&
+           std::memcmp(mesh1.GetVertexData(), mesh2.GetVertexData(), mesh1.GetVertexDataSize()) == 0;
+}
+
+TEST_CASE("Mesh Vertex Layout Reflection", "[mesh][vertex][layout]")
+{
+    SECTION("Vertex layout is derived from vertex structure fields order")
+    {
+        CHECK(MeshVertexTraits<ReflectedVertex>::GetLayout() == ReflectedVertex::layout);
+    }
+
+    SECTION("Vertex layout different from vertex structure fields order is rejected")
+    {
+        const Mesh::VertexLayout wrong_layout{
+            Mesh::VertexField::Position,
+            Mesh::VertexField::Normal,
+            Mesh::VertexField::TexCoord,
+        };
+        CHECK_THROWS_AS(CubeMesh<ReflectedVertex>(wrong_layout), Methane::ArgumentExceptionBase<std::invalid_argument>);
+    }
+
+    SECTION("Reflected and runtime vertex field access generate equal sphere mesh")
+    {
+        const SphereMesh<ReflectedVertex> reflected_mesh(ReflectedVertex::layout, 2.F, 32U, 64U);
+        const SphereMesh<CustomVertex>    custom_mesh(ReflectedVertex::layout, 2.F, 32U, 64U);
+        CHECK(AreVertexDataEqual(reflected_mesh, custom_mesh));
+        CHECK(reflected_mesh.GetIndices() == custom_mesh.GetIndices());
+    }
+
+    SECTION("Reflected and runtime vertex field access generate equal icosahedron mesh")
+    {
+        const IcosahedronMesh<ReflectedVertex> reflected_mesh(ReflectedVertex::layout, 2.F, 3U, true);
+        const IcosahedronMesh<CustomVertex>    custom_mesh(ReflectedVertex::layout, 2.F, 3U, true);
+        CHECK(AreVertexDataEqual(reflected_mesh, custom_mesh));
+        CHECK(reflected_mesh.GetIndices() == custom_mesh.GetIndices());
+    }
+}
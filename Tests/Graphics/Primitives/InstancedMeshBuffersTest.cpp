@@ -0,0 +1,249 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/InstancedMeshBuffersTest.cpp
+Unit-tests of the instanced mesh buffers packing instances by mesh subsets and drawing them with Null RHI backend
+
+******************************************************************************/
+
+#include "../RHI/RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/InstancedMeshBuffers.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+namespace
+{
+
+struct TestVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal,
+    };
+};
+
+struct TestInstance
+{
+    uint32_t id = 0U;
+};
+
+using TestMeshBuffers = InstancedMeshBuffers<TestInstance>;
+using InstanceRanges  = Null::RenderCommandList::InstanceRanges;
+using InstanceIds     = std::vector<uint32_t>;
+
+// Uber-mesh of two cubes with vertices of the second cube following the first one, so its subset starts from vertex 24
+UberMesh<TestVertex> CreateTwoCubesMesh()
+{
+    UberMesh<TestVertex> uber_mesh(TestVertex::layout);
+    uber_mesh.AddSubMesh(CubeMesh<TestVertex>(TestVertex::layout), false);
+    uber_mesh.AddSubMesh(CubeMesh<TestVertex>(TestVertex::layout, 2.F, 2.F, 2.F), false);
+    return uber_mesh;
+}
+
+InstanceIds GetPackedInstanceIds(const TestMeshBuffers& mesh_buffers)
+{
+    InstanceIds instance_ids;
+    std::transform(mesh_buffers.GetPackedInstances().begin(), mesh_buffers.GetPackedInstances().end(), std::back_inserter(instance_ids),
+                   [](const TestInstance& instance) { return instance.id; });
+    return instance_ids;
+}
+
+} // anonymous namespace
+
+static tf::Executor    g_parallel_executor;
+static const FrameSize g_frame_size(640U, 480U);
+
+TEST_CASE("Instanced Mesh Buffers Packing", "[mesh][buffers][instanced]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::CommandQueue  render_queue = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+
+    TestMeshBuffers mesh_buffers(render_queue, CreateTwoCubesMesh(), "Test Cubes", 6U);
+    REQUIRE(mesh_buffers.GetSubsetsCount() == 2U);
+    REQUIRE(mesh_buffers.GetInstanceCount() == 6U);
+    for (uint32_t instance_index = 0U; instance_index < mesh_buffers.GetInstanceCount(); ++instance_index)
+    {
+        mesh_buffers.SetInstanceData(TestInstance{ instance_index }, instance_index);
+    }
+
+    SECTION("All instances are drawn with the first subset by default")
+    {
+        for (Data::Index instance_index = 0U; instance_index < mesh_buffers.GetInstanceCount(); ++instance_index)
+        {
+            CHECK(mesh_buffers.GetInstanceSubsetIndex(instance_index) == 0U);
+        }
+        CHECK(mesh_buffers.PackInstances() == 6U);
+        CHECK(mesh_buffers.GetSubsetInstanceOffsets() == MeshBuffersBase::SubsetInstanceOffsets{ 0U, 6U, 6U });
+        CHECK(GetPackedInstanceIds(mesh_buffers) == InstanceIds{ 0U, 1U, 2U, 3U, 4U, 5U });
+    }
+
+    SECTION("All instances are packed grouped by subsets in ascending order")
+    {
+        mesh_buffers.SetInstanceSubsetIndex(1U, 1U);
+        mesh_buffers.SetInstanceSubsetIndex(3U, 1U);
+        mesh_buffers.SetInstanceSubsetIndex(4U, 1U);
+        CHECK(mesh_buffers.GetInstanceSubsetIndex(3U) == 1U);
+
+        CHECK(mesh_buffers.PackInstances() == 6U);
+        CHECK(mesh_buffers.GetSubsetInstanceOffsets() == MeshBuffersBase::SubsetInstanceOffsets{ 0U, 3U, 6U });
+        CHECK(GetPackedInstanceIds(mesh_buffers) == InstanceIds{ 0U, 2U, 5U, 1U, 3U, 4U });
+        CHECK(mesh_buffers.GetPackedInstancesSubresource().GetDataSize() == 6U * TestMeshBuffers::GetInstanceSize());
+    }
+
+    SECTION("Only visible instances are packed grouped by subsets")
+    {
+        mesh_buffers.SetInstanceSubsetIndex(1U, 1U);
+        mesh_buffers.SetInstanceSubsetIndex(4U, 1U);
+
+        CHECK(mesh_buffers.PackInstances({ 1U, 2U, 4U, 5U }) == 4U);
+        CHECK(mesh_buffers.GetSubsetInstanceOffsets() == MeshBuffersBase::SubsetInstanceOffsets{ 0U, 2U, 4U });
+        CHECK(GetPackedInstanceIds(mesh_buffers) == InstanceIds{ 2U, 5U, 1U, 4U });
+
+        CHECK(mesh_buffers.PackInstances({}) == 0U);
+        CHECK(mesh_buffers.GetSubsetInstanceOffsets() == MeshBuffersBase::SubsetInstanceOffsets{ 0U, 0U, 0U });
+        CHECK(mesh_buffers.GetPackedInstancesSubresource().GetDataSize() == 0U);
+    }
+
+    SECTION("Instance and subset indices are validated")
+    {
+        CHECK_THROWS(mesh_buffers.SetInstanceSubsetIndex(6U, 0U));
+        CHECK_THROWS(mesh_buffers.SetInstanceSubsetIndex(0U, 2U));
+        CHECK_THROWS(mesh_buffers.GetInstanceSubsetIndex(6U));
+        CHECK_THROWS(mesh_buffers.PackInstances({ 0U, 6U }));
+    }
+}
+
+TEST_CASE("Instanced Mesh Buffers Drawing", "[mesh][buffers][instanced][draw]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+    const Rhi::RenderPass    render_pass    = render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+    const Rhi::CommandQueue  render_queue   = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::Program       render_program = render_context.CreateProgram({
+        {
+            { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+            { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+        },
+        Rhi::ProgramInputBufferLayouts{
+            Rhi::ProgramInputBufferLayout{ { "POSITION", "NORMAL" }, Rhi::ProgramInputBufferLayout::StepType::PerVertex },
+            Rhi::ProgramInputBufferLayout{ { "INSTANCE_ID" },        Rhi::ProgramInputBufferLayout::StepType::PerInstance },
+        }
+    });
+    const Rhi::RenderState       render_state     = render_context.CreateRenderState(Rhi::RenderStateSettingsImpl{ render_program, render_pattern });
+    const Rhi::ProgramBindings   program_bindings = render_program.CreateBindings({});
+    const Rhi::RenderCommandList cmd_list         = render_queue.CreateRenderCommandList(render_pass);
+    const auto& null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    TestMeshBuffers mesh_buffers(render_queue, CreateTwoCubesMesh(), "Test Cubes", 6U);
+    mesh_buffers.SetInstanceSubsetIndex(1U, 1U);
+    mesh_buffers.SetInstanceSubsetIndex(3U, 1U);
+    mesh_buffers.SetInstanceSubsetIndex(4U, 1U);
+    REQUIRE(mesh_buffers.PackInstances() == 6U);
+
+    // Instance buffer has less items than mesh vertices, so it would fail start vertex validation of the second subset
+    const Rhi::Buffer instance_buffer = render_context.CreateBuffer(
+        Rhi::BufferSettings::ForVertexBuffer(mesh_buffers.GetInstanceBufferSize(), TestMeshBuffers::GetInstanceSize(), true));
+    const InstanceDataMeshBufferBindings instance_bindings{
+        instance_buffer,
+        mesh_buffers.CreateInstanceVertexBufferSet(instance_buffer),
+        program_bindings
+    };
+    REQUIRE(instance_bindings.vertex_buffer_set.GetCount() == 2U);
+    REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+
+    SECTION("All packed instances are drawn with single draw call per subset")
+    {
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 0U, 3U }, { 3U, 6U } });
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Range of packed instances is split between subset draw calls")
+    {
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 2U, 5U));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 2U, 3U }, { 3U, 5U } });
+
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 3U, 6U));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 2U, 3U }, { 3U, 5U }, { 3U, 6U } });
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Adjacent ranges of packed instances draw all instances once")
+    {
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 0U, 2U));
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 2U, 4U));
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 4U, 6U));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 0U, 2U }, { 2U, 3U }, { 3U, 4U }, { 4U, 6U } });
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Empty ranges and subsets without packed instances are not drawn")
+    {
+        REQUIRE(mesh_buffers.PackInstances({ 3U, 4U }) == 2U);
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 0U, 2U } });
+
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_bindings, 1U, 1U));
+        CHECK(null_cmd_list.GetDrawsCount() == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Invalid ranges of packed instances are not drawn")
+    {
+        CHECK_THROWS(mesh_buffers.Draw(cmd_list, instance_bindings, 0U, 7U));
+        CHECK_THROWS(mesh_buffers.Draw(cmd_list, instance_bindings, 4U, 3U));
+        CHECK(null_cmd_list.GetDrawsCount() == 0U);
+    }
+
+    SECTION("Instances out of per-instance buffer bounds are not drawn")
+    {
+        const Rhi::Buffer small_instance_buffer = render_context.CreateBuffer(
+            Rhi::BufferSettings::ForVertexBuffer(4U * TestMeshBuffers::GetInstanceSize(), TestMeshBuffers::GetInstanceSize(), true));
+        const InstanceDataMeshBufferBindings small_instance_bindings{
+            small_instance_buffer,
+            mesh_buffers.CreateInstanceVertexBufferSet(small_instance_buffer),
+            program_bindings
+        };
+
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, small_instance_bindings, 0U, 4U));
+        CHECK(null_cmd_list.GetDrawnInstanceRanges() == InstanceRanges{ { 0U, 3U }, { 3U, 4U } });
+        CHECK_THROWS(mesh_buffers.Draw(cmd_list, small_instance_bindings, 4U, 6U));
+    }
+}
@@ -29,6 +29,9 @@ Unit-tests of the RHI Buffer
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
 
 #include <memory>
 #include <taskflow/taskflow.hpp>
@@ -168,4 +171,34 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
     {
         CHECK_NOTHROW(buffer.GetData(compute_context.GetUploadCommandKit().GetQueue()));
     }
+
+    SECTION("Request Read-Back is Ready on Command List Completion")
+    {
+        const Rhi::Buffer read_back_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForReadBackBuffer(1024));
+        const Rhi::ComputeCommandList cmd_list = compute_context.GetComputeCommandKit().GetQueue().CreateComputeCommandList();
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        REQUIRE_NOTHROW(cmd_list.Reset());
+
+        Ptr<Rhi::IReadBackRequest> read_back_request_ptr;
+        REQUIRE_NOTHROW(read_back_request_ptr = read_back_buffer.RequestReadBack(cmd_list.GetInterface(), Rhi::BytesRange(0U, 512U)));
+        REQUIRE(read_back_request_ptr);
+        CHECK_FALSE(read_back_request_ptr->IsReady());
+        CHECK_THROWS(read_back_request_ptr->WaitUntilReady());
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_context.GetComputeCommandKit().GetQueue().Execute(cmd_list_set));
+        CHECK_FALSE(read_back_request_ptr->IsReady());
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(read_back_request_ptr->IsReady());
+        CHECK(read_back_request_ptr->WaitUntilReady());
+        CHECK_NOTHROW(read_back_request_ptr->GetData());
+    }
+
+    SECTION("Can not Request Read-Back without Read-Back Usage")
+    {
+        const Rhi::ComputeCommandList cmd_list = compute_context.GetComputeCommandKit().GetQueue().CreateComputeCommandList();
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(buffer.RequestReadBack(cmd_list.GetInterface()));
+    }
 }
@@ -24,14 +24,18 @@ Unit-tests of the RHI Command Queue
 #include "RhiTestHelpers.hpp"
 
 #include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
 #include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/Fence.h>
 #include <Methane/Graphics/RHI/TransferCommandList.h>
 #include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
 #include <Methane/Graphics/RHI/CommandListSet.h>
 #include <Methane/Graphics/Null/CommandListSet.h>
+#include <Methane/Graphics/Null/Fence.h>
 
 #include <memory>
 #include <taskflow/taskflow.hpp>
@@ -153,3 +157,42 @@ TEST_CASE("RHI Compute Command Queue Factory", "[rhi][compute][context][factory]
         CHECK(compute_cmd_list.GetCommandQueue().GetInterfacePtr().get() == compute_cmd_queue.GetInterfacePtr().get());
     }
 }
+
+TEST_CASE("RHI Render Command Queue Execution during Asynchronous Upload", "[rhi][render][queue][upload]")
+{
+    Rhi::RenderContextSettings render_context_settings{ FrameSize(640U, 480U) };
+    render_context_settings.options_mask.SetBitOn(Rhi::ContextOption::AsyncResourceUploads);
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, render_context_settings);
+
+    constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+    const Rhi::CommandKit upload_cmd_kit = render_context.GetUploadCommandKit();
+    const Rhi::CommandKit render_cmd_kit = render_context.GetRenderCommandKit();
+    const auto& upload_fence = dynamic_cast<const Null::Fence&>(upload_cmd_kit.GetFence(post_upload_cmd_list_id));
+
+    Rhi::TransferCommandList transfer_cmd_list = upload_cmd_kit.GetTransferListForEncoding();
+    Rhi::RenderCommandList post_upload_cmd_list = render_cmd_kit.GetRenderListForEncoding(post_upload_cmd_list_id);
+    REQUIRE(render_context.UploadResources());
+    REQUIRE(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    const uint32_t upload_fence_gpu_waits_count = upload_fence.GetGpuWaitsCount();
+
+    // Render queue keeps executing while upload is in flight without waiting for upload fence on GPU
+    const Rhi::CommandListSet render_cmd_list_set = render_cmd_kit.GetListSet();
+    Rhi::RenderCommandList render_cmd_list = render_cmd_kit.GetRenderListForEncoding();
+    REQUIRE_NOTHROW(render_cmd_list.Commit());
+    REQUIRE_NOTHROW(render_cmd_kit.GetQueue().Execute(render_cmd_list_set));
+    CHECK(render_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+    CHECK(upload_fence.GetGpuWaitsCount() == upload_fence_gpu_waits_count);
+    dynamic_cast<Null::CommandListSet&>(render_cmd_list_set.GetInterface()).Complete();
+
+    // Post-upload synchronization is executed with the first render queue execution after upload completion
+    dynamic_cast<Null::CommandListSet&>(upload_cmd_kit.GetListSet().GetInterface()).Complete();
+    REQUIRE_NOTHROW(render_context.WaitForGpu(Rhi::ContextWaitFor::ResourcesUploaded));
+    REQUIRE(transfer_cmd_list.GetState() == Rhi::CommandListState::Pending);
+    render_cmd_list = render_cmd_kit.GetRenderListForEncoding();
+    REQUIRE_NOTHROW(render_cmd_list.Commit());
+    REQUIRE_NOTHROW(render_cmd_kit.GetQueue().Execute(render_cmd_list_set));
+    CHECK(render_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    CHECK(upload_fence.GetGpuWaitsCount() == upload_fence_gpu_waits_count);
+}
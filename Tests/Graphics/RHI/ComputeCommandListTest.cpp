@@ -42,6 +42,7 @@ Unit-tests of the RHI Compute Command List
 #include <Methane/Graphics/Null/ComputeState.h>
 #include <Methane/Graphics/Null/CommandListDebugGroup.h>
 #include <Methane/Graphics/Null/ProgramBindings.h>
+#include <Methane/Graphics/Base/ResourceBarriers.h>
 
 #include <chrono>
 #include <future>
@@ -219,6 +220,123 @@ TEST_CASE("RHI Compute Command List Functions", "[rhi][list][compute]")
         CHECK(dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).GetProgramBindingsPtr() == compute_program_bindings.GetInterfacePtr().get());
     }
 
+    SECTION("Set Program Bindings Resource Barriers Once Before Dispatch")
+    {
+        const Rhi::Texture texture1 = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        const Rhi::Texture texture2 = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(320, 240), {}, PixelFormat::RGBA8, false));
+        const Rhi::Sampler sampler  = compute_context.CreateSampler({
+            rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+            rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+        });
+        const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+
+        const Rhi::ProgramBindings compute_program_bindings1 = compute_program.CreateBindings({
+            { { Rhi::ShaderType::Compute, "InTexture" }, { { texture1.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+        });
+        const Rhi::ProgramBindings compute_program_bindings2 = compute_program.CreateBindings({
+            { { Rhi::ShaderType::Compute, "InTexture" }, { { texture2.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+        });
+
+        auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface());
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(compute_program_bindings1));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(compute_program_bindings2));
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 1U);
+        CHECK(null_cmd_list.GetResourceBarriersCount() == 2U);
+        CHECK(texture1.GetState() == Rhi::ResourceState::ShaderResource);
+        CHECK(texture2.GetState() == Rhi::ResourceState::ShaderResource);
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 1U);
+    }
+
+    SECTION("Merge Pending Resource Barriers of the Same Resource")
+    {
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        Rhi::IResource& texture_resource = texture.GetInterface();
+        const Rhi::ResourceBarriers copy_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::Undefined, Rhi::ResourceState::CopyDest)
+        });
+        const Rhi::ResourceBarriers read_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::CopyDest, Rhi::ResourceState::ShaderResource)
+        });
+
+        auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface());
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(null_cmd_list.AddPendingResourceBarriers(copy_barriers.GetInterface()));
+        REQUIRE_NOTHROW(null_cmd_list.AddPendingResourceBarriers(read_barriers.GetInterface()));
+
+        const Rhi::IResourceBarriers* pending_barriers_ptr = null_cmd_list.GetPendingResourceBarriersPtr();
+        REQUIRE(pending_barriers_ptr);
+        REQUIRE(pending_barriers_ptr->GetBarriers().size() == 1U);
+        CHECK(pending_barriers_ptr->GetBarriers().front() == Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::Undefined, Rhi::ResourceState::ShaderResource));
+
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 1U);
+        CHECK(null_cmd_list.GetResourceBarriersCount() == 1U);
+        CHECK(pending_barriers_ptr->IsEmpty());
+    }
+
+    SECTION("Flush Pending Resource Barriers of Not Chained State Transitions")
+    {
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        Rhi::IResource& texture_resource = texture.GetInterface();
+        const Rhi::ResourceBarriers copy_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::Undefined, Rhi::ResourceState::CopyDest)
+        });
+        const Rhi::ResourceBarriers read_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::ShaderResource, Rhi::ResourceState::UnorderedAccess)
+        });
+
+        auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface());
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(null_cmd_list.AddPendingResourceBarriers(copy_barriers.GetInterface()));
+        REQUIRE_NOTHROW(null_cmd_list.AddPendingResourceBarriers(read_barriers.GetInterface()));
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 1U);
+        CHECK(null_cmd_list.GetResourceBarriersCount() == 1U);
+
+        const Rhi::IResourceBarriers* pending_barriers_ptr = null_cmd_list.GetPendingResourceBarriersPtr();
+        REQUIRE(pending_barriers_ptr);
+        REQUIRE(pending_barriers_ptr->GetBarriers().size() == 1U);
+        CHECK(pending_barriers_ptr->GetBarriers().front() == Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::ShaderResource, Rhi::ResourceState::UnorderedAccess));
+    }
+
+    SECTION("Remove and Clear Resource Barriers")
+    {
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        const Rhi::Buffer  buffer1 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+        const Rhi::Buffer  buffer2 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+        const Rhi::ResourceBarriers barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ShaderResource),
+            Rhi::ResourceBarrier(buffer1.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ConstantBuffer),
+            Rhi::ResourceBarrier(buffer2.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::CopyDest),
+        });
+        REQUIRE(barriers.GetBarriers().size() == 3U);
+
+        CHECK(barriers.RemoveStateTransition(texture.GetInterface()));
+        CHECK_FALSE(barriers.RemoveStateTransition(texture.GetInterface()));
+        CHECK(barriers.GetBarriers().size() == 2U);
+        CHECK(barriers.HasStateTransition(buffer1.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ConstantBuffer));
+        CHECK(barriers.HasStateTransition(buffer2.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::CopyDest));
+
+        CHECK(barriers.AddStateTransition(buffer2.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ShaderResource) == Rhi::IResourceBarriers::AddResult::Updated);
+        CHECK(barriers.HasStateTransition(buffer2.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ShaderResource));
+        CHECK(barriers.RemoveStateTransition(buffer1.GetInterface()));
+        CHECK(barriers.HasStateTransition(buffer2.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::ShaderResource));
+
+        dynamic_cast<Base::ResourceBarriers&>(barriers.GetInterface()).Clear();
+        CHECK(barriers.IsEmpty());
+        CHECK(barriers.AddStateTransition(texture.GetInterface(), Rhi::ResourceState::Undefined, Rhi::ResourceState::CopyDest) == Rhi::IResourceBarriers::AddResult::Added);
+    }
+
     SECTION("Set Resource Barriers")
     {
         const Rhi::ResourceBarriers barriers(Rhi::IResourceBarriers::Set{});
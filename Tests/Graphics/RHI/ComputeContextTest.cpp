@@ -26,7 +26,9 @@ Unit-tests of the RHI ComputeContext
 #include <Methane/Data/AppShadersProvider.h>
 #include <Methane/Graphics/RHI/ComputeContext.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
 #include <Methane/Graphics/RHI/TransferCommandList.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Graphics/RHI/Device.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
@@ -36,6 +38,7 @@ Unit-tests of the RHI ComputeContext
 #include <Methane/Graphics/RHI/Buffer.h>
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
 
 #include <taskflow/taskflow.hpp>
 #include <magic_enum.hpp>
@@ -172,6 +175,73 @@ TEST_CASE("RHI Compute Context Functions", "[rhi][compute][context]")
         //FIXME: CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
     }
 
+    SECTION("Context Upload Resources Asynchronously")
+    {
+        const Rhi::ComputeContext async_compute_context(GetTestDevice(), g_parallel_executor, Rhi::ComputeContextSettings{
+            Rhi::ContextOptionMask{ Rhi::ContextOption::AsyncResourceUploads }
+        });
+        constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+        Rhi::TransferCommandList transfer_cmd_list = async_compute_context.GetUploadCommandKit().GetTransferListForEncoding();
+        Rhi::ComputeCommandList post_upload_cmd_list = async_compute_context.GetComputeCommandKit().GetComputeListForEncoding(post_upload_cmd_list_id);
+        CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+
+        CHECK(async_compute_context.UploadResources());
+        CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+
+        // Null command queue does not track execution, so upload completion on GPU is emulated explicitly
+        dynamic_cast<Null::CommandListSet&>(async_compute_context.GetUploadCommandKit().GetListSet().GetInterface()).Complete();
+        CHECK_NOTHROW(async_compute_context.WaitForGpu(Rhi::ContextWaitFor::ResourcesUploaded));
+        CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+
+        // Post-upload synchronization is executed right before the first command list execution on compute queue
+        const Rhi::CommandKit compute_cmd_kit = async_compute_context.GetComputeCommandKit();
+        Rhi::ComputeCommandList compute_cmd_list = compute_cmd_kit.GetComputeListForEncoding();
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_kit.GetQueue().Execute(compute_cmd_kit.GetListSet()));
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(compute_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    }
+
+    SECTION("Context Upload Resources Asynchronously while Next Upload is Encoded")
+    {
+        const Rhi::ComputeContext async_compute_context(GetTestDevice(), g_parallel_executor, Rhi::ComputeContextSettings{
+            Rhi::ContextOptionMask{ Rhi::ContextOption::AsyncResourceUploads }
+        });
+        constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+        const Rhi::CommandKit compute_cmd_kit = async_compute_context.GetComputeCommandKit();
+        const Rhi::CommandListSet upload_cmd_list_set = async_compute_context.GetUploadCommandKit().GetListSet();
+        Rhi::TransferCommandList transfer_cmd_list = async_compute_context.GetUploadCommandKit().GetTransferListForEncoding();
+        Rhi::ComputeCommandList post_upload_cmd_list = compute_cmd_kit.GetComputeListForEncoding(post_upload_cmd_list_id);
+        REQUIRE(async_compute_context.UploadResources());
+        dynamic_cast<Null::CommandListSet&>(upload_cmd_list_set.GetInterface()).Complete();
+        REQUIRE_NOTHROW(async_compute_context.WaitForGpu(Rhi::ContextWaitFor::ResourcesUploaded));
+        REQUIRE(transfer_cmd_list.GetState() == Rhi::CommandListState::Pending);
+
+        // Next upload is started before compute queue execution, so it is uploaded first to submit its release barriers,
+        // while post-upload synchronization is postponed until completion of the next upload
+        transfer_cmd_list = async_compute_context.GetUploadCommandKit().GetTransferListForEncoding();
+        REQUIRE(transfer_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+
+        const Rhi::CommandListSet compute_cmd_list_set = compute_cmd_kit.GetListSet();
+        Rhi::ComputeCommandList compute_cmd_list = compute_cmd_kit.GetComputeListForEncoding();
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_kit.GetQueue().Execute(compute_cmd_list_set));
+        CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Encoding);
+        dynamic_cast<Null::CommandListSet&>(compute_cmd_list_set.GetInterface()).Complete();
+
+        dynamic_cast<Null::CommandListSet&>(upload_cmd_list_set.GetInterface()).Complete();
+        REQUIRE_NOTHROW(async_compute_context.WaitForGpu(Rhi::ContextWaitFor::ResourcesUploaded));
+        REQUIRE(transfer_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        compute_cmd_list = compute_cmd_kit.GetComputeListForEncoding();
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_kit.GetQueue().Execute(compute_cmd_list_set));
+        CHECK(post_upload_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    }
+
     SECTION("Context Complete Initialization")
     {
         ContextCallbackTester context_callback_tester(compute_context);
@@ -30,6 +30,7 @@ Unit-tests of the RHI ComputeContext
 #include <Methane/Graphics/RHI/Shader.h>
 
 #include <memory>
+#include <atomic>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -38,6 +39,28 @@ using namespace Methane::Graphics;
 
 static tf::Executor g_parallel_executor;
 
+class ComputeStateCallbackTester final
+    : private Data::Receiver<Rhi::IComputeStateCallback>
+{
+public:
+    explicit ComputeStateCallbackTester(const Rhi::ComputeState& compute_state)
+        : m_compute_state(compute_state.GetInterface())
+    { compute_state.Connect(*this); }
+
+    bool IsStateCompiled() const noexcept         { return m_compiled_state_ptr != nullptr; }
+    bool IsCompiledStateMatching() const noexcept { return m_compiled_state_ptr == std::addressof(m_compute_state); }
+
+private:
+    // Callback is called from the parallel executor thread, so it only stores the result checked later on the main thread
+    void OnComputeStateCompiled(Rhi::IComputeState& compute_state) override
+    {
+        m_compiled_state_ptr = std::addressof(compute_state);
+    }
+
+    Rhi::IComputeState&              m_compute_state;
+    std::atomic<Rhi::IComputeState*> m_compiled_state_ptr{ nullptr };
+};
+
 TEST_CASE("RHI Compute State Functions", "[rhi][compute][state]")
 {
     const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
@@ -112,4 +135,35 @@ TEST_CASE("RHI Compute State Functions", "[rhi][compute][state]")
         REQUIRE(compute_state.GetProgram().GetInterfacePtr().get() == new_compute_program.GetInterfacePtr().get());
         REQUIRE(compute_state.GetSettings().thread_group_size == Rhi::ThreadGroupSize(32, 32, 1));
     }
+
+    SECTION("Synchronous Compilation")
+    {
+        CHECK_FALSE(compute_state.GetSettings().async_compilation_enabled);
+        CHECK(compute_state.IsCompiled());
+    }
+
+    SECTION("Asynchronous Compilation")
+    {
+        Rhi::ComputeStateSettingsImpl async_compute_state_settings = compute_state_settings;
+        async_compute_state_settings.async_compilation_enabled = true;
+
+        const Rhi::ComputeState async_compute_state = compute_context.CreateComputeState(async_compute_state_settings);
+        CHECK(async_compute_state.GetSettings().async_compilation_enabled);
+        g_parallel_executor.wait_for_all();
+        CHECK(async_compute_state.IsCompiled());
+    }
+
+    SECTION("Asynchronous Compilation Callback on Reset")
+    {
+        Rhi::ComputeStateSettingsImpl async_compute_state_settings = compute_state_settings;
+        async_compute_state_settings.async_compilation_enabled = true;
+
+        const Rhi::ComputeState async_compute_state = compute_context.CreateComputeState(async_compute_state_settings);
+        ComputeStateCallbackTester compute_state_callback_tester(async_compute_state);
+        REQUIRE_NOTHROW(async_compute_state.Reset(async_compute_state_settings));
+        g_parallel_executor.wait_for_all();
+        CHECK(compute_state_callback_tester.IsStateCompiled());
+        CHECK(compute_state_callback_tester.IsCompiledStateMatching());
+        CHECK(async_compute_state.IsCompiled());
+    }
 }
@@ -0,0 +1,386 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ProgramBindingsBenchmark.cpp
+Benchmark of the RHI Program Bindings creation and copying with Null backend
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Memory.hpp>
+
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr size_t g_bindings_count = 100000U;
+static tf::Executor g_benchmark_executor;
+static std::atomic<size_t> g_heap_allocations_count{ 0U };
+static std::atomic<size_t> g_heap_allocated_size{ 0U };
+
+// NOTE: global heap allocations are counted to measure memory used by program bindings,
+//       all replaceable allocation functions are replaced, which is why the benchmark is built as a separate executable
+static void* AllocateCounted(size_t size, size_t alignment) noexcept
+{
+    g_heap_allocations_count++;
+    g_heap_allocated_size += size;
+    if (!size)
+        size = 1U;
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return std::malloc(size); // NOSONAR
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    return std::aligned_alloc(alignment, (size + alignment - 1U) / alignment * alignment);
+#endif
+}
+
+static void FreeCounted(void* memory_ptr, size_t alignment) noexcept
+{
+#ifdef _WIN32
+    if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        _aligned_free(memory_ptr);
+        return;
+    }
+#else
+    META_UNUSED(alignment);
+#endif
+    std::free(memory_ptr); // NOSONAR
+}
+
+static void* AllocateCountedOrThrow(size_t size, size_t alignment)
+{
+    if (void* memory_ptr = AllocateCounted(size, alignment))
+        return memory_ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size)                                                    { return AllocateCountedOrThrow(size, 0U); }
+void* operator new[](size_t size)                                                  { return AllocateCountedOrThrow(size, 0U); }
+void* operator new(size_t size, std::align_val_t alignment)                        { return AllocateCountedOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment)                      { return AllocateCountedOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept                    { return AllocateCounted(size, 0U); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept                  { return AllocateCounted(size, 0U); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept   { return AllocateCounted(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return AllocateCounted(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* memory_ptr) noexcept                                    { FreeCounted(memory_ptr, 0U); }
+void operator delete[](void* memory_ptr) noexcept                                  { FreeCounted(memory_ptr, 0U); }
+void operator delete(void* memory_ptr, size_t) noexcept                            { FreeCounted(memory_ptr, 0U); }
+void operator delete[](void* memory_ptr, size_t) noexcept                          { FreeCounted(memory_ptr, 0U); }
+void operator delete(void* memory_ptr, const std::nothrow_t&) noexcept             { FreeCounted(memory_ptr, 0U); }
+void operator delete[](void* memory_ptr, const std::nothrow_t&) noexcept           { FreeCounted(memory_ptr, 0U); }
+void operator delete(void* memory_ptr, std::align_val_t alignment) noexcept        { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+void operator delete[](void* memory_ptr, std::align_val_t alignment) noexcept      { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+void operator delete(void* memory_ptr, size_t, std::align_val_t alignment) noexcept   { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+void operator delete[](void* memory_ptr, size_t, std::align_val_t alignment) noexcept { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+void operator delete(void* memory_ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept   { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+void operator delete[](void* memory_ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept { FreeCounted(memory_ptr, static_cast<size_t>(alignment)); }
+
+struct HeapUsage
+{
+    size_t allocations_count;
+    size_t allocated_size;
+};
+
+template<typename FuncType>
+static HeapUsage MeasureHeapUsage(const FuncType& func)
+{
+    const size_t start_allocations_count = g_heap_allocations_count;
+    const size_t start_allocated_size = g_heap_allocated_size;
+    func();
+    return HeapUsage{ g_heap_allocations_count - start_allocations_count, g_heap_allocated_size - start_allocated_size };
+}
+
+static Rhi::Program CreateBenchmarkComputeProgram(const Rhi::ComputeContext& compute_context)
+{
+    const Rhi::ProgramArgumentAccessor texture_accessor{ Rhi::ShaderType::Compute, "InTexture", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor sampler_accessor{ Rhi::ShaderType::Compute, "InSampler", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor buffer_accessor { Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors
+            {
+                texture_accessor,
+                sampler_accessor,
+                buffer_accessor
+            }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { texture_accessor, { Rhi::ResourceType::Texture, 1U } },
+        { sampler_accessor, { Rhi::ResourceType::Sampler, 1U } },
+        { buffer_accessor,  { Rhi::ResourceType::Buffer,  1U } },
+    });
+    return compute_program;
+}
+
+// NOTE: benchmark is hidden from default test runs because of its duration,
+//       run it explicitly with "[rhi][bindings][benchmark]" tags filter
+TEST_CASE("Benchmark creation and copying of program bindings", "[.][rhi][program][bindings][benchmark]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_benchmark_executor, {});
+    const Rhi::Program compute_program = CreateBenchmarkComputeProgram(compute_context);
+
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer1 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+    const Rhi::Buffer buffer2 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(64000, false, true));
+
+    const Rhi::Program::ResourceViewsByArgument compute_resource_views{
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer1.GetInterface() } } },
+    };
+
+    const Rhi::Program::ResourceViewsByArgument replace_resource_views{
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer2.GetInterface() } } },
+    };
+
+    BENCHMARK("Create 100k program bindings")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings;
+        program_bindings.reserve(g_bindings_count);
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            program_bindings.emplace_back(compute_program, compute_resource_views);
+        }
+        return program_bindings.size();
+    };
+
+    const Rhi::ProgramBindings orig_program_bindings(compute_program, compute_resource_views);
+
+    BENCHMARK("Copy 100k program bindings with replacement")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings;
+        program_bindings.reserve(g_bindings_count);
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            program_bindings.emplace_back(orig_program_bindings, replace_resource_views);
+        }
+        return program_bindings.size();
+    };
+
+    // Copies created in parallel share constant argument bindings of the original program bindings,
+    // while descriptor writes of each copy are accumulated and flushed by the copy itself
+    BENCHMARK("Copy 100k program bindings with replacement in parallel")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings(g_bindings_count);
+        tf::Taskflow copy_task_flow;
+        copy_task_flow.for_each_index(size_t(0), g_bindings_count, size_t(1),
+            [&program_bindings, &orig_program_bindings, &replace_resource_views](size_t index)
+            {
+                program_bindings[index] = Rhi::ProgramBindings(orig_program_bindings, replace_resource_views);
+            });
+        g_benchmark_executor.run(copy_task_flow).get();
+        return program_bindings.size();
+    };
+
+    BENCHMARK("Get 100k argument bindings by name")
+    {
+        const Rhi::ProgramArgument buffer_argument{ Rhi::ShaderType::Compute, "OutBuffer" };
+        size_t resource_views_count = 0U;
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            resource_views_count += orig_program_bindings.Get(buffer_argument).GetResourceViews().size();
+        }
+        return resource_views_count;
+    };
+
+    BENCHMARK("Get 100k argument bindings by id")
+    {
+        const Rhi::ProgramArgumentId buffer_argument_id = compute_program.GetArgumentId({ Rhi::ShaderType::Compute, "OutBuffer" });
+        size_t resource_views_count = 0U;
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            resource_views_count += orig_program_bindings.Get(buffer_argument_id).GetResourceViews().size();
+        }
+        return resource_views_count;
+    };
+}
+
+// NOTE: mutable argument bindings were allocated one by one in heap before they were pooled in contiguous arena of program bindings,
+//       both ways of copying are compared here along with total heap usage of the program bindings creation and copying
+TEST_CASE("Benchmark memory of program argument bindings", "[.][rhi][program][bindings][benchmark]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_benchmark_executor, {});
+    const Rhi::Program compute_program = CreateBenchmarkComputeProgram(compute_context);
+
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer1 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+    const Rhi::Buffer buffer2 = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(64000, false, true));
+
+    const Rhi::Program::ResourceViewsByArgument compute_resource_views{
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer1.GetInterface() } } },
+    };
+
+    const Rhi::Program::ResourceViewsByArgument replace_resource_views{
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer2.GetInterface() } } },
+    };
+
+    const Rhi::ProgramBindings orig_program_bindings(compute_program, compute_resource_views);
+    const auto& orig_buffer_binding = dynamic_cast<const Base::ProgramArgumentBinding&>(orig_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }));
+
+    // Copied argument binding is disconnected from the original program bindings to measure copying of the argument binding alone
+    const Ptr<Base::ProgramArgumentBinding> buffer_binding_ptr = orig_buffer_binding.CreateCopy();
+    buffer_binding_ptr->Disconnect(dynamic_cast<Base::ProgramBindings&>(orig_program_bindings.GetInterface()));
+    const Base::ProgramArgumentBinding& buffer_binding = *buffer_binding_ptr;
+
+    std::vector<Ptr<Base::ProgramArgumentBinding>> argument_bindings;
+    argument_bindings.reserve(g_bindings_count);
+    const HeapUsage heap_argument_bindings_usage = MeasureHeapUsage([&argument_bindings, &buffer_binding]()
+    {
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            argument_bindings.emplace_back(buffer_binding.CreateCopy());
+        }
+    });
+    argument_bindings.clear();
+
+    const auto arena_ptr = std::make_shared<Base::ProgramArgumentBindingsArena>(heap_argument_bindings_usage.allocated_size);
+    const Base::ProgramArgumentBinding::Allocator arena_allocator(arena_ptr);
+    const HeapUsage arena_argument_bindings_usage = MeasureHeapUsage([&argument_bindings, &buffer_binding, &arena_allocator]()
+    {
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            argument_bindings.emplace_back(buffer_binding.CreateCopy(arena_allocator));
+        }
+    });
+    argument_bindings.clear();
+
+    WARN("Copy 100k argument bindings in heap (before): " << heap_argument_bindings_usage.allocations_count
+         << " allocations of " << heap_argument_bindings_usage.allocated_size << " bytes");
+    WARN("Copy 100k argument bindings in arena (after): " << arena_argument_bindings_usage.allocations_count
+         << " allocations of " << arena_argument_bindings_usage.allocated_size << " bytes");
+    CHECK(arena_argument_bindings_usage.allocations_count < heap_argument_bindings_usage.allocations_count);
+
+    std::vector<Rhi::ProgramBindings> program_bindings;
+    program_bindings.reserve(g_bindings_count);
+    const HeapUsage create_program_bindings_usage = MeasureHeapUsage([&program_bindings, &compute_program, &compute_resource_views]()
+    {
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            program_bindings.emplace_back(compute_program, compute_resource_views);
+        }
+    });
+    program_bindings.clear();
+
+    const HeapUsage copy_program_bindings_usage = MeasureHeapUsage([&program_bindings, &orig_program_bindings, &replace_resource_views]()
+    {
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            program_bindings.emplace_back(orig_program_bindings, replace_resource_views);
+        }
+    });
+    program_bindings.clear();
+
+    WARN("Create 100k program bindings: " << create_program_bindings_usage.allocations_count
+         << " allocations of " << create_program_bindings_usage.allocated_size << " bytes");
+    WARN("Copy 100k program bindings with replacement: " << copy_program_bindings_usage.allocations_count
+         << " allocations of " << copy_program_bindings_usage.allocated_size << " bytes");
+
+    BENCHMARK("Copy 100k argument bindings in heap (before)")
+    {
+        std::vector<Ptr<Base::ProgramArgumentBinding>> argument_bindings_copies;
+        argument_bindings_copies.reserve(g_bindings_count);
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            argument_bindings_copies.emplace_back(buffer_binding.CreateCopy());
+        }
+        return argument_bindings_copies.size();
+    };
+
+    BENCHMARK("Copy 100k argument bindings in arena (after)")
+    {
+        const auto bench_arena_ptr = std::make_shared<Base::ProgramArgumentBindingsArena>(arena_ptr->GetRequestedSize());
+        const Base::ProgramArgumentBinding::Allocator bench_arena_allocator(bench_arena_ptr);
+        std::vector<Ptr<Base::ProgramArgumentBinding>> argument_bindings_copies;
+        argument_bindings_copies.reserve(g_bindings_count);
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            argument_bindings_copies.emplace_back(buffer_binding.CreateCopy(bench_arena_allocator));
+        }
+        return argument_bindings_copies.size();
+    };
+}
+
+// NOTE: with deferred initialization descriptor writes of each program bindings object are accumulated
+//       and flushed in a batch on context initialization completion, which is measured here together with creation
+TEST_CASE("Benchmark creation of program bindings with deferred initialization", "[.][rhi][program][bindings][benchmark]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_benchmark_executor,
+        Rhi::ComputeContextSettings{ Rhi::ContextOptionMask{ Rhi::ContextOption::DeferredProgramBindingsInitialization } });
+    const Rhi::Program compute_program = CreateBenchmarkComputeProgram(compute_context);
+
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+
+    const Rhi::Program::ResourceViewsByArgument compute_resource_views{
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+    };
+
+    BENCHMARK("Create 100k program bindings and complete initialization")
+    {
+        std::vector<Rhi::ProgramBindings> program_bindings;
+        program_bindings.reserve(g_bindings_count);
+        for(size_t i = 0; i < g_bindings_count; ++i)
+        {
+            program_bindings.emplace_back(compute_program, compute_resource_views);
+        }
+        compute_context.CompleteInitialization();
+        return program_bindings.size();
+    };
+}
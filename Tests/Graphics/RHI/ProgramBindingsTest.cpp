@@ -31,8 +31,11 @@ Unit-tests of the RHI Program Bindings
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/RHI/Sampler.h>
 #include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Base/ProgramArgumentBinding.h>
+#include <Methane/Graphics/Base/ProgramArgumentBindingsArena.h>
 
 #include <memory>
+#include <set>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -126,6 +129,21 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
         }
     }
 
+    SECTION("Get Compute Program Bindings by Argument Id")
+    {
+        const Rhi::ProgramBindings program_bindings = compute_program.CreateBindings(compute_resource_views);
+        std::set<Rhi::ProgramArgumentId> argument_ids;
+        for(const auto& [program_argument, argument_resource_views] : compute_resource_views)
+        {
+            Rhi::ProgramArgumentId argument_id = 0U;
+            REQUIRE_NOTHROW(argument_id = compute_program.GetArgumentId(program_argument));
+            CHECK(argument_id < 3U);
+            CHECK(argument_ids.insert(argument_id).second);
+            CHECK(std::addressof(program_bindings.Get(argument_id)) == std::addressof(program_bindings.Get(program_argument)));
+        }
+        CHECK_THROWS_AS(compute_program.GetArgumentId({ Rhi::ShaderType::Compute, "Unknown" }), Rhi::ProgramArgumentNotFoundException);
+    }
+
     SECTION("Can not create Compute Program Bindings with Unbound Resources")
     {
         Rhi::ProgramBindings program_bindings;
@@ -167,6 +185,28 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
         CHECK(copy_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetResourceViews().at(0).GetResourcePtr().get() == buffer2.GetInterfacePtr().get());
     }
 
+    SECTION("Create A Copy of Program Bindings without Replacements")
+    {
+        Rhi::ProgramBindings orig_program_bindings = compute_program.CreateBindings(compute_resource_views);
+        Rhi::ProgramBindings copy_program_bindings;
+        REQUIRE_NOTHROW(copy_program_bindings = Rhi::ProgramBindings(orig_program_bindings, {}));
+        REQUIRE(copy_program_bindings.IsInitialized());
+        CHECK(&copy_program_bindings.Get({ Rhi::ShaderType::Compute, "InTexture" }) == &orig_program_bindings.Get({ Rhi::ShaderType::Compute, "InTexture" }));
+        CHECK(&copy_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }) != &orig_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }));
+        CHECK(copy_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetResourceViews().at(0).GetResourcePtr().get() == buffer1.GetInterfacePtr().get());
+        CHECK(static_cast<std::string>(copy_program_bindings) == static_cast<std::string>(orig_program_bindings));
+    }
+
+    SECTION("Mutable Argument Binding Outlives Program Bindings")
+    {
+        auto program_bindings_ptr = std::make_unique<Rhi::ProgramBindings>(compute_program, compute_resource_views);
+        auto& buffer_binding = dynamic_cast<Base::ProgramArgumentBinding&>(program_bindings_ptr->Get({ Rhi::ShaderType::Compute, "OutBuffer" }));
+        const Ptr<Base::ProgramArgumentBinding> buffer_binding_ptr = buffer_binding.GetPtr();
+        program_bindings_ptr.reset();
+        REQUIRE(buffer_binding_ptr);
+        CHECK(buffer_binding_ptr->GetResourceViews().at(0).GetResourcePtr().get() == buffer1.GetInterfacePtr().get());
+    }
+
     SECTION("Object Destroyed Callback")
     {
         auto program_bindings_ptr = std::make_unique<Rhi::ProgramBindings>(compute_program, compute_resource_views);
@@ -265,4 +305,53 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
               "  - Compute shaders argument 'InTexture' (Constant) is bound to Texture 'T' subresources from index(d:0, a:0, m:0) for count(d:1, a:1, m:1) with offset 0;\n" \
               "  - Compute shaders argument 'OutBuffer' (Mutable) is bound to Buffer 'B1' subresources from index(d:0, a:0, m:0) for count(d:1, a:1, m:1) with offset 0.");
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("RHI Program Argument Bindings Arena", "[rhi][program][bindings]")
+{
+    SECTION("Allocate in arena capacity")
+    {
+        Base::ProgramArgumentBindingsArena arena(64U);
+        void* const first_ptr = arena.Allocate(20U, 4U);
+        void* const second_ptr = arena.Allocate(16U, 16U);
+        REQUIRE(first_ptr);
+        REQUIRE(second_ptr);
+        CHECK(arena.Contains(first_ptr));
+        CHECK(arena.Contains(second_ptr));
+        CHECK(reinterpret_cast<uintptr_t>(second_ptr) % 16U == 0U);
+        CHECK(arena.GetUsedSize() == 48U);
+        CHECK(arena.GetRequestedSize() == 48U);
+    }
+
+    SECTION("Requested size is counted beyond arena capacity")
+    {
+        Base::ProgramArgumentBindingsArena arena(32U);
+        CHECK(arena.Allocate(24U, 8U));
+        CHECK_FALSE(arena.Allocate(24U, 8U));
+        CHECK(arena.GetUsedSize() == 24U);
+        CHECK(arena.GetRequestedSize() == 48U);
+    }
+
+    SECTION("Allocator falls back to heap when arena is exhausted")
+    {
+        const auto arena_ptr = std::make_shared<Base::ProgramArgumentBindingsArena>(sizeof(uint64_t));
+        Base::ProgramArgumentBindingsAllocator<uint64_t> allocator(arena_ptr);
+        uint64_t* const arena_value_ptr = allocator.allocate(1U);
+        uint64_t* const heap_value_ptr = allocator.allocate(1U);
+        CHECK(arena_ptr->Contains(arena_value_ptr));
+        CHECK_FALSE(arena_ptr->Contains(heap_value_ptr));
+        allocator.deallocate(heap_value_ptr, 1U);
+        allocator.deallocate(arena_value_ptr, 1U);
+    }
+
+    SECTION("Shared objects keep arena alive")
+    {
+        auto arena_ptr = std::make_shared<Base::ProgramArgumentBindingsArena>(256U);
+        const Base::ProgramArgumentBindingsAllocator<std::string> allocator(arena_ptr);
+        const Ptr<std::string> string_ptr = std::allocate_shared<std::string>(allocator, "arena");
+        const WeakPtr<Base::ProgramArgumentBindingsArena> arena_weak_ptr = arena_ptr;
+        arena_ptr.reset();
+        CHECK_FALSE(arena_weak_ptr.expired());
+        CHECK(*string_ptr == "arena");
+    }
+}
@@ -129,4 +129,36 @@ TEST_CASE("RHI Program Factory", "[rhi][program][factory]")
         REQUIRE(program_bindings.IsInitialized());
         CHECK(program_bindings.GetInterfacePtr());
     }
-}
\ No newline at end of file
+}
+TEST_CASE("RHI Program Input Layout", "[rhi][program][input]")
+{
+    const Rhi::ProgramSettingsImpl::ShaderSet shader_set{
+        { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+    };
+
+    SECTION("Can Create Program With Explicit Argument Formats")
+    {
+        const Rhi::ProgramInputBufferLayouts input_buffer_layouts{
+            Rhi::ProgramInputBufferLayout{
+                { "POSITION", "NORMAL" },
+                Rhi::ProgramInputBufferLayout::StepType::PerVertex, 1U,
+                { PixelFormat::RGBA16Float, PixelFormat::RG16Snorm }
+            }
+        };
+        Rhi::Program program;
+        REQUIRE_NOTHROW(program = compute_context.CreateProgram(Rhi::ProgramSettingsImpl{ shader_set, input_buffer_layouts }));
+        CHECK(program.GetSettings().input_buffer_layouts.front().argument_formats == Rhi::ProgramInputBufferLayout::ArgumentFormats{ PixelFormat::RGBA16Float, PixelFormat::RG16Snorm });
+    }
+
+    SECTION("Can Not Create Program With Argument Formats Count Different From Semantics")
+    {
+        const Rhi::ProgramInputBufferLayouts input_buffer_layouts{
+            Rhi::ProgramInputBufferLayout{
+                { "POSITION", "NORMAL" },
+                Rhi::ProgramInputBufferLayout::StepType::PerVertex, 1U,
+                { PixelFormat::RGBA16Float }
+            }
+        };
+        CHECK_THROWS_AS(compute_context.CreateProgram(Rhi::ProgramSettingsImpl{ shader_set, input_buffer_layouts }), std::invalid_argument);
+    }
+}
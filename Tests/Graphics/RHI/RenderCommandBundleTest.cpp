@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandBundleTest.cpp
+Unit-tests of the RHI render command bundles recorded once and executed by render command lists
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <memory>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor    g_parallel_executor;
+static const FrameSize g_frame_size(640U, 480U);
+
+TEST_CASE("RHI Render Command Bundle Functions", "[rhi][render][list][bundle]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+    const Rhi::RenderPass    render_pass    = render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+    const Rhi::CommandQueue  render_queue   = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::Program       render_program = render_context.CreateProgram({
+        {
+            { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+            { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+        },
+    });
+    const Rhi::RenderState render_state = render_context.CreateRenderState(Rhi::RenderStateSettingsImpl{ render_program, render_pattern });
+    const Rhi::ViewState   view_state(Rhi::ViewSettings{ { GetFrameViewport(g_frame_size) }, { GetFrameScissorRect(g_frame_size) } });
+
+    const Rhi::RenderCommandList bundle   = render_queue.CreateRenderCommandBundle(render_pass);
+    const Rhi::RenderCommandList cmd_list = render_queue.CreateRenderCommandList(render_pass);
+    const auto& null_bundle   = dynamic_cast<const Null::RenderCommandList&>(bundle.GetInterface());
+    const auto& null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    SECTION("Bundle Construction")
+    {
+        REQUIRE(bundle.IsInitialized());
+        CHECK(bundle.IsBundle());
+        CHECK_FALSE(cmd_list.IsBundle());
+        CHECK(bundle.GetState() == Rhi::CommandListState::Pending);
+        CHECK(null_bundle.GetExecutingListsCount() == 0U);
+    }
+
+    SECTION("Record and Replay Bundle Commands")
+    {
+        REQUIRE_NOTHROW(bundle.ResetWithState(render_state));
+        REQUIRE_NOTHROW(bundle.SetViewState(view_state));
+        REQUIRE_NOTHROW(bundle.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        REQUIRE_NOTHROW(bundle.Draw(Rhi::RenderPrimitive::Triangle, 6U));
+        REQUIRE_NOTHROW(bundle.Commit());
+        CHECK(bundle.GetState() == Rhi::CommandListState::Committed);
+        CHECK(null_bundle.GetRecordedCommandsCount() == 4U);
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        CHECK(null_cmd_list.GetDrawsCount() == 2U);
+        CHECK(null_cmd_list.GetRecordedCommandsCount() == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        CHECK(null_cmd_list.GetDrawsCount() == 4U);
+        CHECK(null_bundle.GetExecutingListsCount() == 1U);
+        CHECK(null_cmd_list.GetDrawingState().render_state_ptr == nullptr);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Bundle Keeps Recorded View State Alive")
+    {
+        auto bundle_view_state_ptr = std::make_unique<Rhi::ViewState>(view_state.GetSettings());
+        REQUIRE_NOTHROW(bundle.ResetWithState(render_state));
+        REQUIRE_NOTHROW(bundle.SetViewState(*bundle_view_state_ptr));
+        REQUIRE_NOTHROW(bundle.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        REQUIRE_NOTHROW(bundle.Commit());
+        bundle_view_state_ptr.reset();
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        CHECK(null_cmd_list.GetDrawsCount() == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Bundle Reset is Rejected until Executing Command List is Completed")
+    {
+        REQUIRE_NOTHROW(bundle.ResetWithState(render_state));
+        REQUIRE_NOTHROW(bundle.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        REQUIRE_NOTHROW(bundle.Commit());
+
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK(null_bundle.GetExecutingListsCount() == 1U);
+        CHECK_THROWS(bundle.Reset());
+
+        REQUIRE_NOTHROW(render_queue.Execute(cmd_list_set));
+        CHECK(cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK_THROWS(bundle.Reset());
+        CHECK(bundle.GetState() == Rhi::CommandListState::Committed);
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(null_bundle.GetExecutingListsCount() == 0U);
+        CHECK_NOTHROW(bundle.Reset());
+        CHECK(bundle.GetState() == Rhi::CommandListState::Encoding);
+    }
+
+    SECTION("Bundle is Released on Executing Command List Reset")
+    {
+        REQUIRE_NOTHROW(bundle.ResetWithState(render_state));
+        REQUIRE_NOTHROW(bundle.Commit());
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        CHECK(null_bundle.GetExecutingListsCount() == 1U);
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK(null_bundle.GetExecutingListsCount() == 0U);
+        CHECK_NOTHROW(bundle.Reset());
+    }
+
+    SECTION("Bundle Execution Validation")
+    {
+        REQUIRE_NOTHROW(bundle.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(cmd_list.ExecuteBundle(bundle));
+
+        REQUIRE_NOTHROW(bundle.Commit());
+        const Rhi::RenderCommandList other_cmd_list = render_queue.CreateRenderCommandList(render_pass);
+        REQUIRE_NOTHROW(other_cmd_list.Reset());
+        REQUIRE_NOTHROW(other_cmd_list.Commit());
+        CHECK_THROWS(cmd_list.ExecuteBundle(other_cmd_list));
+
+        const Rhi::RenderCommandList other_bundle = render_queue.CreateRenderCommandBundle(render_pass);
+        REQUIRE_NOTHROW(other_bundle.Reset());
+        CHECK_THROWS(other_bundle.ExecuteBundle(bundle));
+
+        const Rhi::RenderPattern other_render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+        const Rhi::RenderPass    other_render_pass    = other_render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+        const Rhi::RenderCommandList other_pass_cmd_list = render_queue.CreateRenderCommandList(other_render_pass);
+        REQUIRE_NOTHROW(other_pass_cmd_list.Reset());
+        CHECK_THROWS(other_pass_cmd_list.ExecuteBundle(bundle));
+
+        CHECK_NOTHROW(cmd_list.ExecuteBundle(bundle));
+        CHECK(null_bundle.GetExecutingListsCount() == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+}
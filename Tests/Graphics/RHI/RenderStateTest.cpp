@@ -0,0 +1,280 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderStateTest.cpp
+Unit-tests of the RHI RenderState and its asynchronous compilation
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Null/RenderState.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor    g_parallel_executor;
+static const FrameSize g_frame_size(640U, 480U);
+
+class RenderStateCallbackTester final
+    : private Data::Receiver<Rhi::IRenderStateCallback>
+{
+public:
+    explicit RenderStateCallbackTester(const Rhi::RenderState& render_state)
+        : m_render_state(render_state.GetInterface())
+    { render_state.Connect(*this); }
+
+    bool IsStateCompiled() const noexcept         { return m_compiled_state_ptr != nullptr; }
+    bool IsCompiledStateMatching() const noexcept { return m_compiled_state_ptr == std::addressof(m_render_state); }
+
+private:
+    // Callback is called from the parallel executor thread, so it only stores the result checked later on the main thread
+    void OnRenderStateCompiled(Rhi::IRenderState& render_state) override
+    {
+        m_compiled_state_ptr = std::addressof(render_state);
+    }
+
+    Rhi::IRenderState&              m_render_state;
+    std::atomic<Rhi::IRenderState*> m_compiled_state_ptr{ nullptr };
+};
+
+namespace
+{
+
+// Occupies single worker thread of the executor until unblocked, so that asynchronous compilation tasks stay pending;
+// executor is unblocked on destruction to let the test finish even when some requirement has failed
+class ExecutorBlocker
+{
+public:
+    explicit ExecutorBlocker(tf::Executor& executor)
+    {
+        executor.silent_async([unblock_future = m_unblock_promise.get_future().share()]() { unblock_future.wait(); });
+    }
+
+    ~ExecutorBlocker() { Unblock(); }
+
+    void Unblock()
+    {
+        if (m_is_blocked)
+            m_unblock_promise.set_value();
+        m_is_blocked = false;
+    }
+
+private:
+    std::promise<void> m_unblock_promise;
+    bool               m_is_blocked = true;
+};
+
+Rhi::Program CreateRenderProgram(const Rhi::RenderContext& render_context)
+{
+    return render_context.CreateProgram({
+        {
+            { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Render", "MainVS" } } },
+            { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Render", "MainPS" } } }
+        },
+    });
+}
+
+} // anonymous namespace
+
+TEST_CASE("RHI Render State Functions", "[rhi][render][state]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+    const Rhi::RenderStateSettingsImpl render_state_settings{ CreateRenderProgram(render_context), render_pattern };
+
+    SECTION("Render State Construction")
+    {
+        Rhi::RenderState render_state;
+        REQUIRE_NOTHROW(render_state = render_context.CreateRenderState(render_state_settings));
+        REQUIRE(render_state.IsInitialized());
+        CHECK(render_state.GetInterfacePtr());
+        CHECK(render_state.GetProgram().GetInterfacePtr().get() == render_state_settings.program.GetInterfacePtr().get());
+        CHECK(render_state.GetRenderPattern().GetInterfacePtr().get() == render_pattern.GetInterfacePtr().get());
+    }
+
+    SECTION("Object Destroyed Callback")
+    {
+        auto render_state_ptr = std::make_unique<Rhi::RenderState>(render_context, render_state_settings);
+        ObjectCallbackTester object_callback_tester(*render_state_ptr);
+        CHECK_FALSE(object_callback_tester.IsObjectDestroyed());
+        render_state_ptr.reset();
+        CHECK(object_callback_tester.IsObjectDestroyed());
+    }
+
+    SECTION("Synchronous Compilation")
+    {
+        const Rhi::RenderState render_state = render_context.CreateRenderState(render_state_settings);
+        CHECK_FALSE(render_state.GetSettings().async_compilation_enabled);
+        CHECK(render_state.IsCompiled());
+    }
+
+    SECTION("Asynchronous Compilation")
+    {
+        Rhi::RenderStateSettingsImpl async_render_state_settings = render_state_settings;
+        async_render_state_settings.async_compilation_enabled = true;
+
+        const Rhi::RenderState async_render_state = render_context.CreateRenderState(async_render_state_settings);
+        CHECK(async_render_state.GetSettings().async_compilation_enabled);
+        g_parallel_executor.wait_for_all();
+        CHECK(async_render_state.IsCompiled());
+    }
+
+    SECTION("Asynchronous Compilation Callback on Reset")
+    {
+        Rhi::RenderStateSettingsImpl async_render_state_settings = render_state_settings;
+        async_render_state_settings.async_compilation_enabled = true;
+
+        const Rhi::RenderState async_render_state = render_context.CreateRenderState(async_render_state_settings);
+        RenderStateCallbackTester render_state_callback_tester(async_render_state);
+        REQUIRE_NOTHROW(async_render_state.Reset(async_render_state_settings));
+        g_parallel_executor.wait_for_all();
+        CHECK(render_state_callback_tester.IsStateCompiled());
+        CHECK(render_state_callback_tester.IsCompiledStateMatching());
+        CHECK(async_render_state.IsCompiled());
+    }
+}
+
+TEST_CASE("RHI Render State Asynchronous Compilation in Command List", "[rhi][render][state][list]")
+{
+    // Single worker executor is blocked to guarantee that asynchronous render state compilation is pending during draw calls
+    tf::Executor single_thread_executor(1U);
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), single_thread_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+    const Rhi::RenderPass    render_pass    = render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+    const Rhi::CommandQueue  render_queue   = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderCommandList render_cmd_list = render_queue.CreateRenderCommandList(render_pass);
+    const auto& null_render_cmd_list = dynamic_cast<const Null::RenderCommandList&>(render_cmd_list.GetInterface());
+
+    Rhi::RenderStateSettingsImpl async_render_state_settings{ CreateRenderProgram(render_context), render_pattern };
+    async_render_state_settings.async_compilation_enabled = true;
+
+    // Render state is declared before executor blocker to be destroyed after it, since it waits for compilation completion
+    Rhi::RenderState async_render_state;
+    ExecutorBlocker  executor_blocker(single_thread_executor);
+    async_render_state = render_context.CreateRenderState(async_render_state_settings);
+    RenderStateCallbackTester render_state_callback_tester(async_render_state);
+    REQUIRE_FALSE(async_render_state.IsCompiled());
+
+    SECTION("Draw is skipped until render state is compiled")
+    {
+        REQUIRE_NOTHROW(render_cmd_list.ResetWithState(async_render_state));
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(null_render_cmd_list.GetDrawsCount() == 0U);
+
+        executor_blocker.Unblock();
+        single_thread_executor.wait_for_all();
+        CHECK(render_state_callback_tester.IsStateCompiled());
+        CHECK(render_state_callback_tester.IsCompiledStateMatching());
+        REQUIRE(async_render_state.IsCompiled());
+
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(null_render_cmd_list.GetDrawsCount() == 1U);
+        REQUIRE_NOTHROW(render_cmd_list.Commit());
+    }
+
+    SECTION("Render state compiled before draw is applied with draw")
+    {
+        REQUIRE_NOTHROW(render_cmd_list.ResetWithState(async_render_state));
+        executor_blocker.Unblock();
+        single_thread_executor.wait_for_all();
+        REQUIRE(async_render_state.IsCompiled());
+
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(null_render_cmd_list.GetDrawsCount() == 1U);
+        REQUIRE_NOTHROW(render_cmd_list.Commit());
+    }
+
+    SECTION("Draws count is cleared on command list reset")
+    {
+        REQUIRE_NOTHROW(render_cmd_list.ResetWithState(async_render_state));
+        executor_blocker.Unblock();
+        single_thread_executor.wait_for_all();
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(null_render_cmd_list.GetDrawsCount() == 2U);
+
+        REQUIRE_NOTHROW(render_cmd_list.Reset());
+        CHECK(null_render_cmd_list.GetDrawsCount() == 0U);
+        REQUIRE_NOTHROW(render_cmd_list.Commit());
+    }
+}
+
+TEST_CASE("RHI Render State Asynchronous Compilation Failure", "[rhi][render][state][list]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor, Rhi::RenderContextSettings{ g_frame_size });
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern(Rhi::RenderPatternSettings{});
+    const Rhi::RenderPass    render_pass    = render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size });
+    const Rhi::CommandQueue  render_queue   = render_context.CreateCommandQueue(Rhi::CommandListType::Render);
+    const Rhi::RenderCommandList render_cmd_list = render_queue.CreateRenderCommandList(render_pass);
+    const auto& null_render_cmd_list = dynamic_cast<const Null::RenderCommandList&>(render_cmd_list.GetInterface());
+
+    Rhi::RenderStateSettingsImpl async_render_state_settings{ CreateRenderProgram(render_context), render_pattern };
+    async_render_state_settings.async_compilation_enabled = true;
+
+    // Initial compilation is completed before connecting callback tester to check callback of the failed compilation only
+    const Rhi::RenderState async_render_state = render_context.CreateRenderState(async_render_state_settings);
+    g_parallel_executor.wait_for_all();
+    RenderStateCallbackTester render_state_callback_tester(async_render_state);
+    auto& null_render_state = dynamic_cast<Null::RenderState&>(async_render_state.GetInterface());
+    null_render_state.SetCompileErrorMessage("test compilation failure");
+    REQUIRE_NOTHROW(async_render_state.Reset(async_render_state_settings));
+    g_parallel_executor.wait_for_all();
+
+    SECTION("Failed state is not compiled and compiled callback is not emitted")
+    {
+        CHECK_FALSE(async_render_state.IsCompiled());
+        CHECK_FALSE(render_state_callback_tester.IsStateCompiled());
+    }
+
+    SECTION("Compilation error is thrown on render state apply")
+    {
+        CHECK_THROWS_AS(render_cmd_list.ResetWithState(async_render_state), std::runtime_error);
+        CHECK(null_render_cmd_list.GetDrawsCount() == 0U);
+    }
+
+    SECTION("Compilation error is cleared on successful recompilation")
+    {
+        null_render_state.SetCompileErrorMessage({});
+        REQUIRE_NOTHROW(async_render_state.Reset(async_render_state_settings));
+        g_parallel_executor.wait_for_all();
+        REQUIRE(async_render_state.IsCompiled());
+
+        REQUIRE_NOTHROW(render_cmd_list.ResetWithState(async_render_state));
+        REQUIRE_NOTHROW(render_cmd_list.Draw(Rhi::RenderPrimitive::Triangle, 3U));
+        CHECK(null_render_cmd_list.GetDrawsCount() == 1U);
+        REQUIRE_NOTHROW(render_cmd_list.Commit());
+    }
+}
@@ -30,6 +30,9 @@ Unit-tests of the RHI Texture
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
 
 #include <memory>
 #include <taskflow/taskflow.hpp>
@@ -119,6 +122,110 @@ TEST_CASE("RHI Texture Functions", "[rhi][texture][resource]")
                                                    Rhi::ResourceState::ShaderResource));
     }
 
+    SECTION("Set Sub-Resource State with Barriers")
+    {
+        const Rhi::Texture mipmapped_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, true));
+        const Rhi::SubResourceCount subresource_count = mipmapped_texture.GetSubresourceCount();
+        REQUIRE(subresource_count.GetRawCount() == 7U);
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopyDest));
+
+        Rhi::ResourceBarriers resource_barriers;
+        const Rhi::SubResourceIndex mip1_index(0U, 0U, 1U);
+        CHECK(mipmapped_texture.SetSubResourceState(mip1_index, Rhi::ResourceState::CopySource, resource_barriers));
+        CHECK(mipmapped_texture.GetSubResourceState(mip1_index) == Rhi::ResourceState::CopySource);
+        CHECK(mipmapped_texture.GetSubResourceState(Rhi::SubResourceIndex()) == Rhi::ResourceState::CopyDest);
+        REQUIRE(resource_barriers.GetBarriers().size() == 1U);
+
+        const Rhi::ResourceBarrier& subresource_barrier = resource_barriers.GetBarriers().front();
+        REQUIRE(subresource_barrier.GetId().GetSubResourceIndex().has_value());
+        CHECK(subresource_barrier.GetId().GetSubResourceIndex().value() == mip1_index);
+        CHECK(subresource_barrier.GetStateChange().GetStateBefore() == Rhi::ResourceState::CopyDest);
+        CHECK(subresource_barrier.GetStateChange().GetStateAfter() == Rhi::ResourceState::CopySource);
+        CHECK_FALSE(mipmapped_texture.SetSubResourceState(mip1_index, Rhi::ResourceState::CopySource, resource_barriers));
+    }
+
+    SECTION("Set State of Texture with Different Sub-Resource States")
+    {
+        const Rhi::Texture mipmapped_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, true));
+        const Rhi::SubResourceCount subresource_count = mipmapped_texture.GetSubresourceCount();
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopyDest));
+        CHECK(mipmapped_texture.SetSubResourceState(Rhi::SubResourceIndex(0U, 0U, 1U), Rhi::ResourceState::CopySource));
+
+        // Barriers are added only for sub-resources which are not in the requested state yet
+        Rhi::ResourceBarriers resource_barriers;
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopySource, resource_barriers));
+        CHECK(resource_barriers.GetBarriers().size() == subresource_count.GetRawCount() - 1U);
+        CHECK(mipmapped_texture.GetState() == Rhi::ResourceState::CopySource);
+        for(Data::Index raw_index = 0U; raw_index < subresource_count.GetRawCount(); ++raw_index)
+        {
+            CHECK(mipmapped_texture.GetSubResourceState(Rhi::SubResourceIndex(raw_index, subresource_count)) == Rhi::ResourceState::CopySource);
+        }
+    }
+
+    SECTION("Set Sub-Resource States to the Same State")
+    {
+        const Rhi::Texture mipmapped_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(4, 4), {}, PixelFormat::RGBA8, true));
+        const Rhi::SubResourceCount subresource_count = mipmapped_texture.GetSubresourceCount();
+        REQUIRE(subresource_count.GetRawCount() == 3U);
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopyDest));
+
+        Rhi::ResourceBarriers resource_barriers;
+        for(Data::Index raw_index = 0U; raw_index < subresource_count.GetRawCount(); ++raw_index)
+        {
+            CHECK(mipmapped_texture.GetState() == Rhi::ResourceState::CopyDest);
+            CHECK(mipmapped_texture.SetSubResourceState(Rhi::SubResourceIndex(raw_index, subresource_count),
+                                                        Rhi::ResourceState::ShaderResource, resource_barriers));
+        }
+
+        CHECK(resource_barriers.GetBarriers().size() == subresource_count.GetRawCount());
+        CHECK(mipmapped_texture.GetState() == Rhi::ResourceState::ShaderResource);
+    }
+
+    SECTION("Sub-Resource State Transition Splits Whole Texture Transition")
+    {
+        const Rhi::Texture mipmapped_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, true));
+        const Rhi::SubResourceCount subresource_count = mipmapped_texture.GetSubresourceCount();
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopyDest));
+
+        Rhi::ResourceBarriers resource_barriers;
+        CHECK(mipmapped_texture.SetState(Rhi::ResourceState::CopySource, resource_barriers));
+        REQUIRE(resource_barriers.GetBarriers().size() == 1U);
+
+        const Rhi::SubResourceIndex mip1_index(0U, 0U, 1U);
+        CHECK(mipmapped_texture.SetSubResourceState(mip1_index, Rhi::ResourceState::ShaderResource, resource_barriers));
+        CHECK(resource_barriers.GetBarriers().size() == subresource_count.GetRawCount());
+        CHECK_FALSE(resource_barriers.GetBarrier(Rhi::ResourceBarrier::Id(Rhi::ResourceBarrier::Type::StateTransition,
+                                                                          mipmapped_texture.GetInterface())));
+
+        const Rhi::ResourceBarrier* mip1_barrier_ptr = resource_barriers.GetBarrier(
+            Rhi::ResourceBarrier::Id(Rhi::ResourceBarrier::Type::StateTransition, mipmapped_texture.GetInterface(), mip1_index));
+        REQUIRE(mip1_barrier_ptr);
+        CHECK(mip1_barrier_ptr->GetStateChange().GetStateBefore() == Rhi::ResourceState::CopyDest);
+        CHECK(mip1_barrier_ptr->GetStateChange().GetStateAfter() == Rhi::ResourceState::ShaderResource);
+    }
+
+    SECTION("Whole Texture and Sub-Resource Transitions Can Not Be Mixed")
+    {
+        const Rhi::Texture mipmapped_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::RGBA8, true));
+        Rhi::IResource& texture_resource = mipmapped_texture.GetInterface();
+        const Rhi::SubResourceIndex mip1_index(0U, 0U, 1U);
+        const Rhi::ResourceBarrier  mip1_barrier(texture_resource, mip1_index, Rhi::ResourceState::CopyDest, Rhi::ResourceState::CopySource);
+
+        const Rhi::ResourceBarriers resource_barriers(Rhi::IResourceBarriers::Set{
+            Rhi::ResourceBarrier(texture_resource, Rhi::ResourceState::CopyDest, Rhi::ResourceState::ShaderResource)
+        });
+        CHECK_THROWS(resource_barriers.Add(mip1_barrier.GetId(), mip1_barrier));
+
+        CHECK(resource_barriers.RemoveStateTransition(texture_resource));
+        CHECK(resource_barriers.Add(mip1_barrier.GetId(), mip1_barrier) == Rhi::IResourceBarriers::AddResult::Added);
+        CHECK_THROWS(resource_barriers.AddStateTransition(texture_resource, Rhi::ResourceState::CopyDest, Rhi::ResourceState::ShaderResource));
+    }
+
     SECTION("Set Owner Queue Family")
     {
         CHECK_FALSE(texture.GetOwnerQueueFamily().has_value());
@@ -174,4 +281,34 @@ TEST_CASE("RHI Texture Functions", "[rhi][texture][resource]")
         CHECK_NOTHROW(texture.GetData(compute_context.GetComputeCommandKit().GetQueue(),
                                       Rhi::SubResource::Index{}, Rhi::BytesRangeOpt{}));
     }
+
+    SECTION("Request Read-Back is Ready on Command List Completion")
+    {
+        const Rhi::Texture read_back_texture = compute_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(Dimensions(64, 64), {}, PixelFormat::R8Uint, false,
+                                           Rhi::ResourceUsageMask{ Rhi::ResourceUsage::ShaderWrite, Rhi::ResourceUsage::ReadBack }));
+        const Rhi::ComputeCommandList cmd_list = compute_context.GetComputeCommandKit().GetQueue().CreateComputeCommandList();
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+        REQUIRE_NOTHROW(cmd_list.Reset());
+
+        Ptr<Rhi::IReadBackRequest> read_back_request_ptr;
+        REQUIRE_NOTHROW(read_back_request_ptr = read_back_texture.RequestReadBack(cmd_list.GetInterface()));
+        REQUIRE(read_back_request_ptr);
+        CHECK_FALSE(read_back_request_ptr->IsReady());
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_context.GetComputeCommandKit().GetQueue().Execute(cmd_list_set));
+        CHECK_FALSE(read_back_request_ptr->IsReady());
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(read_back_request_ptr->IsReady());
+        CHECK_NOTHROW(read_back_request_ptr->GetData());
+    }
+
+    SECTION("Can not Request Read-Back without Read-Back Usage")
+    {
+        const Rhi::ComputeCommandList cmd_list = compute_context.GetComputeCommandKit().GetQueue().CreateComputeCommandList();
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(texture.RequestReadBack(cmd_list.GetInterface()));
+    }
 }
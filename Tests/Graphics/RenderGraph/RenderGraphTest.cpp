@@ -0,0 +1,251 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RenderGraph/RenderGraphTest.cpp
+Unit-tests of the Render Graph executed with Null RHI backend
+
+******************************************************************************/
+
+#include "../RHI/RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RenderGraph.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/ComputeCommandList.h>
+
+#include <string>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("Render Graph Compilation and Execution", "[rhi][graph]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList cmd_list_1 = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::ComputeCommandList cmd_list_2 = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::ComputeCommandList cmd_list_3 = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::TextureSettings texture_settings = Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false);
+    const Rhi::Texture output_texture = compute_context.CreateTexture(texture_settings);
+
+    RenderGraph render_graph(compute_context.GetInterface());
+    const RenderGraph::ResourceId output_id = render_graph.ImportResource(output_texture.GetInterface());
+
+    SECTION("Cull Passes Not Contributing to Imported Resources")
+    {
+        const RenderGraph::ResourceId color_id  = render_graph.CreateTexture("Color", texture_settings);
+        const RenderGraph::ResourceId unused_id = render_graph.CreateTexture("Unused", texture_settings);
+        const RenderGraph::PassId color_pass_id = render_graph.AddPass("Color", cmd_list_1.GetInterface(), {})
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess).GetId();
+        const RenderGraph::PassId unused_pass_id = render_graph.AddPass("Unused", cmd_list_1.GetInterface(), {})
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(unused_id, Rhi::ResourceState::UnorderedAccess).GetId();
+        const RenderGraph::PassId output_pass_id = render_graph.AddPass("Output", cmd_list_1.GetInterface(), {})
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess).GetId();
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK_FALSE(render_graph.IsPassCulled(color_pass_id));
+        CHECK(render_graph.IsPassCulled(unused_pass_id));
+        CHECK_FALSE(render_graph.IsPassCulled(output_pass_id));
+        CHECK(render_graph.GetExecutionOrder() == std::vector<RenderGraph::PassId>{ color_pass_id, output_pass_id });
+        CHECK_THROWS(render_graph.GetResource(unused_id));
+    }
+
+    SECTION("Keep Passes with Side Effects")
+    {
+        const RenderGraph::PassId pass_id = render_graph.AddPass("Side Effects", cmd_list_1.GetInterface(), {})
+            .SetSideEffects().GetId();
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK_FALSE(render_graph.IsPassCulled(pass_id));
+        CHECK(render_graph.GetExecutionOrder() == std::vector<RenderGraph::PassId>{ pass_id });
+    }
+
+    SECTION("Order Passes by Resource Dependencies")
+    {
+        const RenderGraph::ResourceId color_id = render_graph.CreateTexture("Color", texture_settings);
+        const RenderGraph::PassId output_pass_id = render_graph.AddPass("Output", cmd_list_2.GetInterface(), {})
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess).GetId();
+        const RenderGraph::PassId color_pass_id = render_graph.AddPass("Color", cmd_list_1.GetInterface(), {})
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess).GetId();
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK(render_graph.GetExecutionOrder() == std::vector<RenderGraph::PassId>{ color_pass_id, output_pass_id });
+        REQUIRE(render_graph.GetCommandLists().size() == 2U);
+        CHECK(std::addressof(render_graph.GetCommandLists()[0].get()) == std::addressof(cmd_list_1.GetInterface()));
+        CHECK(std::addressof(render_graph.GetCommandLists()[1].get()) == std::addressof(cmd_list_2.GetInterface()));
+    }
+
+    SECTION("Fail to Compile Passes with Cyclic Dependencies")
+    {
+        const RenderGraph::ResourceId texture_a_id = render_graph.CreateTexture("A", texture_settings);
+        const RenderGraph::ResourceId texture_b_id = render_graph.CreateTexture("B", texture_settings);
+        render_graph.AddPass("A to B", cmd_list_1.GetInterface(), {})
+            .Read(texture_a_id, Rhi::ResourceState::ShaderResource)
+            .Write(texture_b_id, Rhi::ResourceState::UnorderedAccess)
+            .SetSideEffects();
+        render_graph.AddPass("B to A", cmd_list_2.GetInterface(), {})
+            .Read(texture_b_id, Rhi::ResourceState::ShaderResource)
+            .Write(texture_a_id, Rhi::ResourceState::UnorderedAccess)
+            .SetSideEffects();
+
+        CHECK_THROWS(render_graph.Compile());
+        CHECK_FALSE(render_graph.IsCompiled());
+    }
+
+    SECTION("Fail to Compile Not Contiguous Passes of Command List")
+    {
+        const RenderGraph::ResourceId color_id = render_graph.CreateTexture("Color", texture_settings);
+        const RenderGraph::ResourceId blur_id  = render_graph.CreateTexture("Blur", texture_settings);
+        render_graph.AddPass("Color", cmd_list_1.GetInterface(), {})
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("Blur", cmd_list_2.GetInterface(), {})
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(blur_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("Output", cmd_list_1.GetInterface(), {})
+            .Read(blur_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess);
+
+        CHECK_THROWS(render_graph.Compile());
+    }
+
+    SECTION("Alias Transient Resources with Not Overlapping Lifetimes")
+    {
+        const RenderGraph::ResourceId texture_a_id = render_graph.CreateTexture("A", texture_settings);
+        const RenderGraph::ResourceId texture_b_id = render_graph.CreateTexture("B", texture_settings);
+        const RenderGraph::ResourceId texture_c_id = render_graph.CreateTexture("C", texture_settings);
+        render_graph.AddPass("Write A", cmd_list_1.GetInterface(), {})
+            .Write(texture_a_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("A to B", cmd_list_1.GetInterface(), {})
+            .Read(texture_a_id, Rhi::ResourceState::ShaderResource)
+            .Write(texture_b_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("B to C", cmd_list_1.GetInterface(), {})
+            .Read(texture_b_id, Rhi::ResourceState::ShaderResource)
+            .Write(texture_c_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("C to Output", cmd_list_1.GetInterface(), {})
+            .Read(texture_c_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess);
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK(render_graph.GetPhysicalResourcesCount() == 2U);
+        CHECK(std::addressof(render_graph.GetResource(texture_a_id)) == std::addressof(render_graph.GetResource(texture_c_id)));
+        CHECK(std::addressof(render_graph.GetResource(texture_a_id)) != std::addressof(render_graph.GetResource(texture_b_id)));
+        CHECK(std::addressof(render_graph.GetResource(output_id)) == std::addressof(output_texture.GetInterface()));
+    }
+
+    SECTION("Do Not Alias Transient Resources with Different Settings")
+    {
+        const RenderGraph::ResourceId texture_a_id = render_graph.CreateTexture("A", texture_settings);
+        const RenderGraph::ResourceId texture_b_id = render_graph.CreateTexture("B", Rhi::TextureSettings::ForImage(Dimensions(320, 240), {}, PixelFormat::RGBA8, false));
+        render_graph.AddPass("Write A", cmd_list_1.GetInterface(), {})
+            .Write(texture_a_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("A to Output", cmd_list_1.GetInterface(), {})
+            .Read(texture_a_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("Write B", cmd_list_1.GetInterface(), {})
+            .Write(texture_b_id, Rhi::ResourceState::UnorderedAccess)
+            .SetSideEffects();
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK(render_graph.GetPhysicalResourcesCount() == 2U);
+    }
+
+    SECTION("Execute Passes with Minimal Resource Barriers")
+    {
+        const RenderGraph::ResourceId color_id = render_graph.CreateTexture("Color", texture_settings);
+        std::vector<std::string> executed_pass_names;
+        render_graph.AddPass("Color", cmd_list_1.GetInterface(),
+                             [&executed_pass_names](Rhi::ICommandList&) { executed_pass_names.emplace_back("Color"); })
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("Read Color", cmd_list_2.GetInterface(),
+                             [&executed_pass_names](Rhi::ICommandList&) { executed_pass_names.emplace_back("Read Color"); })
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .SetSideEffects();
+        render_graph.AddPass("Output", cmd_list_3.GetInterface(),
+                             [&executed_pass_names](Rhi::ICommandList&) { executed_pass_names.emplace_back("Output"); })
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess);
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        REQUIRE_NOTHROW(render_graph.Execute());
+        CHECK(executed_pass_names == std::vector<std::string>{ "Color", "Read Color", "Output" });
+
+        // Color: Undefined -> UnorderedAccess, Read Color: UnorderedAccess -> ShaderResource, Output: Undefined -> UnorderedAccess
+        const auto& null_cmd_list_1 = dynamic_cast<Null::ComputeCommandList&>(cmd_list_1.GetInterface());
+        const auto& null_cmd_list_2 = dynamic_cast<Null::ComputeCommandList&>(cmd_list_2.GetInterface());
+        const auto& null_cmd_list_3 = dynamic_cast<Null::ComputeCommandList&>(cmd_list_3.GetInterface());
+        CHECK(null_cmd_list_1.GetResourceBarriersCount() == 1U);
+        CHECK(null_cmd_list_2.GetResourceBarriersCount() == 1U);
+        CHECK(null_cmd_list_3.GetResourceBarriersCount() == 1U);
+        CHECK(render_graph.GetTexture(color_id).GetState() == Rhi::ResourceState::ShaderResource);
+        CHECK(output_texture.GetState() == Rhi::ResourceState::UnorderedAccess);
+        CHECK(cmd_list_1.GetState() == Rhi::CommandListState::Committed);
+        CHECK(cmd_list_2.GetState() == Rhi::CommandListState::Committed);
+        CHECK(cmd_list_3.GetState() == Rhi::CommandListState::Committed);
+    }
+
+    SECTION("Execute Passes Sharing Command List")
+    {
+        const RenderGraph::ResourceId color_id = render_graph.CreateTexture("Color", texture_settings);
+        render_graph.AddPass("Color", cmd_list_1.GetInterface(), {})
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess);
+        render_graph.AddPass("Output", cmd_list_1.GetInterface(), {})
+            .Read(color_id, Rhi::ResourceState::ShaderResource)
+            .Write(output_id, Rhi::ResourceState::UnorderedAccess);
+
+        REQUIRE_NOTHROW(render_graph.Compile());
+        REQUIRE_NOTHROW(render_graph.Execute());
+
+        const auto& null_cmd_list = dynamic_cast<Null::ComputeCommandList&>(cmd_list_1.GetInterface());
+        CHECK(null_cmd_list.GetResourceBarriersSetCount() == 2U);
+        CHECK(null_cmd_list.GetResourceBarriersCount() == 3U);
+        CHECK(render_graph.GetCommandLists().size() == 1U);
+        CHECK(cmd_list_1.GetState() == Rhi::CommandListState::Committed);
+    }
+
+    SECTION("Clear Graph Keeping Physical Resources")
+    {
+        const RenderGraph::ResourceId color_id = render_graph.CreateTexture("Color", texture_settings);
+        render_graph.AddPass("Color", cmd_list_1.GetInterface(), {})
+            .Write(color_id, Rhi::ResourceState::UnorderedAccess)
+            .SetSideEffects();
+        REQUIRE_NOTHROW(render_graph.Compile());
+        const Rhi::IResource* color_resource_ptr = std::addressof(render_graph.GetResource(color_id));
+
+        render_graph.Clear();
+        CHECK_FALSE(render_graph.IsCompiled());
+        CHECK(render_graph.GetExecutionOrder().empty());
+
+        const RenderGraph::ResourceId new_color_id = render_graph.CreateTexture("New Color", texture_settings);
+        render_graph.AddPass("New Color", cmd_list_1.GetInterface(), {})
+            .Write(new_color_id, Rhi::ResourceState::UnorderedAccess)
+            .SetSideEffects();
+        REQUIRE_NOTHROW(render_graph.Compile());
+        CHECK(render_graph.GetPhysicalResourcesCount() == 1U);
+        CHECK(std::addressof(render_graph.GetResource(new_color_id)) == color_resource_ptr);
+    }
+}